@@ -274,6 +274,11 @@ def run_wasm_reduce_tests():
         # sufficiently
         assert after < 0.7 * before, [before, after]
 
+        # the same, checking candidates in process
+        support.run_command(shared.WASM_REDUCE + ['a.wasm', '--oracle=fuzz-exec', '-t', 'b.wasm', '-w', 'c.wasm'])
+        after = os.stat('c.wasm').st_size
+        assert after < 0.7 * before, [before, after]
+
 
 def run_spec_tests():
     print('\n[ checking wasm-shell spec testcases... ]\n')
@@ -0,0 +1,76 @@
+#!/usr/bin/env python
+#
+# Copyright 2019 WebAssembly Community Group participants
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Prints a trace recorded by the instrumentation passes in a trace buffer
+(--pass-arg=trace-buffer@START,SIZE), one event per line:
+
+  <event> <site id> [<value>]
+
+The input is the concatenation of the bytes passed to trace_flush.
+"""
+
+import struct
+import sys
+
+# The events and the struct formats of their values, in the order of their
+# codes. This must be kept in sync with TRACE_EVENTS in
+# src/passes/instrumentation.h.
+EVENTS = [
+    ('log_execution', ''),
+    ('load_ptr', '<i'),
+    ('load_val_i32', '<i'),
+    ('load_val_i64', '<q'),
+    ('load_val_f32', '<f'),
+    ('load_val_f64', '<d'),
+    ('store_ptr', '<i'),
+    ('store_val_i32', '<i'),
+    ('store_val_i64', '<q'),
+    ('store_val_f32', '<f'),
+    ('store_val_f64', '<d'),
+    ('get_i32', '<i'),
+    ('get_i64', '<q'),
+    ('get_f32', '<f'),
+    ('get_f64', '<d'),
+    ('set_i32', '<i'),
+    ('set_i64', '<q'),
+    ('set_f32', '<f'),
+    ('set_f64', '<d'),
+]
+
+ID_SHIFT = 5
+
+
+def decode(data):
+    pos = 0
+    while pos < len(data):
+        header, = struct.unpack_from('<I', data, pos)
+        pos += 4
+        code = header & ((1 << ID_SHIFT) - 1)
+        if code >= len(EVENTS):
+            raise Exception('invalid event code %d at %d' % (code, pos - 4))
+        name, fmt = EVENTS[code]
+        line = '%s %d' % (name, header >> ID_SHIFT)
+        if fmt:
+            value, = struct.unpack_from(fmt, data, pos)
+            pos += struct.calcsize(fmt)
+            line += ' %s' % value
+        yield line
+
+
+if __name__ == '__main__':
+    with open(sys.argv[1], 'rb') as f:
+        for line in decode(f.read()):
+            print(line)
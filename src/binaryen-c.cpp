@@ -100,17 +100,45 @@ Literal fromBinaryenLiteral(BinaryenLiteral x) {
   WASM_UNREACHABLE();
 }
 
-// Mutexes (global for now; in theory if multiple modules
-// are used at once this should be optimized to be per-
-// module, but likely it doesn't matter)
-
-static std::mutex BinaryenFunctionMutex;
-static std::mutex BinaryenFunctionTypeMutex;
-
 // Optimization options
 static PassOptions globalPassOptions =
   PassOptions::getWithDefaultOptimizationOptions();
 
+// Modules created by this API carry the state the API needs for them, so that
+// independent modules can be built on different threads without contending
+// for anything.
+struct APIModule : public Module {
+  // Locks for adding functions and function types, which can be called from
+  // multiple threads at once for the same module.
+  std::mutex functionMutex;
+  std::mutex functionTypeMutex;
+  // The optimization options for this module, if they were set for it.
+  // Otherwise the global ones are used.
+  std::unique_ptr<PassOptions> passOptions;
+};
+
+static APIModule* getAPIModule(BinaryenModuleRef module) {
+  return (APIModule*)module;
+}
+
+static PassOptions& getPassOptions(BinaryenModuleRef module) {
+  auto* apiModule = getAPIModule(module);
+  if (apiModule->passOptions) {
+    return *apiModule->passOptions;
+  }
+  return globalPassOptions;
+}
+
+// Returns the options of a module, creating them from the global ones if
+// they were not set for it yet.
+static PassOptions& getOwnPassOptions(BinaryenModuleRef module) {
+  auto* apiModule = getAPIModule(module);
+  if (!apiModule->passOptions) {
+    apiModule->passOptions = make_unique<PassOptions>(globalPassOptions);
+  }
+  return *apiModule->passOptions;
+}
+
 // Tracing support
 
 static int tracing = 0;
@@ -474,7 +502,7 @@ BinaryenModuleRef BinaryenModuleCreate(void) {
     expressions[NULL] = 0;
   }
 
-  return new Module();
+  return new APIModule();
 }
 void BinaryenModuleDispose(BinaryenModuleRef module) {
   if (tracing) {
@@ -495,7 +523,7 @@ void BinaryenModuleDispose(BinaryenModuleRef module) {
     relooperBlocks.clear();
   }
 
-  delete (Module*)module;
+  delete getAPIModule(module);
 }
 
 // Function types
@@ -542,7 +570,7 @@ BinaryenFunctionTypeRef BinaryenAddFunctionType(BinaryenModuleRef module,
 
   // Lock. This can be called from multiple threads at once, and is a
   // point where they all access and modify the module.
-  std::lock_guard<std::mutex> lock(BinaryenFunctionTypeMutex);
+  std::lock_guard<std::mutex> lock(getAPIModule(module)->functionTypeMutex);
   return wasm->addFunctionType(std::move(ret));
 }
 void BinaryenRemoveFunctionType(BinaryenModuleRef module, const char* name) {
@@ -558,7 +586,7 @@ void BinaryenRemoveFunctionType(BinaryenModuleRef module, const char* name) {
   // Lock. This can be called from multiple threads at once, and is a
   // point where they all access and modify the module.
   {
-    std::lock_guard<std::mutex> lock(BinaryenFunctionTypeMutex);
+    std::lock_guard<std::mutex> lock(getAPIModule(module)->functionTypeMutex);
     wasm->removeFunctionType(name);
   }
 }
@@ -1823,6 +1851,288 @@ BinaryenExpressionRef BinaryenBrOnExn(BinaryenModuleRef module,
   return static_cast<Expression*>(ret);
 }
 
+// Batched construction
+
+BinaryenExpressionRef BinaryenBuildExpression(BinaryenModuleRef module,
+                                              const uint32_t* code,
+                                              BinaryenIndex codeSize,
+                                              const char** names,
+                                              BinaryenIndex numNames) {
+  Module* wasm = (Module*)module;
+  Builder builder(*wasm);
+
+  // Intern the names once, so that each use is just an index.
+  std::vector<Name> internedNames;
+  internedNames.reserve(numNames);
+  for (BinaryenIndex i = 0; i < numNames; i++) {
+    internedNames.push_back(names[i]);
+  }
+
+  BinaryenIndex pc = 0;
+  auto next = [&]() {
+    if (pc >= codeSize) {
+      Fatal() << "BinaryenBuildExpression: unexpected end of code";
+    }
+    return code[pc++];
+  };
+  // Immediates are checked against the range of what they encode before they
+  // are cast, and errors report the position of the bad word.
+  auto nextInRange = [&](uint32_t end, const char* what) {
+    auto value = next();
+    if (value >= end) {
+      Fatal() << "BinaryenBuildExpression: bad " << what << " " << value
+              << " at " << (pc - 1);
+    }
+    return value;
+  };
+  // Tuple types are not supported, as they cannot be checked here.
+  auto nextType = [&]() {
+    return Type(nextInRange(Type::_last_value_type, "type"));
+  };
+  // Block and loop labels are optional, and given as BinaryenIndex(-1) when
+  // missing.
+  auto nextName = [&](bool optional) {
+    auto index = next();
+    if (optional && index == BinaryenIndex(-1)) {
+      return Name();
+    }
+    if (index >= numNames) {
+      Fatal() << "BinaryenBuildExpression: bad name index " << index;
+    }
+    return internedNames[index];
+  };
+
+  std::vector<Expression*> stack;
+  auto pop = [&]() {
+    if (stack.empty()) {
+      Fatal() << "BinaryenBuildExpression: stack underflow at " << pc;
+    }
+    auto* ret = stack.back();
+    stack.pop_back();
+    return ret;
+  };
+  // Moves the top of the stack into a list of children, in order.
+  auto popList = [&](ExpressionList& list, BinaryenIndex num) {
+    if (num > stack.size()) {
+      Fatal() << "BinaryenBuildExpression: stack underflow at " << pc;
+    }
+    auto start = stack.size() - num;
+    list.resize(num);
+    for (BinaryenIndex i = 0; i < num; i++) {
+      list[i] = stack[start + i];
+    }
+    stack.resize(start);
+  };
+
+  while (pc < codeSize) {
+    auto id = Expression::Id(
+      nextInRange(Expression::NumExpressionIds, "expression id"));
+    Expression* curr;
+    switch (id) {
+      case Expression::BlockId: {
+        auto name = nextName(true);
+        auto numChildren = next();
+        auto type = next();
+        if (type != BinaryenTypeAuto() && type >= Type::_last_value_type) {
+          Fatal() << "BinaryenBuildExpression: bad type " << type << " at "
+                  << (pc - 1);
+        }
+        auto* block = wasm->allocator.alloc<Block>();
+        block->name = name;
+        popList(block->list, numChildren);
+        if (type != BinaryenTypeAuto()) {
+          block->finalize(Type(type));
+        } else {
+          block->finalize();
+        }
+        curr = block;
+        break;
+      }
+      case Expression::IfId: {
+        auto hasElse = next();
+        auto* ifFalse = hasElse ? pop() : nullptr;
+        auto* ifTrue = pop();
+        curr = builder.makeIf(pop(), ifTrue, ifFalse);
+        break;
+      }
+      case Expression::LoopId: {
+        auto name = nextName(true);
+        curr = builder.makeLoop(name, pop());
+        break;
+      }
+      case Expression::BreakId: {
+        auto name = nextName(false);
+        auto hasValue = next();
+        auto hasCondition = next();
+        auto* condition = hasCondition ? pop() : nullptr;
+        auto* value = hasValue ? pop() : nullptr;
+        curr = builder.makeBreak(name, value, condition);
+        break;
+      }
+      case Expression::CallId: {
+        auto target = nextName(false);
+        auto numOperands = next();
+        auto type = nextType();
+        auto* call = wasm->allocator.alloc<Call>();
+        call->target = target;
+        popList(call->operands, numOperands);
+        call->type = type;
+        call->finalize();
+        curr = call;
+        break;
+      }
+      case Expression::LocalGetId: {
+        auto index = next();
+        curr = builder.makeLocalGet(index, nextType());
+        break;
+      }
+      case Expression::LocalSetId: {
+        auto index = next();
+        auto isTee = next();
+        curr = isTee ? builder.makeLocalTee(index, pop())
+                     : builder.makeLocalSet(index, pop());
+        break;
+      }
+      case Expression::GlobalGetId: {
+        auto name = nextName(false);
+        curr = builder.makeGlobalGet(name, nextType());
+        break;
+      }
+      case Expression::GlobalSetId: {
+        auto name = nextName(false);
+        curr = builder.makeGlobalSet(name, pop());
+        break;
+      }
+      case Expression::LoadId: {
+        auto bytes = next();
+        auto signed_ = next();
+        auto offset = next();
+        auto align = next();
+        auto type = nextType();
+        auto* load = builder.makeLoad(
+          bytes, !!signed_, offset, align ? align : bytes, pop(), type);
+        load->finalize();
+        curr = load;
+        break;
+      }
+      case Expression::StoreId: {
+        auto bytes = next();
+        auto offset = next();
+        auto align = next();
+        auto type = nextType();
+        auto* value = pop();
+        curr = builder.makeStore(
+          bytes, offset, align ? align : bytes, pop(), value, type);
+        break;
+      }
+      case Expression::ConstId: {
+        auto type = nextType();
+        Literal value;
+        switch (type) {
+          case i32:
+            value = Literal(int32_t(next()));
+            break;
+          case f32:
+            value = Literal(int32_t(next())).castToF32();
+            break;
+          case i64:
+          case f64: {
+            uint64_t low = next();
+            uint64_t high = next();
+            value = Literal(int64_t(low | (high << 32)));
+            if (type == f64) {
+              value = value.castToF64();
+            }
+            break;
+          }
+          default:
+            Fatal() << "BinaryenBuildExpression: bad const type " << type
+                    << " at " << (pc - 1);
+        }
+        curr = builder.makeConst(value);
+        break;
+      }
+      case Expression::UnaryId: {
+        auto op = UnaryOp(nextInRange(InvalidUnary, "unary op"));
+        curr = builder.makeUnary(op, pop());
+        break;
+      }
+      case Expression::BinaryId: {
+        auto op = BinaryOp(nextInRange(InvalidBinary, "binary op"));
+        auto* right = pop();
+        curr = builder.makeBinary(op, pop(), right);
+        break;
+      }
+      case Expression::SelectId: {
+        auto* condition = pop();
+        auto* ifFalse = pop();
+        curr = builder.makeSelect(condition, pop(), ifFalse);
+        break;
+      }
+      case Expression::DropId: {
+        curr = builder.makeDrop(pop());
+        break;
+      }
+      case Expression::ReturnId: {
+        auto hasValue = next();
+        curr = builder.makeReturn(hasValue ? pop() : nullptr);
+        break;
+      }
+      case Expression::NopId: {
+        curr = builder.makeNop();
+        break;
+      }
+      case Expression::UnreachableId: {
+        curr = builder.makeUnreachable();
+        break;
+      }
+      default:
+        Fatal() << "BinaryenBuildExpression: unsupported expression id " << id
+                << " at " << (pc - 1);
+    }
+    stack.push_back(curr);
+  }
+
+  // Several expressions left on the stack are a sequence, like the body of a
+  // function.
+  if (stack.empty()) {
+    Fatal() << "BinaryenBuildExpression: no expression was built";
+  }
+  Expression* ret = stack.size() == 1 ? stack[0] : builder.makeBlock(stack);
+
+  if (tracing) {
+    std::cout << "  {\n";
+    std::cout << "    uint32_t code[] = { ";
+    for (BinaryenIndex i = 0; i < codeSize; i++) {
+      if (i > 0) {
+        std::cout << ", ";
+      }
+      if (i % 12 == 11) {
+        std::cout << "\n       "; // don't create hugely long lines
+      }
+      std::cout << code[i];
+    }
+    std::cout << " };\n";
+    std::cout << "    const char* names[] = { ";
+    for (BinaryenIndex i = 0; i < numNames; i++) {
+      if (i > 0) {
+        std::cout << ", ";
+      }
+      std::cout << "\"" << names[i] << "\"";
+    }
+    if (numNames == 0) {
+      // ensure the array is not empty, otherwise a compiler error on VS
+      std::cout << "0";
+    }
+    std::cout << " };\n  ";
+    traceExpression(
+      ret, "BinaryenBuildExpression", "code", codeSize, "names", numNames);
+    std::cout << "  }\n";
+  }
+
+  return static_cast<Expression*>(ret);
+}
+
 // Expression utility
 
 BinaryenExpressionId BinaryenExpressionGetId(BinaryenExpressionRef expr) {
@@ -3170,7 +3480,7 @@ BinaryenFunctionRef BinaryenAddFunction(BinaryenModuleRef module,
   // Lock. This can be called from multiple threads at once, and is a
   // point where they all access and modify the module.
   {
-    std::lock_guard<std::mutex> lock(BinaryenFunctionMutex);
+    std::lock_guard<std::mutex> lock(getAPIModule(module)->functionMutex);
     wasm->addFunction(ret);
   }
 
@@ -3766,7 +4076,7 @@ BinaryenModuleRef BinaryenModuleParse(const char* text) {
     std::cout << "  // BinaryenModuleRead\n";
   }
 
-  auto* wasm = new Module;
+  auto* wasm = new APIModule;
   try {
     SExpressionParser parser(const_cast<char*>(text));
     Element& root = *parser.root;
@@ -3793,7 +4103,7 @@ void BinaryenModulePrintAsmjs(BinaryenModuleRef module) {
 
   Module* wasm = (Module*)module;
   Wasm2JSBuilder::Flags flags;
-  Wasm2JSBuilder wasm2js(flags, globalPassOptions);
+  Wasm2JSBuilder wasm2js(flags, getPassOptions(module));
   Ref asmjs = wasm2js.processWasm(wasm);
   JSPrinter jser(true, true, asmjs);
   Output out("", Flags::Text, Flags::Release); // stdout
@@ -3820,7 +4130,7 @@ void BinaryenModuleOptimize(BinaryenModuleRef module) {
 
   Module* wasm = (Module*)module;
   PassRunner passRunner(wasm);
-  passRunner.options = globalPassOptions;
+  passRunner.options = getPassOptions(module);
   passRunner.addDefaultOptimizationPasses();
   passRunner.run();
 }
@@ -3873,6 +4183,56 @@ void BinaryenSetDebugInfo(int on) {
   globalPassOptions.debugInfo = on != 0;
 }
 
+int BinaryenModuleGetOptimizeLevel(BinaryenModuleRef module) {
+  if (tracing) {
+    std::cout << "  BinaryenModuleGetOptimizeLevel(the_module);\n";
+  }
+
+  return getPassOptions(module).optimizeLevel;
+}
+
+void BinaryenModuleSetOptimizeLevel(BinaryenModuleRef module, int level) {
+  if (tracing) {
+    std::cout << "  BinaryenModuleSetOptimizeLevel(the_module, " << level
+              << ");\n";
+  }
+
+  getOwnPassOptions(module).optimizeLevel = level;
+}
+
+int BinaryenModuleGetShrinkLevel(BinaryenModuleRef module) {
+  if (tracing) {
+    std::cout << "  BinaryenModuleGetShrinkLevel(the_module);\n";
+  }
+
+  return getPassOptions(module).shrinkLevel;
+}
+
+void BinaryenModuleSetShrinkLevel(BinaryenModuleRef module, int level) {
+  if (tracing) {
+    std::cout << "  BinaryenModuleSetShrinkLevel(the_module, " << level
+              << ");\n";
+  }
+
+  getOwnPassOptions(module).shrinkLevel = level;
+}
+
+int BinaryenModuleGetDebugInfo(BinaryenModuleRef module) {
+  if (tracing) {
+    std::cout << "  BinaryenModuleGetDebugInfo(the_module);\n";
+  }
+
+  return getPassOptions(module).debugInfo;
+}
+
+void BinaryenModuleSetDebugInfo(BinaryenModuleRef module, int on) {
+  if (tracing) {
+    std::cout << "  BinaryenModuleSetDebugInfo(the_module, " << on << ");\n";
+  }
+
+  getOwnPassOptions(module).debugInfo = on != 0;
+}
+
 void BinaryenModuleRunPasses(BinaryenModuleRef module,
                              const char** passes,
                              BinaryenIndex numPasses) {
@@ -3893,7 +4253,7 @@ void BinaryenModuleRunPasses(BinaryenModuleRef module,
 
   Module* wasm = (Module*)module;
   PassRunner passRunner(wasm);
-  passRunner.options = globalPassOptions;
+  passRunner.options = getPassOptions(module);
   for (BinaryenIndex i = 0; i < numPasses; i++) {
     passRunner.add(passes[i]);
   }
@@ -3906,34 +4266,127 @@ void BinaryenModuleAutoDrop(BinaryenModuleRef module) {
   }
 
   Module* wasm = (Module*)module;
-  PassRunner runner(wasm, globalPassOptions);
+  PassRunner runner(wasm, getPassOptions(module));
   AutoDrop().run(&runner, wasm);
 }
 
-static BinaryenBufferSizes writeModule(BinaryenModuleRef module,
-                                       char* output,
-                                       size_t outputSize,
-                                       const char* sourceMapUrl,
-                                       char* sourceMap,
-                                       size_t sourceMapSize) {
+// A stream buffer that passes what is written to it on to a callback, in
+// chunks, so that output can be streamed without building it all in memory.
+class CallbackStreamBuf : public std::streambuf {
+public:
+  CallbackStreamBuf(BinaryenWriteCallback callback, void* userData)
+    : callback(callback), userData(userData) {
+    setp(chunk, chunk + sizeof(chunk));
+  }
+
+  ~CallbackStreamBuf() { emit(); }
+
+protected:
+  int_type overflow(int_type c) override {
+    emit();
+    if (!traits_type::eq_int_type(c, traits_type::eof())) {
+      *pptr() = traits_type::to_char_type(c);
+      pbump(1);
+    }
+    return traits_type::not_eof(c);
+  }
+
+  std::streamsize xsputn(const char* data, std::streamsize size) override {
+    if (size >= std::streamsize(sizeof(chunk))) {
+      // Large writes go straight to the callback.
+      emit();
+      callback(data, size, userData);
+      return size;
+    }
+    return std::streambuf::xsputn(data, size);
+  }
+
+  int sync() override {
+    emit();
+    return 0;
+  }
+
+private:
+  BinaryenWriteCallback callback;
+  void* userData;
+  char chunk[4096];
+
+  void emit() {
+    if (pptr() > pbase()) {
+      callback(pbase(), pptr() - pbase(), userData);
+    }
+    setp(chunk, chunk + sizeof(chunk));
+  }
+};
+
+// Appends to a BinaryenOutputBuffer, growing it as needed.
+static void
+appendToOutputBuffer(const char* data, size_t size, void* userData) {
+  auto* buffer = (BinaryenOutputBuffer*)userData;
+  if (buffer->size + size > buffer->capacity) {
+    size_t capacity = std::max(buffer->size + size, buffer->capacity * 2);
+    auto* grown = (char*)realloc(buffer->data, capacity);
+    if (!grown) {
+      Fatal() << "out of memory growing an output buffer";
+    }
+    buffer->data = grown;
+    buffer->capacity = capacity;
+  }
+  std::copy_n(data, size, buffer->data + buffer->size);
+  buffer->size += size;
+}
+
+// A fixed-size buffer that silently truncates what does not fit.
+struct FixedOutputBuffer {
+  char* data;
+  size_t capacity;
+  size_t size = 0;
+
+  FixedOutputBuffer(char* data, size_t capacity)
+    : data(data), capacity(capacity) {}
+
+  static void append(const char* data, size_t size, void* userData) {
+    auto* buffer = (FixedOutputBuffer*)userData;
+    size = std::min(size, buffer->capacity - buffer->size);
+    std::copy_n(data, size, buffer->data + buffer->size);
+    buffer->size += size;
+  }
+};
+
+// Writes a module in binary form, passing the binary to one callback and the
+// source map, if a URL for it is given, to another. The binary is passed in
+// one piece, as the writer needs random access to it while writing, but the
+// source map is streamed.
+static void writeModule(BinaryenModuleRef module,
+                        BinaryenWriteCallback callback,
+                        void* userData,
+                        const char* sourceMapUrl,
+                        BinaryenWriteCallback sourceMapCallback,
+                        void* sourceMapUserData) {
   Module* wasm = (Module*)module;
   BufferWithRandomAccess buffer(false);
-  WasmBinaryWriter writer(wasm, buffer, false);
-  writer.setNamesSection(globalPassOptions.debugInfo);
-  std::ostringstream os;
-  if (sourceMapUrl) {
-    writer.setSourceMap(&os, sourceMapUrl);
-  }
-  writer.write();
-  size_t bytes = std::min(buffer.size(), outputSize);
-  std::copy_n(buffer.begin(), bytes, output);
-  size_t sourceMapBytes = 0;
-  if (sourceMapUrl) {
-    auto str = os.str();
-    sourceMapBytes = std::min(str.length(), sourceMapSize);
-    std::copy_n(str.c_str(), sourceMapBytes, sourceMap);
+  {
+    WasmBinaryWriter writer(wasm, buffer, false);
+    writer.setNamesSection(getPassOptions(module).debugInfo);
+    std::unique_ptr<CallbackStreamBuf> sourceMapBuf;
+    std::unique_ptr<std::ostream> sourceMapStream;
+    if (sourceMapUrl) {
+      sourceMapBuf =
+        make_unique<CallbackStreamBuf>(sourceMapCallback, sourceMapUserData);
+      sourceMapStream = wasm::make_unique<std::ostream>(sourceMapBuf.get());
+      writer.setSourceMap(sourceMapStream.get(), sourceMapUrl);
+    }
+    writer.write();
   }
-  return {bytes, sourceMapBytes};
+  callback((const char*)buffer.data(), buffer.size(), userData);
+}
+
+static void writeModuleText(BinaryenModuleRef module,
+                            BinaryenWriteCallback callback,
+                            void* userData) {
+  CallbackStreamBuf buf(callback, userData);
+  std::ostream stream(&buf);
+  WasmPrinter::printModule((Module*)module, stream);
 }
 
 size_t
@@ -3942,8 +4395,10 @@ BinaryenModuleWrite(BinaryenModuleRef module, char* output, size_t outputSize) {
     std::cout << "  // BinaryenModuleWrite\n";
   }
 
-  return writeModule((Module*)module, output, outputSize, nullptr, nullptr, 0)
-    .outputBytes;
+  FixedOutputBuffer buffer(output, outputSize);
+  writeModule(
+    module, FixedOutputBuffer::append, &buffer, nullptr, nullptr, nullptr);
+  return buffer.size;
 }
 
 size_t BinaryenModuleWriteText(BinaryenModuleRef module,
@@ -3954,16 +4409,11 @@ size_t BinaryenModuleWriteText(BinaryenModuleRef module,
     std::cout << "  // BinaryenModuleWriteTextr\n";
   }
 
-  // use a stringstream as an std::ostream. Extract the std::string
-  // representation, and then store in the output.
-  std::stringstream ss;
-  WasmPrinter::printModule((Module*)module, ss);
-
-  const auto temp = ss.str();
-  const auto ctemp = temp.c_str();
-
-  strncpy(output, ctemp, outputSize);
-  return std::min(outputSize, temp.size());
+  FixedOutputBuffer buffer(output, outputSize);
+  writeModuleText(module, FixedOutputBuffer::append, &buffer);
+  // Zero the rest of the output, as strncpy did.
+  std::fill(output + buffer.size, output + outputSize, 0);
+  return buffer.size;
 }
 
 BinaryenBufferSizes BinaryenModuleWriteWithSourceMap(BinaryenModuleRef module,
@@ -3978,8 +4428,15 @@ BinaryenBufferSizes BinaryenModuleWriteWithSourceMap(BinaryenModuleRef module,
 
   assert(url);
   assert(sourceMap);
-  return writeModule(
-    (Module*)module, output, outputSize, url, sourceMap, sourceMapSize);
+  FixedOutputBuffer buffer(output, outputSize);
+  FixedOutputBuffer sourceMapBuffer(sourceMap, sourceMapSize);
+  writeModule(module,
+              FixedOutputBuffer::append,
+              &buffer,
+              url,
+              FixedOutputBuffer::append,
+              &sourceMapBuffer);
+  return {buffer.size, sourceMapBuffer.size};
 }
 
 BinaryenModuleAllocateAndWriteResult
@@ -3991,24 +4448,18 @@ BinaryenModuleAllocateAndWrite(BinaryenModuleRef module,
     std::cout << ");\n";
   }
 
-  Module* wasm = (Module*)module;
-  BufferWithRandomAccess buffer(false);
-  WasmBinaryWriter writer(wasm, buffer, false);
-  writer.setNamesSection(globalPassOptions.debugInfo);
-  std::ostringstream os;
+  BinaryenOutputBuffer binary = {nullptr, 0, 0};
+  BinaryenOutputBuffer sourceMap = {nullptr, 0, 0};
+  writeModule(module,
+              appendToOutputBuffer,
+              &binary,
+              sourceMapUrl,
+              appendToOutputBuffer,
+              &sourceMap);
   if (sourceMapUrl) {
-    writer.setSourceMap(&os, sourceMapUrl);
+    appendToOutputBuffer("", 1, &sourceMap);
   }
-  writer.write();
-  void* binary = malloc(buffer.size());
-  std::copy_n(buffer.begin(), buffer.size(), static_cast<char*>(binary));
-  char* sourceMap = nullptr;
-  if (sourceMapUrl) {
-    auto str = os.str();
-    sourceMap = (char*)malloc(str.length() + 1);
-    std::copy_n(str.c_str(), str.length() + 1, sourceMap);
-  }
-  return {binary, buffer.size(), sourceMap};
+  return {binary.data, binary.size, sourceMap.data};
 }
 
 char* BinaryenModuleAllocateAndWriteText(BinaryenModuleRef module) {
@@ -4016,14 +4467,65 @@ char* BinaryenModuleAllocateAndWriteText(BinaryenModuleRef module) {
     std::cout << " // BinaryenModuleAllocateAndWriteText(the_module);";
   }
 
-  std::stringstream ss;
-  WasmPrinter::printModule((Module*)module, ss);
+  BinaryenOutputBuffer text = {nullptr, 0, 0};
+  writeModuleText(module, appendToOutputBuffer, &text);
+  appendToOutputBuffer("", 1, &text);
+  return text.data;
+}
+
+void BinaryenModuleWriteWithCallback(BinaryenModuleRef module,
+                                     BinaryenWriteCallback callback,
+                                     void* userData,
+                                     const char* sourceMapUrl,
+                                     BinaryenWriteCallback sourceMapCallback,
+                                     void* sourceMapUserData) {
+  if (tracing) {
+    std::cout << "  // BinaryenModuleWriteWithCallback\n";
+  }
+
+  assert(!sourceMapUrl || sourceMapCallback);
+  writeModule(module,
+              callback,
+              userData,
+              sourceMapUrl,
+              sourceMapCallback,
+              sourceMapUserData);
+}
+
+void BinaryenModuleWriteTextWithCallback(BinaryenModuleRef module,
+                                         BinaryenWriteCallback callback,
+                                         void* userData) {
+  if (tracing) {
+    std::cout << "  // BinaryenModuleWriteTextWithCallback\n";
+  }
+
+  writeModuleText(module, callback, userData);
+}
+
+void BinaryenModuleWriteToBuffer(BinaryenModuleRef module,
+                                 BinaryenOutputBuffer* output,
+                                 const char* sourceMapUrl,
+                                 BinaryenOutputBuffer* sourceMap) {
+  if (tracing) {
+    std::cout << "  // BinaryenModuleWriteToBuffer\n";
+  }
+
+  assert(!sourceMapUrl || sourceMap);
+  writeModule(module,
+              appendToOutputBuffer,
+              output,
+              sourceMapUrl,
+              appendToOutputBuffer,
+              sourceMap);
+}
+
+void BinaryenModuleWriteTextToBuffer(BinaryenModuleRef module,
+                                     BinaryenOutputBuffer* output) {
+  if (tracing) {
+    std::cout << "  // BinaryenModuleWriteTextToBuffer\n";
+  }
 
-  const std::string out = ss.str();
-  const int len = out.length() + 1;
-  char* cout = (char*)malloc(len);
-  strncpy(cout, out.c_str(), len);
-  return cout;
+  writeModuleText(module, appendToOutputBuffer, output);
 }
 
 BinaryenModuleRef BinaryenModuleRead(char* input, size_t inputSize) {
@@ -4031,7 +4533,7 @@ BinaryenModuleRef BinaryenModuleRead(char* input, size_t inputSize) {
     std::cout << "  // BinaryenModuleRead\n";
   }
 
-  auto* wasm = new Module;
+  auto* wasm = new APIModule;
   std::vector<char> buffer(false);
   buffer.resize(inputSize);
   std::copy_n(input, inputSize, buffer.begin());
@@ -4204,7 +4706,7 @@ void BinaryenFunctionOptimize(BinaryenFunctionRef func,
 
   Module* wasm = (Module*)module;
   PassRunner passRunner(wasm);
-  passRunner.options = globalPassOptions;
+  passRunner.options = getPassOptions(module);
   passRunner.addDefaultOptimizationPasses();
   passRunner.runOnFunction((Function*)func);
 }
@@ -4229,7 +4731,7 @@ void BinaryenFunctionRunPasses(BinaryenFunctionRef func,
 
   Module* wasm = (Module*)module;
   PassRunner passRunner(wasm);
-  passRunner.options = globalPassOptions;
+  passRunner.options = getPassOptions(module);
   for (BinaryenIndex i = 0; i < numPasses; i++) {
     passRunner.add(passes[i]);
   }
@@ -4662,7 +5164,7 @@ BinaryenGetFunctionTypeBySignature(BinaryenModuleRef module,
 
   // Lock. Guard against reading the list while types are being added.
   {
-    std::lock_guard<std::mutex> lock(BinaryenFunctionTypeMutex);
+    std::lock_guard<std::mutex> lock(getAPIModule(module)->functionTypeMutex);
     for (BinaryenIndex i = 0; i < wasm->functionTypes.size(); i++) {
       FunctionType* curr = wasm->functionTypes[i].get();
       if (curr->structuralComparison(test)) {
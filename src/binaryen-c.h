@@ -38,6 +38,11 @@
 //                Other methods - creating imports, exports, etc. - are
 //                not currently thread-safe (as there is typically no need
 //                to parallelize them).
+//                The locks behind this are per module, so independent modules
+//                can be built in parallel without contending for them, and
+//                each module can have its own optimization options (see
+//                BinaryenModuleSetOptimizeLevel etc.). API tracing is global,
+//                and is not meant to be used from multiple threads.
 //
 //================
 
@@ -828,6 +833,45 @@ BINARYEN_API BinaryenExpressionRef BinaryenPush(BinaryenModuleRef module,
 BINARYEN_API BinaryenExpressionRef BinaryenPop(BinaryenModuleRef module,
                                                BinaryenType type);
 
+// BuildExpression: builds a whole tree of expressions, such as a function
+//                  body, in a single call. 'code' is a postfix program: each
+//                  expression is its expression id followed by its
+//                  immediates, and takes its children from those built before
+//                  it, in the order of the binary format (so a Select's
+//                  condition comes last). Names are indexes into 'names'. The
+//                  supported ids and their immediates are:
+//
+//   Block        name (or BinaryenIndex(-1)), numChildren, type (or Auto)
+//   If           hasElse (0 or 1)
+//   Loop         name (or BinaryenIndex(-1))
+//   Break        name, hasValue, hasCondition
+//   Call         target name, numOperands, returnType
+//   LocalGet     index, type
+//   LocalSet     index, isTee (0 or 1)
+//   GlobalGet    name, type
+//   GlobalSet    name
+//   Load         bytes, signed, offset, align, type
+//   Store        bytes, offset, align, type
+//   Const        type, then 1 word of bits for i32 and f32, or 2 words (low,
+//                high) for i64 and f64
+//   Unary        op
+//   Binary       op
+//   Select, Drop, Nop, Unreachable
+//   Return       hasValue
+//
+// Types must be single value types, none or unreachable. An immediate out of
+// range for what it encodes is a fatal error.
+//
+// If more than one expression is left at the end, they are returned in an
+// unnamed block. Unlike the per-expression functions, this avoids a call per
+// expression, which matters when building large modules.
+BINARYEN_API BinaryenExpressionRef
+BinaryenBuildExpression(BinaryenModuleRef module,
+                        const uint32_t* code,
+                        BinaryenIndex codeSize,
+                        const char** names,
+                        BinaryenIndex numNames);
+
 BINARYEN_API BinaryenExpressionId
 BinaryenExpressionGetId(BinaryenExpressionRef expr);
 BINARYEN_API BinaryenType BinaryenExpressionGetType(BinaryenExpressionRef expr);
@@ -1080,6 +1124,10 @@ BINARYEN_REF(Function);
 //            and then vars, so if you have one param it will be at index
 //            0 (and written $0), and if you also have 2 vars they will be
 //            at indexes 1 and 2, etc., that is, they share an index space.
+// @body: must not contain expressions taken from another function's body.
+//        Optimizing or compacting a function may allocate its expressions in
+//        that function's own storage, which is freed along with it, so build
+//        a new tree instead of reusing one.
 BINARYEN_API BinaryenFunctionRef
 BinaryenAddFunction(BinaryenModuleRef module,
                     const char* name,
@@ -1090,7 +1138,9 @@ BinaryenAddFunction(BinaryenModuleRef module,
 // Gets a function reference by name.
 BINARYEN_API BinaryenFunctionRef BinaryenGetFunction(BinaryenModuleRef module,
                                                      const char* name);
-// Removes a function by name.
+// Removes a function by name. This frees the expressions in its body if they
+// were allocated by optimizing or compacting it, so no references to them may
+// remain elsewhere in the module.
 BINARYEN_API void BinaryenRemoveFunction(BinaryenModuleRef module,
                                          const char* name);
 
@@ -1247,8 +1297,14 @@ BINARYEN_API void BinaryenModulePrintAsmjs(BinaryenModuleRef module);
 //  @return 0 if an error occurred, 1 if validated succesfully
 BINARYEN_API int BinaryenModuleValidate(BinaryenModuleRef module);
 
-// Runs the standard optimization passes on the module. Uses the currently set
-// global optimize and shrink level.
+// Runs the standard optimization passes on the module. Uses the module's
+// optimize and shrink level if they were set for it, and otherwise the global
+// ones.
+//
+// Note that this and the other functions that run passes use the global
+// thread pool, which only does work for one caller at a time. Optimizing
+// independent modules from several threads is therefore safe, but the calls
+// take turns running their parallel passes, and do not scale across cores.
 BINARYEN_API void BinaryenModuleOptimize(BinaryenModuleRef module);
 
 // Gets the currently set optimize level. Applies to all modules, globally.
@@ -1275,8 +1331,35 @@ BINARYEN_API int BinaryenGetDebugInfo(void);
 // Applies to all modules, globally.
 BINARYEN_API void BinaryenSetDebugInfo(int on);
 
-// Runs the specified passes on the module. Uses the currently set global
-// optimize and shrink level.
+// Gets the optimize level of a module: the one set for it with
+// BinaryenModuleSetOptimizeLevel, or else the global one.
+BINARYEN_API int BinaryenModuleGetOptimizeLevel(BinaryenModuleRef module);
+
+// Sets the optimization level to use for a module, overriding the global one.
+// Options set for a module are copied from the global ones the first time any
+// of them is set, and from then on are independent of them, so modules used on
+// different threads can have different options.
+BINARYEN_API void BinaryenModuleSetOptimizeLevel(BinaryenModuleRef module,
+                                                 int level);
+
+// Gets the shrink level of a module: the one set for it with
+// BinaryenModuleSetShrinkLevel, or else the global one.
+BINARYEN_API int BinaryenModuleGetShrinkLevel(BinaryenModuleRef module);
+
+// Sets the shrink level to use for a module, overriding the global one.
+BINARYEN_API void BinaryenModuleSetShrinkLevel(BinaryenModuleRef module,
+                                               int level);
+
+// Gets whether debug information is enabled for a module: the setting for it
+// from BinaryenModuleSetDebugInfo, or else the global one.
+BINARYEN_API int BinaryenModuleGetDebugInfo(BinaryenModuleRef module);
+
+// Enables or disables debug information in binaries emitted for a module,
+// overriding the global setting.
+BINARYEN_API void BinaryenModuleSetDebugInfo(BinaryenModuleRef module, int on);
+
+// Runs the specified passes on the module. Uses the module's optimize and
+// shrink level, like BinaryenModuleOptimize.
 BINARYEN_API void BinaryenModuleRunPasses(BinaryenModuleRef module,
                                           const char** passes,
                                           BinaryenIndex numPasses);
@@ -1286,8 +1369,8 @@ BINARYEN_API void BinaryenModuleRunPasses(BinaryenModuleRef module,
 // yourself, but simpler to use autodrop).
 BINARYEN_API void BinaryenModuleAutoDrop(BinaryenModuleRef module);
 
-// Serialize a module into binary form. Uses the currently set global debugInfo
-// option.
+// Serialize a module into binary form. Uses the module's debugInfo option if
+// it was set for it, and otherwise the global one.
 // @return how many bytes were written. This will be less than or equal to
 //         outputSize
 size_t BINARYEN_API BinaryenModuleWrite(BinaryenModuleRef module,
@@ -1307,7 +1390,7 @@ typedef struct BinaryenBufferSizes {
 } BinaryenBufferSizes;
 
 // Serialize a module into binary form including its source map. Uses the
-// currently set global debugInfo option.
+// module's debugInfo option, like BinaryenModuleWrite.
 // @returns how many bytes were written. This will be less than or equal to
 //          outputSize
 BINARYEN_API BinaryenBufferSizes
@@ -1328,10 +1411,10 @@ typedef struct BinaryenModuleAllocateAndWriteResult {
 } BinaryenModuleAllocateAndWriteResult;
 
 // Serializes a module into binary form, optionally including its source map if
-// sourceMapUrl has been specified. Uses the currently set global debugInfo
-// option. Differs from BinaryenModuleWrite in that it implicitly allocates
-// appropriate buffers using malloc(), and expects the user to free() them
-// manually once not needed anymore.
+// sourceMapUrl has been specified. Uses the module's debugInfo option, like
+// BinaryenModuleWrite. Differs from BinaryenModuleWrite in that it implicitly
+// allocates appropriate buffers using malloc(), and expects the user to free()
+// them manually once not needed anymore.
 BINARYEN_API BinaryenModuleAllocateAndWriteResult
 BinaryenModuleAllocateAndWrite(BinaryenModuleRef module,
                                const char* sourceMapUrl);
@@ -1341,6 +1424,55 @@ BinaryenModuleAllocateAndWrite(BinaryenModuleRef module,
 // once not needed anymore.
 BINARYEN_API char* BinaryenModuleAllocateAndWriteText(BinaryenModuleRef module);
 
+// Receives output from the BinaryenModuleWrite*WithCallback functions, in one
+// or more chunks. The data is only valid during the call.
+typedef void (*BinaryenWriteCallback)(const char* data,
+                                      size_t size,
+                                      void* userData);
+
+// Serializes a module into binary form, passing the output to a callback
+// instead of copying it into a buffer. If sourceMapUrl is given, the source map
+// is passed to sourceMapCallback. Uses the module's debugInfo option, like
+// BinaryenModuleWrite.
+BINARYEN_API void
+BinaryenModuleWriteWithCallback(BinaryenModuleRef module,
+                                BinaryenWriteCallback callback,
+                                void* userData,
+                                const char* sourceMapUrl,
+                                BinaryenWriteCallback sourceMapCallback,
+                                void* sourceMapUserData);
+
+// Serializes a module in s-expression text format, passing the output to a
+// callback in chunks as it is printed.
+BINARYEN_API void
+BinaryenModuleWriteTextWithCallback(BinaryenModuleRef module,
+                                    BinaryenWriteCallback callback,
+                                    void* userData);
+
+// A buffer owned by the user, which the BinaryenModuleWrite*ToBuffer functions
+// append to, growing it with realloc() as needed. It can start out empty (all
+// zeros), and can be reused by setting size to 0. The user is expected to
+// free() data once not needed anymore.
+typedef struct BinaryenOutputBuffer {
+  char* data;
+  size_t size;
+  size_t capacity;
+} BinaryenOutputBuffer;
+
+// Serializes a module into binary form, appending it to a buffer. If
+// sourceMapUrl is given, the source map is appended to sourceMap. Uses the
+// module's debugInfo option, like BinaryenModuleWrite.
+BINARYEN_API void BinaryenModuleWriteToBuffer(BinaryenModuleRef module,
+                                              BinaryenOutputBuffer* output,
+                                              const char* sourceMapUrl,
+                                              BinaryenOutputBuffer* sourceMap);
+
+// Serializes a module in s-expression text format, appending it to a buffer.
+// No null terminator is added.
+BINARYEN_API void
+BinaryenModuleWriteTextToBuffer(BinaryenModuleRef module,
+                                BinaryenOutputBuffer* output);
+
 // Deserialize a module from binary form.
 BINARYEN_API BinaryenModuleRef BinaryenModuleRead(char* input,
                                                   size_t inputSize);
@@ -1402,17 +1534,19 @@ BINARYEN_API BinaryenIndex BinaryenFunctionGetNumVars(BinaryenFunctionRef func);
 // specified `Function`.
 BINARYEN_API BinaryenType BinaryenFunctionGetVar(BinaryenFunctionRef func,
                                                  BinaryenIndex index);
-// Gets the body of the specified `Function`.
+// Gets the body of the specified `Function`. The expressions in it belong to
+// that function and must not be moved into another one (see
+// BinaryenAddFunction).
 BINARYEN_API BinaryenExpressionRef
 BinaryenFunctionGetBody(BinaryenFunctionRef func);
 
-// Runs the standard optimization passes on the function. Uses the currently set
-// global optimize and shrink level.
+// Runs the standard optimization passes on the function. Uses the module's
+// optimize and shrink level, like BinaryenModuleOptimize.
 BINARYEN_API void BinaryenFunctionOptimize(BinaryenFunctionRef func,
                                            BinaryenModuleRef module);
 
-// Runs the specified passes on the function. Uses the currently set global
-// optimize and shrink level.
+// Runs the specified passes on the function. Uses the module's optimize and
+// shrink level, like BinaryenModuleOptimize.
 BINARYEN_API void BinaryenFunctionRunPasses(BinaryenFunctionRef func,
                                             BinaryenModuleRef module,
                                             const char** passes,
@@ -24,6 +24,7 @@
 #include "cfg-traversal.h"
 #include "ir/utils.h"
 #include "support/sorted_vector.h"
+#include "support/threads.h"
 #include "wasm-builder.h"
 #include "wasm-traversal.h"
 #include "wasm.h"
@@ -103,12 +104,20 @@ struct LivenessWalker : public CFGWalker<SubType, VisitorType, Liveness> {
   typedef
     typename CFGWalker<SubType, VisitorType, Liveness>::BasicBlock BasicBlock;
 
+  // Functions with at least this many basic blocks are analyzed in parallel
+  // where possible.
+  static const Index MIN_PARALLEL_BLOCKS = 10000;
+
+  // Functions with more locals than this use sparse data structures for
+  // information about pairs of locals, as matrices would take too much memory.
+  static const Index MAX_DENSE_LOCALS = 4096;
+
   Index numLocals;
   std::unordered_set<BasicBlock*> liveBlocks;
   // canonicalized - accesses should check (low, high)
-  // TODO: use a map for high N, as this tends to be sparse? or don't look at
-  // copies at all for big N?
   std::vector<uint8_t> copies;
+  // the same, when sparse, indexed by (low << 32) | high
+  std::unordered_map<uint64_t, uint8_t> sparseCopies;
   // total # of copies for each local, with all others
   std::vector<Index> totalCopies;
 
@@ -175,8 +184,13 @@ struct LivenessWalker : public CFGWalker<SubType, VisitorType, Liveness> {
 
   void doWalkFunction(Function* func) {
     numLocals = func->getNumLocals();
-    copies.resize(numLocals * numLocals);
-    std::fill(copies.begin(), copies.end(), 0);
+    sparseCopies.clear();
+    if (isSparse()) {
+      copies.clear();
+    } else {
+      copies.resize(numLocals * numLocals);
+      std::fill(copies.begin(), copies.end(), 0);
+    }
     totalCopies.resize(numLocals);
     std::fill(totalCopies.begin(), totalCopies.end(), 0);
     // create the CFG by walking the IR
@@ -192,14 +206,27 @@ struct LivenessWalker : public CFGWalker<SubType, VisitorType, Liveness> {
   void flowLiveness() {
     // keep working while stuff is flowing
     std::unordered_set<BasicBlock*> queue;
+    std::vector<BasicBlock*> blocks;
     for (auto& curr : CFGWalker<SubType, VisitorType, Liveness>::basicBlocks) {
       if (liveBlocks.count(curr.get()) == 0) {
         continue; // ignore dead blocks
       }
       queue.insert(curr.get());
-      // do the first scan through the block, starting with nothing live at the
-      // end, and updating the liveness at the start
-      scanLivenessThroughActions(curr->contents.actions, curr->contents.start);
+      blocks.push_back(curr.get());
+    }
+    // do the first scan through each block, starting with nothing live at the
+    // end, and updating the liveness at the start. the blocks are independent
+    // here, so in large functions we scan them in parallel
+    auto scan = [&](size_t i) {
+      scanLivenessThroughActions(blocks[i]->contents.actions,
+                                 blocks[i]->contents.start);
+    };
+    if (blocks.size() >= MIN_PARALLEL_BLOCKS) {
+      ThreadPool::get()->runInParallel(blocks.size(), scan);
+    } else {
+      for (size_t i = 0; i < blocks.size(); i++) {
+        scan(i);
+      }
     }
     // at every point in time, we assume we already noted interferences between
     // things already known alive at the end, and scanned back through the block
@@ -260,16 +287,28 @@ struct LivenessWalker : public CFGWalker<SubType, VisitorType, Liveness> {
     }
   }
 
+  bool isSparse() { return numLocals > MAX_DENSE_LOCALS; }
+
   void addCopy(Index i, Index j) {
-    auto k = std::min(i, j) * numLocals + std::max(i, j);
-    copies[k] = std::min(copies[k], uint8_t(254)) + 1;
+    auto& count = isSparse()
+                    ? sparseCopies[getSparseKey(i, j)]
+                    : copies[std::min(i, j) * numLocals + std::max(i, j)];
+    count = std::min(count, uint8_t(254)) + 1;
     totalCopies[i]++;
     totalCopies[j]++;
   }
 
   uint8_t getCopies(Index i, Index j) {
+    if (isSparse()) {
+      auto iter = sparseCopies.find(getSparseKey(i, j));
+      return iter != sparseCopies.end() ? iter->second : 0;
+    }
     return copies[std::min(i, j) * numLocals + std::max(i, j)];
   }
+
+  static uint64_t getSparseKey(Index i, Index j) {
+    return (uint64_t(std::min(i, j)) << 32) | std::max(i, j);
+  }
 };
 
 } // namespace wasm
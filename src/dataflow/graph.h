@@ -25,6 +25,8 @@
 #ifndef wasm_dataflow_graph_h
 #define wasm_dataflow_graph_h
 
+#include <deque>
+
 #include "dataflow/node.h"
 #include "ir/abstract.h"
 #include "ir/iteration.h"
@@ -73,8 +75,12 @@ struct Graph : public UnifiedExpressionVisitor<Graph, Node*> {
   // The module we are working in.
   Module* module;
 
-  // All of our nodes
-  std::vector<std::unique_ptr<Node>> nodes;
+  // All of our nodes, in order of creation. A node's id is its index here.
+  std::vector<Node*> nodes;
+
+  // The storage for our nodes. A deque allocates them in chunks and never
+  // moves them, so the pointers to them stay valid.
+  std::deque<Node> nodeStorage;
 
   // Tracking state during building
 
@@ -160,9 +166,12 @@ struct Graph : public UnifiedExpressionVisitor<Graph, Node*> {
   Node* makeZero(wasm::Type type) { return makeConst(Literal::makeZero(type)); }
 
   // Add a new node to our list of owned nodes.
-  Node* addNode(Node* node) {
-    nodes.push_back(std::unique_ptr<Node>(node));
-    return node;
+  Node* addNode(Node node) {
+    nodeStorage.push_back(std::move(node));
+    auto* ret = &nodeStorage.back();
+    ret->id = nodes.size();
+    nodes.push_back(ret);
+    return ret;
   }
 
   Node* makeZeroComp(Node* node, bool equal, Expression* origin) {
@@ -342,7 +351,7 @@ struct Graph : public UnifiedExpressionVisitor<Graph, Node*> {
         // the loop body, replace references to the Var with the
         // previous value (the value that is all we need instead of a phi).
         for (auto j = firstNodeFromLoop; j < nodes.size(); j++) {
-          for (auto*& value : nodes[j].get()->values) {
+          for (auto*& value : nodes[j]->values) {
             if (value == var) {
               value = proper;
             }
@@ -105,45 +105,46 @@ struct Node {
   // For Zext, this is the value we extend.
   std::vector<Node*> values;
 
-  // Constructors
-  static Node* makeVar(wasm::Type wasmType) {
-    Node* ret = new Node(Var);
-    ret->wasmType = wasmType;
+  // The index of this node in the nodes of the Graph that contains it, or
+  // NoId if it is not in a Graph. Ids are dense, so they can index vectors of
+  // per-node data.
+  static const Index NoId = Index(-1);
+  Index id = NoId;
+
+  // Constructors. These return the node by value, and a Graph adds it to its
+  // storage with Graph::addNode().
+  static Node makeVar(wasm::Type wasmType) {
+    Node ret(Var);
+    ret.wasmType = wasmType;
     return ret;
   }
-  static Node* makeExpr(Expression* expr, Expression* origin) {
-    Node* ret = new Node(Expr);
-    ret->expr = expr;
-    ret->origin = origin;
+  static Node makeExpr(Expression* expr, Expression* origin) {
+    Node ret(Expr);
+    ret.expr = expr;
+    ret.origin = origin;
     return ret;
   }
-  static Node* makePhi(Node* block, Index index) {
-    Node* ret = new Node(Phi);
-    ret->addValue(block);
-    ret->index = index;
+  static Node makePhi(Node* block, Index index) {
+    Node ret(Phi);
+    ret.addValue(block);
+    ret.index = index;
     return ret;
   }
-  static Node* makeCond(Node* block, Index index, Node* node) {
-    Node* ret = new Node(Cond);
-    ret->addValue(block);
-    ret->index = index;
-    ret->addValue(node);
+  static Node makeCond(Node* block, Index index, Node* node) {
+    Node ret(Cond);
+    ret.addValue(block);
+    ret.index = index;
+    ret.addValue(node);
     return ret;
   }
-  static Node* makeBlock() {
-    Node* ret = new Node(Block);
-    return ret;
-  }
-  static Node* makeZext(Node* child, Expression* origin) {
-    Node* ret = new Node(Zext);
-    ret->addValue(child);
-    ret->origin = origin;
-    return ret;
-  }
-  static Node* makeBad() {
-    Node* ret = new Node(Bad);
+  static Node makeBlock() { return Node(Block); }
+  static Node makeZext(Node* child, Expression* origin) {
+    Node ret(Zext);
+    ret.addValue(child);
+    ret.origin = origin;
     return ret;
   }
+  static Node makeBad() { return Node(Bad); }
 
   // Helpers
 
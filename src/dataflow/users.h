@@ -38,27 +38,31 @@ namespace DataFlow {
 class Users {
   typedef std::unordered_set<DataFlow::Node*> UserSet;
 
-  std::unordered_map<DataFlow::Node*, UserSet> users;
+  // The users of each node, indexed by the node's id.
+  std::vector<UserSet> users;
 
 public:
   void build(Graph& graph) {
-    for (auto& node : graph.nodes) {
+    users.clear();
+    users.resize(graph.nodes.size());
+    for (auto* node : graph.nodes) {
       for (auto* value : node->values) {
-        users[value].insert(node.get());
+        addUser(value, node);
       }
     }
   }
 
-  UserSet& getUsers(Node* node) {
-    auto iter = users.find(node);
-    if (iter == users.end()) {
-      static UserSet empty; // FIXME thread_local?
+  const UserSet& getUsers(Node* node) const {
+    if (!isInGraph(node)) {
+      // This is not a node in the graph, like the canonical bad node. It has
+      // no users, and the shared empty set is never written to.
+      static const UserSet empty;
       return empty;
     }
-    return iter->second;
+    return users[node->id];
   }
 
-  Index getNumUses(Node* node) {
+  Index getNumUses(Node* node) const {
     auto& users = getUsers(node);
     // A user may have more than one use
     Index numUses = 0;
@@ -83,16 +87,28 @@ public:
   // removed.
   void stopUsingValues(Node* node) {
     for (auto* value : node->values) {
-      auto& users = getUsers(value);
-      users.erase(node);
+      if (isInGraph(value)) {
+        users[value->id].erase(node);
+      }
     }
   }
 
   // Adds a new user to a node. Called when we add or change a value of a node.
-  void addUser(Node* node, Node* newUser) { users[node].insert(newUser); }
+  void addUser(Node* node, Node* newUser) {
+    if (isInGraph(node)) {
+      users[node->id].insert(newUser);
+    }
+  }
 
   // Remove all uses of a node. Called when a node is being removed.
-  void removeAllUsesOf(Node* node) { users.erase(node); }
+  void removeAllUsesOf(Node* node) {
+    if (isInGraph(node)) {
+      users[node->id].clear();
+    }
+  }
+
+private:
+  bool isInGraph(Node* node) const { return node->id < users.size(); }
 };
 
 } // namespace DataFlow
@@ -19,6 +19,7 @@
 #include <cfg/cfg-traversal.h>
 #include <ir/find_all.h>
 #include <ir/local-graph.h>
+#include <support/threads.h>
 #include <wasm-builder.h>
 #include <wasm-printing.h>
 
@@ -26,6 +27,10 @@ namespace wasm {
 
 namespace LocalGraphInternal {
 
+// Functions with at least this many basic blocks are analyzed in parallel
+// where possible.
+static const Index MIN_PARALLEL_BLOCKS = 10000;
+
 // Information about a basic block.
 struct Info {
   // actions occurring in this block: local.gets and local.sets
@@ -80,13 +85,8 @@ struct Flower : public CFGWalker<Flower, Visitor<Flower>, Info> {
     // This block struct is optimized for this flow process (Minimal
     // information, iteration index).
     struct FlowBlock {
-      // Last Traversed Iteration: This value helps us to find if this block has
-      // been seen while traversing blocks. We compare this value to the current
-      // iteration index in order to determine if we already process this block
-      // in the current iteration. This speeds up the processing compared to
-      // unordered_set or other struct usage. (No need to reset internal values,
-      // lookup into container, ...)
-      size_t lastTraversedIteration;
+      // The index of this block, to find its state in a FlowState.
+      Index index;
       std::vector<Expression*> actions;
       std::vector<FlowBlock*> in;
       // Sor each index, the last local.set for it
@@ -99,9 +99,6 @@ struct Flower : public CFGWalker<Flower, Visitor<Flower>, Info> {
     };
 
     auto numLocals = func->getNumLocals();
-    std::vector<std::vector<LocalGet*>> allGets;
-    allGets.resize(numLocals);
-    std::vector<FlowBlock*> work;
 
     // Convert input blocks (basicBlocks) into more efficient flow blocks to
     // improve memory access.
@@ -124,7 +121,7 @@ struct Flower : public CFGWalker<Flower, Visitor<Flower>, Info> {
       if (block.get() == entry) {
         entryFlowBlock = &flowBlock;
       }
-      flowBlock.lastTraversedIteration = NULL_ITERATION;
+      flowBlock.index = i;
       flowBlock.actions.swap(block->contents.actions);
       // Map in block to flow blocks
       auto& in = block->in;
@@ -141,85 +138,144 @@ struct Flower : public CFGWalker<Flower, Visitor<Flower>, Info> {
     }
     assert(entryFlowBlock != nullptr);
 
-    size_t currentIteration = 0;
-    for (auto& block : flowBlocks) {
-#ifdef LOCAL_GRAPH_DEBUG
-      std::cout << "basic block " << block.get() << " :\n";
-      for (auto& action : block->contents.actions) {
-        std::cout << "  action: " << *action << '\n';
-      }
-      for (auto* lastSet : block->contents.lastSets) {
-        std::cout << "  last set " << lastSet << '\n';
-      }
-#endif
-      // go through the block, finding each get and adding it to its index,
-      // and seeing how sets affect that
-      auto& actions = block.actions;
-      // move towards the front, handling things as we go
-      for (int i = int(actions.size()) - 1; i >= 0; i--) {
-        auto* action = actions[i];
-        if (auto* get = action->dynCast<LocalGet>()) {
-          allGets[get->index].push_back(get);
-        } else {
-          // This set is the only set for all those gets.
-          auto* set = action->cast<LocalSet>();
-          auto& gets = allGets[set->index];
-          for (auto* get : gets) {
-            getSetses[get].insert(set);
-          }
-          gets.clear();
+    // The state of flowing the gets of some of the blocks.
+    struct FlowState {
+      std::vector<std::vector<LocalGet*>> allGets;
+      std::vector<FlowBlock*> work;
+      // Last Traversed Iteration: For each block, this value helps us to find
+      // if this block has been seen while traversing blocks. We compare this
+      // value to the current iteration index in order to determine if we
+      // already process this block in the current iteration. This speeds up
+      // the processing compared to unordered_set or other struct usage. (No
+      // need to reset internal values, lookup into container, ...)
+      std::vector<size_t> lastTraversedIteration;
+      size_t currentIteration = 0;
+    };
+
+    // The gets of each block are flowed independently of those of other
+    // blocks, so in large functions we flow groups of blocks in parallel. To
+    // allow that, every get has an entry in getSetses before we start, and
+    // we just fill in the sets of the gets of our own blocks.
+    size_t numGroups = 1;
+    if (flowBlocks.size() >= MIN_PARALLEL_BLOCKS) {
+      numGroups = ThreadPool::get()->availableSize();
+    }
+    bool parallel = numGroups > 1;
+    if (parallel) {
+      for (auto& pair : locations) {
+        if (auto* get = pair.first->dynCast<LocalGet>()) {
+          getSetses[get];
         }
       }
-      // If anything is left, we must flow it back through other blocks. we
-      // can do that for all gets as a whole, they will get the same results.
-      for (Index index = 0; index < numLocals; index++) {
-        auto& gets = allGets[index];
-        if (gets.empty()) {
-          continue;
+    }
+    auto getSets = [&](LocalGet* get) -> LocalGraph::Sets& {
+      return parallel ? getSetses.find(get)->second : getSetses[get];
+    };
+
+    auto flowGroup = [&](size_t group) {
+      FlowState state;
+      state.allGets.resize(numLocals);
+      state.lastTraversedIteration.resize(flowBlocks.size(), NULL_ITERATION);
+      auto& allGets = state.allGets;
+      auto& work = state.work;
+      auto& currentIteration = state.currentIteration;
+      for (size_t b = group; b < flowBlocks.size(); b += numGroups) {
+        auto& block = flowBlocks[b];
+#ifdef LOCAL_GRAPH_DEBUG
+        std::cout << "basic block " << &block << " :\n";
+        for (auto* action : block.actions) {
+          std::cout << "  action: " << *action << '\n';
         }
-        work.push_back(&block);
-        // Note that we may need to revisit the later parts of this initial
-        // block, if we are in a loop, so don't mark it as seen.
-        while (!work.empty()) {
-          auto* curr = work.back();
-          work.pop_back();
-          // We have gone through this block; now we must handle flowing to
-          // the inputs.
-          if (curr->in.empty()) {
-            if (curr == entryFlowBlock) {
-              // These receive a param or zero init value.
-              for (auto* get : gets) {
-                getSetses[get].insert(nullptr);
-              }
-            }
+        for (auto& lastSet : block.lastSets) {
+          std::cout << "  last set " << lastSet.second << '\n';
+        }
+#endif
+        // go through the block, finding each get and adding it to its index,
+        // and seeing how sets affect that
+        auto& actions = block.actions;
+        // move towards the front, handling things as we go
+        for (int i = int(actions.size()) - 1; i >= 0; i--) {
+          auto* action = actions[i];
+          if (auto* get = action->dynCast<LocalGet>()) {
+            allGets[get->index].push_back(get);
           } else {
-            for (auto* pred : curr->in) {
-              if (pred->lastTraversedIteration == currentIteration) {
-                // We've already seen pred in this iteration.
-                continue;
-              }
-              pred->lastTraversedIteration = currentIteration;
-              auto lastSet =
-                std::find_if(pred->lastSets.begin(),
-                             pred->lastSets.end(),
-                             [&](std::pair<Index, LocalSet*>& value) {
-                               return value.first == index;
-                             });
-              if (lastSet != pred->lastSets.end()) {
-                // There is a set here, apply it, and stop the flow.
+            // This set is the only set for all those gets.
+            auto* set = action->cast<LocalSet>();
+            auto& gets = allGets[set->index];
+            for (auto* get : gets) {
+              getSets(get).insert(set);
+            }
+            gets.clear();
+          }
+        }
+        // If anything is left, we must flow it back through other blocks. we
+        // can do that for all gets as a whole, they will get the same results.
+        for (Index index = 0; index < numLocals; index++) {
+          auto& gets = allGets[index];
+          if (gets.empty()) {
+            continue;
+          }
+          work.push_back(&block);
+          // Note that we may need to revisit the later parts of this initial
+          // block, if we are in a loop, so don't mark it as seen.
+          while (!work.empty()) {
+            auto* curr = work.back();
+            work.pop_back();
+            // We have gone through this block; now we must handle flowing to
+            // the inputs.
+            if (curr->in.empty()) {
+              if (curr == entryFlowBlock) {
+                // These receive a param or zero init value.
                 for (auto* get : gets) {
-                  getSetses[get].insert(lastSet->second);
+                  getSets(get).insert(nullptr);
+                }
+              }
+            } else {
+              for (auto* pred : curr->in) {
+                auto& lastTraversedIteration =
+                  state.lastTraversedIteration[pred->index];
+                if (lastTraversedIteration == currentIteration) {
+                  // We've already seen pred in this iteration.
+                  continue;
+                }
+                lastTraversedIteration = currentIteration;
+                auto lastSet =
+                  std::find_if(pred->lastSets.begin(),
+                               pred->lastSets.end(),
+                               [&](std::pair<Index, LocalSet*>& value) {
+                                 return value.first == index;
+                               });
+                if (lastSet != pred->lastSets.end()) {
+                  // There is a set here, apply it, and stop the flow.
+                  for (auto* get : gets) {
+                    getSets(get).insert(lastSet->second);
+                  }
+                } else {
+                  // Keep on flowing.
+                  work.push_back(pred);
                 }
-              } else {
-                // Keep on flowing.
-                work.push_back(pred);
               }
             }
           }
+          gets.clear();
+          currentIteration++;
+        }
+      }
+    };
+
+    if (parallel) {
+      ThreadPool::get()->runInParallel(numGroups, flowGroup);
+      // gets that no set reaches have no entry, as when we do not run in
+      // parallel
+      for (auto iter = getSetses.begin(); iter != getSetses.end();) {
+        if (iter->second.empty()) {
+          iter = getSetses.erase(iter);
+        } else {
+          ++iter;
         }
-        gets.clear();
-        currentIteration++;
       }
+    } else {
+      flowGroup(0);
     }
   }
 };
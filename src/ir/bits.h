@@ -17,7 +17,10 @@
 #ifndef wasm_ir_bits_h
 #define wasm_ir_bits_h
 
+#include <unordered_map>
+
 #include "ir/literal-utils.h"
+#include "ir/load-utils.h"
 #include "support/bits.h"
 #include "wasm-builder.h"
 
@@ -103,6 +106,183 @@ struct Bits {
   }
 };
 
+// Finds the maximum amount of bits used in integer expressions. This is not
+// extremely precise (it doesn't look into add operands, etc.).
+// LocalInfoProvider provides getMaxBitsForLocal(LocalGet*).
+//
+// The results for subexpressions are cached, so that asking about every node
+// of a deep tree takes linear time and not quadratic. After modifying an
+// expression in place, forget() it, and anything above it that may have been
+// asked about.
+template<typename LocalInfoProvider> struct MaxBits {
+  LocalInfoProvider* localInfoProvider;
+
+  MaxBits(LocalInfoProvider* localInfoProvider)
+    : localInfoProvider(localInfoProvider) {}
+
+  Index get(Expression* curr) {
+    if (!mayRecurse(curr)) {
+      return compute(curr);
+    }
+    auto iter = cache.find(curr);
+    if (iter != cache.end()) {
+      return iter->second;
+    }
+    auto bits = compute(curr);
+    cache[curr] = bits;
+    return bits;
+  }
+
+  void forget(Expression* curr) { cache.erase(curr); }
+
+  void clear() { cache.clear(); }
+
+private:
+  std::unordered_map<Expression*, Index> cache;
+
+  // Leaves are cheap to compute, and not worth caching.
+  static bool mayRecurse(Expression* curr) {
+    return curr->is<Binary>() || curr->is<Unary>() || curr->is<LocalSet>();
+  }
+
+  Index compute(Expression* curr) {
+    if (auto* const_ = curr->dynCast<Const>()) {
+      switch (curr->type) {
+        case i32:
+          return 32 - const_->value.countLeadingZeroes().geti32();
+        case i64:
+          return 64 - const_->value.countLeadingZeroes().geti64();
+        default:
+          WASM_UNREACHABLE();
+      }
+    } else if (auto* binary = curr->dynCast<Binary>()) {
+      switch (binary->op) {
+        // 32-bit
+        case AddInt32:
+        case SubInt32:
+        case MulInt32:
+        case DivSInt32:
+        case DivUInt32:
+        case RemSInt32:
+        case RemUInt32:
+        case RotLInt32:
+        case RotRInt32:
+          return 32;
+        case AndInt32:
+          return std::min(get(binary->left), get(binary->right));
+        case OrInt32:
+        case XorInt32:
+          return std::max(get(binary->left), get(binary->right));
+        case ShlInt32: {
+          if (auto* shifts = binary->right->dynCast<Const>()) {
+            return std::min(Index(32),
+                            get(binary->left) +
+                              Bits::getEffectiveShifts(shifts));
+          }
+          return 32;
+        }
+        case ShrUInt32: {
+          if (auto* shift = binary->right->dynCast<Const>()) {
+            auto maxBits = get(binary->left);
+            auto shifts =
+              std::min(Index(Bits::getEffectiveShifts(shift)),
+                       maxBits); // can ignore more shifts than zero us out
+            return std::max(Index(0), maxBits - shifts);
+          }
+          return 32;
+        }
+        case ShrSInt32: {
+          if (auto* shift = binary->right->dynCast<Const>()) {
+            auto maxBits = get(binary->left);
+            if (maxBits == 32) {
+              return 32;
+            }
+            auto shifts =
+              std::min(Index(Bits::getEffectiveShifts(shift)),
+                       maxBits); // can ignore more shifts than zero us out
+            return std::max(Index(0), maxBits - shifts);
+          }
+          return 32;
+        }
+        // 64-bit TODO
+        // comparisons
+        case EqInt32:
+        case NeInt32:
+        case LtSInt32:
+        case LtUInt32:
+        case LeSInt32:
+        case LeUInt32:
+        case GtSInt32:
+        case GtUInt32:
+        case GeSInt32:
+        case GeUInt32:
+        case EqInt64:
+        case NeInt64:
+        case LtSInt64:
+        case LtUInt64:
+        case LeSInt64:
+        case LeUInt64:
+        case GtSInt64:
+        case GtUInt64:
+        case GeSInt64:
+        case GeUInt64:
+        case EqFloat32:
+        case NeFloat32:
+        case LtFloat32:
+        case LeFloat32:
+        case GtFloat32:
+        case GeFloat32:
+        case EqFloat64:
+        case NeFloat64:
+        case LtFloat64:
+        case LeFloat64:
+        case GtFloat64:
+        case GeFloat64:
+          return 1;
+        default: {}
+      }
+    } else if (auto* unary = curr->dynCast<Unary>()) {
+      switch (unary->op) {
+        case ClzInt32:
+        case CtzInt32:
+        case PopcntInt32:
+          return 6;
+        case ClzInt64:
+        case CtzInt64:
+        case PopcntInt64:
+          return 7;
+        case EqZInt32:
+        case EqZInt64:
+          return 1;
+        case WrapInt64:
+          return std::min(Index(32), get(unary->value));
+        default: {}
+      }
+    } else if (auto* set = curr->dynCast<LocalSet>()) {
+      // a tee passes through the value
+      return get(set->value);
+    } else if (auto* localGet = curr->dynCast<LocalGet>()) {
+      return localInfoProvider->getMaxBitsForLocal(localGet);
+    } else if (auto* load = curr->dynCast<Load>()) {
+      // if signed, then the sign-extension might fill all the bits
+      // if unsigned, then we have a limit
+      if (LoadUtils::isSignRelevant(load) && !load->signed_) {
+        return 8 * load->bytes;
+      }
+    }
+    switch (curr->type) {
+      case i32:
+        return 32;
+      case i64:
+        return 64;
+      case unreachable:
+        return 64; // not interesting, but don't crash
+      default:
+        WASM_UNREACHABLE();
+    }
+  }
+};
+
 } // namespace wasm
 
 #endif // wasm_ir_bits_h
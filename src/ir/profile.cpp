@@ -0,0 +1,33 @@
+/*
+ * Copyright 2019 WebAssembly Community Group participants
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ir/profile.h"
+#include "pass.h"
+#include "support/file.h"
+
+namespace wasm {
+
+std::unique_ptr<Profile> Profile::fromOptions(PassOptions& options) {
+  auto arg = options.getArgumentOrDefault("profile", "");
+  if (arg.empty()) {
+    return nullptr;
+  }
+  auto profile = make_unique<Profile>();
+  profile->read(read_possible_response_file(arg));
+  return profile;
+}
+
+} // namespace wasm
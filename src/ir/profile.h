@@ -0,0 +1,149 @@
+/*
+ * Copyright 2019 WebAssembly Community Group participants
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+//
+// A profile of the calls made when running a module: how many times each
+// function was called, and how many times each caller called each callee
+// (directly or indirectly). The interpreter writes one with
+// wasm-shell --profile=FILE, and passes that can use one read it from
+// --pass-arg=profile@@FILE.
+//
+// The text format has an entry per line, with tab-separated fields:
+//
+//   <count> <function>
+//   <count> <caller> <callee>
+//
+
+#ifndef wasm_ir_profile_h
+#define wasm_ir_profile_h
+
+#include <algorithm>
+#include <cstdlib>
+#include <memory>
+#include <ostream>
+#include <unordered_map>
+#include <vector>
+
+#include "support/string.h"
+#include "wasm.h"
+
+namespace wasm {
+
+struct PassOptions;
+
+struct Profile {
+  // function => how many times it was called
+  std::unordered_map<Name, uint64_t> functionCounts;
+  // caller => callee => how many times the caller called the callee
+  std::unordered_map<Name, std::unordered_map<Name, uint64_t>> callCounts;
+  // the number of calls in the profile
+  uint64_t totalCalls = 0;
+
+  // A call from a caller to a callee is hot if it accounts for at least
+  // 1/HOT_CALL_FRACTION of all the calls.
+  static const uint64_t HOT_CALL_FRACTION = 100;
+
+  // Notes a call. The caller is null for calls from outside the module.
+  void noteCall(Name caller, Name callee) {
+    functionCounts[callee]++;
+    if (caller.is()) {
+      callCounts[caller][callee]++;
+    }
+    totalCalls++;
+  }
+
+  uint64_t getCount(Name func) const {
+    auto iter = functionCounts.find(func);
+    return iter == functionCounts.end() ? 0 : iter->second;
+  }
+
+  uint64_t getCallCount(Name caller, Name callee) const {
+    auto iter = callCounts.find(caller);
+    if (iter == callCounts.end()) {
+      return 0;
+    }
+    auto calleeIter = iter->second.find(callee);
+    return calleeIter == iter->second.end() ? 0 : calleeIter->second;
+  }
+
+  // A function that was never called in the profile is cold.
+  bool isCold(Name func) const { return getCount(func) == 0; }
+
+  bool isHotCall(Name caller, Name callee) const {
+    auto count = getCallCount(caller, callee);
+    return count > 0 && count * HOT_CALL_FRACTION >= totalCalls;
+  }
+
+  void read(const std::string& text) {
+    for (auto& line : String::Split(String::trim(text), "\n")) {
+      if (line.empty()) {
+        continue;
+      }
+      String::Split fields(line, "\t");
+      if (fields.size() != 2 && fields.size() != 3) {
+        Fatal() << "invalid profile line: " << line;
+      }
+      char* end;
+      uint64_t count = strtoull(fields[0].c_str(), &end, 10);
+      if (fields[0].empty() || *end) {
+        Fatal() << "invalid profile count: " << fields[0];
+      }
+      if (fields.size() == 2) {
+        functionCounts[fields[1]] += count;
+        totalCalls += count;
+      } else {
+        callCounts[fields[1]][fields[2]] += count;
+      }
+    }
+  }
+
+  // Writes the profile, with the entries sorted by name.
+  void write(std::ostream& o) const {
+    std::vector<Name> names;
+    for (auto& pair : functionCounts) {
+      names.push_back(pair.first);
+    }
+    std::sort(names.begin(), names.end());
+    for (auto name : names) {
+      o << getCount(name) << '\t' << name.str << '\n';
+    }
+    names.clear();
+    for (auto& pair : callCounts) {
+      names.push_back(pair.first);
+    }
+    std::sort(names.begin(), names.end());
+    for (auto caller : names) {
+      std::vector<Name> callees;
+      for (auto& pair : callCounts.at(caller)) {
+        callees.push_back(pair.first);
+      }
+      std::sort(callees.begin(), callees.end());
+      for (auto callee : callees) {
+        o << getCallCount(caller, callee) << '\t' << caller.str << '\t'
+          << callee.str << '\n';
+      }
+    }
+  }
+
+  // Returns the profile given in the pass arguments, if there is one. This is
+  // defined out of line so that the interpreter, which writes profiles, does
+  // not depend on pass.h.
+  static std::unique_ptr<Profile> fromOptions(PassOptions& options);
+};
+
+} // namespace wasm
+
+#endif // wasm_ir_profile_h
@@ -2027,6 +2027,8 @@ function wrapModule(module, self) {
       return Module['_BinaryenRemoveFunctionType'](module, strToStack(name));
     });
   };
+  // 'body' must not reuse expressions from another function's body (see
+  // getFunctionInfo); build a new tree instead.
   self['addFunction'] = function(name, functionType, varTypes, body) {
     return preserveStack(function() {
       return Module['_BinaryenAddFunction'](module, strToStack(name), functionType, i32sToStack(varTypes), varTypes.length, body);
@@ -2037,6 +2039,7 @@ function wrapModule(module, self) {
       return Module['_BinaryenGetFunction'](module, strToStack(name));
     });
   };
+  // Expressions from the removed function's body must no longer be used.
   self['removeFunction'] = function(name) {
     return preserveStack(function() {
       return Module['_BinaryenRemoveFunction'](module, strToStack(name));
@@ -2707,7 +2710,9 @@ Module['getFunctionTypeInfo'] = function(func) {
   };
 };
 
-// Obtains information about a 'Function'
+// Obtains information about a 'Function'. The expressions in 'body' belong to
+// that function and must not be moved into another one: optimizing it may
+// allocate them in storage that is freed when the function is removed.
 Module['getFunctionInfo'] = function(func) {
   return {
     'name': UTF8ToString(Module['_BinaryenFunctionGetName'](func)),
@@ -91,6 +91,27 @@ public:
 
   inline static Literal makeZero(Type type) { return makeFromInt32(0, type); }
 
+  // The bits of a value of any type but v128, in 8 bytes, and the inverse.
+  // This lets a value be stored compactly where its type is known from
+  // elsewhere, like the type of a local.
+  uint64_t getScalarBits() const {
+    assert(type != Type::v128);
+    if (type == Type::i32 || type == Type::f32) {
+      return uint32_t(i32);
+    }
+    return uint64_t(i64);
+  }
+  inline static Literal makeFromScalarBits(uint64_t bits, Type type) {
+    assert(type != Type::v128);
+    Literal ret(type);
+    if (type == Type::i32 || type == Type::f32) {
+      ret.i32 = int32_t(bits);
+    } else {
+      ret.i64 = int64_t(bits);
+    }
+    return ret;
+  }
+
   Literal castToF32();
   Literal castToF64();
   Literal castToI32();
@@ -17,6 +17,7 @@
 #ifndef wasm_mixed_arena_h
 #define wasm_mixed_arena_h
 
+#include <algorithm>
 #include <atomic>
 #include <cassert>
 #include <memory>
@@ -57,18 +58,29 @@
 // a MixedArena, no matter which thread you are on. Allocations will
 // of course be fastest on the original thread for the arena.
 //
+// Function-parallel passes avoid that by redirecting the allocations through
+// the module's arena to the arena of the function they are working on (see
+// MixedArena::Redirect), which only one thread uses at a time. That keeps the
+// nodes of a function together, and frees them when the function is removed.
+//
 
 struct MixedArena {
   // fast bump allocation
 
   static const size_t CHUNK_SIZE = 32768;
+  static const size_t MIN_CHUNK_SIZE = 1024;
   static const size_t MAX_ALIGN = 16; // allow 128bit SIMD
 
-  // Each pointer in chunks is to a multiple of CHUNK_SIZE - typically 1,
-  // but possibly more.
+  // Each pointer in chunks is to a chunk of at least MIN_CHUNK_SIZE bytes -
+  // typically CHUNK_SIZE, but possibly more.
   std::vector<void*> chunks;
 
-  size_t index = 0; // in last chunk
+  size_t index = 0;     // in last chunk
+  size_t chunkSize = 0; // of last chunk
+
+  // Arenas that are likely to stay small, like those of functions, can start
+  // with small chunks, which double in size up to CHUNK_SIZE.
+  size_t nextChunkSize;
 
   std::thread::id threadId;
 
@@ -77,13 +89,40 @@ struct MixedArena {
   // list of next, adding an allocator if necessary
   std::atomic<MixedArena*> next;
 
-  MixedArena() {
+  MixedArena(size_t initialChunkSize = CHUNK_SIZE)
+    : nextChunkSize(initialChunkSize) {
     threadId = std::this_thread::get_id();
     next.store(nullptr);
   }
 
+  // While one of these exists, allocations on the current thread through the
+  // arena 'from' are performed in the arena 'to' instead, without any thread
+  // checks, so 'to' must not be used by other threads meanwhile. The node
+  // that is allocated still refers to 'from', so the arena vectors in it
+  // allocate through 'from' later, wherever that is redirected to then.
+  struct Redirect {
+    MixedArena* from;
+    MixedArena* to;
+    Redirect* previous;
+
+    Redirect(MixedArena& from, MixedArena& to)
+      : from(&from), to(&to), previous(get()) {
+      get() = this;
+    }
+    ~Redirect() { get() = previous; }
+
+    static Redirect*& get() {
+      static thread_local Redirect* curr = nullptr;
+      return curr;
+    }
+  };
+
   // Allocate an amount of space with a guaranteed alignment
   void* allocSpace(size_t size, size_t align) {
+    auto* redirect = Redirect::get();
+    if (redirect && redirect->from == this) {
+      return redirect->to->bumpAllocSpace(size, align);
+    }
     // the bump allocator data should not be modified by multiple threads at
     // once.
     auto myId = std::this_thread::get_id();
@@ -118,19 +157,27 @@ struct MixedArena {
       }
       return curr->allocSpace(size, align);
     }
+    return bumpAllocSpace(size, align);
+  }
+
+  // Allocate in this arena, which must only be used by the current thread.
+  void* bumpAllocSpace(size_t size, size_t align) {
     // First, move the current index in the last chunk to an aligned position.
     index = (index + align - 1) & (-align);
-    if (index + size > CHUNK_SIZE || chunks.size() == 0) {
+    if (index + size > chunkSize || chunks.size() == 0) {
       // Allocate a new chunk.
-      auto numChunks = (size + CHUNK_SIZE - 1) / CHUNK_SIZE;
-      assert(size <= numChunks * CHUNK_SIZE);
-      auto* allocation =
-        wasm::aligned_malloc(MAX_ALIGN, numChunks * CHUNK_SIZE);
+      auto newChunkSize = nextChunkSize;
+      if (size > newChunkSize) {
+        newChunkSize = (size + CHUNK_SIZE - 1) / CHUNK_SIZE * CHUNK_SIZE;
+      }
+      auto* allocation = wasm::aligned_malloc(MAX_ALIGN, newChunkSize);
       if (!allocation) {
         abort();
       }
       chunks.push_back(allocation);
       index = 0;
+      chunkSize = newChunkSize;
+      nextChunkSize = std::min(nextChunkSize * 2, size_t(CHUNK_SIZE));
     }
     uint8_t* ret = static_cast<uint8_t*>(chunks.back());
     ret += index;
@@ -148,6 +195,18 @@ struct MixedArena {
     return ret;
   }
 
+  // Exchanges the memory of two arenas, including the side arenas of other
+  // threads. Must not be called while other threads may allocate.
+  void swap(MixedArena& other) {
+    chunks.swap(other.chunks);
+    std::swap(index, other.index);
+    std::swap(chunkSize, other.chunkSize);
+    std::swap(nextChunkSize, other.nextChunkSize);
+    auto* otherNext = other.next.load();
+    other.next.store(next.load());
+    next.store(otherNext);
+  }
+
   void clear() {
     for (auto* chunk : chunks) {
       wasm::aligned_free(chunk);
@@ -247,6 +247,23 @@
 //      an unwind/rewind in an invalid place (this can be helpful for manual
 //      tweaking of the whitelist/blacklist).
 //
+//  --pass-arg=asyncify-report@file.json
+//
+//      Writes a JSON report to the given file, with an entry for each
+//      function: whether it was instrumented, and if so why (the chain of
+//      calls that leads to something that can unwind), how many locals
+//      it saves and restores, and its code size in bytes before and after
+//      the pass. This is useful for deciding what to put in the whitelist
+//      or blacklist.
+//
+//  --pass-arg=asyncify-profile
+//
+//      Calls the imports asyncify-profile.unwind and asyncify-profile.rewind
+//      with the function's index in the report whenever an instrumented
+//      function unwinds or rewinds, so that the host (or wasm-shell, which
+//      prints them) can count how often that happens. Instrumentation that
+//      never runs is a candidate for the blacklist.
+//
 // TODO When wasm has GC, extending the live ranges of locals can keep things
 //      alive unnecessarily. We may want to set locals to null at the end
 //      of their original range.
@@ -261,7 +278,9 @@
 #include "pass.h"
 #include "support/file.h"
 #include "support/string.h"
+#include "wasm-binary.h"
 #include "wasm-builder.h"
+#include "wasm-stack.h"
 #include "wasm.h"
 
 namespace wasm {
@@ -282,6 +301,11 @@ static const Name START_REWIND = "start_rewind";
 static const Name STOP_REWIND = "stop_rewind";
 static const Name ASYNCIFY_GET_CALL_INDEX = "__asyncify_get_call_index";
 static const Name ASYNCIFY_CHECK_CALL_INDEX = "__asyncify_check_call_index";
+static const Name ASYNCIFY_PROFILE = "asyncify-profile";
+static const Name UNWIND = "unwind";
+static const Name REWIND = "rewind";
+static const Name ASYNCIFY_PROFILE_UNWIND = "__asyncify_profile_unwind";
+static const Name ASYNCIFY_PROFILE_REWIND = "__asyncify_profile_rewind";
 
 // TODO: having just normal/unwind_or_rewind would decrease code
 //       size, but make debugging harder
@@ -420,6 +444,16 @@ class ModuleAnalyzer {
     // that call it are instrumented. This is not done for the bottom.
     bool isTopMostRuntime = false;
     bool inBlacklist = false;
+    bool inWhitelist = false;
+    // If this function can change the state by itself (and not because of
+    // what it calls), why: an unwinding import, or an indirect call.
+    std::string directReason;
+    // The index of this function among the defined functions in the module.
+    Index index = 0;
+    // How many locals are saved and restored on unwinding and rewinding,
+    // and their total size in bytes.
+    Index savedLocals = 0;
+    Index savedLocalsSize = 0;
   };
 
   typedef std::map<Function*, Info> Map;
@@ -453,6 +487,10 @@ public:
             info.canChangeState =
               canImportChangeState(func->module, func->base);
           }
+          if (info.canChangeState) {
+            info.directReason =
+              std::string(func->module.str) + '.' + func->base.str;
+          }
           return;
         }
         struct Walker : PostWalker<Walker> {
@@ -467,6 +505,7 @@ public:
                 curr->target = ASYNCIFY_START_UNWIND;
                 info->canChangeState = true;
                 info->isTopMostRuntime = true;
+                info->directReason = "asyncify.start_unwind";
               } else if (target->base == STOP_UNWIND) {
                 curr->target = ASYNCIFY_STOP_UNWIND;
                 info->isBottomMostRuntime = true;
@@ -477,6 +516,7 @@ public:
                 curr->target = ASYNCIFY_STOP_REWIND;
                 info->canChangeState = true;
                 info->isTopMostRuntime = true;
+                info->directReason = "asyncify.stop_rewind";
               } else {
                 Fatal() << "call to unidenfied asyncify import: "
                         << target->base;
@@ -489,6 +529,7 @@ public:
             }
             if (canIndirectChangeState) {
               info->canChangeState = true;
+              info->directReason = "(indirect call)";
             }
             // TODO optimize the other case, at least by type
           }
@@ -557,11 +598,17 @@ public:
       // Only the functions in the whitelist can change the state.
       for (auto& func : module.functions) {
         if (!func->imported()) {
-          map[func.get()].canChangeState = whitelist.match(func->name);
+          auto& info = map[func.get()];
+          info.inWhitelist = whitelist.match(func->name);
+          info.canChangeState = info.inWhitelist;
         }
       }
     }
 
+    Index index = 0;
+    ModuleUtils::iterDefinedFunctions(
+      module, [&](Function* func) { map[func].index = index++; });
+
     blacklist.checkPatternsMatches();
     whitelist.checkPatternsMatches();
   }
@@ -571,59 +618,178 @@ public:
     return info.canChangeState && !info.isTopMostRuntime;
   }
 
-  bool canChangeState(Expression* curr) {
-    // Look inside to see if we call any of the things we know can change the
-    // state.
-    // TODO: caching, this is O(N^2)
-    struct Walker : PostWalker<Walker> {
-      void visitCall(Call* curr) {
-        // We only implement these at the very end, but we know that they
-        // definitely change the state.
-        if (curr->target == ASYNCIFY_START_UNWIND ||
-            curr->target == ASYNCIFY_STOP_REWIND ||
-            curr->target == ASYNCIFY_GET_CALL_INDEX ||
-            curr->target == ASYNCIFY_CHECK_CALL_INDEX) {
-          canChangeState = true;
-          return;
-        }
-        if (curr->target == ASYNCIFY_STOP_UNWIND ||
-            curr->target == ASYNCIFY_START_REWIND) {
-          isBottomMostRuntime = true;
-          return;
-        }
-        // The target may not exist if it is one of our temporary intrinsics.
-        auto* target = module->getFunctionOrNull(curr->target);
-        if (target && (*map)[target].canChangeState) {
-          canChangeState = true;
-        }
+  Index getIndex(Function* func) { return map[func].index; }
+
+  Index getSavedLocals(Function* func) { return map[func].savedLocals; }
+
+  Index getSavedLocalsSize(Function* func) {
+    return map[func].savedLocalsSize;
+  }
+
+  void noteSavedLocals(Function* func, Index num, Index size) {
+    auto& info = map[func];
+    info.savedLocals = num;
+    info.savedLocalsSize = size;
+  }
+
+  // Returns why a function can change the state: the chain of calls from it
+  // to something that changes the state directly, ending with a description
+  // of that.
+  std::vector<std::string> getReason(Function* func) {
+    if (reasonCallees.empty()) {
+      computeReasonCallees();
+    }
+    std::vector<std::string> reason;
+    auto& info = map[func];
+    if (!info.canChangeState) {
+      return reason;
+    }
+    if (info.inWhitelist) {
+      reason.push_back("(whitelist)");
+      return reason;
+    }
+    while (1) {
+      auto& curr = map[func];
+      if (!curr.directReason.empty()) {
+        reason.push_back(curr.directReason);
+        return reason;
       }
-      void visitCallIndirect(CallIndirect* curr) {
-        if (canIndirectChangeState) {
-          canChangeState = true;
-        }
-        // TODO optimize the other case, at least by type
+      auto iter = reasonCallees.find(func);
+      if (iter == reasonCallees.end()) {
+        return reason;
+      }
+      func = iter->second;
+      if (!func->imported()) {
+        reason.push_back(func->name.str);
+      }
+    }
+  }
+
+  // What a single expression (ignoring its children) does to the state.
+  enum StateEffect : uint8_t {
+    NoStateEffect = 0,
+    // It can change the state.
+    ChangesState = 1 << 0,
+    // It is a call into the bottom-most runtime.
+    BottomMostRuntime = 1 << 1
+  };
+
+  uint8_t getStateEffect(Expression* curr) {
+    if (auto* call = curr->dynCast<Call>()) {
+      // We only implement these at the very end, but we know that they
+      // definitely change the state.
+      if (call->target == ASYNCIFY_START_UNWIND ||
+          call->target == ASYNCIFY_STOP_REWIND ||
+          call->target == ASYNCIFY_GET_CALL_INDEX ||
+          call->target == ASYNCIFY_CHECK_CALL_INDEX) {
+        return ChangesState;
+      }
+      if (call->target == ASYNCIFY_STOP_UNWIND ||
+          call->target == ASYNCIFY_START_REWIND) {
+        return BottomMostRuntime;
       }
-      Module* module;
+      // The target may not exist if it is one of our temporary intrinsics.
+      auto* target = module.getFunctionOrNull(call->target);
+      if (target && map[target].canChangeState) {
+        return ChangesState;
+      }
+    } else if (curr->is<CallIndirect>()) {
+      if (canIndirectChangeState) {
+        return ChangesState;
+      }
+      // TODO optimize the other case, at least by type
+    }
+    return NoStateEffect;
+  }
+
+  static bool canChangeState(uint8_t effects) {
+    return (effects & ChangesState) && !(effects & BottomMostRuntime);
+  }
+
+  // Look inside to see if we call any of the things we know can change the
+  // state. This walks the entire subtree; when many nested subtrees are
+  // queried, use a CanChangeStateCache instead.
+  bool canChangeState(Expression* curr) {
+    struct Walker
+      : public PostWalker<Walker, UnifiedExpressionVisitor<Walker>> {
       ModuleAnalyzer* analyzer;
-      Map* map;
-      bool canIndirectChangeState;
-      bool canChangeState = false;
-      bool isBottomMostRuntime = false;
+      uint8_t effects = NoStateEffect;
+
+      void visitExpression(Expression* curr) {
+        effects |= analyzer->getStateEffect(curr);
+      }
     };
     Walker walker;
-    walker.module = &module;
     walker.analyzer = this;
-    walker.map = &map;
-    walker.canIndirectChangeState = canIndirectChangeState;
     walker.walk(curr);
-    if (walker.isBottomMostRuntime) {
-      walker.canChangeState = false;
-    }
-    return walker.canChangeState;
+    return canChangeState(walker.effects);
   }
 
+  // Answers canChangeState() for all the expressions in a tree, which is
+  // computed once for the entire tree in linear time.
+  struct CanChangeStateCache
+    : public ExpressionStackWalker<
+        CanChangeStateCache,
+        UnifiedExpressionVisitor<CanChangeStateCache>> {
+    ModuleAnalyzer* analyzer;
+    // The effects of each expression including its children.
+    std::unordered_map<Expression*, uint8_t> effects;
+
+    CanChangeStateCache(ModuleAnalyzer* analyzer, Expression* root)
+      : analyzer(analyzer) {
+      walk(root);
+    }
+
+    void visitExpression(Expression* curr) {
+      // Our children were visited before us, and already added their effects
+      // to ours.
+      auto currEffects = (effects[curr] |= analyzer->getStateEffect(curr));
+      if (expressionStack.size() > 1) {
+        auto* parent = expressionStack[expressionStack.size() - 2];
+        effects[parent] |= currEffects;
+      }
+    }
+
+    bool canChangeState(Expression* curr) {
+      auto iter = effects.find(curr);
+      if (iter == effects.end()) {
+        // This was not in the original tree.
+        return analyzer->canChangeState(curr);
+      }
+      return ModuleAnalyzer::canChangeState(iter->second);
+    }
+  };
+
   GlobalHelper globals;
   bool asserts;
+  bool profile = false;
+
+private:
+  // For each function that can change the state because of what it calls,
+  // one of those callees, on a shortest path to something that changes the
+  // state directly.
+  std::unordered_map<Function*, Function*> reasonCallees;
+
+  void computeReasonCallees() {
+    // Search backwards from the functions that change the state directly.
+    std::vector<Function*> work;
+    std::unordered_set<Function*> seen;
+    for (auto& pair : map) {
+      if (pair.second.canChangeState && !pair.second.directReason.empty()) {
+        work.push_back(pair.first);
+        seen.insert(pair.first);
+      }
+    }
+    for (size_t i = 0; i < work.size(); i++) {
+      auto* func = work[i];
+      for (auto* caller : map[func].calledBy) {
+        if (map[caller].canChangeState && seen.insert(caller).second) {
+          reasonCallees[caller] = func;
+          work.push_back(caller);
+        }
+      }
+    }
+  }
 };
 
 // Checks if something performs a call: either a direct or indirect call,
@@ -698,6 +864,10 @@ struct AsyncifyFlow : public Pass {
       }
       return;
     }
+    // We query every level of the tree as we process it, so compute all the
+    // answers ahead of time.
+    ModuleAnalyzer::CanChangeStateCache cache(analyzer, func->body);
+    canChangeStateCache = &cache;
     // Rewrite the function body.
     // Each function we enter will pop one from the stack, which is the index
     // of the next call to make.
@@ -723,12 +893,18 @@ private:
   Module* module;
   Function* func;
 
+  ModuleAnalyzer::CanChangeStateCache* canChangeStateCache;
+
   // Each call in the function has an index, noted during unwind and checked
   // during rewind.
   Index callIndex = 0;
 
+  bool canChangeState(Expression* curr) {
+    return canChangeStateCache->canChangeState(curr);
+  }
+
   Expression* process(Expression* curr) {
-    if (!analyzer->canChangeState(curr)) {
+    if (!canChangeState(curr)) {
       return makeMaybeSkip(curr);
     }
     // The IR is in flat form, which makes this much simpler: there are no
@@ -770,12 +946,12 @@ private:
       Index i = 0;
       auto& list = block->list;
       while (i < list.size()) {
-        if (analyzer->canChangeState(list[i])) {
+        if (canChangeState(list[i])) {
           list[i] = process(list[i]);
           i++;
         } else {
           Index end = i + 1;
-          while (end < list.size() && !analyzer->canChangeState(list[end])) {
+          while (end < list.size() && !canChangeState(list[end])) {
             end++;
           }
           // We have a range of [i, end) in which the state cannot change,
@@ -800,7 +976,7 @@ private:
     } else if (auto* iff = curr->dynCast<If>()) {
       // The state change cannot be in the condition due to flat form, so it
       // must be in one of the children.
-      assert(!analyzer->canChangeState(iff->condition));
+      assert(!canChangeState(iff->condition));
       // We must linearize this, which means we pass through both arms if we
       // are rewinding.
       if (!iff->ifFalse) {
@@ -1054,15 +1230,22 @@ struct AsyncifyLocals : public WalkerPass<PostWalker<AsyncifyLocals>> {
       // reached). The optimizer can remove this anyhow.
       barrier = builder->makeUnreachable();
     }
+    auto* loading = makeLocalLoading();
+    auto* saving = makeLocalSaving();
+    if (analyzer->profile) {
+      loading = builder->makeSequence(makeProfileCall(ASYNCIFY_PROFILE_REWIND),
+                                      loading);
+      saving = builder->makeSequence(makeProfileCall(ASYNCIFY_PROFILE_UNWIND),
+                                     saving);
+    }
     auto* newBody = builder->makeBlock(
-      {builder->makeIf(builder->makeStateCheck(State::Rewinding),
-                       makeLocalLoading()),
+      {builder->makeIf(builder->makeStateCheck(State::Rewinding), loading),
        builder->makeLocalSet(
          unwindIndex,
          builder->makeBlock(ASYNCIFY_UNWIND,
                             builder->makeSequence(func->body, barrier))),
        makeCallIndexPush(unwindIndex),
-       makeLocalSaving()});
+       saving});
     if (func->result != none) {
       // If we unwind, we must still "return" a value, even if it will be
       // ignored on the outside.
@@ -1082,6 +1265,13 @@ private:
   Index numPreservableLocals;
   std::map<Type, Index> fakeCallLocals;
 
+  Expression* makeProfileCall(Name target) {
+    return builder->makeCall(
+      target,
+      {builder->makeConst(Literal(int32_t(analyzer->getIndex(getFunction()))))},
+      none);
+  }
+
   Expression* makeLocalLoading() {
     if (numPreservableLocals == 0) {
       return builder->makeNop();
@@ -1093,6 +1283,7 @@ private:
       auto size = getTypeSize(type);
       total += size;
     }
+    analyzer->noteSavedLocals(func, numPreservableLocals, total);
     auto* block = builder->makeBlock();
     block->list.push_back(builder->makeIncStackPos(-total));
     auto tempIndex = builder->addVar(func, i32);
@@ -1166,6 +1357,24 @@ static std::string getFullImportName(Name module, Name base) {
   return std::string(module.str) + '.' + base.str;
 }
 
+// Quotes a string for the JSON report. Names may contain any character.
+static std::string quoteJSON(const std::string& str) {
+  std::string ret = "\"";
+  for (unsigned char c : str) {
+    if (c == '"' || c == '\\') {
+      ret += '\\';
+      ret += c;
+    } else if (c < 0x20) {
+      char buffer[7];
+      snprintf(buffer, sizeof(buffer), "\\u%04x", c);
+      ret += buffer;
+    } else {
+      ret += c;
+    }
+  }
+  return ret + '"';
+}
+
 struct Asyncify : public Pass {
   void run(PassRunner* runner, Module* module) override {
     bool optimize = runner->options.optimizeLevel > 0;
@@ -1193,6 +1402,10 @@ struct Asyncify : public Pass {
       ",");
     auto asserts =
       runner->options.getArgumentOrDefault("asyncify-asserts", "") != "";
+    auto reportFile =
+      runner->options.getArgumentOrDefault("asyncify-report", "");
+    auto profile =
+      runner->options.getArgumentOrDefault("asyncify-profile", "") != "";
 
     blacklist = handleBracketingOperators(blacklist);
     whitelist = handleBracketingOperators(whitelist);
@@ -1222,9 +1435,18 @@ struct Asyncify : public Pass {
                             blacklist,
                             whitelist,
                             asserts);
+    analyzer.profile = profile;
+
+    std::map<Name, size_t> sizesBefore;
+    if (!reportFile.empty()) {
+      sizesBefore = getFunctionSizes(module);
+    }
 
     // Add necessary globals before we emit code to use them.
     addGlobals(module);
+    if (profile) {
+      addProfileImports(module);
+    }
 
     // Instrument the flow of code, adding code instrumentation and
     // skips for when rewinding. We do this on flat IR so that it is
@@ -1275,9 +1497,80 @@ struct Asyncify : public Pass {
     // Finally, add function support (that should not have been seen by
     // the previous passes).
     addFunctions(module);
+
+    if (!reportFile.empty()) {
+      writeReport(module, analyzer, sizesBefore, reportFile);
+    }
   }
 
 private:
+  void addProfileImports(Module* module) {
+    for (auto& pair : {std::make_pair(ASYNCIFY_PROFILE_UNWIND, UNWIND),
+                       std::make_pair(ASYNCIFY_PROFILE_REWIND, REWIND)}) {
+      auto* func = new Function;
+      func->name = pair.first;
+      func->module = ASYNCIFY_PROFILE;
+      func->base = pair.second;
+      func->params.push_back(i32);
+      func->result = none;
+      module->addFunction(func);
+    }
+  }
+
+  // Returns the size in bytes of the binary code of each defined function.
+  static std::map<Name, size_t> getFunctionSizes(Module* module) {
+    std::map<Name, size_t> sizes;
+    BufferWithRandomAccess unused;
+    WasmBinaryWriter writer(module, unused);
+    ModuleUtils::iterDefinedFunctions(*module, [&](Function* func) {
+      BufferWithRandomAccess buffer;
+      BinaryenIRToBinaryWriter(writer, buffer, func).write();
+      sizes[func->name] = buffer.size();
+    });
+    return sizes;
+  }
+
+  void writeReport(Module* module,
+                   ModuleAnalyzer& analyzer,
+                   std::map<Name, size_t>& sizesBefore,
+                   std::string reportFile) {
+    auto sizesAfter = getFunctionSizes(module);
+    Output output(reportFile, Flags::Text, Flags::Release);
+    auto& o = output.getStream();
+    o << "{\n  \"functions\": [";
+    bool first = true;
+    ModuleUtils::iterDefinedFunctions(*module, [&](Function* func) {
+      // Skip the functions we added.
+      if (!sizesBefore.count(func->name)) {
+        return;
+      }
+      o << (first ? "" : ",") << "\n    {\n";
+      first = false;
+      o << "      \"name\": " << quoteJSON(func->name.str) << ",\n";
+      o << "      \"index\": " << analyzer.getIndex(func) << ",\n";
+      bool instrumented = analyzer.needsInstrumentation(func);
+      o << "      \"instrumented\": " << (instrumented ? "true" : "false")
+        << ",\n";
+      o << "      \"reason\": [";
+      if (instrumented) {
+        bool firstReason = true;
+        for (auto& reason : analyzer.getReason(func)) {
+          o << (firstReason ? "" : ", ") << quoteJSON(reason);
+          firstReason = false;
+        }
+      }
+      o << "],\n";
+      o << "      \"savedLocals\": " << analyzer.getSavedLocals(func)
+        << ",\n";
+      o << "      \"savedLocalsSize\": " << analyzer.getSavedLocalsSize(func)
+        << ",\n";
+      o << "      \"sizeBefore\": " << sizesBefore[func->name] << ",\n";
+      o << "      \"sizeAfter\": " << sizesAfter[func->name] << "\n";
+      o << "    }";
+    });
+    o << "\n  ]\n}\n";
+  }
+
   void addGlobals(Module* module) {
     Builder builder(*module);
     module->addGlobal(builder.makeGlobal(ASYNCIFY_STATE,
@@ -21,6 +21,7 @@
 //
 
 #include <algorithm>
+#include <map>
 #include <memory>
 #include <unordered_set>
 
@@ -37,6 +38,75 @@
 
 namespace wasm {
 
+// The most memory to use for interference matrices when building them in
+// parallel.
+static const size_t MAX_PARALLEL_INTERFERENCE_BYTES = 256 * 1024 * 1024;
+
+// Functions with at least this many locals pick their indices in parallel.
+static const Index MIN_PARALLEL_LOCALS = 1000;
+
+// Interferences as a list, for each local, of the locals it interferes with,
+// for functions with too many locals for a matrix. While we add to them, the
+// lists only have the higher locals, and may have duplicates.
+struct InterferenceLists {
+  std::vector<std::vector<Index>> lists;
+  // the size of each list when we last removed duplicates from it
+  std::vector<size_t> uniqueSizes;
+
+  void reset(Index numLocals) {
+    lists.clear();
+    lists.resize(numLocals);
+    uniqueSizes.clear();
+    uniqueSizes.resize(numLocals);
+  }
+
+  void add(Index low, Index high) {
+    auto& list = lists[low];
+    list.push_back(high);
+    if (list.size() >= 2 * uniqueSizes[low] + 16) {
+      removeDuplicates(low);
+    }
+  }
+
+  void add(InterferenceLists& other) {
+    for (Index i = 0; i < other.lists.size(); i++) {
+      for (auto j : other.lists[i]) {
+        add(i, j);
+      }
+    }
+  }
+
+  void removeDuplicates(Index i) {
+    auto& list = lists[i];
+    std::sort(list.begin(), list.end());
+    list.erase(std::unique(list.begin(), list.end()), list.end());
+    uniqueSizes[i] = list.size();
+  }
+
+  // Removes the duplicates and adds each interference to the list of the
+  // higher local too, leaving each list sorted.
+  void finish() {
+    std::vector<std::vector<Index>> full(lists.size());
+    for (Index i = 0; i < lists.size(); i++) {
+      removeDuplicates(i);
+      // full[i] has the lower locals so far, in order, and these are higher
+      auto& list = lists[i];
+      full[i].insert(full[i].end(), list.begin(), list.end());
+      for (auto j : list) {
+        full[j].push_back(i);
+      }
+      std::vector<Index>().swap(list);
+    }
+    lists.swap(full);
+    uniqueSizes.clear();
+  }
+
+  bool has(Index i, Index j) {
+    auto& list = lists[i];
+    return std::binary_search(list.begin(), list.end(), j);
+  }
+};
+
 struct CoalesceLocals
   : public WalkerPass<LivenessWalker<CoalesceLocals, Visitor<CoalesceLocals>>> {
   bool isFunctionParallel() override { return true; }
@@ -53,11 +123,18 @@ struct CoalesceLocals
 
   void calculateInterferences(const SetOfLocals& locals);
 
+  // Finds the interferences in a block, calling note(i, j) for each. Only the
+  // block is modified, so blocks can be scanned in parallel.
+  template<typename T> void calculateInterferences(BasicBlock* block, T note);
+
   void pickIndicesFromOrder(std::vector<Index>& order,
                             std::vector<Index>& indices);
   void pickIndicesFromOrder(std::vector<Index>& order,
                             std::vector<Index>& indices,
                             Index& removedCopies);
+  void pickIndicesFromOrderSparse(std::vector<Index>& order,
+                                  std::vector<Index>& indices,
+                                  Index& removedCopies);
 
   // returns a vector of oldIndex => newIndex
   virtual void pickIndices(std::vector<Index>& indices);
@@ -68,25 +145,33 @@ struct CoalesceLocals
 
   // canonicalized - accesses should check (low, high)
   std::vector<bool> interferences;
+  // the same, when sparse
+  InterferenceLists interferenceLists;
+
+  // when sparse, the locals each local has copies with, and how many
+  std::vector<std::vector<std::pair<Index, uint8_t>>> copyLists;
 
   void interfere(Index i, Index j) {
     if (i == j) {
       return;
     }
-    interferences[std::min(i, j) * numLocals + std::max(i, j)] = 1;
+    interfereLowHigh(std::min(i, j), std::max(i, j));
   }
 
   // optimized version where you know that low < high
   void interfereLowHigh(Index low, Index high) {
     assert(low < high);
-    interferences[low * numLocals + high] = 1;
-  }
-
-  void unInterfere(Index i, Index j) {
-    interferences[std::min(i, j) * numLocals + std::max(i, j)] = 0;
+    if (isSparse()) {
+      interferenceLists.add(low, high);
+    } else {
+      interferences[low * numLocals + high] = 1;
+    }
   }
 
   bool interferes(Index i, Index j) {
+    if (isSparse()) {
+      return interferenceLists.has(i, j);
+    }
     return interferences[std::min(i, j) * numLocals + std::max(i, j)];
   }
 };
@@ -97,6 +182,15 @@ void CoalesceLocals::doWalkFunction(Function* func) {
   increaseBackEdgePriorities();
   // use liveness to find interference
   calculateInterferences();
+  if (isSparse()) {
+    copyLists.clear();
+    copyLists.resize(numLocals);
+    for (auto& pair : sparseCopies) {
+      Index low = pair.first >> 32, high = Index(pair.first);
+      copyLists[low].emplace_back(high, pair.second);
+      copyLists[high].emplace_back(low, pair.second);
+    }
+  }
   // pick new indices
   std::vector<Index> indices;
   pickIndices(indices);
@@ -132,32 +226,102 @@ void CoalesceLocals::increaseBackEdgePriorities() {
   }
 }
 
+template<typename T>
+void CoalesceLocals::calculateInterferences(BasicBlock* block, T note) {
+  // Two locals interfere if they are both live at some point. On any path
+  // from the entry to that point, the one that was set last is live right
+  // after that set, and so is the other one (unless neither was set, and both
+  // are live at the entry, which the caller handles). So it is enough to note
+  // interferences at the sets that are not dead, which is much less work than
+  // noting all the pairs of locals that are live at the end of each block.
+  auto live = block->contents.end;
+  auto& actions = block->contents.actions;
+  for (int i = int(actions.size()) - 1; i >= 0; i--) {
+    auto& action = actions[i];
+    auto index = action.index;
+    if (action.isGet()) {
+      live.insert(index);
+    } else {
+      if (live.erase(index)) {
+        action.effective = true;
+        for (auto i : live) {
+          note(i, index);
+        }
+      }
+    }
+  }
+}
+
 void CoalesceLocals::calculateInterferences() {
-  interferences.resize(numLocals * numLocals);
-  std::fill(interferences.begin(), interferences.end(), false);
+  if (isSparse()) {
+    interferences.clear();
+    interferenceLists.reset(numLocals);
+  } else {
+    interferences.resize(numLocals * numLocals);
+    std::fill(interferences.begin(), interferences.end(), false);
+  }
+  std::vector<BasicBlock*> blocks;
   for (auto& curr : basicBlocks) {
     if (liveBlocks.count(curr.get()) == 0) {
       continue; // ignore dead blocks
     }
-    // everything coming in might interfere, as it might come from a different
-    // block
-    auto live = curr->contents.end;
-    calculateInterferences(live);
-    // scan through the block itself
-    auto& actions = curr->contents.actions;
-    for (int i = int(actions.size()) - 1; i >= 0; i--) {
-      auto& action = actions[i];
-      auto index = action.index;
-      if (action.isGet()) {
-        // new live local, interferes with all the rest
-        live.insert(index);
-        for (auto i : live) {
-          interfere(i, index);
-        }
-      } else {
-        if (live.erase(index)) {
-          action.effective = true;
-        }
+    blocks.push_back(curr.get());
+  }
+  // In large functions, scan groups of blocks in parallel. Each group notes
+  // interferences in a matrix of its own, as neighboring bits cannot be
+  // written from different threads, so limit the memory that takes.
+  size_t numGroups = 1;
+  if (blocks.size() >= MIN_PARALLEL_BLOCKS) {
+    size_t matrixBytes = size_t(numLocals) * numLocals / 8 + 1;
+    numGroups = ThreadPool::get()->availableSize();
+    if (!isSparse()) {
+      numGroups =
+        std::min(numGroups, MAX_PARALLEL_INTERFERENCE_BYTES / matrixBytes);
+    }
+  }
+  if (numGroups <= 1) {
+    for (auto* block : blocks) {
+      calculateInterferences(block,
+                             [&](Index i, Index j) { interfere(i, j); });
+    }
+  } else if (isSparse()) {
+    // each group notes interferences in lists of its own
+    std::vector<InterferenceLists> groupLists(numGroups);
+    ThreadPool::get()->runInParallel(numGroups, [&](size_t group) {
+      auto& lists = groupLists[group];
+      lists.reset(numLocals);
+      for (size_t b = group; b < blocks.size(); b += numGroups) {
+        calculateInterferences(blocks[b], [&](Index i, Index j) {
+          if (i != j) {
+            lists.add(std::min(i, j), std::max(i, j));
+          }
+        });
+      }
+    });
+    for (auto& lists : groupLists) {
+      interferenceLists.add(lists);
+    }
+  } else {
+    // the indexes of the bits each group set, to merge them afterwards
+    std::vector<std::vector<size_t>> groupBits(numGroups);
+    ThreadPool::get()->runInParallel(numGroups, [&](size_t group) {
+      std::vector<bool> matrix(size_t(numLocals) * numLocals);
+      auto& bits = groupBits[group];
+      for (size_t b = group; b < blocks.size(); b += numGroups) {
+        calculateInterferences(blocks[b], [&](Index i, Index j) {
+          if (i != j) {
+            auto bit = size_t(std::min(i, j)) * numLocals + std::max(i, j);
+            if (!matrix[bit]) {
+              matrix[bit] = true;
+              bits.push_back(bit);
+            }
+          }
+        });
+      }
+    });
+    for (auto& bits : groupBits) {
+      for (auto bit : bits) {
+        interferences[bit] = true;
       }
     }
   }
@@ -169,6 +333,9 @@ void CoalesceLocals::calculateInterferences() {
     start.insert(i);
   }
   calculateInterferences(start);
+  if (isSparse()) {
+    interferenceLists.finish();
+  }
 }
 
 void CoalesceLocals::calculateInterferences(const SetOfLocals& locals) {
@@ -191,6 +358,10 @@ void CoalesceLocals::pickIndicesFromOrder(std::vector<Index>& order,
 void CoalesceLocals::pickIndicesFromOrder(std::vector<Index>& order,
                                           std::vector<Index>& indices,
                                           Index& removedCopies) {
+  if (isSparse()) {
+    pickIndicesFromOrderSparse(order, indices, removedCopies);
+    return;
+  }
 // mostly-simple greedy coloring
 #if CFG_DEBUG
   std::cerr << "\npickIndicesFromOrder on " << getFunction()->name << '\n';
@@ -294,6 +465,96 @@ void CoalesceLocals::pickIndicesFromOrder(std::vector<Index>& order,
   }
 }
 
+// The same as pickIndicesFromOrder, for when the interferences are sparse.
+// Instead of tracking the interferences and copies of each new index with
+// every local, we look at those of the locals that were already assigned, which
+// takes time proportional to the number of interferences and copies.
+void CoalesceLocals::pickIndicesFromOrderSparse(std::vector<Index>& order,
+                                                std::vector<Index>& indices,
+                                                Index& removedCopies) {
+  auto* func = getFunction();
+  auto numParams = func->getNumParams();
+  indices.resize(numLocals);
+  std::vector<bool> assigned(numLocals);
+  std::vector<Type> types;
+  // the new indices of each type, in increasing order
+  std::map<Type, std::vector<Index>> indicesOfType;
+  // for each new index, the last local we noticed interferes with it, and the
+  // last local we summed the copies with it for
+  std::vector<Index> interferingLocal, copyingLocal;
+  std::vector<uint8_t> newCopies;
+  std::vector<Index> withCopies;
+  Index nextFree = 0;
+  removedCopies = 0;
+  auto addIndex = [&](Type type) {
+    types.push_back(type);
+    indicesOfType[type].push_back(nextFree);
+    interferingLocal.push_back(-1);
+    copyingLocal.push_back(-1);
+    newCopies.push_back(0);
+    return nextFree++;
+  };
+  // we can't reorder parameters, they are fixed in order, and cannot coalesce
+  Index i = 0;
+  for (; i < numParams; i++) {
+    assert(order[i] == i); // order must leave the params in place
+    indices[i] = addIndex(func->getLocalType(i));
+    assigned[i] = true;
+  }
+  for (; i < numLocals; i++) {
+    Index actual = order[i];
+    auto type = func->getLocalType(actual);
+    for (auto j : interferenceLists.lists[actual]) {
+      if (assigned[j]) {
+        interferingLocal[indices[j]] = actual;
+      }
+    }
+    withCopies.clear();
+    for (auto& pair : copyLists[actual]) {
+      if (!assigned[pair.first]) {
+        continue;
+      }
+      auto index = indices[pair.first];
+      if (copyingLocal[index] != actual) {
+        copyingLocal[index] = actual;
+        newCopies[index] = 0;
+        withCopies.push_back(index);
+      }
+      newCopies[index] += pair.second;
+    }
+    // pick the index eliminating the most copies, and the lowest of those
+    Index found = -1;
+    uint8_t foundCopies = 0;
+    for (auto index : withCopies) {
+      if (interferingLocal[index] == actual || types[index] != type) {
+        continue;
+      }
+      auto currCopies = newCopies[index];
+      if (currCopies > foundCopies ||
+          (currCopies == foundCopies && found != Index(-1) && index < found)) {
+        found = index;
+        foundCopies = currCopies;
+      }
+    }
+    if (found == Index(-1)) {
+      for (auto index : indicesOfType[type]) {
+        if (interferingLocal[index] != actual) {
+          found = index;
+          break;
+        }
+      }
+    }
+    if (found == Index(-1)) {
+      found = addIndex(type);
+      removedCopies += getCopies(found, actual);
+    } else {
+      removedCopies += foundCopies;
+    }
+    indices[actual] = found;
+    assigned[actual] = true;
+  }
+}
+
 // given a baseline order, adjust it based on an important order of priorities
 // (higher values are higher priority). The priorities take precedence, unless
 // they are equal and then the original order should be kept.
@@ -327,20 +588,31 @@ void CoalesceLocals::pickIndices(std::vector<Index>& indices) {
   // program may have a natural order of locals inherent in it.
   auto order = makeIdentity(numLocals);
   order = adjustOrderByPriorities(order, adjustedTotalCopies);
-  Index removedCopies;
-  pickIndicesFromOrder(order, indices, removedCopies);
-  auto maxIndex = *std::max_element(indices.begin(), indices.end());
   // next try the reverse order. this both gives us another chance at something
   // good, and also the very naturalness of the simple order may be quite
   // suboptimal
-  setIdentity(order);
+  auto reverseOrder = makeIdentity(numLocals);
   for (Index i = numParams; i < numLocals; i++) {
-    order[i] = numParams + numLocals - 1 - i;
+    reverseOrder[i] = numParams + numLocals - 1 - i;
   }
-  order = adjustOrderByPriorities(order, adjustedTotalCopies);
+  reverseOrder = adjustOrderByPriorities(reverseOrder, adjustedTotalCopies);
+  // with many locals, try both at the same time
+  Index removedCopies, reverseRemovedCopies;
   std::vector<Index> reverseIndices;
-  Index reverseRemovedCopies;
-  pickIndicesFromOrder(order, reverseIndices, reverseRemovedCopies);
+  auto pick = [&](size_t i) {
+    if (i == 0) {
+      pickIndicesFromOrder(order, indices, removedCopies);
+    } else {
+      pickIndicesFromOrder(reverseOrder, reverseIndices, reverseRemovedCopies);
+    }
+  };
+  if (numLocals >= MIN_PARALLEL_LOCALS) {
+    ThreadPool::get()->runInParallel(2, pick);
+  } else {
+    pick(0);
+    pick(1);
+  }
+  auto maxIndex = *std::max_element(indices.begin(), indices.end());
   auto reverseMaxIndex =
     *std::max_element(reverseIndices.begin(), reverseIndices.end());
   // prefer to remove copies foremost, as it matters more for code size (minus
@@ -0,0 +1,103 @@
+/*
+ * Copyright 2019 WebAssembly Community Group participants
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+//
+// Reclaims the memory of dead IR. Arenas never free anything until they are
+// destroyed, so over a long pipeline the nodes that passes removed or
+// replaced pile up, and the live ones end up scattered across chunks. This
+// pass copies each function's live IR into fresh chunks in its own arena, in
+// traversal order, and the rest into fresh chunks in the module's arena, and
+// then frees all the old ones, including those of the side arenas of other
+// threads.
+//
+// This invalidates every pointer to an expression that is held outside of
+// the module, so it must only be run between passes, and not while anyone
+// (like a user of the C API) holds on to an expression. Like any other pass
+// that modifies Binaryen IR, it discards Stack IR.
+//
+
+#include "ir/utils.h"
+#include "pass.h"
+#include "wasm.h"
+
+namespace wasm {
+
+struct CompactArena : public Pass {
+  void run(PassRunner* runner, Module* module) override {
+    // Move everything to a temporary arena, which frees it when we are done.
+    // Note that the existing arena vectors still refer to the module's arena,
+    // but as we only read them from here on, that does not matter.
+    MixedArena old;
+    old.swap(module->allocator);
+
+    std::vector<std::unique_ptr<MixedArena>> oldFunctionArenas;
+    for (auto& func : module->functions) {
+      if (!func->imported()) {
+        oldFunctionArenas.emplace_back(
+          make_unique<MixedArena>(size_t(MixedArena::MIN_CHUNK_SIZE)));
+        oldFunctionArenas.back()->swap(func->arena);
+        MixedArena::Redirect redirect(module->allocator, func->arena);
+        compactFunction(func.get(), module);
+      }
+    }
+    for (auto& global : module->globals) {
+      if (!global->imported()) {
+        global->init = ExpressionManipulator::copy(global->init, *module);
+      }
+    }
+    for (auto& segment : module->table.segments) {
+      segment.offset = ExpressionManipulator::copy(segment.offset, *module);
+    }
+    for (auto& segment : module->memory.segments) {
+      if (!segment.isPassive) {
+        segment.offset = ExpressionManipulator::copy(segment.offset, *module);
+      }
+    }
+  }
+
+  // Lists the expressions in a tree, in a fixed order.
+  struct Lister : public PostWalker<Lister, UnifiedExpressionVisitor<Lister>> {
+    std::vector<Expression*> list;
+
+    void visitExpression(Expression* curr) { list.push_back(curr); }
+  };
+
+  void compactFunction(Function* func, Module* module) {
+    auto* oldBody = func->body;
+    func->body = ExpressionManipulator::copy(oldBody, *module);
+    if (func->debugLocations.empty()) {
+      return;
+    }
+    // The copy has the same structure, so we can map the debug info from the
+    // old nodes to the new ones.
+    Lister oldList, newList;
+    oldList.walk(oldBody);
+    newList.walk(func->body);
+    assert(oldList.list.size() == newList.list.size());
+    PointerMap<Expression*, Function::DebugLocation> debugLocations;
+    for (Index i = 0; i < oldList.list.size(); i++) {
+      auto iter = func->debugLocations.find(oldList.list[i]);
+      if (iter != func->debugLocations.end()) {
+        debugLocations[newList.list[i]] = iter->second;
+      }
+    }
+    func->debugLocations.swap(debugLocations);
+  }
+};
+
+Pass* createCompactArenaPass() { return new CompactArena(); }
+
+} // namespace wasm
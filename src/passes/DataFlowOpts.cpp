@@ -32,10 +32,26 @@
 #include "ir/utils.h"
 #include "pass.h"
 #include "wasm-builder.h"
+#include "wasm-interpreter.h"
 #include "wasm.h"
 
 namespace wasm {
 
+// Evaluates an expression whose children are all constants. This needs no
+// module or function around the expression, unlike running precompute on it.
+class ConstantFolder : public ExpressionRunner<ConstantFolder> {
+public:
+  // In flat IR the children are constants, so that is as deep as we go.
+  ConstantFolder() : ExpressionRunner<ConstantFolder>(2) {}
+
+  // Thrown on a trap, like a division by zero.
+  struct TrapException {};
+
+  Flow visitGlobalGet(GlobalGet* curr) { WASM_UNREACHABLE(); }
+
+  void trap(const char* why) override { throw TrapException(); }
+};
+
 struct DataFlowOpts : public WalkerPass<PostWalker<DataFlowOpts>> {
   bool isFunctionParallel() override { return true; }
 
@@ -44,7 +60,10 @@ struct DataFlowOpts : public WalkerPass<PostWalker<DataFlowOpts>> {
   DataFlow::Users nodeUsers;
 
   // The optimization work left to do: nodes that we need to look at.
-  std::unordered_set<DataFlow::Node*> workLeft;
+  std::vector<DataFlow::Node*> workLeft;
+
+  // Whether each node, by id, is in workLeft.
+  std::vector<bool> inWorkLeft;
 
   DataFlow::Graph graph;
 
@@ -55,15 +74,16 @@ struct DataFlowOpts : public WalkerPass<PostWalker<DataFlowOpts>> {
     nodeUsers.build(graph);
     // Propagate optimizations through the graph.
     std::unordered_set<DataFlow::Node*> optimized; // which nodes we optimized
-    for (auto& node : graph.nodes) {
-      workLeft.insert(node.get()); // we should try to optimize each node
+    inWorkLeft.resize(graph.nodes.size());
+    for (auto* node : graph.nodes) {
+      addWork(node); // we should try to optimize each node
     }
     while (!workLeft.empty()) {
       // std::cout << "\n\ndump before work iter\n";
       // dump(graph, std::cout);
-      auto iter = workLeft.begin();
-      auto* node = *iter;
-      workLeft.erase(iter);
+      auto* node = workLeft.back();
+      workLeft.pop_back();
+      inWorkLeft[node->id] = false;
       workOn(node);
     }
     // After updating the DataFlow IR, we can update the sets in
@@ -80,6 +100,13 @@ struct DataFlowOpts : public WalkerPass<PostWalker<DataFlowOpts>> {
     }
   }
 
+  void addWork(DataFlow::Node* node) {
+    if (!inWorkLeft[node->id]) {
+      inWorkLeft[node->id] = true;
+      workLeft.push_back(node);
+    }
+  }
+
   void workOn(DataFlow::Node* node) {
     if (node->isConst()) {
       return;
@@ -132,25 +159,20 @@ struct DataFlowOpts : public WalkerPass<PostWalker<DataFlowOpts>> {
       }
     }
     // Now we know that all our DataFlow inputs are constant, and all
-    // our Binaryen IR representations of them are constant too. RUn
-    // precompute, which will transform the expression into a constanat.
-    Module temp;
-    // XXX we should copy expr here, in principle, and definitely will need to
-    //     when we do arbitrarily regenerated expressions
-    auto* func = Builder(temp).makeFunction(
-      "temp", std::vector<Type>{}, none, std::vector<Type>{}, expr);
-    PassRunner runner(&temp);
-    runner.setIsNested(true);
-    runner.add("precompute");
-    runner.runOnFunction(func);
-    // Get the optimized thing
-    auto* result = func->body;
-    // It may not be a constant, e.g. 0 / 0 does not optimize to 0
-    if (!result->is<Const>()) {
+    // our Binaryen IR representations of them are constant too, so we
+    // can evaluate the expression into a constant.
+    Literal result;
+    try {
+      result = ConstantFolder().visit(expr).value;
+    } catch (ConstantFolder::TrapException&) {
+      // It may not be a constant, e.g. 0 / 0 traps
+      return;
+    }
+    // Like precompute, do not emit v128 constants.
+    if (result.type.isVector()) {
       return;
     }
-    // All good, copy it.
-    node->expr = Builder(*getModule()).makeConst(result->cast<Const>()->value);
+    node->expr = Builder(*getModule()).makeConst(result);
     assert(node->isConst());
     // We no longer have values, and so do not use anything.
     nodeUsers.stopUsingValues(node);
@@ -169,10 +191,10 @@ struct DataFlowOpts : public WalkerPass<PostWalker<DataFlowOpts>> {
     // in particular phis.
     assert(with->isConst()); // TODO
     // All the users should be worked on later, as we will update them.
-    auto& users = nodeUsers.getUsers(node);
+    const auto& users = nodeUsers.getUsers(node);
     for (auto* user : users) {
       // Add the user to the work left to do, as we are modifying it.
-      workLeft.insert(user);
+      addWork(user);
       // `with` is getting another user.
       nodeUsers.addUser(with, user);
       // Replacing in the DataFlow IR is simple - just replace it,
@@ -92,11 +92,14 @@ struct DAEScanner
       CFGWalker<DAEScanner, Visitor<DAEScanner>, DAEBlockInfo>> {
   bool isFunctionParallel() override { return true; }
 
-  Pass* create() override { return new DAEScanner(infoMap); }
+  Pass* create() override { return new DAEScanner(infoMap, toScan); }
 
-  DAEScanner(DAEFunctionInfoMap* infoMap) : infoMap(infoMap) {}
+  DAEScanner(DAEFunctionInfoMap* infoMap, std::unordered_set<Name>* toScan)
+    : infoMap(infoMap), toScan(toScan) {}
 
   DAEFunctionInfoMap* infoMap;
+  // The functions whose info is stale; we do not scan the others.
+  std::unordered_set<Name>* toScan;
   DAEFunctionInfo* info;
 
   Index numParams;
@@ -148,6 +151,9 @@ struct DAEScanner
   // main entry point
 
   void doWalkFunction(Function* func) {
+    if (!toScan->count(func->name)) {
+      return;
+    }
     numParams = func->getNumParams();
     info = &((*infoMap)[func->name]);
     CFGWalker<DAEScanner, Visitor<DAEScanner>, DAEBlockInfo>::doWalkFunction(
@@ -228,22 +234,12 @@ struct DAE : public Pass {
   bool optimize = false;
 
   void run(PassRunner* runner, Module* module) override {
-    // Iterate to convergence.
-    while (1) {
-      if (!iteration(runner, module)) {
-        break;
-      }
-    }
-  }
-
-  bool iteration(PassRunner* runner, Module* module) {
-    allDroppedCalls.clear();
-
-    DAEFunctionInfoMap infoMap;
     // Ensure they all exist so the parallel threads don't modify the data
     // structure.
-    ModuleUtils::iterDefinedFunctions(
-      *module, [&](Function* func) { infoMap[func->name]; });
+    ModuleUtils::iterDefinedFunctions(*module, [&](Function* func) {
+      infoMap[func->name];
+      toScan.insert(func->name);
+    });
     // Check the influence of the table and exports.
     for (auto& curr : module->exports) {
       if (curr->kind == ExternalKind::Function) {
@@ -255,25 +251,63 @@ struct DAE : public Pass {
         infoMap[name].hasUnseenCalls = true;
       }
     }
-    // Scan all the functions.
-    DAEScanner(&infoMap).run(runner, module);
-    // Combine all the info.
-    std::unordered_map<Name, std::vector<Call*>> allCalls;
-    std::unordered_set<Name> tailCallees;
-    for (auto& pair : infoMap) {
-      auto& info = pair.second;
+    // Iterate to convergence. Each iteration only rescans the functions that
+    // the previous one modified, as the info of the others is still valid.
+    Index iterations = 0;
+    while (1) {
+      iterations++;
+      auto scanned = toScan.size();
+      bool changed = iteration(runner, module);
+      if (runner->options.debug) {
+        std::cerr << "[DAE] iteration " << iterations << ": scanned "
+                  << scanned << " functions, " << toScan.size()
+                  << " to rescan\n";
+      }
+      if (!changed) {
+        break;
+      }
+    }
+  }
+
+  bool iteration(PassRunner* runner, Module* module) {
+    // Forget the info of the functions we are about to rescan. The functions
+    // they called must be looked at again, as their calls may have changed.
+    std::unordered_set<Name> toCheck;
+    for (auto name : toScan) {
+      auto& info = infoMap[name];
       for (auto& pair : info.calls) {
-        auto name = pair.first;
-        auto& calls = pair.second;
-        auto& allCallsToName = allCalls[name];
-        allCallsToName.insert(allCallsToName.end(), calls.begin(), calls.end());
+        callers[pair.first].erase(name);
+        toCheck.insert(pair.first);
+      }
+      for (auto& pair : info.droppedCalls) {
+        allDroppedCalls.erase(pair.first);
       }
-      for (auto& callee : info.tailCallees) {
-        tailCallees.insert(callee);
+      auto hasUnseenCalls = info.hasUnseenCalls;
+      info = DAEFunctionInfo();
+      info.hasUnseenCalls = hasUnseenCalls;
+    }
+    DAEScanner(&infoMap, &toScan).run(runner, module);
+    // Combine the new info with the rest.
+    for (auto name : toScan) {
+      auto& info = infoMap[name];
+      for (auto& pair : info.calls) {
+        callers[pair.first].insert(name);
+        toCheck.insert(pair.first);
       }
       for (auto& pair : info.droppedCalls) {
         allDroppedCalls[pair.first] = pair.second;
       }
+      toCheck.insert(name);
+    }
+    toScan.clear();
+    // Nothing changed for the functions we do not check, so there is nothing
+    // new to optimize in them either - except that we only look at return
+    // values when no parameters were changed, so remember to check them then.
+    toCheckReturns.insert(toCheck.begin(), toCheck.end());
+    // Gather the calls to the functions we check.
+    std::unordered_map<Name, std::vector<Call*>> allCalls;
+    for (auto name : toCheck) {
+      addCalls(name, allCalls);
     }
     // We now have a mapping of all call sites for each function. Check which
     // are always passed the same constant for a particular argument.
@@ -361,20 +395,21 @@ struct DAE : public Pass {
     // modified allCalls (we can't modify a call site twice in one iteration,
     // once to remove a param, once to drop the return value).
     if (changed.empty()) {
-      for (auto& func : module->functions) {
+      for (auto name : toCheckReturns) {
+        auto* func = module->getFunction(name);
         if (func->result == none) {
           continue;
         }
-        auto name = func->name;
         if (infoMap[name].hasUnseenCalls) {
           continue;
         }
         if (infoMap[name].hasTailCalls) {
           continue;
         }
-        if (tailCallees.find(name) != tailCallees.end()) {
+        if (isTailCallee(name)) {
           continue;
         }
+        addCalls(name, allCalls);
         auto iter = allCalls.find(name);
         if (iter == allCalls.end()) {
           continue;
@@ -387,21 +422,65 @@ struct DAE : public Pass {
         if (!allDropped) {
           continue;
         }
-        removeReturnValue(func.get(), calls, module);
+        removeReturnValue(func, calls, module);
         // TODO Removing a drop may also open optimization opportunities in the
         // callers.
-        changed.insert(func.get());
+        changed.insert(func);
       }
+      toCheckReturns.clear();
     }
     if (optimize && !changed.empty()) {
       OptUtils::optimizeAfterInlining(changed, module, runner);
     }
+    // The changed functions must be rescanned, and so must their callers, as
+    // we modified the calls.
+    for (auto* func : changed) {
+      toScan.insert(func->name);
+      auto iter = callers.find(func->name);
+      if (iter != callers.end()) {
+        toScan.insert(iter->second.begin(), iter->second.end());
+      }
+    }
     return !changed.empty();
   }
 
 private:
+  DAEFunctionInfoMap infoMap;
+  // The functions whose info must be computed in the next iteration.
+  std::unordered_set<Name> toScan;
+  // The functions whose return values we have not looked at since they or
+  // their callers changed.
+  std::unordered_set<Name> toCheckReturns;
+  // Maps a function name to the functions that call it.
+  std::unordered_map<Name, std::unordered_set<Name>> callers;
   std::unordered_map<Call*, Expression**> allDroppedCalls;
 
+  // Adds the calls to a function, if there are any, to a map.
+  void addCalls(Name name,
+                std::unordered_map<Name, std::vector<Call*>>& allCalls) {
+    auto iter = callers.find(name);
+    if (iter == callers.end() || iter->second.empty() ||
+        allCalls.count(name)) {
+      return;
+    }
+    auto& allCallsToName = allCalls[name];
+    for (auto caller : iter->second) {
+      auto& calls = infoMap[caller].calls[name];
+      allCallsToName.insert(allCallsToName.end(), calls.begin(), calls.end());
+    }
+  }
+
+  bool isTailCallee(Name name) {
+    auto iter = callers.find(name);
+    if (iter == callers.end()) {
+      return false;
+    }
+    return std::any_of(
+      iter->second.begin(), iter->second.end(), [&](Name caller) {
+        return infoMap[caller].tailCallees.count(name) > 0;
+      });
+  }
+
   void removeParameter(Function* func, Index i, std::vector<Call*>& calls) {
     // Clear the type, which is no longer accurate.
     func->type = Name();
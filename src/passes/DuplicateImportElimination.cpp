@@ -33,7 +33,6 @@ struct DuplicateImportElimination : public Pass {
     ImportInfo imports(*module);
     std::map<Name, Name> replacements;
     std::map<std::pair<Name, Name>, Name> seen;
-    std::vector<Name> toRemove;
     for (auto* func : imports.importedFunctions) {
       auto pair = std::make_pair(func->module, func->base);
       auto iter = seen.find(pair);
@@ -44,7 +43,6 @@ struct DuplicateImportElimination : public Pass {
         // merge if the types match, of course.
         if (getSig(previousFunc) == getSig(func)) {
           replacements[func->name] = previousName;
-          toRemove.push_back(func->name);
           continue;
         }
       }
@@ -53,9 +51,8 @@ struct DuplicateImportElimination : public Pass {
     if (!replacements.empty()) {
       module->updateMaps();
       OptUtils::replaceFunctions(runner, *module, replacements);
-      for (auto name : toRemove) {
-        module->removeFunction(name);
-      }
+      module->removeFunctions(
+        [&](Function* func) { return replacements.count(func->name) > 0; });
     }
   }
 };
@@ -20,6 +20,9 @@
 // returning the low half and storing the high half into a
 // global.
 //
+// Globals and function types are lowered first, on the whole
+// module, and then function bodies are lowered in parallel.
+//
 
 #include "abi/js.h"
 #include "asmjs/shared-constants.h"
@@ -34,14 +37,32 @@
 #include "wasm-builder.h"
 #include "wasm.h"
 #include <algorithm>
+#include <atomic>
 
 namespace wasm {
 
 static Name makeHighName(Name n) { return std::string(n.c_str()) + "$hi"; }
 
-struct I64ToI32Lowering : public WalkerPass<PostWalker<I64ToI32Lowering>> {
+// What the lowering of function bodies needs to know about the module-level
+// lowering.
+struct I64ToI32LoweringInfo {
+  // Globals that were i64, and now have a "$hi" global for the high bits.
+  std::unordered_set<Name> originallyI64Globals;
+  // Functions and function types that returned i64. We do not look at their
+  // result types, as the lowering of other functions changes them.
+  std::unordered_set<Name> i64ResultFunctions;
+  std::unordered_set<Name> i64ResultFunctionTypes;
+  // Whether we need the scratch memory helpers, which we add to the module
+  // at the end.
+  std::atomic<bool> needsScratchMemory;
+
+  I64ToI32LoweringInfo() { needsScratchMemory.store(false); }
+};
+
+struct I64ToI32FunctionLowering
+  : public WalkerPass<PostWalker<I64ToI32FunctionLowering>> {
   struct TempVar {
-    TempVar(Index idx, Type ty, I64ToI32Lowering& pass)
+    TempVar(Index idx, Type ty, I64ToI32FunctionLowering& pass)
       : idx(idx), pass(pass), moved(false), ty(ty) {}
 
     TempVar(TempVar&& other)
@@ -91,84 +112,20 @@ struct I64ToI32Lowering : public WalkerPass<PostWalker<I64ToI32Lowering>> {
     }
 
     Index idx;
-    I64ToI32Lowering& pass;
+    I64ToI32FunctionLowering& pass;
     bool moved; // since C++ will still destruct moved-from values
     Type ty;
   };
 
-  // false since function types need to be lowered
-  // TODO: allow module-level transformations in parallel passes
-  bool isFunctionParallel() override { return false; }
-
-  Pass* create() override { return new I64ToI32Lowering; }
+  bool isFunctionParallel() override { return true; }
 
-  void doWalkModule(Module* module) {
-    if (!builder) {
-      builder = make_unique<Builder>(*module);
-    }
-    // add new globals for high bits
-    for (size_t i = 0, globals = module->globals.size(); i < globals; ++i) {
-      auto* curr = module->globals[i].get();
-      if (curr->type != i64) {
-        continue;
-      }
-      originallyI64Globals.insert(curr->name);
-      curr->type = i32;
-      auto* high = builder->makeGlobal(makeHighName(curr->name),
-                                       i32,
-                                       builder->makeConst(Literal(int32_t(0))),
-                                       Builder::Mutable);
-      module->addGlobal(high);
-      if (curr->imported()) {
-        Fatal() << "TODO: imported i64 globals";
-      } else {
-        if (auto* c = curr->init->dynCast<Const>()) {
-          uint64_t value = c->value.geti64();
-          c->value = Literal(uint32_t(value));
-          c->type = i32;
-          high->init = builder->makeConst(Literal(uint32_t(value >> 32)));
-        } else if (auto* get = curr->init->dynCast<GlobalGet>()) {
-          high->init = builder->makeGlobalGet(makeHighName(get->name), i32);
-        } else {
-          WASM_UNREACHABLE();
-        }
-        curr->init->type = i32;
-      }
-    }
-
-    // For functions that return 64-bit values, we use this global variable
-    // to return the high 32 bits.
-    auto* highBits = new Global();
-    highBits->type = i32;
-    highBits->name = INT64_TO_32_HIGH_BITS;
-    highBits->init = builder->makeConst(Literal(int32_t(0)));
-    highBits->mutable_ = true;
-    module->addGlobal(highBits);
-    PostWalker<I64ToI32Lowering>::doWalkModule(module);
-  }
+  Pass* create() override { return new I64ToI32FunctionLowering(info); }
 
-  void visitFunctionType(FunctionType* curr) {
-    std::vector<Type> params;
-    for (auto t : curr->params) {
-      if (t == i64) {
-        params.push_back(i32);
-        params.push_back(i32);
-      } else {
-        params.push_back(t);
-      }
-    }
-    std::swap(params, curr->params);
-    if (curr->result == i64) {
-      curr->result = i32;
-    }
-  }
+  I64ToI32FunctionLowering(I64ToI32LoweringInfo* info) : info(info) {}
 
   void doWalkFunction(Function* func) {
     Flat::verifyFlatness(func);
-    // create builder here if this is first entry to module for this object
-    if (!builder) {
-      builder = make_unique<Builder>(*getModule());
-    }
+    builder = make_unique<Builder>(*getModule());
     indexMap.clear();
     highBitVars.clear();
     freeTemps.clear();
@@ -200,14 +157,11 @@ struct I64ToI32Lowering : public WalkerPass<PostWalker<I64ToI32Lowering>> {
       }
     }
     nextTemp = func->getNumLocals();
-    PostWalker<I64ToI32Lowering>::doWalkFunction(func);
+    PostWalker<I64ToI32FunctionLowering>::doWalkFunction(func);
   }
 
   void visitFunction(Function* func) {
-    if (func->imported()) {
-      return;
-    }
-    if (func->result == i64) {
+    if (info->i64ResultFunctions.count(func->name)) {
       func->result = i32;
       // body may not have out param if it ends with control flow
       if (hasOutParam(func->body)) {
@@ -262,8 +216,7 @@ struct I64ToI32Lowering : public WalkerPass<PostWalker<I64ToI32Lowering>> {
     return call;
   }
   void visitCall(Call* curr) {
-    if (curr->isReturn &&
-        getModule()->getFunction(curr->target)->result == i64) {
+    if (curr->isReturn && info->i64ResultFunctions.count(curr->target)) {
       Fatal()
         << "i64 to i32 lowering of return_call values not yet implemented";
     }
@@ -281,7 +234,7 @@ struct I64ToI32Lowering : public WalkerPass<PostWalker<I64ToI32Lowering>> {
 
   void visitCallIndirect(CallIndirect* curr) {
     if (curr->isReturn &&
-        getModule()->getFunctionType(curr->fullType)->result == i64) {
+        info->i64ResultFunctionTypes.count(curr->fullType)) {
       Fatal()
         << "i64 to i32 lowering of return_call values not yet implemented";
     }
@@ -342,10 +295,7 @@ struct I64ToI32Lowering : public WalkerPass<PostWalker<I64ToI32Lowering>> {
   }
 
   void visitGlobalGet(GlobalGet* curr) {
-    if (!getFunction()) {
-      return; // if in a global init, skip - we already handled that.
-    }
-    if (!originallyI64Globals.count(curr->name)) {
+    if (!info->originallyI64Globals.count(curr->name)) {
       return;
     }
     curr->type = i32;
@@ -358,7 +308,7 @@ struct I64ToI32Lowering : public WalkerPass<PostWalker<I64ToI32Lowering>> {
   }
 
   void visitGlobalSet(GlobalSet* curr) {
-    if (!originallyI64Globals.count(curr->name)) {
+    if (!info->originallyI64Globals.count(curr->name)) {
       return;
     }
     if (handleUnreachable(curr)) {
@@ -447,9 +397,6 @@ struct I64ToI32Lowering : public WalkerPass<PostWalker<I64ToI32Lowering>> {
   }
 
   void visitConst(Const* curr) {
-    if (!getFunction()) {
-      return; // if in a global init, skip - we already handled that.
-    }
     if (curr->type != i64) {
       return;
     }
@@ -525,8 +472,7 @@ struct I64ToI32Lowering : public WalkerPass<PostWalker<I64ToI32Lowering>> {
                         i32));
     setOutParam(result, std::move(highBits));
     replaceCurrent(result);
-    MemoryUtils::ensureExists(getModule()->memory);
-    ABI::wasm2js::ensureScratchMemoryHelpers(getModule());
+    info->needsScratchMemory.store(true);
   }
 
   void lowerReinterpretInt64(Unary* curr) {
@@ -543,8 +489,7 @@ struct I64ToI32Lowering : public WalkerPass<PostWalker<I64ToI32Lowering>> {
                         none),
       builder->makeCall(ABI::wasm2js::SCRATCH_LOAD_F64, {}, f64));
     replaceCurrent(result);
-    MemoryUtils::ensureExists(getModule()->memory);
-    ABI::wasm2js::ensureScratchMemoryHelpers(getModule());
+    info->needsScratchMemory.store(true);
   }
 
   void lowerTruncFloatToInt(Unary* curr) {
@@ -842,17 +787,19 @@ struct I64ToI32Lowering : public WalkerPass<PostWalker<I64ToI32Lowering>> {
                   TempVar&& leftHigh,
                   TempVar&& rightLow,
                   TempVar&& rightHigh) {
-    TempVar lowResult = getTemp();
-    TempVar highResult = getTemp();
+    // Each half of the left side is only read before we write that half of
+    // the result, so we can reuse its temps.
+    TempVar lowResult = std::move(leftLow);
+    TempVar highResult = std::move(leftHigh);
     LocalSet* addLow = builder->makeLocalSet(
       lowResult,
       builder->makeBinary(AddInt32,
-                          builder->makeLocalGet(leftLow, i32),
+                          builder->makeLocalGet(lowResult, i32),
                           builder->makeLocalGet(rightLow, i32)));
     LocalSet* addHigh = builder->makeLocalSet(
       highResult,
       builder->makeBinary(AddInt32,
-                          builder->makeLocalGet(leftHigh, i32),
+                          builder->makeLocalGet(highResult, i32),
                           builder->makeLocalGet(rightHigh, i32)));
     LocalSet* carryBit = builder->makeLocalSet(
       highResult,
@@ -875,24 +822,26 @@ struct I64ToI32Lowering : public WalkerPass<PostWalker<I64ToI32Lowering>> {
                   TempVar&& leftHigh,
                   TempVar&& rightLow,
                   TempVar&& rightHigh) {
-    TempVar lowResult = getTemp();
-    TempVar highResult = getTemp();
+    // Compute the borrow first, so that we can then reuse the temps of the
+    // left low bits and the right high bits for the result.
     TempVar borrow = getTemp();
-    LocalSet* subLow = builder->makeLocalSet(
-      lowResult,
-      builder->makeBinary(SubInt32,
-                          builder->makeLocalGet(leftLow, i32),
-                          builder->makeLocalGet(rightLow, i32)));
     LocalSet* borrowBit = builder->makeLocalSet(
       borrow,
       builder->makeBinary(LtUInt32,
                           builder->makeLocalGet(leftLow, i32),
                           builder->makeLocalGet(rightLow, i32)));
+    TempVar lowResult = std::move(leftLow);
+    TempVar highResult = std::move(rightHigh);
+    LocalSet* subLow = builder->makeLocalSet(
+      lowResult,
+      builder->makeBinary(SubInt32,
+                          builder->makeLocalGet(lowResult, i32),
+                          builder->makeLocalGet(rightLow, i32)));
     LocalSet* subHigh1 = builder->makeLocalSet(
       highResult,
       builder->makeBinary(AddInt32,
                           builder->makeLocalGet(borrow, i32),
-                          builder->makeLocalGet(rightHigh, i32)));
+                          builder->makeLocalGet(highResult, i32)));
     LocalSet* subHigh2 = builder->makeLocalSet(
       highResult,
       builder->makeBinary(SubInt32,
@@ -900,7 +849,7 @@ struct I64ToI32Lowering : public WalkerPass<PostWalker<I64ToI32Lowering>> {
                           builder->makeLocalGet(highResult, i32)));
     LocalGet* getLow = builder->makeLocalGet(lowResult, i32);
     result =
-      builder->blockify(result, subLow, borrowBit, subHigh1, subHigh2, getLow);
+      builder->blockify(result, borrowBit, subLow, subHigh1, subHigh2, getLow);
     setOutParam(result, std::move(highResult));
     return result;
   }
@@ -1452,12 +1401,12 @@ struct I64ToI32Lowering : public WalkerPass<PostWalker<I64ToI32Lowering>> {
   }
 
 private:
+  I64ToI32LoweringInfo* info;
   std::unique_ptr<Builder> builder;
   std::unordered_map<Index, Index> indexMap;
   std::unordered_map<int, std::vector<Index>> freeTemps;
   std::unordered_map<Expression*, TempVar> highBitVars;
   std::unordered_map<Index, Type> tempTypes;
-  std::unordered_set<Name> originallyI64Globals;
   Index nextTemp;
 
   TempVar getTemp(Type ty = i32) {
@@ -1523,6 +1472,94 @@ private:
   }
 };
 
+struct I64ToI32Lowering : public Pass {
+  void run(PassRunner* runner, Module* module) override {
+    I64ToI32LoweringInfo info;
+    Builder builder(*module);
+    // add new globals for high bits
+    for (size_t i = 0, globals = module->globals.size(); i < globals; ++i) {
+      auto* curr = module->globals[i].get();
+      if (curr->type != i64) {
+        continue;
+      }
+      info.originallyI64Globals.insert(curr->name);
+      curr->type = i32;
+      auto* high = builder.makeGlobal(makeHighName(curr->name),
+                                      i32,
+                                      builder.makeConst(Literal(int32_t(0))),
+                                      Builder::Mutable);
+      module->addGlobal(high);
+      if (curr->imported()) {
+        Fatal() << "TODO: imported i64 globals";
+      } else {
+        if (auto* c = curr->init->dynCast<Const>()) {
+          uint64_t value = c->value.geti64();
+          c->value = Literal(uint32_t(value));
+          c->type = i32;
+          high->init = builder.makeConst(Literal(uint32_t(value >> 32)));
+        } else if (auto* get = curr->init->dynCast<GlobalGet>()) {
+          high->init = builder.makeGlobalGet(makeHighName(get->name), i32);
+        } else {
+          WASM_UNREACHABLE();
+        }
+        curr->init->type = i32;
+      }
+    }
+
+    // For functions that return 64-bit values, we use this global variable
+    // to return the high 32 bits.
+    auto* highBits = new Global();
+    highBits->type = i32;
+    highBits->name = INT64_TO_32_HIGH_BITS;
+    highBits->init = builder.makeConst(Literal(int32_t(0)));
+    highBits->mutable_ = true;
+    module->addGlobal(highBits);
+
+    for (auto& curr : module->functionTypes) {
+      if (curr->result == i64) {
+        info.i64ResultFunctionTypes.insert(curr->name);
+      }
+      lowerFunctionType(curr.get());
+    }
+    for (auto& func : module->functions) {
+      if (func->result == i64) {
+        info.i64ResultFunctions.insert(func->name);
+      }
+    }
+
+    // Lower the function bodies, which also lowers their params, locals and
+    // results.
+    {
+      PassRunner subRunner(module, runner->options);
+      subRunner.setIsNested(true);
+      subRunner.add(make_unique<I64ToI32FunctionLowering>(&info));
+      subRunner.run();
+    }
+
+    if (info.needsScratchMemory.load()) {
+      MemoryUtils::ensureExists(module->memory);
+      ABI::wasm2js::ensureScratchMemoryHelpers(module);
+    }
+  }
+
+private:
+  void lowerFunctionType(FunctionType* curr) {
+    std::vector<Type> params;
+    for (auto t : curr->params) {
+      if (t == i64) {
+        params.push_back(i32);
+        params.push_back(i32);
+      } else {
+        params.push_back(t);
+      }
+    }
+    std::swap(params, curr->params);
+    if (curr->result == i64) {
+      curr->result = i32;
+    }
+  }
+};
+
 Pass* createI64ToI32LoweringPass() { return new I64ToI32Lowering(); }
 
 } // namespace wasm
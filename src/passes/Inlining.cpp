@@ -30,11 +30,10 @@
 // everything later.
 //
 
-#include <atomic>
-
 #include "ir/debug.h"
 #include "ir/literal-utils.h"
 #include "ir/module-utils.h"
+#include "ir/profile.h"
 #include "ir/utils.h"
 #include "parsing.h"
 #include "pass.h"
@@ -46,10 +45,12 @@ namespace wasm {
 
 // Useful into on a function, helping us decide if we can inline it
 struct FunctionInfo {
-  std::atomic<Index> calls;
+  Index calls;
   Index size;
-  std::atomic<bool> lightweight;
+  bool lightweight;
   bool usedGlobally; // in a table or export
+  // the functions this one calls, and how many times
+  std::unordered_map<Name, Index> callees;
 
   FunctionInfo() {
     calls = 0;
@@ -58,8 +59,10 @@ struct FunctionInfo {
     usedGlobally = false;
   }
 
-  // See pass.h for how defaults for these options were chosen.
-  bool worthInlining(PassOptions& options) {
+  // See pass.h for how defaults for these options were chosen. If a profile
+  // shows that the function is cold, we only inline it when that is not
+  // likely to increase code size.
+  bool worthInlining(PassOptions& options, bool cold) {
     // if it's big, it's just not worth doing (TODO: investigate more)
     if (size > options.inlining.flexibleInlineMaxSize) {
       return false;
@@ -83,42 +86,61 @@ struct FunctionInfo {
     // so only worth it if we really care about speed and don't care
     // about size, and if it's lightweight so a good candidate for
     // speeding us up.
-    return options.optimizeLevel >= 3 && options.shrinkLevel == 0 &&
+    return !cold && options.optimizeLevel >= 3 && options.shrinkLevel == 0 &&
            lightweight;
   }
+
+  // Whether it is worth inlining the function into callers that a profile
+  // shows call it often. Recursive functions could keep growing their callers,
+  // so we leave them alone.
+  bool worthInliningWhenHot(PassOptions& options, Name name) {
+    return size <= options.inlining.flexibleInlineMaxSize &&
+           options.shrinkLevel == 0 && !callees.count(name);
+  }
 };
 
 typedef std::unordered_map<Name, FunctionInfo> NameInfoMap;
 
+// Scans functions, noting their own properties and the calls they make (the
+// call counts of the called functions are then updated serially).
 struct FunctionInfoScanner
   : public WalkerPass<PostWalker<FunctionInfoScanner>> {
   bool isFunctionParallel() override { return true; }
 
-  FunctionInfoScanner(NameInfoMap* infos) : infos(infos) {}
+  FunctionInfoScanner(NameInfoMap* infos, std::unordered_set<Name>* toScan)
+    : infos(infos), toScan(toScan) {}
 
   FunctionInfoScanner* create() override {
-    return new FunctionInfoScanner(infos);
+    return new FunctionInfoScanner(infos, toScan);
   }
 
   void visitLoop(Loop* curr) {
     // having a loop is not lightweight
-    (*infos)[getFunction()->name].lightweight = false;
+    info->lightweight = false;
   }
 
   void visitCall(Call* curr) {
-    // can't add a new element in parallel
-    assert(infos->count(curr->target) > 0);
-    (*infos)[curr->target].calls++;
+    info->callees[curr->target]++;
     // having a call is not lightweight
-    (*infos)[getFunction()->name].lightweight = false;
+    info->lightweight = false;
   }
 
-  void visitFunction(Function* curr) {
-    (*infos)[curr->name].size = Measurer::measure(curr->body);
+  void doWalkFunction(Function* func) {
+    if (!toScan->count(func->name)) {
+      return;
+    }
+    // can't add a new element in parallel
+    assert(infos->count(func->name) > 0);
+    info = &(*infos)[func->name];
+    walk(func->body);
+    info->size = Measurer::measure(func->body);
   }
 
 private:
   NameInfoMap* infos;
+  // the functions to scan; the infos of the others are up to date
+  std::unordered_set<Name>* toScan;
+  FunctionInfo* info;
 };
 
 struct InliningAction {
@@ -131,6 +153,9 @@ struct InliningAction {
 
 struct InliningState {
   std::unordered_set<Name> worthInlining;
+  // functions that are worth inlining where the profile shows they are hot
+  std::unordered_set<Name> worthInliningWhenHot;
+  Profile* profile = nullptr;
   // function name => actions that can be performed in it
   std::unordered_map<Name, std::vector<InliningAction>> actionsForFunction;
 };
@@ -142,6 +167,13 @@ struct Planner : public WalkerPass<PostWalker<Planner>> {
 
   Planner* create() override { return new Planner(state); }
 
+  void doWalkFunction(Function* func) {
+    // only functions that call something worth inlining can have actions
+    if (state->actionsForFunction.count(func->name)) {
+      walk(func->body);
+    }
+  }
+
   void visitCall(Call* curr) {
     // plan to inline if we know this is valid to inline, and if the call is
     // actually performed - if it is dead code, it's pointless to inline.
@@ -156,7 +188,7 @@ struct Planner : public WalkerPass<PostWalker<Planner>> {
     } else {
       isUnreachable = curr->type == unreachable;
     }
-    if (state->worthInlining.count(curr->target) && !isUnreachable &&
+    if (isWorthInlining(curr->target) && !isUnreachable &&
         curr->target != getFunction()->name) {
       // nest the call in a block. that way the location of the pointer to the
       // call will not change even if we inline multiple times into the same
@@ -172,6 +204,14 @@ struct Planner : public WalkerPass<PostWalker<Planner>> {
 
 private:
   InliningState* state;
+
+  bool isWorthInlining(Name target) {
+    if (state->worthInlining.count(target)) {
+      return true;
+    }
+    return state->worthInliningWhenHot.count(target) &&
+           state->profile->isHotCall(getFunction()->name, target);
+  }
 };
 
 struct Updater : public PostWalker<Updater> {
@@ -279,13 +319,39 @@ struct Inlining : public Pass {
   // whether to optimize where we inline
   bool optimize = false;
 
-  // the information for each function. recomputed in each iteraction
+  // the information for each function. kept up to date between iterations
   NameInfoMap infos;
+  // function name => the functions that call it
+  std::unordered_map<Name, std::unordered_set<Name>> callers;
+  // the functions whose infos must be recomputed, as they changed
+  std::unordered_set<Name> toScan;
+  // the profile given in the pass arguments, if any
+  std::unique_ptr<Profile> profile;
 
   Index iterationNumber;
 
   void run(PassRunner* runner, Module* module) override {
     Index numFunctions = module->functions.size();
+    profile = Profile::fromOptions(runner->options);
+    // fill in info, as we operate on it in parallel (each function to its own
+    // entry)
+    for (auto& func : module->functions) {
+      infos[func->name];
+    }
+    ModuleUtils::iterDefinedFunctions(
+      *module, [&](Function* func) { toScan.insert(func->name); });
+    // fill in global uses
+    // anything exported or used in a table should not be inlined
+    for (auto& ex : module->exports) {
+      if (ex->kind == ExternalKind::Function) {
+        infos[ex->value].usedGlobally = true;
+      }
+    }
+    for (auto& segment : module->table.segments) {
+      for (auto name : segment.data) {
+        infos[name].usedGlobally = true;
+      }
+    }
     // keep going while we inline, to handle nesting. TODO: optimize
     iterationNumber = 0;
     // no point to do more iterations than the number of functions, as
@@ -295,9 +361,10 @@ struct Inlining : public Pass {
     while (iterationNumber <= numFunctions) {
 #ifdef INLINING_DEBUG
       std::cout << "inlining loop iter " << iterationNumber
-                << " (numFunctions: " << numFunctions << ")\n";
+                << " (numFunctions: " << numFunctions
+                << ", rescanning: " << toScan.size() << ")\n";
 #endif
-      calculateInfos(module);
+      updateInfos(module);
       if (!iteration(runner, module)) {
         return;
       }
@@ -305,47 +372,73 @@ struct Inlining : public Pass {
     }
   }
 
-  void calculateInfos(Module* module) {
-    infos.clear();
-    // fill in info, as we operate on it in parallel (each function to its own
-    // entry)
-    for (auto& func : module->functions) {
-      infos[func->name];
+  // Removes a function's calls from the counts of the functions it calls.
+  void forgetCalls(Name name) {
+    auto& info = infos[name];
+    for (auto& pair : info.callees) {
+      infos[pair.first].calls -= pair.second;
+      callers[pair.first].erase(name);
     }
-    PassRunner runner(module);
-    FunctionInfoScanner(&infos).run(&runner, module);
-    // fill in global uses
-    // anything exported or used in a table should not be inlined
-    for (auto& ex : module->exports) {
-      if (ex->kind == ExternalKind::Function) {
-        infos[ex->value].usedGlobally = true;
-      }
+    info.callees.clear();
+  }
+
+  // Rescans the functions that changed since the last iteration. Nothing else
+  // can have changed, except for the call counts, which we update from the
+  // calls of the rescanned functions.
+  void updateInfos(Module* module) {
+    for (auto name : toScan) {
+      forgetCalls(name);
+      auto& info = infos[name];
+      info.size = 0;
+      info.lightweight = true;
     }
-    for (auto& segment : module->table.segments) {
-      for (auto name : segment.data) {
-        infos[name].usedGlobally = true;
+    PassRunner runner(module);
+    FunctionInfoScanner(&infos, &toScan).run(&runner, module);
+    for (auto name : toScan) {
+      for (auto& pair : infos[name].callees) {
+        infos[pair.first].calls += pair.second;
+        callers[pair.first].insert(name);
       }
     }
+    toScan.clear();
   }
 
   bool iteration(PassRunner* runner, Module* module) {
     // decide which to inline
     InliningState state;
+    state.profile = profile.get();
     ModuleUtils::iterDefinedFunctions(*module, [&](Function* func) {
-      if (infos[func->name].worthInlining(runner->options)) {
+      auto& info = infos[func->name];
+      bool cold = profile && profile->isCold(func->name);
+      if (info.worthInlining(runner->options, cold)) {
         state.worthInlining.insert(func->name);
+      } else if (profile &&
+                 info.worthInliningWhenHot(runner->options, func->name)) {
+        state.worthInliningWhenHot.insert(func->name);
       }
     });
-    if (state.worthInlining.size() == 0) {
+    if (state.worthInlining.empty() && state.worthInliningWhenHot.empty()) {
       return false;
     }
     // fill in actionsForFunction, as we operate on it in parallel (each
-    // function to its own entry)
-    for (auto& func : module->functions) {
-      state.actionsForFunction[func->name];
+    // function to its own entry). only functions that call something worth
+    // inlining need to be planned
+    for (auto* names : {&state.worthInlining, &state.worthInliningWhenHot}) {
+      for (auto name : *names) {
+        for (auto caller : callers[name]) {
+          state.actionsForFunction[caller];
+        }
+      }
     }
     // find and plan inlinings
     Planner(&state).run(runner, module);
+    // the planner modifies the functions it finds actions in, so they must be
+    // rescanned, as must the functions we inline into
+    for (auto& pair : state.actionsForFunction) {
+      if (!pair.second.empty()) {
+        toScan.insert(pair.first);
+      }
+    }
     // perform inlinings TODO: parallelize
     std::unordered_map<Name, Index> inlinedUses; // how many uses we inlined
     // which functions were inlined into
@@ -358,7 +451,11 @@ struct Inlining : public Pass {
       if (inlinedUses.count(func->name)) {
         continue;
       }
-      for (auto& action : state.actionsForFunction[func->name]) {
+      auto iter = state.actionsForFunction.find(func->name);
+      if (iter == state.actionsForFunction.end()) {
+        continue;
+      }
+      for (auto& action : iter->second) {
         auto* inlinedFunction = action.contents;
         // if we've inlined into a function, don't inline it in this iteration,
         // avoid risk of races
@@ -385,6 +482,7 @@ struct Inlining : public Pass {
       OptUtils::optimizeAfterInlining(inlinedInto, module, runner);
     }
     // remove functions that we no longer need after inlining
+    std::vector<Name> removed;
     auto& funcs = module->functions;
     funcs.erase(std::remove_if(funcs.begin(),
                                funcs.end(),
@@ -399,9 +497,17 @@ struct Inlining : public Pass {
                                  if (canRemove)
                                    std::cout << "removing " << name << '\n';
 #endif
+                                 if (canRemove) {
+                                   removed.push_back(name);
+                                 }
                                  return canRemove;
                                }),
                 funcs.end());
+    // the calls in removed functions no longer count
+    for (auto name : removed) {
+      forgetCalls(name);
+      toScan.erase(name);
+    }
     // return whether we did any work
     return inlinedUses.size() > 0;
   }
@@ -42,11 +42,13 @@
 //     (i32.const 1) // value
 //    )
 //   )
+//
+// With --pass-arg=trace-buffer@START,SIZE the values are recorded in a buffer
+// in memory instead, see instrumentation.h. That does not support reference
+// types, which cannot be stored in memory, but does support i64s, which need
+// no legalization for JS.
 
-#include "asm_v_wasm.h"
-#include "asmjs/shared-constants.h"
-#include "ir/function-type-utils.h"
-#include "shared-constants.h"
+#include "instrumentation.h"
 #include <pass.h>
 #include <wasm-builder.h>
 #include <wasm.h>
@@ -67,7 +69,9 @@ Name set_f64("set_f64");
 Name set_anyref("set_anyref");
 Name set_exnref("set_exnref");
 
-struct InstrumentLocals : public WalkerPass<PostWalker<InstrumentLocals>> {
+struct InstrumentLocals : public InstrumentationWalker<InstrumentLocals> {
+  using InstrumentationWalker::InstrumentationWalker;
+
   void visitLocalGet(LocalGet* curr) {
     Builder builder(*getModule());
     Name import;
@@ -76,7 +80,11 @@ struct InstrumentLocals : public WalkerPass<PostWalker<InstrumentLocals>> {
         import = get_i32;
         break;
       case i64:
-        return; // TODO
+        if (!instrumentation->isBuffered()) {
+          return; // TODO
+        }
+        import = get_i64;
+        break;
       case f32:
         import = get_f32;
         break;
@@ -96,12 +104,17 @@ struct InstrumentLocals : public WalkerPass<PostWalker<InstrumentLocals>> {
       case unreachable:
         WASM_UNREACHABLE();
     }
-    replaceCurrent(
-      builder.makeCall(import,
-                       {builder.makeConst(Literal(int32_t(id++))),
-                        builder.makeConst(Literal(int32_t(curr->index))),
-                        curr},
-                       curr->type));
+    auto* func = getFunction();
+    auto* call = instrumentation->makeEvent(
+      func,
+      instrumentation->newSite(func),
+      import,
+      {builder.makeConst(Literal(int32_t(curr->index)))},
+      curr,
+      curr->type);
+    if (call) {
+      replaceCurrent(call);
+    }
   }
 
   void visitLocalSet(LocalSet* curr) {
@@ -119,7 +132,11 @@ struct InstrumentLocals : public WalkerPass<PostWalker<InstrumentLocals>> {
         import = set_i32;
         break;
       case i64:
-        return; // TODO
+        if (!instrumentation->isBuffered()) {
+          return; // TODO
+        }
+        import = set_i64;
+        break;
       case f32:
         import = set_f32;
         break;
@@ -139,49 +156,42 @@ struct InstrumentLocals : public WalkerPass<PostWalker<InstrumentLocals>> {
       case none:
         WASM_UNREACHABLE();
     }
-    curr->value =
-      builder.makeCall(import,
-                       {builder.makeConst(Literal(int32_t(id++))),
-                        builder.makeConst(Literal(int32_t(curr->index))),
-                        curr->value},
-                       curr->value->type);
+    auto* func = getFunction();
+    auto* call = instrumentation->makeEvent(
+      func,
+      instrumentation->newSite(func),
+      import,
+      {builder.makeConst(Literal(int32_t(curr->index)))},
+      curr->value,
+      curr->value->type);
+    if (call) {
+      curr->value = call;
+    }
   }
 
-  void visitModule(Module* curr) {
-    addImport(curr, get_i32, "iiii");
-    addImport(curr, get_i64, "jiij");
-    addImport(curr, get_f32, "fiif");
-    addImport(curr, get_f64, "diid");
-    addImport(curr, set_i32, "iiii");
-    addImport(curr, set_i64, "jiij");
-    addImport(curr, set_f32, "fiif");
-    addImport(curr, set_f64, "diid");
-
-    if (curr->features.hasReferenceTypes()) {
-      addImport(curr, get_anyref, "aiia");
-      addImport(curr, set_anyref, "aiia");
+  static Instrumentation::Imports getImports(Module* module) {
+    Instrumentation::Imports imports = {{get_i32, "iiii"},
+                                        {get_i64, "jiij"},
+                                        {get_f32, "fiif"},
+                                        {get_f64, "diid"},
+                                        {set_i32, "iiii"},
+                                        {set_i64, "jiij"},
+                                        {set_f32, "fiif"},
+                                        {set_f64, "diid"}};
+    if (module->features.hasReferenceTypes()) {
+      imports.push_back({get_anyref, "aiia"});
+      imports.push_back({set_anyref, "aiia"});
     }
-    if (curr->features.hasExceptionHandling()) {
-      addImport(curr, get_exnref, "eiie");
-      addImport(curr, set_exnref, "eiie");
+    if (module->features.hasExceptionHandling()) {
+      imports.push_back({get_exnref, "eiie"});
+      imports.push_back({set_exnref, "eiie"});
     }
-  }
-
-private:
-  Index id = 0;
-
-  void addImport(Module* wasm, Name name, std::string sig) {
-    auto import = new Function;
-    import->name = name;
-    import->module = ENV;
-    import->base = name;
-    auto* functionType = ensureFunctionType(sig, wasm);
-    import->type = functionType->name;
-    FunctionTypeUtils::fillFunction(import, functionType);
-    wasm->addFunction(import);
+    return imports;
   }
 };
 
-Pass* createInstrumentLocalsPass() { return new InstrumentLocals(); }
+Pass* createInstrumentLocalsPass() {
+  return new Instrument<InstrumentLocals>();
+}
 
 } // namespace wasm
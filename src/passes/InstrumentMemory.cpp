@@ -51,11 +51,11 @@
 //     (i32.const 4)
 //    )
 //   )
+//
+// With --pass-arg=trace-buffer@START,SIZE the pointers and values are
+// recorded in a buffer in memory instead, see instrumentation.h.
 
-#include "asm_v_wasm.h"
-#include "asmjs/shared-constants.h"
-#include "ir/function-type-utils.h"
-#include "shared-constants.h"
+#include "instrumentation.h"
 #include <pass.h>
 #include <wasm-builder.h>
 #include <wasm.h>
@@ -75,17 +75,21 @@ static Name store_val_f64("store_val_f64");
 
 // TODO: Add support for atomicRMW/cmpxchg
 
-struct InstrumentMemory : public WalkerPass<PostWalker<InstrumentMemory>> {
+struct InstrumentMemory : public InstrumentationWalker<InstrumentMemory> {
+  using InstrumentationWalker::InstrumentationWalker;
+
   void visitLoad(Load* curr) {
-    id++;
+    auto* func = getFunction();
+    auto id = instrumentation->newSite(func);
     Builder builder(*getModule());
-    curr->ptr =
-      builder.makeCall(load_ptr,
-                       {builder.makeConst(Literal(int32_t(id))),
-                        builder.makeConst(Literal(int32_t(curr->bytes))),
-                        builder.makeConst(Literal(int32_t(curr->offset.addr))),
-                        curr->ptr},
-                       i32);
+    curr->ptr = instrumentation->makeEvent(
+      func,
+      id,
+      load_ptr,
+      {builder.makeConst(Literal(int32_t(curr->bytes))),
+       builder.makeConst(Literal(int32_t(curr->offset.addr)))},
+      curr->ptr,
+      i32);
     Name target;
     switch (curr->type) {
       case i32:
@@ -103,20 +107,22 @@ struct InstrumentMemory : public WalkerPass<PostWalker<InstrumentMemory>> {
       default:
         return; // TODO: other types, unreachable, etc.
     }
-    replaceCurrent(builder.makeCall(
-      target, {builder.makeConst(Literal(int32_t(id))), curr}, curr->type));
+    replaceCurrent(
+      instrumentation->makeEvent(func, id, target, {}, curr, curr->type));
   }
 
   void visitStore(Store* curr) {
-    id++;
+    auto* func = getFunction();
+    auto id = instrumentation->newSite(func);
     Builder builder(*getModule());
-    curr->ptr =
-      builder.makeCall(store_ptr,
-                       {builder.makeConst(Literal(int32_t(id))),
-                        builder.makeConst(Literal(int32_t(curr->bytes))),
-                        builder.makeConst(Literal(int32_t(curr->offset.addr))),
-                        curr->ptr},
-                       i32);
+    curr->ptr = instrumentation->makeEvent(
+      func,
+      id,
+      store_ptr,
+      {builder.makeConst(Literal(int32_t(curr->bytes))),
+       builder.makeConst(Literal(int32_t(curr->offset.addr)))},
+      curr->ptr,
+      i32);
     Name target;
     switch (curr->value->type) {
       case i32:
@@ -134,40 +140,27 @@ struct InstrumentMemory : public WalkerPass<PostWalker<InstrumentMemory>> {
       default:
         return; // TODO: other types, unreachable, etc.
     }
-    curr->value =
-      builder.makeCall(target,
-                       {builder.makeConst(Literal(int32_t(id))), curr->value},
-                       curr->value->type);
+    curr->value = instrumentation->makeEvent(
+      func, id, target, {}, curr->value, curr->value->type);
   }
 
-  void visitModule(Module* curr) {
-    addImport(curr, load_ptr, "iiiii");
-    addImport(curr, load_val_i32, "iii");
-    addImport(curr, load_val_i64, "jij");
-    addImport(curr, load_val_f32, "fif");
-    addImport(curr, load_val_f64, "did");
-    addImport(curr, store_ptr, "iiiii");
-    addImport(curr, store_val_i32, "iii");
-    addImport(curr, store_val_i64, "jij");
-    addImport(curr, store_val_f32, "fif");
-    addImport(curr, store_val_f64, "did");
-  }
-
-private:
-  Index id;
-
-  void addImport(Module* curr, Name name, std::string sig) {
-    auto import = new Function;
-    import->name = name;
-    import->module = ENV;
-    import->base = name;
-    auto* functionType = ensureFunctionType(sig, curr);
-    import->type = functionType->name;
-    FunctionTypeUtils::fillFunction(import, functionType);
-    curr->addFunction(import);
+  static Instrumentation::Imports getImports(Module* module) {
+    return {{load_ptr, "iiiii"},
+            {load_val_i32, "iii"},
+            {load_val_i64, "jij"},
+            {load_val_f32, "fif"},
+            {load_val_f64, "did"},
+            {store_ptr, "iiiii"},
+            {store_val_i32, "iii"},
+            {store_val_i64, "jij"},
+            {store_val_f32, "fif"},
+            {store_val_f64, "did"}};
   }
 };
 
-Pass* createInstrumentMemoryPass() { return new InstrumentMemory(); }
+// The ids of the sites start from 1.
+Pass* createInstrumentMemoryPass() {
+  return new Instrument<InstrumentMemory>(1);
+}
 
 } // namespace wasm
@@ -109,9 +109,9 @@ struct LegalizeJSInterface : public Pass {
       }
     }
     if (!illegalImportsToLegal.empty()) {
-      for (auto& pair : illegalImportsToLegal) {
-        module->removeFunction(pair.first);
-      }
+      module->removeFunctions([&](Function* func) {
+        return illegalImportsToLegal.count(func->name) > 0;
+      });
 
       // fix up imports: call_import of an illegal must be turned to a call of a
       // legal
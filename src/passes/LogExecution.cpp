@@ -27,11 +27,11 @@
 // instruments say a return, there will be no code run in the return's
 // value.
 //
+// With --pass-arg=trace-buffer@START,SIZE the ids are recorded in a buffer
+// in memory instead, see instrumentation.h.
+//
 
-#include "asm_v_wasm.h"
-#include "asmjs/shared-constants.h"
-#include "ir/function-type-utils.h"
-#include "shared-constants.h"
+#include "instrumentation.h"
 #include <pass.h>
 #include <wasm-builder.h>
 #include <wasm.h>
@@ -40,7 +40,9 @@ namespace wasm {
 
 Name LOGGER("log_execution");
 
-struct LogExecution : public WalkerPass<PostWalker<LogExecution>> {
+struct LogExecution : public InstrumentationWalker<LogExecution> {
+  using InstrumentationWalker::InstrumentationWalker;
+
   void visitLoop(Loop* curr) { curr->body = makeLogCall(curr->body); }
 
   void visitReturn(Return* curr) { replaceCurrent(makeLogCall(curr)); }
@@ -57,29 +59,21 @@ struct LogExecution : public WalkerPass<PostWalker<LogExecution>> {
     curr->body = makeLogCall(curr->body);
   }
 
-  void visitModule(Module* curr) {
-    // Add the import
-    auto import = new Function;
-    import->name = LOGGER;
-    import->module = ENV;
-    import->base = LOGGER;
-    auto* functionType = ensureFunctionType("vi", curr);
-    import->type = functionType->name;
-    FunctionTypeUtils::fillFunction(import, functionType);
-    curr->addFunction(import);
+  static Instrumentation::Imports getImports(Module* module) {
+    return {{LOGGER, "vi"}};
   }
 
 private:
   Expression* makeLogCall(Expression* curr) {
-    static Index id = 0;
+    auto* func = getFunction();
     Builder builder(*getModule());
     return builder.makeSequence(
-      builder.makeCall(
-        LOGGER, {builder.makeConst(Literal(int32_t(id++)))}, none),
+      instrumentation->makeEvent(
+        func, instrumentation->newSite(func), LOGGER, {}, nullptr, none),
       curr);
   }
 };
 
-Pass* createLogExecutionPass() { return new LogExecution(); }
+Pass* createLogExecutionPass() { return new Instrument<LogExecution>(); }
 
 } // namespace wasm
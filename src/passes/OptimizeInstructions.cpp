@@ -21,16 +21,16 @@
 #include <algorithm>
 
 #include <ir/abstract.h>
+#include <ir/bits.h>
 #include <ir/cost.h>
 #include <ir/effects.h>
+#include <ir/iteration.h>
 #include <ir/literal-utils.h>
 #include <ir/load-utils.h>
 #include <ir/manipulation.h>
 #include <ir/properties.h>
 #include <ir/utils.h>
 #include <pass.h>
-#include <support/threads.h>
-#include <wasm-s-parser.h>
 #include <wasm.h>
 
 // TODO: Use the new sign-extension opcodes where appropriate. This needs to be
@@ -38,158 +38,6 @@
 
 namespace wasm {
 
-Name I32_EXPR = "i32.expr";
-Name I64_EXPR = "i64.expr";
-Name F32_EXPR = "f32.expr";
-Name F64_EXPR = "f64.expr";
-Name ANY_EXPR = "any.expr";
-
-// Utilities
-
-// returns the maximum amount of bits used in an integer expression
-// not extremely precise (doesn't look into add operands, etc.)
-// LocalInfoProvider is an optional class that can provide answers about
-// local.get.
-template<typename LocalInfoProvider>
-Index getMaxBits(Expression* curr, LocalInfoProvider* localInfoProvider) {
-  if (auto* const_ = curr->dynCast<Const>()) {
-    switch (curr->type) {
-      case i32:
-        return 32 - const_->value.countLeadingZeroes().geti32();
-      case i64:
-        return 64 - const_->value.countLeadingZeroes().geti64();
-      default:
-        WASM_UNREACHABLE();
-    }
-  } else if (auto* binary = curr->dynCast<Binary>()) {
-    switch (binary->op) {
-      // 32-bit
-      case AddInt32:
-      case SubInt32:
-      case MulInt32:
-      case DivSInt32:
-      case DivUInt32:
-      case RemSInt32:
-      case RemUInt32:
-      case RotLInt32:
-      case RotRInt32:
-        return 32;
-      case AndInt32:
-        return std::min(getMaxBits(binary->left, localInfoProvider),
-                        getMaxBits(binary->right, localInfoProvider));
-      case OrInt32:
-      case XorInt32:
-        return std::max(getMaxBits(binary->left, localInfoProvider),
-                        getMaxBits(binary->right, localInfoProvider));
-      case ShlInt32: {
-        if (auto* shifts = binary->right->dynCast<Const>()) {
-          return std::min(Index(32),
-                          getMaxBits(binary->left, localInfoProvider) +
-                            Bits::getEffectiveShifts(shifts));
-        }
-        return 32;
-      }
-      case ShrUInt32: {
-        if (auto* shift = binary->right->dynCast<Const>()) {
-          auto maxBits = getMaxBits(binary->left, localInfoProvider);
-          auto shifts =
-            std::min(Index(Bits::getEffectiveShifts(shift)),
-                     maxBits); // can ignore more shifts than zero us out
-          return std::max(Index(0), maxBits - shifts);
-        }
-        return 32;
-      }
-      case ShrSInt32: {
-        if (auto* shift = binary->right->dynCast<Const>()) {
-          auto maxBits = getMaxBits(binary->left, localInfoProvider);
-          if (maxBits == 32) {
-            return 32;
-          }
-          auto shifts =
-            std::min(Index(Bits::getEffectiveShifts(shift)),
-                     maxBits); // can ignore more shifts than zero us out
-          return std::max(Index(0), maxBits - shifts);
-        }
-        return 32;
-      }
-      // 64-bit TODO
-      // comparisons
-      case EqInt32:
-      case NeInt32:
-      case LtSInt32:
-      case LtUInt32:
-      case LeSInt32:
-      case LeUInt32:
-      case GtSInt32:
-      case GtUInt32:
-      case GeSInt32:
-      case GeUInt32:
-      case EqInt64:
-      case NeInt64:
-      case LtSInt64:
-      case LtUInt64:
-      case LeSInt64:
-      case LeUInt64:
-      case GtSInt64:
-      case GtUInt64:
-      case GeSInt64:
-      case GeUInt64:
-      case EqFloat32:
-      case NeFloat32:
-      case LtFloat32:
-      case LeFloat32:
-      case GtFloat32:
-      case GeFloat32:
-      case EqFloat64:
-      case NeFloat64:
-      case LtFloat64:
-      case LeFloat64:
-      case GtFloat64:
-      case GeFloat64:
-        return 1;
-      default: {}
-    }
-  } else if (auto* unary = curr->dynCast<Unary>()) {
-    switch (unary->op) {
-      case ClzInt32:
-      case CtzInt32:
-      case PopcntInt32:
-        return 6;
-      case ClzInt64:
-      case CtzInt64:
-      case PopcntInt64:
-        return 7;
-      case EqZInt32:
-      case EqZInt64:
-        return 1;
-      case WrapInt64:
-        return std::min(Index(32), getMaxBits(unary->value, localInfoProvider));
-      default: {}
-    }
-  } else if (auto* set = curr->dynCast<LocalSet>()) {
-    // a tee passes through the value
-    return getMaxBits(set->value, localInfoProvider);
-  } else if (auto* get = curr->dynCast<LocalGet>()) {
-    return localInfoProvider->getMaxBitsForLocal(get);
-  } else if (auto* load = curr->dynCast<Load>()) {
-    // if signed, then the sign-extension might fill all the bits
-    // if unsigned, then we have a limit
-    if (LoadUtils::isSignRelevant(load) && !load->signed_) {
-      return 8 * load->bytes;
-    }
-  }
-  switch (curr->type) {
-    case i32:
-      return 32;
-    case i64:
-      return 64;
-    case unreachable:
-      return 64; // not interesting, but don't crash
-    default:
-      WASM_UNREACHABLE();
-  }
-}
-
 // Useful information about locals
 struct LocalInfo {
   static const Index kUnknown = Index(-1);
@@ -200,8 +48,10 @@ struct LocalInfo {
 
 struct LocalScanner : PostWalker<LocalScanner> {
   std::vector<LocalInfo>& localInfo;
+  MaxBits<LocalScanner> maxBits;
 
-  LocalScanner(std::vector<LocalInfo>& localInfo) : localInfo(localInfo) {}
+  LocalScanner(std::vector<LocalInfo>& localInfo)
+    : localInfo(localInfo), maxBits(this) {}
 
   void doWalkFunction(Function* func) {
     // prepare
@@ -238,7 +88,7 @@ struct LocalScanner : PostWalker<LocalScanner> {
     // an integer var, worth processing
     auto* value = Properties::getFallthrough(curr->value);
     auto& info = localInfo[curr->index];
-    info.maxBits = std::max(info.maxBits, getMaxBits(value, this));
+    info.maxBits = std::max(info.maxBits, maxBits.get(value));
     auto signExtBits = LocalInfo::kUnknown;
     if (Properties::getSignExtValue(value)) {
       signExtBits = Properties::getSignExtBits(value);
@@ -255,7 +105,7 @@ struct LocalScanner : PostWalker<LocalScanner> {
     }
   }
 
-  // define this for the templated getMaxBits method. we know nothing here yet
+  // define this for MaxBits. we know nothing here yet
   // about locals, so return the maxes
   Index getMaxBitsForLocal(LocalGet* get) { return getBitsForType(get->type); }
 
@@ -280,11 +130,7 @@ struct OptimizeInstructions
 
   Pass* create() override { return new OptimizeInstructions; }
 
-  void prepareToRun(PassRunner* runner, Module* module) override {
-#if 0
-    static DatabaseEnsurer ensurer;
-#endif
-  }
+  OptimizeInstructions() : maxBits(this) {}
 
   void doWalkFunction(Function* func) {
     // first, scan locals
@@ -293,42 +139,28 @@ struct OptimizeInstructions
       scanner.walkFunction(func);
     }
     // main walk
+    maxBits.clear();
     super::doWalkFunction(func);
   }
 
   void visitExpression(Expression* curr) {
-    // we may be able to apply multiple patterns, one may open opportunities
-    // that look deeper NB: patterns must not have cycles
-    while (1) {
-      auto* handOptimized = handOptimize(curr);
-      if (handOptimized) {
-        curr = handOptimized;
-        replaceCurrent(curr);
-        continue;
+    // we may be able to apply multiple optimizations, one may open
+    // opportunities that look deeper NB: optimizations must not have cycles
+    while (auto* optimized = handOptimize(curr)) {
+      // An optimization may modify the expression, the one it returns, and
+      // the children of that, in place. (Those that return nothing only do so
+      // where the bits don't change, or under expressions whose bits do not
+      // depend on their children.)
+      maxBits.forget(curr);
+      maxBits.forget(optimized);
+      for (auto* child : ChildIterator(optimized)) {
+        maxBits.forget(child);
       }
-#if 0
-      auto iter = database->patternMap.find(curr->_id);
-      if (iter == database->patternMap.end()) return;
-      auto& patterns = iter->second;
-      bool more = false;
-      for (auto& pattern : patterns) {
-        Match match(*getModule(), pattern);
-        if (match.check(curr)) {
-          curr = match.apply();
-          replaceCurrent(curr);
-          more = true;
-          break; // exit pattern for loop, return to main while loop
-        }
-      }
-      if (!more) break;
-#else
-      break;
-#endif
+      curr = optimized;
+      replaceCurrent(curr);
     }
   }
 
-  // Optimizations that don't yet fit in the pattern DSL, but could be
-  // eventually maybe
   Expression* handOptimize(Expression* curr) {
     // if this contains dead code, don't bother trying to optimize it, the type
     // might change (if might not be unreachable if just one arm is, for
@@ -364,7 +196,7 @@ struct OptimizeInstructions
         // if the sign-extend input cannot have a sign bit, we don't need it
         // we also don't need it if it already has an identical-sized sign
         // extend
-        if (getMaxBits(ext, this) + extraShifts < bits ||
+        if (maxBits.get(ext) + extraShifts < bits ||
             isSignExted(ext, bits)) {
           return removeAlmostSignExt(binary);
         }
@@ -529,7 +361,7 @@ struct OptimizeInstructions
               return binary->left;
             }
           } else if (auto maskedBits = Bits::getMaskedBits(mask)) {
-            if (getMaxBits(binary->left, this) <= maskedBits) {
+            if (maxBits.get(binary->left) <= maskedBits) {
               // a mask of lower bits is not needed if we are already smaller
               return binary->left;
             }
@@ -629,9 +461,10 @@ struct OptimizeInstructions
         }
       }
       // finally, try more expensive operations on the binary in
-      // the case that they have no side effects
-      if (!EffectAnalyzer(getPassOptions(), binary->left).hasSideEffects()) {
-        if (ExpressionAnalyzer::equal(binary->left, binary->right)) {
+      // the case that they have no side effects (check for equality first,
+      // as that usually fails right away, while effects scan everything)
+      if (ExpressionAnalyzer::equal(binary->left, binary->right)) {
+        if (!EffectAnalyzer(getPassOptions(), binary->left).hasSideEffects()) {
           return optimizeBinaryWithEqualEffectlessChildren(binary);
         }
       }
@@ -883,6 +716,8 @@ private:
   // Information about our locals
   std::vector<LocalInfo> localInfo;
 
+  MaxBits<OptimizeInstructions> maxBits;
+
   // Canonicalizing the order of a symmetric binary helps us
   // write more concise pattern matching code elsewhere.
   void canonicalize(Binary* binary) {
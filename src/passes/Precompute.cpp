@@ -21,6 +21,11 @@
 // The "propagate" variant of this pass also propagates constants across
 // sets and gets, which implements a standard constant propagation.
 //
+// Results are cached per function, so that evaluating an expression reuses
+// what we found for its children when we visited them earlier, including
+// that they could not be precomputed. The total work per function is also
+// bounded, as propagation may take many rounds.
+//
 // Possible nondeterminism: WebAssembly NaN signs are nondeterministic,
 // and this pass may optimize e.g. a float 0 / 0 into +nan while a VM may
 // emit -nan, which can be a noticeable difference if the bits are
@@ -47,17 +52,39 @@ static const Name NOTPRECOMPUTABLE_FLOW("Binaryen|notprecomputable");
 // helpful to avoid platform differences in native stack sizes.
 static const Index MAX_DEPTH = 50;
 
+// Limit the total number of expressions we evaluate in a function, over all
+// rounds of propagation, to this many per expression in it.
+static const Index MAX_VISITS_PER_EXPRESSION = 100;
+
 typedef std::unordered_map<LocalGet*, Literal> GetValues;
 
-// Precomputes an expression. Errors if we hit anything that can't be
-// precomputed.
+typedef std::unordered_map<Expression*, Flow> FlowCache;
+
+static bool isPrecomputable(const Flow& flow) {
+  return !flow.breaking() || flow.breakTo != NOTPRECOMPUTABLE_FLOW;
+}
+
+// Precomputes an expression. Returns a NOTPRECOMPUTABLE_FLOW if we hit
+// anything that can't be precomputed.
 class PrecomputingExpressionRunner
   : public ExpressionRunner<PrecomputingExpressionRunner> {
+  typedef ExpressionRunner<PrecomputingExpressionRunner> Super;
+
   Module* module;
 
   // map gets to constant values, if they are known to be constant
   GetValues& getValues;
 
+  // the results of expressions we already evaluated
+  FlowCache& cache;
+
+  // Whether we can cache failures. We can't while the values of gets are
+  // still being found, as a failure may turn into a success later.
+  bool cacheFailures;
+
+  // how many more expressions we may evaluate
+  size_t& budget;
+
   // Whether we are trying to precompute down to an expression (which we can do
   // on say 5 + 6) or to a value (which we can't do on a local.tee that flows a
   // 7 through it). When we want to replace the expression, we can only do so
@@ -68,13 +95,47 @@ class PrecomputingExpressionRunner
 public:
   PrecomputingExpressionRunner(Module* module,
                                GetValues& getValues,
+                               FlowCache& cache,
+                               bool cacheFailures,
+                               size_t& budget,
                                bool replaceExpression)
-    : ExpressionRunner<PrecomputingExpressionRunner>(MAX_DEPTH), module(module),
-      getValues(getValues), replaceExpression(replaceExpression) {}
+    : Super(MAX_DEPTH), module(module), getValues(getValues), cache(cache),
+      cacheFailures(cacheFailures), budget(budget),
+      replaceExpression(replaceExpression) {}
 
-  struct NonstandaloneException {
-  }; // TODO: use a flow with a special name, as this is likely very slow
+  // Thrown on a trap, and caught right away in doVisit(). Most of what we
+  // can't precompute returns a NOTPRECOMPUTABLE_FLOW instead, but arithmetic
+  // traps happen deep inside the generic interpreter code.
+  struct NonstandaloneException {};
 
+  Flow doVisit(Expression* curr) {
+    auto iter = cache.find(curr);
+    if (iter != cache.end()) {
+      return iter->second;
+    }
+    Flow flow(NOTPRECOMPUTABLE_FLOW);
+    if (budget == 0) {
+      return flow;
+    }
+    auto oldBudget = budget--;
+    auto oldDepth = depth;
+    try {
+      flow = Super::doVisit(curr);
+    } catch (NonstandaloneException&) {
+      // the visits we unwound did not restore the depth
+      depth = oldDepth;
+    }
+    // Only cache what took more than this one visit: anything else is
+    // cheaper to recompute than to cache.
+    if (budget + 1 < oldBudget && (cacheFailures || isPrecomputable(flow))) {
+      cache[curr] = flow;
+    }
+    return flow;
+  }
+
+  Flow visitUnreachable(Unreachable* curr) {
+    return Flow(NOTPRECOMPUTABLE_FLOW);
+  }
   Flow visitLoop(Loop* curr) {
     // loops might be infinite, so must be careful
     // but we can't tell if non-infinite, since we don't have state, so loops
@@ -154,14 +215,24 @@ struct Precompute
 
   GetValues getValues;
 
+  // The results of precomputing expressions in this round, when we want to
+  // replace them and when we just want their values, which can differ.
+  FlowCache expressionCache, valueCache;
+
+  // how many more expressions we may evaluate in this function
+  size_t budget;
+
   bool worked;
 
   void doWalkFunction(Function* func) {
+    budget = size_t(MAX_VISITS_PER_EXPRESSION) * Measurer::measure(func->body);
     // if propagating, we may need multiple rounds: each propagation can
     // lead to the main walk removing code, which might open up more
     // propagation opportunities
     do {
       getValues.clear();
+      expressionCache.clear();
+      valueCache.clear();
       // with extra effort, we can utilize the get-set graph to precompute
       // things that use locals that are known to be constant. otherwise,
       // we just look at what is immediately before us
@@ -171,7 +242,7 @@ struct Precompute
       // do the main walk over everything
       worked = false;
       super::doWalkFunction(func);
-    } while (propagate && worked);
+    } while (propagate && worked && budget > 0);
   }
 
   void visitExpression(Expression* curr) {
@@ -265,13 +336,16 @@ private:
   // Precompute an expression, returning a flow, which may be a constant
   // (that we can replace the expression with if replaceExpression is set).
   Flow precomputeExpression(Expression* curr, bool replaceExpression = true) {
-    try {
-      return PrecomputingExpressionRunner(
-               getModule(), getValues, replaceExpression)
-        .visit(curr);
-    } catch (PrecomputingExpressionRunner::NonstandaloneException&) {
-      return Flow(NOTPRECOMPUTABLE_FLOW);
-    }
+    // Once we have all the values of gets, a failure is final. Until then,
+    // which is while we compute values for propagation, it may not be.
+    auto& cache = replaceExpression ? expressionCache : valueCache;
+    return PrecomputingExpressionRunner(getModule(),
+                                        getValues,
+                                        cache,
+                                        replaceExpression,
+                                        budget,
+                                        replaceExpression)
+      .visit(curr);
   }
 
   // Precomputes the value of an expression, as opposed to the expression
@@ -22,7 +22,6 @@
 // look at all the rest of the code).
 //
 
-#include "ir/module-utils.h"
 #include "pass.h"
 #include "wasm.h"
 
@@ -45,9 +44,6 @@ struct RemoveImports : public WalkerPass<PostWalker<RemoveImports>> {
   }
 
   void visitModule(Module* curr) {
-    std::vector<Name> names;
-    ModuleUtils::iterImportedFunctions(
-      *curr, [&](Function* func) { names.push_back(func->name); });
     // Do not remove names referenced in a table
     std::set<Name> indirectNames;
     if (curr->table.exists) {
@@ -57,11 +53,9 @@ struct RemoveImports : public WalkerPass<PostWalker<RemoveImports>> {
         }
       }
     }
-    for (auto& name : names) {
-      if (indirectNames.find(name) == indirectNames.end()) {
-        curr->removeFunction(name);
-      }
-    }
+    curr->removeFunctions([&](Function* func) {
+      return func->imported() && indirectNames.count(func->name) == 0;
+    });
   }
 };
 
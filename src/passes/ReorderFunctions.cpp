@@ -26,9 +26,14 @@
 // order, the has some natural tendency one way or the other). TODO: investigate
 // similarity ordering here.
 //
+// If a profile is given (see ir/profile.h), functions are sorted by how many
+// times they were called in it instead, so that hot code is together, using
+// the static use count to break ties.
+//
 
 #include <memory>
 
+#include <ir/profile.h>
 #include <pass.h>
 #include <wasm.h>
 
@@ -75,11 +80,19 @@ struct ReorderFunctions : public Pass {
         counts[curr]++;
       }
     }
+    auto profile = Profile::fromOptions(runner->options);
     // sort
     std::sort(module->functions.begin(),
               module->functions.end(),
-              [&counts](const std::unique_ptr<Function>& a,
-                        const std::unique_ptr<Function>& b) -> bool {
+              [&counts, &profile](const std::unique_ptr<Function>& a,
+                                  const std::unique_ptr<Function>& b) -> bool {
+                if (profile) {
+                  auto aCount = profile->getCount(a->name);
+                  auto bCount = profile->getCount(b->name);
+                  if (aCount != bCount) {
+                    return aCount > bCount;
+                  }
+                }
                 if (counts[a->name] == counts[b->name]) {
                   return strcmp(a->name.str, b->name.str) > 0;
                 }
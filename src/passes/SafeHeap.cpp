@@ -19,14 +19,29 @@
 // for dereferencing 0 (null pointer access), reading past the valid
 // top of sbrk()-addressible memory, and incorrect alignment notation.
 //
+// Accesses that are proven to be in bounds and aligned are not checked. An
+// access is in bounds if it is inside the static data, which is always below
+// the top of sbrk()-addressible memory, and above the low memory that is never
+// valid; see PointerAnalysis for how pointers are followed.
+//
+// By default the checks are done by calling a helper function for each type
+// of access. With --pass-arg=safe-heap-inline they are inlined instead, and
+// only the checks that are needed are done, which is faster but larger. The
+// helper functions are not added in that mode.
+//
+
+#include <limits>
 
 #include "asm_v_wasm.h"
 #include "asmjs/shared-constants.h"
 #include "ir/bits.h"
+#include "ir/find_all.h"
 #include "ir/function-type-utils.h"
 #include "ir/import-utils.h"
 #include "ir/load-utils.h"
+#include "ir/local-graph.h"
 #include "pass.h"
+#include "support/bits.h"
 #include "wasm-builder.h"
 #include "wasm.h"
 
@@ -66,52 +81,308 @@ static Name getStoreName(Store* curr) {
   return ret;
 }
 
+// What is known about an i32 value: a range that it is in, and how many of its
+// low bits are zero.
+struct PointerInfo {
+  uint32_t min;
+  uint32_t max;
+  Index zeroBits;
+
+  static PointerInfo any() {
+    return {0, std::numeric_limits<uint32_t>::max(), 0};
+  }
+
+  // Nothing yet, see PointerAnalysis.
+  static PointerInfo none() {
+    return {std::numeric_limits<uint32_t>::max(), 0, 32};
+  }
+
+  static PointerInfo constant(uint32_t value) {
+    return {value, value, Index(CountTrailingZeroes(value))};
+  }
+
+  bool isNone() const { return min > max; }
+
+  void merge(const PointerInfo& other) {
+    min = std::min(min, other.min);
+    max = std::max(max, other.max);
+    zeroBits = std::min(zeroBits, other.zeroBits);
+  }
+
+  bool operator==(const PointerInfo& other) const {
+    return min == other.min && max == other.max && zeroBits == other.zeroBits;
+  }
+};
+
+// Finds what is known about the pointers in a function. Locals are followed
+// through the sets that can reach each get. The values of the sets are found
+// optimistically, starting from nothing and growing until nothing changes, so
+// that loop induction variables like i = i + 4 are known to stay aligned.
+// Their ranges would keep growing, and so are widened to everything.
+struct PointerAnalysis {
+  PointerAnalysis(Function* func) : func(func) {}
+
+  PointerInfo get(Expression* curr) {
+    if (auto* c = curr->dynCast<Const>()) {
+      if (c->type == i32) {
+        return PointerInfo::constant(c->value.geti32());
+      }
+    } else if (auto* localGet = curr->dynCast<LocalGet>()) {
+      return getLocal(localGet);
+    } else if (auto* set = curr->dynCast<LocalSet>()) {
+      return get(set->value);
+    } else if (auto* select = curr->dynCast<Select>()) {
+      auto info = get(select->ifTrue);
+      info.merge(get(select->ifFalse));
+      return info;
+    } else if (auto* binary = curr->dynCast<Binary>()) {
+      return getBinary(binary);
+    }
+    return PointerInfo::any();
+  }
+
+private:
+  Function* func;
+  std::unique_ptr<LocalGraph> graph;
+  std::unordered_map<LocalSet*, PointerInfo> setInfos;
+
+  // How many times the range of a set can grow before it is widened.
+  static const Index MAX_GROWTH = 3;
+  // How many rounds to look for a fixed point in before giving up.
+  static const Index MAX_ROUNDS = 20;
+
+  void compute() {
+    graph = make_unique<LocalGraph>(func);
+    FindAll<LocalSet> sets(func->body);
+    std::unordered_map<LocalSet*, Index> growths;
+    for (Index round = 0; round < MAX_ROUNDS; round++) {
+      bool changed = false;
+      for (auto* set : sets.list) {
+        if (set->value->type != i32) {
+          continue;
+        }
+        auto info = get(set->value);
+        auto iter = setInfos.find(set);
+        if (iter != setInfos.end()) {
+          auto& old = iter->second;
+          info.merge(old);
+          if (info == old) {
+            continue;
+          }
+          if ((info.min != old.min || info.max != old.max) &&
+              ++growths[set] > MAX_GROWTH) {
+            info.min = 0;
+            info.max = std::numeric_limits<uint32_t>::max();
+          }
+        }
+        setInfos[set] = info;
+        changed = true;
+      }
+      if (!changed) {
+        return;
+      }
+    }
+    for (auto& pair : setInfos) {
+      pair.second = PointerInfo::any();
+    }
+  }
+
+  PointerInfo getLocal(LocalGet* curr) {
+    if (!graph) {
+      compute();
+    }
+    auto iter = graph->getSetses.find(curr);
+    if (iter == graph->getSetses.end()) {
+      return PointerInfo::any();
+    }
+    auto info = PointerInfo::none();
+    for (auto* set : iter->second) {
+      if (!set) {
+        info.merge(func->isParam(curr->index) ? PointerInfo::any()
+                                              : PointerInfo::constant(0));
+      } else {
+        auto setIter = setInfos.find(set);
+        if (setIter != setInfos.end()) {
+          info.merge(setIter->second);
+        }
+      }
+    }
+    return info;
+  }
+
+  PointerInfo getBinary(Binary* curr) {
+    auto left = get(curr->left);
+    auto right = get(curr->right);
+    if (left.isNone() || right.isNone()) {
+      return PointerInfo::none();
+    }
+    auto info = PointerInfo::any();
+    const uint64_t maxValue = std::numeric_limits<uint32_t>::max();
+    switch (curr->op) {
+      case AddInt32: {
+        info.zeroBits = std::min(left.zeroBits, right.zeroBits);
+        if (uint64_t(left.max) + right.max <= maxValue) {
+          info.min = left.min + right.min;
+          info.max = left.max + right.max;
+        }
+        break;
+      }
+      case SubInt32: {
+        info.zeroBits = std::min(left.zeroBits, right.zeroBits);
+        if (left.min >= right.max) {
+          info.min = left.min - right.max;
+          info.max = left.max - right.min;
+        }
+        break;
+      }
+      case MulInt32: {
+        info.zeroBits = std::min(Index(32), left.zeroBits + right.zeroBits);
+        if (uint64_t(left.max) * right.max <= maxValue) {
+          info.min = left.min * right.min;
+          info.max = left.max * right.max;
+        }
+        break;
+      }
+      case ShlInt32: {
+        if (right.min == right.max) {
+          auto shift = right.min & 31;
+          info.zeroBits = std::min(Index(32), left.zeroBits + shift);
+          if (uint64_t(left.max) << shift <= maxValue) {
+            info.min = left.min << shift;
+            info.max = left.max << shift;
+          }
+        }
+        break;
+      }
+      case ShrUInt32: {
+        if (right.min == right.max) {
+          auto shift = right.min & 31;
+          info.zeroBits = left.zeroBits > shift ? left.zeroBits - shift : 0;
+          info.min = left.min >> shift;
+          info.max = left.max >> shift;
+        }
+        break;
+      }
+      case AndInt32: {
+        info.zeroBits = std::max(left.zeroBits, right.zeroBits);
+        info.max = std::min(left.max, right.max);
+        break;
+      }
+      case RemUInt32: {
+        if (right.min > 0) {
+          info.max = std::min(left.max, right.max - 1);
+        }
+        break;
+      }
+      default: {}
+    }
+    return info;
+  }
+};
+
+struct SafeHeap;
+
 struct AccessInstrumenter : public WalkerPass<PostWalker<AccessInstrumenter>> {
   bool isFunctionParallel() override { return true; }
 
-  AccessInstrumenter* create() override { return new AccessInstrumenter; }
+  AccessInstrumenter(SafeHeap* safeHeap) : safeHeap(safeHeap) {}
 
-  void visitLoad(Load* curr) {
-    if (curr->type == unreachable) {
-      return;
+  AccessInstrumenter* create() override {
+    return new AccessInstrumenter(safeHeap);
+  }
+
+  void doWalkFunction(Function* func) {
+    analysis = make_unique<PointerAnalysis>(func);
+    loadAddress = storeAddress = Index(-1);
+    storeValues.clear();
+    walk(func->body);
+  }
+
+  void visitLoad(Load* curr);
+  void visitStore(Store* curr);
+
+private:
+  SafeHeap* safeHeap;
+  std::unique_ptr<PointerAnalysis> analysis;
+
+  // Locals for inline checks, which are reused in the function: the address
+  // of a load is only live during its checks, and so are the address and
+  // value of a store whose value contains no other store.
+  Index loadAddress;
+  Index storeAddress;
+  std::map<Type, Index> storeValues;
+
+  Index getLocal(Index& local, Type type) {
+    if (local == Index(-1)) {
+      local = Builder::addVar(getFunction(), type);
     }
-    Builder builder(*getModule());
-    replaceCurrent(
-      builder.makeCall(getLoadName(curr),
-                       {
-                         curr->ptr,
-                         builder.makeConst(Literal(int32_t(curr->offset))),
-                       },
-                       curr->type));
+    return local;
   }
 
-  void visitStore(Store* curr) {
-    if (curr->type == unreachable) {
-      return;
+  Expression* makeAddress(Expression* ptr, Address offset) {
+    if (!offset) {
+      return ptr;
     }
     Builder builder(*getModule());
-    replaceCurrent(
-      builder.makeCall(getStoreName(curr),
-                       {
-                         curr->ptr,
-                         builder.makeConst(Literal(int32_t(curr->offset))),
-                         curr->value,
-                       },
-                       none));
+    return builder.makeBinary(
+      AddInt32, ptr, builder.makeConst(Literal(int32_t(offset))));
   }
+
+  bool isInBounds(Expression* ptr, Address offset, Index bytes);
+  bool isAligned(Expression* ptr, Address offset, Index align);
+  void addChecks(Block* block,
+                 Index local,
+                 Type type,
+                 Index bytes,
+                 Index align,
+                 bool inBounds,
+                 bool aligned);
 };
 
 struct SafeHeap : public Pass {
   PassOptions options;
 
+  // The end of the static data, and the lowest valid address.
+  uint64_t staticEnd;
+  uint64_t lowBound;
+
+  // Whether to inline the checks rather than call helper functions.
+  bool inlineChecks;
+
   void run(PassRunner* runner, Module* module) override {
     options = runner->options;
+    inlineChecks =
+      runner->options.getArgumentOrDefault("safe-heap-inline", "") != "";
+    lowBound = options.lowMemoryUnused ? PassOptions::LowMemoryBound : 1;
+    staticEnd = getStaticEnd(module);
     // add imports
     addImports(module);
     // instrument loads and stores
-    AccessInstrumenter().run(runner, module);
-    // add helper checking funcs and imports
-    addGlobals(module, module->features);
+    AccessInstrumenter(this).run(runner, module);
+    // add helper checking funcs and imports, unless the checks are inline and
+    // so do not call them
+    if (!inlineChecks) {
+      addGlobals(module, module->features);
+    }
+  }
+
+  // The static data is in the active segments. The top of sbrk()-addressable
+  // memory is always after it.
+  uint64_t getStaticEnd(Module* module) {
+    uint64_t end = 0;
+    for (auto& segment : module->memory.segments) {
+      if (segment.isPassive) {
+        continue;
+      }
+      auto* offset = segment.offset->dynCast<Const>();
+      if (!offset) {
+        return 0;
+      }
+      end = std::max(end,
+                     uint64_t(uint32_t(offset->value.geti32())) +
+                       segment.data.size());
+    }
+    return end;
   }
 
   Name dynamicTopPtr, getSbrkPtr, sbrk, segfault, alignfault;
@@ -361,6 +632,132 @@ struct SafeHeap : public Pass {
   }
 };
 
+void AccessInstrumenter::visitLoad(Load* curr) {
+  if (curr->type == unreachable) {
+    return;
+  }
+  auto inBounds = isInBounds(curr->ptr, curr->offset, curr->bytes);
+  auto aligned = isAligned(curr->ptr, curr->offset, curr->align);
+  if (inBounds && aligned) {
+    return;
+  }
+  Builder builder(*getModule());
+  if (safeHeap->inlineChecks) {
+    auto local = getLocal(loadAddress, i32);
+    auto* block = builder.makeBlock(
+      builder.makeLocalSet(local, makeAddress(curr->ptr, curr->offset)));
+    addChecks(
+      block, local, curr->type, curr->bytes, curr->align, inBounds, aligned);
+    curr->ptr = builder.makeLocalGet(local, i32);
+    curr->offset = 0;
+    block->list.push_back(curr);
+    block->finalize(curr->type);
+    replaceCurrent(block);
+    return;
+  }
+  replaceCurrent(
+    builder.makeCall(getLoadName(curr),
+                     {
+                       curr->ptr,
+                       builder.makeConst(Literal(int32_t(curr->offset))),
+                     },
+                     curr->type));
+}
+
+void AccessInstrumenter::visitStore(Store* curr) {
+  if (curr->type == unreachable) {
+    return;
+  }
+  auto inBounds = isInBounds(curr->ptr, curr->offset, curr->bytes);
+  auto aligned = isAligned(curr->ptr, curr->offset, curr->align);
+  if (inBounds && aligned) {
+    return;
+  }
+  Builder builder(*getModule());
+  if (safeHeap->inlineChecks) {
+    Index local, value;
+    if (FindAll<Store>(curr->value).list.empty()) {
+      local = getLocal(storeAddress, i32);
+      auto iter = storeValues.find(curr->valueType);
+      if (iter == storeValues.end()) {
+        iter = storeValues
+                 .emplace(curr->valueType,
+                          Builder::addVar(getFunction(), curr->valueType))
+                 .first;
+      }
+      value = iter->second;
+    } else {
+      local = Builder::addVar(getFunction(), i32);
+      value = Builder::addVar(getFunction(), curr->valueType);
+    }
+    auto* block = builder.makeBlock(
+      builder.makeLocalSet(local, makeAddress(curr->ptr, curr->offset)));
+    block->list.push_back(builder.makeLocalSet(value, curr->value));
+    addChecks(block,
+              local,
+              curr->valueType,
+              curr->bytes,
+              curr->align,
+              inBounds,
+              aligned);
+    curr->ptr = builder.makeLocalGet(local, i32);
+    curr->value = builder.makeLocalGet(value, curr->valueType);
+    curr->offset = 0;
+    block->list.push_back(curr);
+    block->finalize(none);
+    replaceCurrent(block);
+    return;
+  }
+  replaceCurrent(
+    builder.makeCall(getStoreName(curr),
+                     {
+                       curr->ptr,
+                       builder.makeConst(Literal(int32_t(curr->offset))),
+                       curr->value,
+                     },
+                     none));
+}
+
+bool AccessInstrumenter::isInBounds(Expression* ptr,
+                                    Address offset,
+                                    Index bytes) {
+  auto info = analysis->get(ptr);
+  return !info.isNone() && info.min + offset.addr >= safeHeap->lowBound &&
+         uint64_t(info.max) + offset.addr + bytes <= safeHeap->staticEnd;
+}
+
+bool AccessInstrumenter::isAligned(Expression* ptr,
+                                   Address offset,
+                                   Index align) {
+  if (align <= 1) {
+    return true;
+  }
+  auto info = analysis->get(ptr);
+  if (info.isNone()) {
+    return false;
+  }
+  auto zeroBits =
+    std::min(info.zeroBits, Index(CountTrailingZeroes(offset.addr)));
+  return zeroBits >= Index(CountTrailingZeroes(align));
+}
+
+void AccessInstrumenter::addChecks(Block* block,
+                                   Index local,
+                                   Type type,
+                                   Index bytes,
+                                   Index align,
+                                   bool inBounds,
+                                   bool aligned) {
+  Builder builder(*getModule());
+  if (!inBounds) {
+    block->list.push_back(
+      safeHeap->makeBoundsCheck(type, builder, local, bytes));
+  }
+  if (!aligned) {
+    block->list.push_back(safeHeap->makeAlignCheck(align, builder, local));
+  }
+}
+
 Pass* createSafeHeapPass() { return new SafeHeap(); }
 
 } // namespace wasm
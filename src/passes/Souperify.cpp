@@ -255,7 +255,7 @@ struct Trace {
              excludeAsChildren.find(node) != excludeAsChildren.end())) {
           auto type = node->getWasmType();
           assert(type.isConcrete());
-          auto* var = Node::makeVar(type);
+          auto* var = new Node(Node::makeVar(type));
           replacements[node] = std::unique_ptr<Node>(var);
           node = var;
           break;
@@ -725,8 +725,7 @@ struct Souperify : public WalkerPass<PostWalker<Souperify>> {
     // If we only want single-use nodes, exclude all the others.
     std::unordered_set<DataFlow::Node*> excludeAsChildren;
     if (singleUseOnly) {
-      for (auto& nodePtr : graph.nodes) {
-        auto* node = nodePtr.get();
+      for (auto* node : graph.nodes) {
         if (node->origin) {
           // TODO: work for identical origins could be saved
           auto uses =
@@ -742,8 +741,7 @@ struct Souperify : public WalkerPass<PostWalker<Souperify>> {
       }
     }
     // Emit possible traces.
-    for (auto& nodePtr : graph.nodes) {
-      auto* node = nodePtr.get();
+    for (auto* node : graph.nodes) {
       // Trace
       if (DataFlow::Trace::isTraceable(node)) {
         DataFlow::Trace trace(graph, node, excludeAsChildren, localGraph);
@@ -0,0 +1,405 @@
+/*
+ * Copyright 2019 WebAssembly Community Group participants
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+//
+// Shared code for the instrumentation passes (log-execution,
+// instrument-memory, instrument-locals).
+//
+// By default, each event calls an import with the id of the site where it
+// happened. That is simple to handle on the host side, but every event is a
+// call out of wasm, which is very slow. With
+//
+//   --pass-arg=trace-buffer@START,SIZE
+//
+// events are instead appended to a buffer of SIZE bytes at address START in
+// linear memory, which the program must leave alone. The host is only called
+// when the buffer is full, through the import env.trace_flush(start, size),
+// and must copy the records out, after which the buffer is filled again from
+// the start, so records are never overwritten before they are flushed. The
+// exported function trace_finish flushes what is left, and should be called
+// when the program is done. With
+//
+//   --pass-arg=trace-sample@N
+//
+// only one in every N events is recorded. Several instrumentation passes
+// can record events in the same buffer, if they are given the same
+// arguments.
+//
+// Each record is an i32 header, (site id << 5) | event, followed by the
+// event's value if it has one. Operands that are fixed for a site, like the
+// offset of a load or the index of a local, are not recorded.
+// scripts/decode_trace.py prints a trace as text.
+//
+
+#ifndef wasm_passes_instrumentation_h
+#define wasm_passes_instrumentation_h
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "asm_v_wasm.h"
+#include "asmjs/shared-constants.h"
+#include "ir/function-type-utils.h"
+#include "pass.h"
+#include "shared-constants.h"
+#include "support/string.h"
+#include "wasm-builder.h"
+#include "wasm.h"
+
+namespace wasm {
+
+// The events that can be recorded in a trace buffer, and the types of their
+// values; the code of an event is its index. This must be kept in sync with
+// scripts/decode_trace.py.
+static const struct {
+  const char* name;
+  Type type;
+} TRACE_EVENTS[] = {
+  {"log_execution", none}, {"load_ptr", i32},      {"load_val_i32", i32},
+  {"load_val_i64", i64},   {"load_val_f32", f32},  {"load_val_f64", f64},
+  {"store_ptr", i32},      {"store_val_i32", i32}, {"store_val_i64", i64},
+  {"store_val_f32", f32},  {"store_val_f64", f64}, {"get_i32", i32},
+  {"get_i64", i64},        {"get_f32", f32},       {"get_f64", f64},
+  {"set_i32", i32},        {"set_i64", i64},       {"set_f32", f32},
+  {"set_f64", f64},
+};
+
+static Name TRACE_FLUSH("trace_flush");
+static Name TRACE_FINISH("trace_finish");
+static Name TRACE_POS("trace_pos");
+static Name TRACE_COUNTDOWN("trace_countdown");
+
+struct Instrumentation {
+  typedef std::vector<std::pair<Name, std::string>> Imports;
+
+  // A record header has the site id above this many bits of event code.
+  static const Index ID_SHIFT = 5;
+
+  static const Index NO_EVENT = Index(-1);
+
+  Instrumentation(PassRunner* runner, Module* module) : module(module) {
+    auto buffer = runner->options.getArgumentOrDefault("trace-buffer", "");
+    if (buffer != "") {
+      String::Split parts(buffer, ",");
+      if (parts.size() != 2) {
+        Fatal() << "trace-buffer must be START,SIZE";
+      }
+      start = std::stoul(parts[0]);
+      size = std::stoul(parts[1]);
+      // there must be room for the largest record, a header and an i64
+      if (size < 12 || uint64_t(start) + size > uint64_t(1) << 32) {
+        Fatal() << "invalid trace-buffer: " << buffer;
+      }
+      buffered = true;
+      idShift = ID_SHIFT;
+    }
+    auto sampleStr = runner->options.getArgumentOrDefault("trace-sample", "");
+    if (sampleStr != "") {
+      if (!buffered) {
+        Fatal() << "trace-sample requires trace-buffer";
+      }
+      sample = std::stoul(sampleStr);
+      if (sample == 0) {
+        Fatal() << "trace-sample must be positive";
+      }
+    }
+    // Fill in the map, as functions are instrumented in parallel (each one
+    // touching only its own entry).
+    for (auto& func : module->functions) {
+      sites[func.get()];
+    }
+    // The functions of a buffer that an earlier pass added must not be
+    // instrumented themselves.
+    if (buffered && module->getFunctionOrNull(TRACE_FINISH)) {
+      traceFunctions.insert(TRACE_FINISH);
+      for (auto type : {none, i32, i64, f32, f64}) {
+        traceFunctions.insert(getRecordFunction(type));
+      }
+    }
+  }
+
+  bool isBuffered() const { return buffered; }
+
+  bool isTraceFunction(Function* func) const {
+    return traceFunctions.count(func->name);
+  }
+
+  // Returns a new site in a function. Sites are numbered from 0 in each
+  // function while the functions are instrumented, and renumber() makes
+  // them unique once they all are.
+  Index newSite(Function* func) { return sites.at(func).count++; }
+
+  // Makes the code to trace an event at a site: a call to the import for the
+  // event with the site id, the operands, and the value, or in buffered mode
+  // a call to record the site id and the value. Either way the call returns
+  // the value, if there is one. Returns nullptr if the event cannot be
+  // recorded in the buffer.
+  Expression* makeEvent(Function* func,
+                        Index site,
+                        Name event,
+                        const std::vector<Expression*>& operands,
+                        Expression* value,
+                        Type type) {
+    Builder builder(*module);
+    std::vector<Expression*> args;
+    Name target;
+    Const* id;
+    if (buffered) {
+      auto code = getEvent(event);
+      if (code == NO_EVENT) {
+        return nullptr;
+      }
+      id = builder.makeConst(Literal(int32_t((site << ID_SHIFT) | code)));
+      args.push_back(id);
+      target = getRecordFunction(type);
+    } else {
+      id = builder.makeConst(Literal(int32_t(site)));
+      args.push_back(id);
+      args.insert(args.end(), operands.begin(), operands.end());
+      target = event;
+    }
+    if (value) {
+      args.push_back(value);
+    }
+    sites.at(func).ids.push_back(id);
+    return builder.makeCall(target, args, type);
+  }
+
+  // Numbers the sites in the order of the functions, starting from firstId.
+  void renumber(Index firstId) {
+    uint64_t base = firstId;
+    for (auto& func : module->functions) {
+      auto& funcSites = sites[func.get()];
+      for (auto* id : funcSites.ids) {
+        id->value = Literal(
+          int32_t(uint32_t(id->value.geti32()) + uint32_t(base << idShift)));
+      }
+      base += funcSites.count;
+    }
+    if (base > uint64_t(1) << (32 - idShift)) {
+      Fatal() << "too many instrumentation sites";
+    }
+  }
+
+  // Adds the imports that the instrumented code calls, or in buffered mode
+  // the buffer and the functions that record events in it.
+  void finish(const Imports& imports) {
+    if (!buffered) {
+      for (auto& import : imports) {
+        addImport(import.first, import.second);
+      }
+      return;
+    }
+    if (!module->memory.exists) {
+      Fatal() << "trace-buffer requires a memory";
+    }
+    Builder builder(*module);
+    // Add what an earlier pass did not.
+    if (!module->getFunctionOrNull(TRACE_FLUSH)) {
+      addImport(TRACE_FLUSH, "vii");
+    }
+    if (!module->getGlobalOrNull(TRACE_POS)) {
+      module->addGlobal(builder.makeGlobal(TRACE_POS,
+                                           i32,
+                                           builder.makeConst(Literal(start)),
+                                           Builder::Mutable));
+    }
+    if (sample > 1 && !module->getGlobalOrNull(TRACE_COUNTDOWN)) {
+      module->addGlobal(
+        builder.makeGlobal(TRACE_COUNTDOWN,
+                           i32,
+                           builder.makeConst(Literal(int32_t(1))),
+                           Builder::Mutable));
+    }
+    std::vector<Type> types;
+    for (auto& import : imports) {
+      auto code = getEvent(import.first);
+      if (code == NO_EVENT) {
+        continue;
+      }
+      auto type = TRACE_EVENTS[code].type;
+      if (std::find(types.begin(), types.end(), type) == types.end()) {
+        types.push_back(type);
+      }
+    }
+    for (auto type : types) {
+      if (!module->getFunctionOrNull(getRecordFunction(type))) {
+        addRecordFunction(type);
+      }
+    }
+    if (module->getFunctionOrNull(TRACE_FINISH)) {
+      return;
+    }
+    auto* body = builder.makeSequence(
+      builder.makeCall(
+        TRACE_FLUSH,
+        {builder.makeConst(Literal(start)),
+         builder.makeBinary(SubInt32,
+                            builder.makeGlobalGet(TRACE_POS, i32),
+                            builder.makeConst(Literal(start)))},
+        none),
+      builder.makeGlobalSet(TRACE_POS, builder.makeConst(Literal(start))));
+    module->addFunction(builder.makeFunction(
+      TRACE_FINISH, std::vector<Type>{}, none, std::vector<Type>{}, body));
+    module->addExport(
+      builder.makeExport(TRACE_FINISH, TRACE_FINISH, ExternalKind::Function));
+  }
+
+  void addImport(Name name, std::string sig) {
+    auto import = new Function;
+    import->name = name;
+    import->module = ENV;
+    import->base = name;
+    auto* functionType = ensureFunctionType(sig, module);
+    import->type = functionType->name;
+    FunctionTypeUtils::fillFunction(import, functionType);
+    module->addFunction(import);
+  }
+
+private:
+  Module* module;
+
+  bool buffered = false;
+  uint32_t start = 0;
+  uint32_t size = 0;
+  uint32_t sample = 1;
+  Index idShift = 0;
+
+  struct Sites {
+    Index count = 0;
+    // the constants holding the ids of the sites, to renumber
+    std::vector<Const*> ids;
+  };
+
+  std::unordered_map<Function*, Sites> sites;
+
+  std::unordered_set<Name> traceFunctions;
+
+  static Index getEvent(Name name) {
+    for (Index i = 0; i < sizeof(TRACE_EVENTS) / sizeof(TRACE_EVENTS[0]); i++) {
+      if (strcmp(name.str, TRACE_EVENTS[i].name) == 0) {
+        return i;
+      }
+    }
+    return NO_EVENT;
+  }
+
+  static Name getRecordFunction(Type type) {
+    return type == none ? Name("trace")
+                        : Name("trace_" + type.toString());
+  }
+
+  // Adds the function that records an event with a value of a type, taking
+  // the header and the value, and returning the value.
+  void addRecordFunction(Type type) {
+    Builder builder(*module);
+    std::vector<Type> params = {i32};
+    if (type != none) {
+      params.push_back(type);
+    }
+    auto getValue = [&]() -> Expression* {
+      return type == none ? nullptr : builder.makeLocalGet(1, type);
+    };
+    auto getPos = [&]() { return builder.makeGlobalGet(TRACE_POS, i32); };
+    auto* body = builder.makeBlock();
+    if (sample > 1) {
+      body->list.push_back(builder.makeGlobalSet(
+        TRACE_COUNTDOWN,
+        builder.makeBinary(SubInt32,
+                           builder.makeGlobalGet(TRACE_COUNTDOWN, i32),
+                           builder.makeConst(Literal(int32_t(1))))));
+      body->list.push_back(
+        builder.makeIf(builder.makeGlobalGet(TRACE_COUNTDOWN, i32),
+                       builder.makeReturn(getValue())));
+      body->list.push_back(builder.makeGlobalSet(
+        TRACE_COUNTDOWN, builder.makeConst(Literal(sample))));
+    }
+    uint32_t recordSize = 4 + (type == none ? 0 : getTypeSize(type));
+    // Flush the buffer if the record does not fit.
+    uint32_t last = start + size - recordSize;
+    body->list.push_back(builder.makeIf(
+      builder.makeBinary(GtUInt32, getPos(), builder.makeConst(Literal(last))),
+      builder.makeCall(TRACE_FINISH, {}, none)));
+    body->list.push_back(
+      builder.makeStore(4, 0, 4, getPos(), builder.makeLocalGet(0, i32), i32));
+    if (type != none) {
+      body->list.push_back(builder.makeStore(
+        getTypeSize(type), 4, 4, getPos(), getValue(), type));
+    }
+    body->list.push_back(builder.makeGlobalSet(
+      TRACE_POS,
+      builder.makeBinary(
+        AddInt32, getPos(), builder.makeConst(Literal(recordSize)))));
+    if (type != none) {
+      body->list.push_back(getValue());
+    }
+    body->finalize();
+    module->addFunction(builder.makeFunction(getRecordFunction(type),
+                                             std::move(params),
+                                             type,
+                                             std::vector<Type>{},
+                                             body));
+  }
+};
+
+// The base of the walkers that instrument functions, which run in parallel.
+template<typename SubType>
+struct InstrumentationWalker : public WalkerPass<PostWalker<SubType>> {
+  bool isFunctionParallel() override { return true; }
+
+  InstrumentationWalker(Instrumentation* instrumentation)
+    : instrumentation(instrumentation) {}
+
+  Pass* create() override { return new SubType(instrumentation); }
+
+  void
+  runOnFunction(PassRunner* runner, Module* module, Function* func) override {
+    if (!instrumentation->isTraceFunction(func)) {
+      WalkerPass<PostWalker<SubType>>::runOnFunction(runner, module, func);
+    }
+  }
+
+protected:
+  Instrumentation* instrumentation;
+};
+
+// Runs an instrumentation walker on the functions, then numbers the sites
+// and adds what the instrumented code calls.
+template<typename T> struct Instrument : public Pass {
+  Instrument(Index firstId = 0) : firstId(firstId) {}
+
+  void run(PassRunner* runner, Module* module) override {
+    Instrumentation instrumentation(runner, module);
+    PassRunner subRunner(module, runner->options);
+    subRunner.setIsNested(true);
+    subRunner.add(make_unique<T>(&instrumentation));
+    subRunner.run();
+    instrumentation.renumber(firstId);
+    instrumentation.finish(T::getImports(module));
+  }
+
+private:
+  Index firstId;
+};
+
+} // namespace wasm
+
+#endif // wasm_passes_instrumentation_h
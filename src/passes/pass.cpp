@@ -23,6 +23,7 @@
 
 #include "ir/hashed.h"
 #include "ir/module-utils.h"
+#include "ir/utils.h"
 #include "pass.h"
 #include "passes/passes.h"
 #include "support/colors.h"
@@ -71,6 +72,11 @@ std::string PassRegistry::getPassDescription(std::string name) {
 
 // PassRunner
 
+// When running function-parallel passes, functions with at least this many
+// expressions are run after the others, one at a time, so that passes can
+// parallelize their work on them instead.
+static const Index LARGE_FUNCTION_SIZE = 100000;
+
 void PassRegistry::registerPasses() {
   registerPass("alignment-lowering",
                "lower unaligned loads and stores to smaller aligned ones",
@@ -98,6 +104,9 @@ void PassRegistry::registerPasses() {
                createCodePushingPass);
   registerPass(
     "code-folding", "fold code, merging duplicates", createCodeFoldingPass);
+  registerPass("compact-arena",
+               "copies the live IR into fresh memory and frees the rest",
+               createCompactArenaPass);
   registerPass("const-hoisting",
                "hoist repeated constants to a local",
                createConstHoistingPass);
@@ -557,6 +566,13 @@ void PassRunner::run() {
       if (stack.size() > 0) {
         // run the stack of passes on all the functions, in parallel
         size_t num = ThreadPool::get()->size();
+        // Functions that are large enough are left for later, and run one at
+        // a time from this thread, so that passes can use the thread pool
+        // for work inside them. That is only possible if the pool is
+        // available to us.
+        bool deferLarge = ThreadPool::get()->availableSize() > 1;
+        std::mutex largeMutex;
+        std::vector<Index> largeFunctions;
         std::vector<std::function<ThreadWorkState()>> doWorkers;
         std::atomic<size_t> nextFunction;
         nextFunction.store(0);
@@ -570,9 +586,15 @@ void PassRunner::run() {
             }
             Function* func = this->wasm->functions[index].get();
             if (!func->imported()) {
-              // do the current task: run all passes on this function
-              for (auto* pass : stack) {
-                runPassOnFunction(pass, func);
+              if (deferLarge &&
+                  Measurer::measure(func->body) >= LARGE_FUNCTION_SIZE) {
+                std::lock_guard<std::mutex> lock(largeMutex);
+                largeFunctions.push_back(index);
+              } else {
+                // do the current task: run all passes on this function
+                for (auto* pass : stack) {
+                  runPassOnFunction(pass, func);
+                }
               }
             }
             if (index + 1 == numFunctions) {
@@ -582,6 +604,12 @@ void PassRunner::run() {
           });
         }
         ThreadPool::get()->work(doWorkers);
+        std::sort(largeFunctions.begin(), largeFunctions.end());
+        for (auto index : largeFunctions) {
+          for (auto* pass : stack) {
+            runPassOnFunction(pass, wasm->functions[index].get());
+          }
+        }
       }
       stack.clear();
     };
@@ -721,6 +749,8 @@ void PassRunner::runPass(Pass* pass) {
 
 void PassRunner::runPassOnFunction(Pass* pass, Function* func) {
   assert(pass->isFunctionParallel());
+  // allocate what the pass creates in the function's own arena
+  MixedArena::Redirect redirect(wasm->allocator, func->arena);
   // function-parallel passes get a new instance per function
   auto instance = std::unique_ptr<Pass>(pass->create());
   std::unique_ptr<AfterEffectFunctionChecker> checker;
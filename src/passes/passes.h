@@ -29,6 +29,7 @@ Pass* createCoalesceLocalsPass();
 Pass* createCoalesceLocalsWithLearningPass();
 Pass* createCodeFoldingPass();
 Pass* createCodePushingPass();
+Pass* createCompactArenaPass();
 Pass* createConstHoistingPass();
 Pass* createDAEPass();
 Pass* createDAEOptimizingPass();
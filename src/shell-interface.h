@@ -142,6 +142,11 @@ struct ShellExternalInterface : ModuleInstance::ExternalInterface {
       // XXX hack for torture tests
       std::cout << "exit()\n";
       throw ExitException();
+    } else if (import->module == Name("asyncify-profile")) {
+      // Events from asyncify's profiling mode, which are interesting to count.
+      std::cout << "asyncify-profile." << import->base << ' '
+                << arguments[0].geti32() << '\n';
+      return Literal();
     }
     Fatal() << "callImport: unknown import: " << import->module.str << "."
             << import->name.str;
@@ -0,0 +1,235 @@
+/*
+ * Copyright 2019 WebAssembly Community Group participants
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+//
+// A map from pointers to values, stored in a single array (open addressing
+// with linear probing), so that it takes no allocation per entry and lookups
+// touch little memory. Null pointers are not valid keys.
+//
+// This has the interface of std::unordered_map that we need, with a few
+// differences: inserting or erasing anything invalidates iterators and
+// references to the values, and the iteration order depends on the pointer
+// values. As in std::unordered_map, the key of an entry is const; the map
+// moves entries between slots by destroying and reconstructing them.
+//
+
+#ifndef wasm_support_pointer_map_h
+#define wasm_support_pointer_map_h
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace wasm {
+
+template<typename K, typename V> class PointerMap {
+public:
+  typedef std::pair<const K, V> Entry;
+  typedef Entry value_type;
+
+private:
+  // a power of 2, or 0 before anything is added
+  std::vector<Entry> slots;
+  size_t used = 0;
+
+  static const size_t MIN_CAPACITY = 8;
+
+  void replace(size_t i, Entry&& entry) {
+    slots[i].~Entry();
+    new (&slots[i]) Entry(std::move(entry));
+  }
+
+  size_t getHome(K key) const {
+    // Fibonacci hashing; the low bits of a pointer are mostly 0
+    return (uint64_t(uintptr_t(key)) * 0x9E3779B97F4A7C15ULL >> 32) &
+           (slots.size() - 1);
+  }
+
+  // Returns the slot of the key, or the empty slot where it would be added.
+  size_t lookup(K key) const {
+    assert(key);
+    auto mask = slots.size() - 1;
+    auto i = getHome(key);
+    while (slots[i].first && slots[i].first != key) {
+      i = (i + 1) & mask;
+    }
+    return i;
+  }
+
+  void grow() {
+    auto capacity = std::max(size_t(MIN_CAPACITY), slots.size() * 2);
+    std::vector<Entry> old(capacity, Entry(nullptr, V()));
+    old.swap(slots);
+    for (auto& slot : old) {
+      if (slot.first) {
+        replace(lookup(slot.first), std::move(slot));
+      }
+    }
+  }
+
+public:
+  template<bool Const> class Iterator {
+    typedef typename std::conditional<Const,
+                                      const PointerMap*,
+                                      PointerMap*>::type Parent;
+    typedef typename std::
+      conditional<Const, const Entry, Entry>::type Value;
+
+    Parent parent;
+    size_t index;
+
+    void skipEmpty() {
+      while (index < parent->slots.size() && !parent->slots[index].first) {
+        index++;
+      }
+    }
+
+    friend class PointerMap;
+
+  public:
+    typedef std::forward_iterator_tag iterator_category;
+    typedef Value value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef Value* pointer;
+    typedef Value& reference;
+
+    Iterator(Parent parent, size_t index) : parent(parent), index(index) {
+      skipEmpty();
+    }
+
+    bool operator==(const Iterator& other) const {
+      return index == other.index;
+    }
+    bool operator!=(const Iterator& other) const { return !(*this == other); }
+
+    Iterator& operator++() {
+      index++;
+      skipEmpty();
+      return *this;
+    }
+
+    Value& operator*() const { return parent->slots[index]; }
+    Value* operator->() const { return &parent->slots[index]; }
+  };
+
+  PointerMap() = default;
+  PointerMap(const PointerMap& other) = default;
+  PointerMap(PointerMap&& other) = default;
+
+  // Entries cannot be assigned, as their keys are const, so copy into a new
+  // array instead.
+  PointerMap& operator=(const PointerMap& other) {
+    PointerMap copy(other);
+    swap(copy);
+    return *this;
+  }
+  PointerMap& operator=(PointerMap&& other) {
+    swap(other);
+    return *this;
+  }
+
+  typedef Iterator<false> iterator;
+  typedef Iterator<true> const_iterator;
+
+  iterator begin() { return iterator(this, 0); }
+  iterator end() { return iterator(this, slots.size()); }
+  const_iterator begin() const { return const_iterator(this, 0); }
+  const_iterator end() const { return const_iterator(this, slots.size()); }
+
+  size_t size() const { return used; }
+  bool empty() const { return used == 0; }
+
+  void clear() {
+    slots.clear();
+    used = 0;
+  }
+
+  void swap(PointerMap& other) {
+    slots.swap(other.slots);
+    std::swap(used, other.used);
+  }
+
+  iterator find(K key) {
+    if (empty()) {
+      return end();
+    }
+    auto i = lookup(key);
+    return slots[i].first ? iterator(this, i) : end();
+  }
+
+  const_iterator find(K key) const {
+    if (empty()) {
+      return end();
+    }
+    auto i = lookup(key);
+    return slots[i].first ? const_iterator(this, i) : end();
+  }
+
+  size_t count(K key) const { return find(key) != end(); }
+
+  V& operator[](K key) {
+    // keep at most 3/4 of the slots full, as runs grow quickly past that
+    if ((used + 1) * 4 > slots.size() * 3) {
+      grow();
+    }
+    auto i = lookup(key);
+    if (!slots[i].first) {
+      replace(i, Entry(key, V()));
+      used++;
+    }
+    return slots[i].second;
+  }
+
+  void erase(iterator iter) {
+    // Move later entries of the same run back into the hole, so that lookups
+    // never need to skip over it.
+    auto mask = slots.size() - 1;
+    auto hole = iter.index;
+    auto i = hole;
+    while (1) {
+      i = (i + 1) & mask;
+      if (!slots[i].first) {
+        break;
+      }
+      auto home = getHome(slots[i].first);
+      // the entry can move to the hole if the hole is on its way from its home
+      if (((i - home) & mask) >= ((i - hole) & mask)) {
+        replace(hole, std::move(slots[i]));
+        hole = i;
+      }
+    }
+    replace(hole, Entry(nullptr, V()));
+    used--;
+  }
+
+  size_t erase(K key) {
+    auto iter = find(key);
+    if (iter == end()) {
+      return 0;
+    }
+    erase(iter);
+    return 1;
+  }
+};
+
+} // namespace wasm
+
+#endif // wasm_support_pointer_map_h
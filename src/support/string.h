@@ -25,6 +25,8 @@
 #include <string>
 #include <vector>
 
+#include "support/utilities.h"
+
 namespace wasm {
 
 namespace String {
@@ -45,6 +45,9 @@ static std::mutex debug;
 
 namespace wasm {
 
+// Whether the current thread is one of the pool's helper threads.
+static thread_local bool isHelperThread = false;
+
 // Thread
 
 Thread::Thread(ThreadPool* parent) : parent(parent) {
@@ -76,6 +79,7 @@ void Thread::work(std::function<ThreadWorkState()> doWork_) {
 
 void Thread::mainLoop(void* self_) {
   auto* self = static_cast<Thread*>(self_);
+  isHelperThread = true;
   while (1) {
     DEBUG_THREAD("checking for work\n");
     {
@@ -168,8 +172,10 @@ ThreadPool* ThreadPool::get() {
 void ThreadPool::work(
   std::vector<std::function<ThreadWorkState()>>& doWorkers) {
   size_t num = threads.size();
-  // If no multiple cores, or on a side thread, do not use worker threads
-  if (num == 0) {
+  // If no multiple cores, or on a side thread, do not use worker threads. The
+  // latter happens when the pool's own work runs nested parallel work, like a
+  // pass runner inside a task; waiting for the pool there would deadlock.
+  if (num == 0 || isHelperThread) {
     // just run sequentially
     DEBUG_POOL("work() sequentially\n");
     assert(doWorkers.size() > 0);
@@ -202,6 +208,32 @@ void ThreadPool::work(
 
 size_t ThreadPool::size() { return std::max(size_t(1), threads.size()); }
 
+size_t ThreadPool::availableSize() { return isHelperThread ? 1 : size(); }
+
+void ThreadPool::runInParallel(size_t numTasks,
+                               std::function<void(size_t)> task) {
+  if (numTasks == 0) {
+    return;
+  }
+  std::atomic<size_t> nextTask;
+  nextTask.store(0);
+  std::vector<std::function<ThreadWorkState()>> doWorkers;
+  for (size_t i = 0; i < size(); i++) {
+    doWorkers.push_back([&]() {
+      auto index = nextTask.fetch_add(1);
+      if (index >= numTasks) {
+        return ThreadWorkState::Finished;
+      }
+      task(index);
+      if (index + 1 >= numTasks) {
+        return ThreadWorkState::Finished;
+      }
+      return ThreadWorkState::More;
+    });
+  }
+  work(doWorkers);
+}
+
 bool ThreadPool::isRunning() {
   DEBUG_POOL("check if running\n");
   return running;
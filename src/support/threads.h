@@ -101,6 +101,14 @@ public:
 
   size_t size();
 
+  // The number of threads that work() uses when called from this thread. That
+  // is 1 on the pool's own threads, where work() runs sequentially.
+  size_t availableSize();
+
+  // Runs task(i) for each i in [0, numTasks), on as many threads as are
+  // available. This blocks until all tasks are complete.
+  void runInParallel(size_t numTasks, std::function<void(size_t)> task);
+
   bool isRunning();
 
   // Called by helper threads when they are free and ready.
@@ -29,21 +29,36 @@ typedef std::vector<Literal> Loggings;
 // Logs every relevant import call parameter.
 struct LoggingExternalInterface : public ShellExternalInterface {
   Loggings& loggings;
+  bool quiet;
 
-  LoggingExternalInterface(Loggings& loggings) : loggings(loggings) {}
+  LoggingExternalInterface(Loggings& loggings, bool quiet = false)
+    : loggings(loggings), quiet(quiet) {}
 
   Literal callImport(Function* import, LiteralList& arguments) override {
     if (import->module == "fuzzing-support") {
-      std::cout << "[LoggingExternalInterface logging";
+      if (!quiet) {
+        std::cout << "[LoggingExternalInterface logging";
+      }
       loggings.push_back(Literal()); // buffer with a None between calls
       for (auto argument : arguments) {
-        std::cout << ' ' << argument;
+        if (!quiet) {
+          std::cout << ' ' << argument;
+        }
         loggings.push_back(argument);
       }
-      std::cout << "]\n";
+      if (!quiet) {
+        std::cout << "]\n";
+      }
     }
     return Literal();
   }
+
+  void trap(const char* why) override {
+    if (!quiet) {
+      std::cerr << "[trap " << why << "]\n";
+    }
+    throw TrapException();
+  }
 };
 
 // gets execution results from a wasm module. this is useful for fuzzing
@@ -53,10 +68,14 @@ struct LoggingExternalInterface : public ShellExternalInterface {
 struct ExecutionResults {
   std::map<Name, Literal> results;
   Loggings loggings;
+  // don't print anything, for when many modules are checked in parallel
+  bool quiet;
+
+  ExecutionResults(bool quiet = false) : quiet(quiet) {}
 
   // get results of execution
   void get(Module& wasm) {
-    LoggingExternalInterface interface(loggings);
+    LoggingExternalInterface interface(loggings, quiet);
     try {
       ModuleInstance instance(wasm, &interface);
       // execute all exported methods (that are therefore preserved through
@@ -65,13 +84,15 @@ struct ExecutionResults {
         if (exp->kind != ExternalKind::Function) {
           continue;
         }
-        std::cout << "[fuzz-exec] calling " << exp->name << "\n";
+        if (!quiet) {
+          std::cout << "[fuzz-exec] calling " << exp->name << "\n";
+        }
         auto* func = wasm.getFunction(exp->value);
         if (func->result != none) {
           // this has a result
           results[exp->name] = run(func, wasm, instance);
           // ignore the result if we hit an unreachable and returned no value
-          if (results[exp->name].type.isConcrete()) {
+          if (!quiet && results[exp->name].type.isConcrete()) {
             std::cout << "[fuzz-exec] note result: " << exp->name << " => "
                       << results[exp->name] << '\n';
           }
@@ -87,7 +108,7 @@ struct ExecutionResults {
 
   // get current results and check them against previous ones
   void check(Module& wasm) {
-    ExecutionResults optimizedResults;
+    ExecutionResults optimizedResults(quiet);
     optimizedResults.get(wasm);
     if (optimizedResults != *this) {
       std::cout << "[fuzz-exec] optimization passes changed execution results";
@@ -95,21 +116,37 @@ struct ExecutionResults {
     }
   }
 
-  bool operator==(ExecutionResults& other) {
+  // compare to other results, returning whether they are identical
+  bool matches(ExecutionResults& other) {
     for (auto& iter : other.results) {
       auto name = iter.first;
       if (results.find(name) == results.end()) {
-        std::cout << "[fuzz-exec] missing " << name << '\n';
-        abort();
+        if (!quiet) {
+          std::cout << "[fuzz-exec] missing " << name << '\n';
+        }
+        return false;
+      }
+      if (!quiet) {
+        std::cout << "[fuzz-exec] comparing " << name << '\n';
       }
-      std::cout << "[fuzz-exec] comparing " << name << '\n';
       if (results[name] != other.results[name]) {
-        std::cout << "not identical!\n";
-        abort();
+        if (!quiet) {
+          std::cout << "not identical!\n";
+        }
+        return false;
       }
     }
     if (loggings != other.loggings) {
-      std::cout << "logging not identical!\n";
+      if (!quiet) {
+        std::cout << "logging not identical!\n";
+      }
+      return false;
+    }
+    return true;
+  }
+
+  bool operator==(ExecutionResults& other) {
+    if (!matches(other)) {
       abort();
     }
     return true;
@@ -118,7 +155,7 @@ struct ExecutionResults {
   bool operator!=(ExecutionResults& other) { return !((*this) == other); }
 
   Literal run(Function* func, Module& wasm) {
-    LoggingExternalInterface interface(loggings);
+    LoggingExternalInterface interface(loggings, quiet);
     try {
       ModuleInstance instance(wasm, &interface);
       return run(func, wasm, instance);
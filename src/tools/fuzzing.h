@@ -112,9 +112,12 @@ public:
         case 12:
           options.passes.push_back("inlining-optimizing");
           break;
-        case 13:
+        case 13: {
+          // local-cse requires flat IR
+          options.passes.push_back("flatten");
           options.passes.push_back("local-cse");
           break;
+        }
         case 14:
           options.passes.push_back("memory-packing");
           break;
@@ -181,8 +184,6 @@ public:
     if (oneIn(2)) {
       options.passOptions.shrinkLevel = upTo(4);
     }
-    std::cout << "opt level: " << options.passOptions.optimizeLevel << '\n';
-    std::cout << "shrink level: " << options.passOptions.shrinkLevel << '\n';
   }
 
   void setAllowNaNs(bool allowNaNs_) { allowNaNs = allowNaNs_; }
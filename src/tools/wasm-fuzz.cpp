@@ -0,0 +1,389 @@
+/*
+ * Copyright 2019 WebAssembly Community Group participants
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+//
+// A long-running fuzzer that does everything in process. Each iteration
+// generates random input from a seed, translates it into a module, picks
+// passes from it, and checks that the passes keep the module valid and do
+// not change its execution results - the same as
+//
+//   wasm-opt INPUT -ttf --fuzz-passes --fuzz-exec
+//
+// but without the process startup and file I/O, and with iterations running
+// in parallel on the thread pool. The input of each failing iteration is
+// saved, so that it can be reproduced with the command above, and so is that
+// of each iteration in flight when we crash. (That is not possible when a
+// pass stops the process using Fatal(); rerun the seeds reported before that
+// with --iterations=1 to find the culprit.) Per-pass statistics are printed
+// at the end.
+//
+
+#include <atomic>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <random>
+
+#include "execution-results.h"
+#include "fuzzing.h"
+#include "ir/utils.h"
+#include "optimization-options.h"
+#include "pass.h"
+#include "support/command-line.h"
+#include "support/threads.h"
+#include "support/timing.h"
+#include "tool-options.h"
+#include "wasm-validator.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+using namespace wasm;
+
+struct PassStats {
+  // how many times the pass ran
+  size_t runs = 0;
+  // how many times running it changed the module
+  size_t changed = 0;
+  // how many failing iterations included it
+  size_t failures = 0;
+  double seconds = 0;
+
+  void merge(const PassStats& other) {
+    runs += other.runs;
+    changed += other.changed;
+    failures += other.failures;
+    seconds += other.seconds;
+  }
+};
+
+typedef std::map<std::string, PassStats> PassStatsMap;
+
+// The iteration a worker is running. This is what we save if we crash, so it
+// is laid out to be usable from a signal handler.
+struct InFlight {
+  std::atomic<bool> active;
+  const char* data = nullptr;
+  size_t size = 0;
+  char path[1024];
+
+  InFlight() { active.store(false); }
+};
+
+static std::vector<std::unique_ptr<InFlight>> inFlight;
+
+// Saves the inputs of all iterations that have not finished. Only uses
+// async-signal-safe calls, as we call this after a crash.
+static void saveInFlightInputs() {
+#ifndef _WIN32
+  for (auto& iteration : inFlight) {
+    if (!iteration->active.load()) {
+      continue;
+    }
+    int fd = open(iteration->path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd >= 0) {
+      auto unused = write(fd, iteration->data, iteration->size);
+      WASM_UNUSED(unused);
+      close(fd);
+    }
+    const char* message = "[wasm-fuzz] crashed, saved input to ";
+    auto unused = write(STDERR_FILENO, message, strlen(message));
+    unused = write(STDERR_FILENO, iteration->path, strlen(iteration->path));
+    unused = write(STDERR_FILENO, "\n", 1);
+    WASM_UNUSED(unused);
+  }
+#endif
+}
+
+#ifndef _WIN32
+static void handleCrash(int sig) {
+  saveInFlightInputs();
+  signal(sig, SIG_DFL);
+  raise(sig);
+}
+#endif
+
+struct Fuzzer {
+  ToolOptions& options;
+  uint64_t seed;
+  size_t iterations;
+  size_t inputSize;
+  std::string outputDir;
+  bool fuzzNaNs, fuzzMemory, fuzzOOB;
+
+  std::atomic<size_t> nextIteration;
+  std::atomic<size_t> finished;
+  std::atomic<size_t> failures;
+  std::mutex mutex;
+  PassStatsMap stats;
+  Timer timer;
+
+  Fuzzer(ToolOptions& options,
+         uint64_t seed,
+         size_t iterations,
+         size_t inputSize,
+         std::string outputDir,
+         bool fuzzNaNs,
+         bool fuzzMemory,
+         bool fuzzOOB)
+    : options(options), seed(seed), iterations(iterations),
+      inputSize(inputSize), outputDir(outputDir), fuzzNaNs(fuzzNaNs),
+      fuzzMemory(fuzzMemory), fuzzOOB(fuzzOOB) {
+    nextIteration.store(0);
+    finished.store(0);
+    failures.store(0);
+  }
+
+  void run() {
+    size_t num = ThreadPool::get()->size();
+    for (size_t i = 0; i < num; i++) {
+      inFlight.emplace_back(make_unique<InFlight>());
+    }
+#ifndef _WIN32
+    for (int sig : {SIGABRT, SIGSEGV, SIGBUS, SIGFPE, SIGILL}) {
+      signal(sig, handleCrash);
+    }
+#endif
+    timer.start();
+    std::vector<std::function<ThreadWorkState()>> doWorkers;
+    std::vector<PassStatsMap> workerStats(num);
+    for (size_t i = 0; i < num; i++) {
+      doWorkers.push_back([&, i]() {
+        auto index = nextIteration.fetch_add(1);
+        if (iterations && index >= iterations) {
+          return ThreadWorkState::Finished;
+        }
+        runIteration(seed + index, *inFlight[i], workerStats[i]);
+        if (iterations && index + 1 >= iterations) {
+          return ThreadWorkState::Finished;
+        }
+        return ThreadWorkState::More;
+      });
+    }
+    ThreadPool::get()->work(doWorkers);
+    timer.stop();
+    for (auto& workerStat : workerStats) {
+      for (auto& pair : workerStat) {
+        stats[pair.first].merge(pair.second);
+      }
+    }
+  }
+
+  std::vector<char> makeInput(uint64_t iterationSeed) {
+    std::mt19937_64 random(iterationSeed);
+    std::vector<char> input(inputSize);
+    for (auto& c : input) {
+      c = char(random());
+    }
+    return input;
+  }
+
+  // a cheap summary of the module's code, to notice when a pass changes it
+  static HashType hashCode(Module& wasm) {
+    HashType digest = HashType(wasm.functions.size());
+    for (auto& func : wasm.functions) {
+      if (!func->imported()) {
+        digest = rehash(digest, ExpressionAnalyzer::hash(func->body));
+        digest = rehash(digest, HashType(func->getNumVars()));
+      }
+    }
+    return digest;
+  }
+
+  void runIteration(uint64_t iterationSeed,
+                    InFlight& current,
+                    PassStatsMap& localStats) {
+    auto input = makeInput(iterationSeed);
+    snprintf(current.path,
+             sizeof(current.path),
+             "%s%swasm-fuzz-%llu.input",
+             outputDir.c_str(),
+             outputDir.empty() ? "" : "/",
+             (unsigned long long)iterationSeed);
+    current.data = input.data();
+    current.size = input.size();
+    current.active.store(true);
+
+    Module wasm;
+    options.applyFeatures(wasm);
+    TranslateToFuzzReader reader(wasm, input);
+    OptimizationOptions passes("wasm-opt", "");
+    passes.passOptions.arguments = options.passOptions.arguments;
+    reader.pickPasses(passes);
+    reader.setAllowNaNs(fuzzNaNs);
+    reader.setAllowMemory(fuzzMemory);
+    reader.setAllowOOB(fuzzOOB);
+    reader.build();
+
+    std::string failure;
+    bool ranPasses = false;
+    auto validationFlags = WasmValidator::Globally | WasmValidator::Quiet;
+    if (!WasmValidator().validate(wasm, validationFlags)) {
+      failure = "translate-to-fuzz generated an invalid module";
+    } else {
+      ExecutionResults before(true);
+      before.get(wasm);
+      for (auto& pass : passes.passes) {
+        auto& passStats = localStats[pass];
+        auto hashBefore = hashCode(wasm);
+        Timer passTimer;
+        passTimer.start();
+        PassRunner runner(&wasm, passes.passOptions);
+        if (pass == OptimizationOptions::DEFAULT_OPT_PASSES) {
+          runner.addDefaultOptimizationPasses();
+        } else {
+          runner.add(pass);
+        }
+        runner.run();
+        passTimer.stop();
+        passStats.runs++;
+        passStats.seconds += passTimer.getTotal();
+        if (hashCode(wasm) != hashBefore) {
+          passStats.changed++;
+        }
+      }
+      ranPasses = true;
+      if (!WasmValidator().validate(wasm, validationFlags)) {
+        failure = "passes generated an invalid module";
+      } else {
+        ExecutionResults after(true);
+        after.get(wasm);
+        if (!after.matches(before)) {
+          failure = "passes changed execution results";
+        }
+      }
+    }
+
+    if (!failure.empty()) {
+      failures++;
+      if (ranPasses) {
+        for (auto& pass : passes.passes) {
+          localStats[pass].failures++;
+        }
+      }
+      std::ofstream file(current.path, std::ios::binary);
+      file.write(input.data(), input.size());
+      std::lock_guard<std::mutex> lock(mutex);
+      std::cerr << "[wasm-fuzz] seed " << iterationSeed << ": " << failure
+                << ", saved input to " << current.path << '\n';
+    }
+    current.active.store(false);
+
+    auto done = ++finished;
+    if (done % 100 == 0 && !options.quiet) {
+      std::lock_guard<std::mutex> lock(mutex);
+      std::cerr << "[wasm-fuzz] iterations: " << done
+                << ", failures: " << failures.load() << '\n';
+    }
+  }
+
+  void dumpStats(std::ostream& o) {
+    o << "[wasm-fuzz] " << finished.load() << " iterations, " << failures.load()
+      << " failures, in " << timer.getTotal() << " seconds\n";
+    o << "pass runs changed failures seconds\n";
+    for (auto& pair : stats) {
+      auto& passStats = pair.second;
+      o << pair.first << ' ' << passStats.runs << ' ' << passStats.changed
+        << ' ' << passStats.failures << ' ' << passStats.seconds << '\n';
+    }
+  }
+};
+
+//
+// main
+//
+
+int main(int argc, const char* argv[]) {
+  uint64_t seed = 0;
+  size_t iterations = 0;
+  size_t inputSize = 4096;
+  std::string outputDir;
+  bool fuzzNaNs = true, fuzzMemory = true, fuzzOOB = true;
+
+  ToolOptions options("wasm-fuzz",
+                      "Generate modules from random inputs, run random passes "
+                      "on them, and check for bugs, all in process");
+  options
+    .add("--seed",
+         "",
+         "The seed of the first iteration, which increases by one for each "
+         "iteration (default: 0)",
+         Options::Arguments::One,
+         [&](Options* o, const std::string& argument) {
+           seed = std::stoull(argument);
+         })
+    .add("--iterations",
+         "-n",
+         "How many iterations to run (default: 0, which runs until stopped)",
+         Options::Arguments::One,
+         [&](Options* o, const std::string& argument) {
+           iterations = std::stoull(argument);
+         })
+    .add("--input-size",
+         "",
+         "The size of the random input of each iteration (default: 4096)",
+         Options::Arguments::One,
+         [&](Options* o, const std::string& argument) {
+           inputSize = std::stoull(argument);
+         })
+    .add("--output-dir",
+         "-o",
+         "An existing directory to save the inputs of failing iterations in "
+         "(default: the current directory)",
+         Options::Arguments::One,
+         [&](Options* o, const std::string& argument) {
+           outputDir = argument;
+         })
+    .add("--no-fuzz-nans",
+         "",
+         "don't emit NaNs when fuzzing",
+         Options::Arguments::Zero,
+         [&](Options* o, const std::string& arguments) { fuzzNaNs = false; })
+    .add("--no-fuzz-memory",
+         "",
+         "don't emit memory ops when fuzzing",
+         Options::Arguments::Zero,
+         [&](Options* o, const std::string& arguments) { fuzzMemory = false; })
+    .add("--no-fuzz-oob",
+         "",
+         "don't emit out-of-bounds loads/stores/indirect calls when fuzzing",
+         Options::Arguments::Zero,
+         [&](Options* o, const std::string& arguments) { fuzzOOB = false; });
+  options.parse(argc, argv);
+
+  if (inputSize == 0) {
+    Fatal() << "the input size must be positive";
+  }
+
+  Fuzzer fuzzer(options,
+                seed,
+                iterations,
+                inputSize,
+                outputDir,
+                fuzzNaNs,
+                fuzzMemory,
+                fuzzOOB);
+  fuzzer.run();
+  fuzzer.dumpStats(std::cout);
+
+  return fuzzer.failures.load() > 0 ? 1 : 0;
+}
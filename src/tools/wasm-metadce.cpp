@@ -318,17 +318,9 @@ public:
   // Apply to the wasm
   void apply() {
     // Remove the unused exports
-    std::vector<Name> toRemove;
-    for (auto& exp : wasm.exports) {
-      auto name = exp->name;
-      auto dceName = exportToDCENode[name];
-      if (reached.find(dceName) == reached.end()) {
-        toRemove.push_back(name);
-      }
-    }
-    for (auto name : toRemove) {
-      wasm.removeExport(name);
-    }
+    wasm.removeExports([&](Export* exp) {
+      return reached.find(exportToDCENode[exp->name]) == reached.end();
+    });
     // Now they are gone, standard optimization passes can do the rest!
     PassRunner passRunner(&wasm);
     passRunner.add("remove-unused-module-elements");
@@ -239,6 +239,8 @@ int main(int argc, const char* argv[]) {
     TranslateToFuzzReader reader(wasm, options.extra["infile"]);
     if (fuzzPasses) {
       reader.pickPasses(options);
+      std::cout << "opt level: " << options.passOptions.optimizeLevel << '\n';
+      std::cout << "shrink level: " << options.passOptions.shrinkLevel << '\n';
     }
     reader.setAllowNaNs(fuzzNaNs);
     reader.setAllowMemory(fuzzMemory);
@@ -25,12 +25,16 @@
 
 #include <cstdio>
 #include <cstdlib>
+#include <functional>
 #include <memory>
+#include <sstream>
 
+#include "execution-results.h"
 #include "ir/branch-utils.h"
 #include "ir/iteration.h"
 #include "ir/literal-utils.h"
 #include "ir/properties.h"
+#include "optimization-options.h"
 #include "pass.h"
 #include "support/colors.h"
 #include "support/command-line.h"
@@ -68,6 +72,10 @@ std::string GetLastErrorStdStr() {
   }
   return std::string();
 }
+#else
+#include <fcntl.h>
+#include <sys/wait.h>
+#include <unistd.h>
 #endif
 using namespace wasm;
 
@@ -193,6 +201,68 @@ struct ProgramResult {
   }
 #endif // _WIN32
 
+#ifndef _WIN32
+  // runs the given work in a forked child process, which sees a copy-on-write
+  // snapshot of our memory, and notes its stdout and exit status just like
+  // for a command. a crash or a timeout in the child is noted as a result,
+  // and does not affect us.
+  void getFromFork(std::function<int()> work) {
+    Timer timer;
+    timer.start();
+    int fds[2];
+    if (pipe(fds) != 0) {
+      Fatal() << "pipe() failed\n";
+    }
+    std::cout.flush();
+    fflush(stdout);
+    pid_t pid = fork();
+    if (pid < 0) {
+      Fatal() << "fork() failed\n";
+    }
+    if (pid == 0) {
+      // child
+      close(fds[0]);
+      dup2(fds[1], STDOUT_FILENO);
+      close(fds[1]);
+      int devNull = open("/dev/null", O_WRONLY);
+      if (devNull >= 0) {
+        dup2(devNull, STDERR_FILENO);
+        close(devNull);
+      }
+      alarm(timeout);
+      int result = work();
+      std::cout.flush();
+      fflush(stdout);
+      _exit(result);
+    }
+    // parent
+    close(fds[1]);
+    output.clear();
+    const int MAX_BUFFER = 1024;
+    char buffer[MAX_BUFFER];
+    ssize_t bytes;
+    while ((bytes = read(fds[0], buffer, MAX_BUFFER)) != 0) {
+      if (bytes < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+        break;
+      }
+      output.append(buffer, bytes);
+    }
+    close(fds[0]);
+    int status;
+    while (waitpid(pid, &status, 0) < 0) {
+      if (errno != EINTR) {
+        Fatal() << "waitpid() failed\n";
+      }
+    }
+    code = status;
+    timer.stop();
+    time = timer.getTotal();
+  }
+#endif // !_WIN32
+
   bool operator==(ProgramResult& other) {
     return code == other.code && output == other.output;
   }
@@ -217,6 +287,107 @@ inline std::ostream& operator<<(std::ostream& o, ProgramResult& result) {
 
 ProgramResult expected;
 
+// Runs a wasm-opt style list of pass arguments, like "--flatten -Os", on a
+// module in this process.
+static void runPassArguments(Module& wasm,
+                             const std::string& arguments,
+                             bool debugInfo) {
+  std::vector<std::string> args = {"wasm-opt"};
+  std::istringstream stream(arguments);
+  std::string arg;
+  while (stream >> arg) {
+    args.push_back(arg);
+  }
+  std::vector<const char*> argv;
+  for (auto& arg : args) {
+    argv.push_back(arg.c_str());
+  }
+  OptimizationOptions options("wasm-opt", "");
+  options.parse(argv.size(), argv.data());
+  if (debugInfo) {
+    options.passOptions.debugInfo = true;
+  }
+  options.runPasses(wasm);
+}
+
+// An in-process alternative to --command, for when the property we are
+// preserving is something Binaryen itself computes (a crash in a pass, a
+// validation error, or a change in execution results). Each candidate is
+// checked in a forked child on its copy of the current module, which avoids
+// writing it out, spawning processes, and parsing it again.
+struct InProcessOracle {
+  enum class Kind {
+    // run the passes, then note whether the module validates
+    Validate,
+    // run the passes, which is interesting if they crash
+    Passes,
+    // note execution results, and if there are passes, check that running
+    // them does not change those results
+    FuzzExec
+  };
+
+  Kind kind;
+  // wasm-opt style pass arguments to run on each candidate, e.g. "-O3"
+  std::string passes;
+  bool debugInfo;
+
+  InProcessOracle(Kind kind, std::string passes, bool debugInfo)
+    : kind(kind), passes(passes), debugInfo(debugInfo) {}
+
+  static Kind parseKind(const std::string& name) {
+    if (name == "validate") {
+      return Kind::Validate;
+    } else if (name == "passes") {
+      return Kind::Passes;
+    } else if (name == "fuzz-exec") {
+      return Kind::FuzzExec;
+    }
+    Fatal() << "unknown oracle: " << name
+            << " (valid oracles are validate, passes, fuzz-exec)\n";
+    WASM_UNREACHABLE();
+  }
+
+  // checks a candidate, printing to stdout and returning an exit code, like
+  // a command would. this may crash, and so it must only be called in a
+  // child process (see ProgramResult::getFromFork).
+  int check(Module& wasm) {
+    // like the -all we pass to wasm-opt when running commands
+    wasm.features = FeatureSet::All;
+    switch (kind) {
+      case Kind::Validate: {
+        runPassArguments(wasm, passes, debugInfo);
+        if (!WasmValidator().validate(wasm)) {
+          std::cout << "[oracle] invalid\n";
+          return 1;
+        }
+        return 0;
+      }
+      case Kind::Passes: {
+        runPassArguments(wasm, passes, debugInfo);
+        return 0;
+      }
+      case Kind::FuzzExec: {
+        ExecutionResults results;
+        results.get(wasm);
+        if (!passes.empty()) {
+          runPassArguments(wasm, passes, debugInfo);
+          results.check(wasm);
+        }
+        return 0;
+      }
+    }
+    WASM_UNREACHABLE();
+  }
+
+  void getResult(Module& wasm, ProgramResult& out) {
+#ifdef _WIN32
+    Fatal() << "in-process oracles are not supported on this platform\n";
+#else
+    out.getFromFork([&]() { return check(wasm); });
+#endif
+  }
+};
+
 // Removing functions is extremely beneficial and efficient. We aggressively
 // try to remove functions, unless we've seen they can't be removed, in which
 // case we may try again but much later.
@@ -226,6 +397,8 @@ struct Reducer
   : public WalkerPass<PostWalker<Reducer, UnifiedExpressionVisitor<Reducer>>> {
   std::string command, test, working;
   bool binary, deNan, verbose, debugInfo;
+  // if provided, used instead of the command
+  InProcessOracle* oracle;
 
   // test is the file we write to that the command will operate on
   // working is the current temporary state, the reduction so far
@@ -235,9 +408,10 @@ struct Reducer
           bool binary,
           bool deNan,
           bool verbose,
-          bool debugInfo)
+          bool debugInfo,
+          InProcessOracle* oracle = nullptr)
     : command(command), test(test), working(working), binary(binary),
-      deNan(deNan), verbose(verbose), debugInfo(debugInfo) {}
+      deNan(deNan), verbose(verbose), debugInfo(debugInfo), oracle(oracle) {}
 
   // runs passes in order to reduce, until we can't reduce any more
   // the criterion here is wasm binary size
@@ -273,6 +447,10 @@ struct Reducer
       "--simplify-locals --vacuum",
       "--strip",
       "--vacuum"};
+    if (oracle) {
+      reduceUsingPassesInProcess(passes);
+      return;
+    }
     auto oldSize = file_size(working);
     bool more = true;
     while (more) {
@@ -313,6 +491,66 @@ struct Reducer
     }
   }
 
+  // like reduceUsingPasses, but running the passes and the oracle in forked
+  // children of this process rather than in new processes
+  void reduceUsingPassesInProcess(const std::vector<std::string>& passes) {
+#ifdef _WIN32
+    Fatal() << "in-process oracles are not supported on this platform\n";
+#else
+    auto oldSize = file_size(working);
+    auto current = make_unique<Module>();
+    ModuleReader().read(working, *current);
+    bool more = true;
+    while (more) {
+      more = false;
+      for (auto pass : passes) {
+        if (verbose) {
+          std::cerr << "|    trying passes in process: " << pass << "\n";
+        }
+        ProgramResult passResult;
+        passResult.getFromFork([&]() {
+          current->features = FeatureSet::All;
+          runPassArguments(*current, pass, debugInfo);
+          writeModule(*current, test);
+          return 0;
+        });
+        if (passResult.failed()) {
+          continue;
+        }
+        auto newSize = file_size(test);
+        if (newSize >= oldSize) {
+          continue;
+        }
+        // the passes didn't fail, and the size looks smaller, so promising
+        // see if it is still has the property we are preserving
+        auto candidate = make_unique<Module>();
+        ModuleReader().read(test, *candidate);
+        ProgramResult result;
+        oracle->getResult(*candidate, result);
+        if (result == expected) {
+          std::cerr << "|    passes \"" << pass
+                    << "\" succeeded, reduced size to " << newSize
+                    << ", and preserved the property\n";
+          copy_file(test, working);
+          more = true;
+          oldSize = newSize;
+          current = std::move(candidate);
+        }
+      }
+    }
+    if (verbose) {
+      std::cerr << "|    done with passes for now\n";
+    }
+#endif
+  }
+
+  void writeModule(Module& wasm, std::string filename) {
+    ModuleWriter writer;
+    writer.setBinary(binary);
+    writer.setDebugInfo(debugInfo);
+    writer.write(wasm, filename);
+  }
+
   // does one pass of slow and destructive reduction. returns whether it
   // succeeded or not
   // the criterion here is a logical change in the program. this may actually
@@ -365,11 +603,13 @@ struct Reducer
   }
 
   bool writeAndTestReduction(ProgramResult& out) {
+    if (oracle) {
+      // no need to write anything, the oracle checks the module in memory
+      oracle->getResult(*getModule(), out);
+      return out == expected;
+    }
     // write the module out
-    ModuleWriter writer;
-    writer.setBinary(binary);
-    writer.setDebugInfo(debugInfo);
-    writer.write(*getModule(), test);
+    writeModule(*getModule(), test);
     // note that it is ok for the destructively-reduced module to be bigger
     // than the previous - each destructive reduction removes logical code,
     // and so is strictly better, even if the wasm binary format happens to
@@ -422,7 +662,11 @@ struct Reducer
 
   void noteReduction(size_t amount = 1) {
     reduced += amount;
-    copy_file(test, working);
+    if (oracle) {
+      writeModule(*getModule(), working);
+    } else {
+      copy_file(test, working);
+    }
   }
 
   // tests a reduction on an arbitrary child
@@ -894,15 +1138,14 @@ struct Reducer
   }
 
   bool tryToRemoveFunctions(std::vector<Name> names) {
-    for (auto name : names) {
-      module->removeFunction(name);
-    }
+    std::unordered_set<Name> nameSet(names.begin(), names.end());
+    module->removeFunctions(
+      [&](Function* func) { return nameSet.count(func->name) > 0; });
 
     // remove all references to them
     struct FunctionReferenceRemover
       : public PostWalker<FunctionReferenceRemover> {
       std::unordered_set<Name> names;
-      std::vector<Name> exportsToRemove;
 
       FunctionReferenceRemover(std::vector<Name>& vec) {
         for (auto name : vec) {
@@ -914,11 +1157,6 @@ struct Reducer
           replaceCurrent(Builder(*getModule()).replaceWithIdenticalType(curr));
         }
       }
-      void visitExport(Export* curr) {
-        if (names.count(curr->value)) {
-          exportsToRemove.push_back(curr->name);
-        }
-      }
       void visitTable(Table* curr) {
         Name other;
         for (auto& segment : curr->segments) {
@@ -945,9 +1183,8 @@ struct Reducer
       }
       void doWalkModule(Module* module) {
         PostWalker<FunctionReferenceRemover>::doWalkModule(module);
-        for (auto name : exportsToRemove) {
-          module->removeExport(name);
-        }
+        module->removeExports(
+          [&](Export* exp) { return names.count(exp->value) > 0; });
       }
     };
     FunctionReferenceRemover referenceRemover(names);
@@ -1032,7 +1269,7 @@ struct Reducer
 //
 
 int main(int argc, const char* argv[]) {
-  std::string input, test, working, command;
+  std::string input, test, working, command, oracleName, oraclePasses;
   // By default, look for binaries alongside our own binary.
   std::string binDir = Path::getDirName(argv[0]);
   bool binary = true, deNan = false, verbose = false, debugInfo = false,
@@ -1106,6 +1343,25 @@ int main(int argc, const char* argv[]) {
            timeout = atoi(argument.c_str());
            std::cout << "|applying timeout: " << timeout << "\n";
          })
+    .add("--oracle",
+         "-or",
+         "Check candidates in process instead of running a command on them, "
+         "which is much faster. One of: validate (whether the module "
+         "validates after running the oracle passes), passes (whether running "
+         "the oracle passes crashes), fuzz-exec (whether the oracle passes "
+         "change execution results)",
+         Options::Arguments::One,
+         [&](Options* o, const std::string& argument) {
+           oracleName = argument;
+         })
+    .add("--oracle-passes",
+         "-orp",
+         "wasm-opt style pass arguments for the oracle to run on candidates, "
+         "for example \"--flatten -O3\"",
+         Options::Arguments::One,
+         [&](Options* o, const std::string& argument) {
+           oraclePasses = argument;
+         })
     .add_positional(
       "INFILE",
       Options::Arguments::One,
@@ -1118,6 +1374,16 @@ int main(int argc, const char* argv[]) {
   if (working.size() == 0) {
     Fatal() << "working file not provided\n";
   }
+  std::unique_ptr<InProcessOracle> oracle;
+  if (oracleName.size() > 0) {
+#ifdef _WIN32
+    Fatal() << "--oracle is not supported on this platform\n";
+#endif
+    oracle = wasm::make_unique<InProcessOracle>(
+      InProcessOracle::parseKind(oracleName), oraclePasses, debugInfo);
+  } else if (command.size() == 0) {
+    Fatal() << "command not provided\n";
+  }
 
   if (!binary) {
     Colors::setEnabled(false);
@@ -1133,7 +1399,13 @@ int main(int argc, const char* argv[]) {
 
   // get the expected output
   copy_file(input, test);
-  expected.getFromExecution(command);
+  if (oracle) {
+    Module wasm;
+    ModuleReader().read(input, wasm);
+    oracle->getResult(wasm, expected);
+  } else {
+    expected.getFromExecution(command);
+  }
 
   std::cerr << "|expected result:\n" << expected << '\n';
   std::cerr << "|!! Make sure the above is what you expect! !!\n\n";
@@ -1152,10 +1424,12 @@ int main(int argc, const char* argv[]) {
                     expected);
   }
 
-  std::cerr
-    << "|checking that command has different behavior on invalid binary (this "
-       "verifies that the test file is used by the command)\n";
-  {
+  // the checks below verify that the command reads the test file, which the
+  // oracle does not use
+  if (!oracle) {
+    std::cerr
+      << "|checking that command has different behavior on invalid binary "
+         "(this verifies that the test file is used by the command)\n";
     {
       std::ofstream dst(test, std::ios::binary);
       dst << "waka waka\n";
@@ -1168,9 +1442,9 @@ int main(int argc, const char* argv[]) {
     }
   }
 
-  std::cerr << "|checking that command has expected behavior on canonicalized "
-               "(read-written) binary\n";
-  {
+  if (!oracle) {
+    std::cerr << "|checking that command has expected behavior on "
+                 "canonicalized (read-written) binary\n";
     // read and write it
     // TODO(tlively): -all should be replaced with an option to use the existing
     // feature set, once implemented.
@@ -1205,7 +1479,8 @@ int main(int argc, const char* argv[]) {
   bool stopping = false;
 
   while (1) {
-    Reducer reducer(command, test, working, binary, deNan, verbose, debugInfo);
+    Reducer reducer(
+      command, test, working, binary, deNan, verbose, debugInfo, oracle.get());
 
     // run binaryen optimization passes to reduce. passes are fast to run
     // and can often reduce large amounts of code efficiently, as opposed
@@ -50,6 +50,9 @@ std::map<Name, std::unique_ptr<SExpressionWasmBuilder>> builders;
 std::map<Name, std::unique_ptr<ShellExternalInterface>> interfaces;
 std::map<Name, std::unique_ptr<ModuleInstance>> instances;
 
+// The calls made by all the instances, if we write a profile
+std::unique_ptr<Profile> profile;
+
 //
 // An operation on a module
 //
@@ -101,8 +104,8 @@ static void run_asserts(Name moduleName,
   if (wasm) {
     // prefix make_unique to work around visual studio bugs
     auto tempInterface = wasm::make_unique<ShellExternalInterface>();
-    auto tempInstance =
-      wasm::make_unique<ModuleInstance>(*wasm, tempInterface.get());
+    auto tempInstance = wasm::make_unique<ModuleInstance>(
+      *wasm, tempInterface.get(), profile.get());
     interfaces[moduleName].swap(tempInterface);
     instances[moduleName].swap(tempInstance);
     instance = instances[moduleName].get();
@@ -245,6 +248,7 @@ static void run_asserts(Name moduleName,
 int main(int argc, const char* argv[]) {
   Name entry;
   std::set<size_t> skipped;
+  std::string profileFile;
 
   Options options("wasm-shell", "Execute .wast files");
   options
@@ -269,6 +273,14 @@ int main(int argc, const char* argv[]) {
              i = ending + 1;
            }
          })
+    .add("--profile",
+         "",
+         "Write a profile of the calls made to a file, for use with "
+         "--pass-arg=profile@@FILE in wasm-opt",
+         Options::Arguments::One,
+         [&profileFile](Options*, const std::string& argument) {
+           profileFile = argument;
+         })
     .add_positional("INFILE",
                     Options::Arguments::One,
                     [](Options* o, const std::string& argument) {
@@ -283,6 +295,10 @@ int main(int argc, const char* argv[]) {
 
   bool checked = false;
 
+  if (!profileFile.empty()) {
+    profile = wasm::make_unique<Profile>();
+  }
+
   try {
     if (options.debug) {
       std::cerr << "parsing text to s-expressions...\n";
@@ -338,6 +354,11 @@ int main(int argc, const char* argv[]) {
     abort();
   }
 
+  if (profile) {
+    Output output(profileFile, Flags::Text, Flags::Release);
+    profile->write(output.getStream());
+  }
+
   if (checked) {
     Colors::green(std::cerr);
     Colors::bold(std::cerr);
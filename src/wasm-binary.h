@@ -1072,8 +1072,7 @@ private:
 
   // storage of source map locations until the section is placed at its final
   // location (shrinking LEBs may cause changes there)
-  std::vector<std::pair<size_t, const Function::DebugLocation*>>
-    sourceMapLocations;
+  std::vector<std::pair<size_t, Function::DebugLocation>> sourceMapLocations;
   size_t sourceMapLocationsSizeAtSectionStart;
   Function::DebugLocation lastDebugLocation;
 
@@ -28,6 +28,7 @@
 #include <sstream>
 
 #include "ir/module-utils.h"
+#include "ir/profile.h"
 #include "support/bits.h"
 #include "support/safe_integer.h"
 #include "wasm-traversal.h"
@@ -56,7 +57,7 @@ public:
   Literal value;
   Name breakTo; // if non-null, a break is going on
 
-  bool breaking() { return breakTo.is(); }
+  bool breaking() const { return breakTo.is(); }
 
   void clearIf(Name target) {
     if (breakTo == target) {
@@ -139,7 +140,7 @@ public:
     if (depth > maxDepth) {
       trap("interpreter recursion limit");
     }
-    auto ret = OverriddenVisitor<SubType, Flow>::visit(curr);
+    auto ret = static_cast<SubType*>(this)->doVisit(curr);
     if (!ret.breaking() &&
         (curr->type.isConcrete() || ret.value.type.isConcrete())) {
 #if 1 // def WASM_INTERPRETER_DEBUG
@@ -155,6 +156,12 @@ public:
     return ret;
   }
 
+  // Dispatches to the visit* method for the kind of expression. Subclasses
+  // can override this to intercept every visit, for example to cache results.
+  Flow doVisit(Expression* curr) {
+    return OverriddenVisitor<SubType, Flow>::visit(curr);
+  }
+
   Flow visitBlock(Block* curr) {
     NOTE_ENTER("Block");
     // special-case Block, because Block nesting (in their first element) can be
@@ -1309,8 +1316,11 @@ public:
   // Multivalue ABI support (see push/pop).
   std::vector<Literal> multiValues;
 
-  ModuleInstanceBase(Module& wasm, ExternalInterface* externalInterface)
-    : wasm(wasm), externalInterface(externalInterface) {
+  // If a profile is given, the calls made are noted in it.
+  ModuleInstanceBase(Module& wasm,
+                     ExternalInterface* externalInterface,
+                     Profile* profile = nullptr)
+    : wasm(wasm), externalInterface(externalInterface), profile(profile) {
     // import globals from the outside
     externalInterface->importGlobals(globals, wasm);
     // prepare memory
@@ -1434,7 +1444,6 @@ private:
 
   class FunctionScope {
   public:
-    std::vector<Literal> locals;
     Function* function;
 
     FunctionScope(Function* function, const LiteralList& arguments)
@@ -1445,23 +1454,52 @@ private:
                   << arguments.size() << " arguments." << std::endl;
         WASM_UNREACHABLE();
       }
-      locals.resize(function->getNumLocals());
-      for (size_t i = 0; i < function->getNumLocals(); i++) {
+      auto numLocals = function->getNumLocals();
+      locals.resize(numLocals);
+      for (Index i = 0; i < numLocals; i++) {
+        auto type = function->getLocalType(i);
+        if (type == Type::v128) {
+          // the slot holds the index of the value in v128Locals
+          locals[i] = v128Locals.size();
+          v128Locals.emplace_back();
+        }
         if (i < arguments.size()) {
           assert(function->isParam(i));
-          if (function->params[i] != arguments[i].type) {
+          if (type != arguments[i].type) {
             std::cerr << "Function `" << function->name << "` expects type "
-                      << function->params[i] << " for parameter " << i
-                      << ", got " << arguments[i].type << "." << std::endl;
+                      << type << " for parameter " << i << ", got "
+                      << arguments[i].type << "." << std::endl;
             WASM_UNREACHABLE();
           }
-          locals[i] = arguments[i];
+          setLocal(i, arguments[i]);
         } else {
           assert(function->isVar(i));
-          locals[i].type = function->getLocalType(i);
         }
       }
     }
+
+    // The type is that of the local, which callers know from the IR.
+    Literal getLocal(Index index, Type type) {
+      if (type == Type::v128) {
+        return Literal(v128Locals[locals[index]].data());
+      }
+      return Literal::makeFromScalarBits(locals[index], type);
+    }
+
+    void setLocal(Index index, const Literal& value) {
+      if (value.type == Type::v128) {
+        auto* bytes = value.getv128Ptr();
+        std::copy(bytes, bytes + 16, v128Locals[locals[index]].begin());
+      } else {
+        locals[index] = value.getScalarBits();
+      }
+    }
+
+  private:
+    // The local types are known from the function, so each local is just the
+    // 8 bytes of its value, except for v128s, which are kept out of line.
+    std::vector<uint64_t> locals;
+    std::vector<std::array<uint8_t, 16>> v128Locals;
   };
 
   // Executes expressions with concrete runtime info, the function and module at
@@ -1553,8 +1591,9 @@ private:
       NOTE_ENTER("LocalGet");
       auto index = curr->index;
       NOTE_EVAL1(index);
-      NOTE_EVAL1(scope.locals[index]);
-      return scope.locals[index];
+      auto value = scope.getLocal(index, curr->type);
+      NOTE_EVAL1(value);
+      return value;
     }
     Flow visitLocalSet(LocalSet* curr) {
       NOTE_ENTER("LocalSet");
@@ -1566,7 +1605,7 @@ private:
       NOTE_EVAL1(index);
       NOTE_EVAL1(flow.value);
       assert(curr->isTee() ? flow.value.type == curr->type : true);
-      scope.locals[index] = flow.value;
+      scope.setLocal(index, flow.value);
       return curr->isTee() ? flow : Flow();
     }
 
@@ -2024,6 +2063,10 @@ public:
     }
     auto previousCallDepth = callDepth;
     callDepth++;
+    if (profile) {
+      profile->noteCall(functionStack.empty() ? Name() : functionStack.back(),
+                        name);
+    }
     auto previousFunctionStackSize = functionStack.size();
     functionStack.push_back(name);
 
@@ -2129,6 +2172,8 @@ protected:
   }
 
   ExternalInterface* externalInterface;
+
+  Profile* profile;
 };
 
 // The default ModuleInstance uses a trivial global manager
@@ -2136,8 +2181,10 @@ using TrivialGlobalManager = std::map<Name, Literal>;
 class ModuleInstance
   : public ModuleInstanceBase<TrivialGlobalManager, ModuleInstance> {
 public:
-  ModuleInstance(Module& wasm, ExternalInterface* externalInterface)
-    : ModuleInstanceBase(wasm, externalInterface) {}
+  ModuleInstance(Module& wasm,
+                 ExternalInterface* externalInterface,
+                 Profile* profile = nullptr)
+    : ModuleInstanceBase(wasm, externalInterface, profile) {}
 };
 
 } // namespace wasm
@@ -27,13 +27,16 @@
 #include <algorithm>
 #include <array>
 #include <cassert>
+#include <functional>
 #include <map>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "literal.h"
 #include "mixed_arena.h"
 #include "support/name.h"
+#include "support/pointer_map.h"
 #include "wasm-features.h"
 #include "wasm-type.h"
 
@@ -1186,10 +1189,16 @@ public:
                    : columnNumber < other.columnNumber;
     }
   };
-  std::unordered_map<Expression*, DebugLocation> debugLocations;
+  PointerMap<Expression*, DebugLocation> debugLocations;
   std::set<DebugLocation> prologLocation;
   std::set<DebugLocation> epilogLocation;
 
+  // Function-parallel passes allocate the nodes they create for this function
+  // here (see MixedArena::Redirect), and they are freed along with it. So a
+  // node must not be moved to another function, or anywhere else in the
+  // module; copy it instead.
+  MixedArena arena{MixedArena::MIN_CHUNK_SIZE};
+
   size_t getNumParams();
   size_t getNumVars();
   size_t getNumLocals();
@@ -1359,12 +1368,13 @@ public:
 private:
   // TODO: add a build option where Names are just indices, and then these
   // methods are not needed
-  std::map<Name, FunctionType*> functionTypesMap;
+  // Names are interned, so these hash their pointers.
+  std::unordered_map<Name, FunctionType*> functionTypesMap;
   // exports map is by the *exported* name, which is unique
-  std::map<Name, Export*> exportsMap;
-  std::map<Name, Function*> functionsMap;
-  std::map<Name, Global*> globalsMap;
-  std::map<Name, Event*> eventsMap;
+  std::unordered_map<Name, Export*> exportsMap;
+  std::unordered_map<Name, Function*> functionsMap;
+  std::unordered_map<Name, Global*> globalsMap;
+  std::unordered_map<Name, Event*> eventsMap;
 
 public:
   Module() = default;
@@ -1396,6 +1406,14 @@ public:
   void removeGlobal(Name name);
   void removeEvent(Name name);
 
+  // Remove all the elements for which pred returns true, in a single pass.
+  // Prefer these to calling the methods above in a loop, which is quadratic.
+  void removeFunctionTypes(std::function<bool(FunctionType*)> pred);
+  void removeExports(std::function<bool(Export*)> pred);
+  void removeFunctions(std::function<bool(Function*)> pred);
+  void removeGlobals(std::function<bool(Global*)> pred);
+  void removeEvents(std::function<bool(Event*)> pred);
+
   void updateMaps();
 
   void clearDebugInfo();
@@ -630,43 +630,43 @@ void WasmBinaryWriter::writeSourceMapProlog() {
   *sourceMap << "],\"names\":[],\"mappings\":\"";
 }
 
-static void writeBase64VLQ(std::ostream& out, int32_t n) {
+static void writeBase64VLQ(std::string& out, int32_t n) {
   uint32_t value = n >= 0 ? n << 1 : ((-n) << 1) | 1;
   while (1) {
     uint32_t digit = value & 0x1F;
     value >>= 5;
     if (!value) {
       // last VLQ digit -- base64 codes 'A'..'Z', 'a'..'f'
-      out << char(digit < 26 ? 'A' + digit : 'a' + digit - 26);
+      out.push_back(char(digit < 26 ? 'A' + digit : 'a' + digit - 26));
       break;
     }
     // more VLG digit will follow -- add continuation bit (0x20),
     // base64 codes 'g'..'z', '0'..'9', '+', '/'
-    out << char(digit < 20
-                  ? 'g' + digit
-                  : digit < 30 ? '0' + digit - 20 : digit == 30 ? '+' : '/');
+    out.push_back(char(digit < 20 ? 'g' + digit
+                                  : digit < 30 ? '0' + digit - 20
+                                               : digit == 30 ? '+' : '/'));
   }
 }
 
 void WasmBinaryWriter::writeSourceMapEpilog() {
-  // write source map entries
+  // write source map entries, all at once rather than a character at a time
+  std::string mappings;
   size_t lastOffset = 0;
   Function::DebugLocation lastLoc = {0, /* lineNumber = */ 1, 0};
   for (const auto& offsetAndlocPair : sourceMapLocations) {
     if (lastOffset > 0) {
-      *sourceMap << ",";
+      mappings.push_back(',');
     }
     size_t offset = offsetAndlocPair.first;
-    const Function::DebugLocation& loc = *offsetAndlocPair.second;
-    writeBase64VLQ(*sourceMap, int32_t(offset - lastOffset));
-    writeBase64VLQ(*sourceMap, int32_t(loc.fileIndex - lastLoc.fileIndex));
-    writeBase64VLQ(*sourceMap, int32_t(loc.lineNumber - lastLoc.lineNumber));
-    writeBase64VLQ(*sourceMap,
-                   int32_t(loc.columnNumber - lastLoc.columnNumber));
+    const Function::DebugLocation& loc = offsetAndlocPair.second;
+    writeBase64VLQ(mappings, int32_t(offset - lastOffset));
+    writeBase64VLQ(mappings, int32_t(loc.fileIndex - lastLoc.fileIndex));
+    writeBase64VLQ(mappings, int32_t(loc.lineNumber - lastLoc.lineNumber));
+    writeBase64VLQ(mappings, int32_t(loc.columnNumber - lastLoc.columnNumber));
     lastLoc = loc;
     lastOffset = offset;
   }
-  *sourceMap << "\"}";
+  *sourceMap << mappings << "\"}";
 }
 
 void WasmBinaryWriter::writeEarlyUserSections() {
@@ -747,7 +747,7 @@ void WasmBinaryWriter::writeDebugLocation(const Function::DebugLocation& loc) {
     return;
   }
   auto offset = o.size();
-  sourceMapLocations.emplace_back(offset, &loc);
+  sourceMapLocations.emplace_back(offset, loc);
   lastDebugLocation = loc;
 }
 
@@ -1552,10 +1552,13 @@ void WasmBinaryBuilder::readExports() {
 }
 
 static int32_t readBase64VLQ(std::istream& in) {
+  // read from the buffer directly, as istream::get() does a lot of work for
+  // each character
+  auto* buffer = in.rdbuf();
   uint32_t value = 0;
   uint32_t shift = 0;
   while (1) {
-    auto ch = in.get();
+    auto ch = buffer->sbumpc();
     if (ch == EOF) {
       throw MapParseException("unexpected EOF in the middle of VLQ");
     }
@@ -637,24 +637,70 @@ std::string escape(const char* input) {
   return code;
 }
 
-const char* stringAtAddr(Module& wasm,
-                         std::vector<Address> const& segmentOffsets,
-                         Address address) {
-  for (unsigned i = 0; i < wasm.memory.segments.size(); ++i) {
-    Memory::Segment& segment = wasm.memory.segments[i];
-    Address offset = segmentOffsets[i];
-    if (offset != UNKNOWN_OFFSET && address >= offset &&
-        address < offset + segment.data.size()) {
-      return &segment.data[address - offset];
+// Finds the data segment contents at constant addresses. Modules can have many
+// segments and many addresses to look up, so we build a sorted index of the
+// address ranges once.
+class SegmentIndex {
+  struct Range {
+    Address end;
+    const char* data;
+  };
+  // start address => range. The ranges do not overlap; where segments do,
+  // the earlier segment wins, as it did when we scanned them in order.
+  std::map<Address, Range> ranges;
+
+public:
+  SegmentIndex(Module& wasm) {
+    auto segmentOffsets = getSegmentOffsets(wasm);
+    for (Index i = 0; i < wasm.memory.segments.size(); ++i) {
+      auto& segment = wasm.memory.segments[i];
+      uint64_t start = segmentOffsets[i];
+      uint64_t end = start + segment.data.size();
+      if (segmentOffsets[i] == UNKNOWN_OFFSET || start == end) {
+        continue;
+      }
+      end = std::min(end, uint64_t(UNKNOWN_OFFSET));
+      // Add the parts of [start, end) not covered by the ranges so far.
+      auto iter = ranges.upper_bound(start);
+      if (iter != ranges.begin()) {
+        auto prev = std::prev(iter);
+        start = std::max(start, uint64_t(prev->second.end));
+      }
+      while (start < end) {
+        uint64_t gapEnd = end;
+        if (iter != ranges.end()) {
+          gapEnd = std::min(gapEnd, uint64_t(iter->first));
+        }
+        if (start < gapEnd) {
+          auto* data = &segment.data[start - segmentOffsets[i]];
+          ranges.emplace_hint(iter, start, Range{gapEnd, data});
+        }
+        if (iter == ranges.end()) {
+          break;
+        }
+        start = std::max(start, uint64_t(iter->second.end));
+        ++iter;
+      }
     }
   }
-  return nullptr;
-}
 
-std::string codeForConstAddr(Module& wasm,
-                             std::vector<Address> const& segmentOffsets,
+  // Returns the data at the address, or nullptr if it is not in a segment.
+  const char* find(Address address) const {
+    auto iter = ranges.upper_bound(address);
+    if (iter == ranges.begin()) {
+      return nullptr;
+    }
+    --iter;
+    if (address >= iter->second.end) {
+      return nullptr;
+    }
+    return iter->second.data + (address - iter->first);
+  }
+};
+
+std::string codeForConstAddr(SegmentIndex const& segmentIndex,
                              int32_t address) {
-  const char* str = stringAtAddr(wasm, segmentOffsets, address);
+  const char* str = segmentIndex.find(address);
   if (!str) {
     // If we can't find the segment corresponding with the address, then we
     // omitted the segment and the address points to an empty string.
@@ -683,7 +729,7 @@ std::string proxyingSuffix(Proxying proxy) {
 
 struct AsmConstWalker : public LinearExecutionWalker<AsmConstWalker> {
   Module& wasm;
-  std::vector<Address> segmentOffsets; // segment index => address offset
+  SegmentIndex const& segmentIndex;
 
   struct AsmConst {
     std::set<std::string> sigs;
@@ -697,8 +743,19 @@ struct AsmConstWalker : public LinearExecutionWalker<AsmConstWalker> {
   // last sets in the current basic block, per index
   std::map<Index, LocalSet*> sets;
 
-  AsmConstWalker(Module& _wasm)
-    : wasm(_wasm), segmentOffsets(getSegmentOffsets(wasm)) {}
+  // A call to an EM_ASM import, found when walking a function.
+  struct AsmConstCall {
+    Call* call;
+    Name importName;
+    std::string baseSig;
+    uint32_t address;
+    std::string code;
+  };
+
+  std::vector<AsmConstCall> calls;
+
+  AsmConstWalker(Module& _wasm, SegmentIndex const& segmentIndex)
+    : wasm(_wasm), segmentIndex(segmentIndex) {}
 
   void noteNonLinear(Expression* curr);
 
@@ -740,8 +797,6 @@ void AsmConstWalker::visitCall(Call* curr) {
     return;
   }
 
-  auto baseSig = getSig(curr);
-  auto sig = asmConstSig(baseSig);
   auto* arg = curr->operands[0];
   while (!arg->dynCast<Const>()) {
     if (auto* get = arg->dynCast<LocalGet>()) {
@@ -787,9 +842,11 @@ void AsmConstWalker::visitCall(Call* curr) {
 
   auto* value = arg->cast<Const>();
   int32_t address = value->value.geti32();
-  auto code = codeForConstAddr(wasm, segmentOffsets, address);
-  auto& asmConst = createAsmConst(address, code, sig, importName);
-  fixupName(curr->target, baseSig, asmConst.proxy);
+  calls.push_back({curr,
+                   importName,
+                   getSig(curr),
+                   uint32_t(address),
+                   codeForConstAddr(segmentIndex, address)});
 }
 
 Proxying AsmConstWalker::proxyType(Name name) {
@@ -815,8 +872,28 @@ void AsmConstWalker::visitTable(Table* curr) {
 }
 
 void AsmConstWalker::process() {
-  // Find and queue necessary imports
-  walkModule(&wasm);
+  // Finding the calls and the code they refer to is most of the work, so do
+  // that in parallel, with a walker per function.
+  typedef std::vector<AsmConstCall> Calls;
+  ModuleUtils::ParallelFunctionAnalysis<Calls> analysis(
+    wasm, [&](Function* func, Calls& calls) {
+      if (func->imported()) {
+        return;
+      }
+      AsmConstWalker walker(wasm, segmentIndex);
+      walker.walkFunctionInModule(func, &wasm);
+      calls = std::move(walker.calls);
+    });
+  // Find and queue necessary imports, in the order of the calls in the module.
+  for (auto& func : wasm.functions) {
+    for (auto& found : analysis.map[func.get()]) {
+      auto sig = asmConstSig(found.baseSig);
+      auto& asmConst =
+        createAsmConst(found.address, found.code, sig, found.importName);
+      fixupName(found.call->target, found.baseSig, asmConst.proxy);
+    }
+  }
+  visitTable(&wasm.table);
   // Add them after the walk, to avoid iterator invalidation on
   // the list of functions.
   addImports();
@@ -883,7 +960,8 @@ void AsmConstWalker::addImports() {
   }
 }
 
-AsmConstWalker fixEmAsmConstsAndReturnWalker(Module& wasm) {
+AsmConstWalker fixEmAsmConstsAndReturnWalker(Module& wasm,
+                                             SegmentIndex const& segmentIndex) {
   // Collect imports to remove
   // This would find our generated functions if we ran it later
   std::vector<Name> toRemove;
@@ -894,7 +972,7 @@ AsmConstWalker fixEmAsmConstsAndReturnWalker(Module& wasm) {
   }
 
   // Walk the module, generate _sig versions of EM_ASM functions
-  AsmConstWalker walker(wasm);
+  AsmConstWalker walker(wasm, segmentIndex);
   walker.process();
 
   // Remove the base functions that we didn't generate
@@ -906,12 +984,12 @@ AsmConstWalker fixEmAsmConstsAndReturnWalker(Module& wasm) {
 
 struct EmJsWalker : public PostWalker<EmJsWalker> {
   Module& wasm;
-  std::vector<Address> segmentOffsets; // segment index => address offset
+  SegmentIndex const& segmentIndex;
 
   std::map<std::string, std::string> codeByName;
 
-  EmJsWalker(Module& _wasm)
-    : wasm(_wasm), segmentOffsets(getSegmentOffsets(wasm)) {}
+  EmJsWalker(Module& _wasm, SegmentIndex const& segmentIndex)
+    : wasm(_wasm), segmentIndex(segmentIndex) {}
 
   void visitExport(Export* curr) {
     if (curr->kind != ExternalKind::Function) {
@@ -931,13 +1009,14 @@ struct EmJsWalker : public PostWalker<EmJsWalker> {
     }
     auto* addrConst = consts.list[0];
     int32_t address = addrConst->value.geti32();
-    auto code = codeForConstAddr(wasm, segmentOffsets, address);
+    auto code = codeForConstAddr(segmentIndex, address);
     codeByName[funcName] = code;
   }
 };
 
-EmJsWalker fixEmJsFuncsAndReturnWalker(Module& wasm) {
-  EmJsWalker walker(wasm);
+EmJsWalker fixEmJsFuncsAndReturnWalker(Module& wasm,
+                                       SegmentIndex const& segmentIndex) {
+  EmJsWalker walker(wasm, segmentIndex);
   walker.walkModule(&wasm);
 
   std::vector<Name> toRemove;
@@ -1101,7 +1180,9 @@ std::string EmscriptenGlueGenerator::generateEmscriptenMetadata(
   std::stringstream meta;
   meta << "{\n";
 
-  AsmConstWalker emAsmWalker = fixEmAsmConstsAndReturnWalker(wasm);
+  SegmentIndex segmentIndex(wasm);
+  AsmConstWalker emAsmWalker =
+    fixEmAsmConstsAndReturnWalker(wasm, segmentIndex);
 
   // print
   commaFirst = true;
@@ -1118,7 +1199,7 @@ std::string EmscriptenGlueGenerator::generateEmscriptenMetadata(
     meta << "\n  },\n";
   }
 
-  EmJsWalker emJsWalker = fixEmJsFuncsAndReturnWalker(wasm);
+  EmJsWalker emJsWalker = fixEmJsFuncsAndReturnWalker(wasm, segmentIndex);
   if (!emJsWalker.codeByName.empty()) {
     meta << "  \"emJsFuncs\": {";
     commaFirst = true;
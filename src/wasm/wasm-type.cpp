@@ -15,6 +15,7 @@
  */
 
 #include <cassert>
+#include <memory>
 #include <shared_mutex>
 #include <sstream>
 #include <unordered_map>
@@ -0,0 +1,69 @@
+// test that BinaryenBuildExpression rejects immediates that are out of range
+// for what they encode. Each case is a fatal error, so it runs in a child
+// process, and we print what the child reported.
+
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <binaryen-c.h>
+
+static void expectFatal(const char* what, const uint32_t* code, int size) {
+  int fds[2];
+  assert(pipe(fds) == 0);
+  fflush(stdout);
+  pid_t pid = fork();
+  assert(pid >= 0);
+  if (pid == 0) {
+    close(fds[0]);
+    dup2(fds[1], 2);
+    BinaryenModuleRef module = BinaryenModuleCreate();
+    BinaryenBuildExpression(module, code, size, NULL, 0);
+    // not reached
+    _exit(0);
+  }
+  close(fds[1]);
+  char buffer[256];
+  size_t length = 0;
+  ssize_t chunk;
+  while ((chunk = read(fds[0], buffer + length, sizeof(buffer) - 1 - length)) >
+         0) {
+    length += chunk;
+  }
+  close(fds[0]);
+  int status;
+  assert(waitpid(pid, &status, 0) == pid);
+  assert(WIFEXITED(status) && WEXITSTATUS(status) != 0);
+  buffer[length] = 0;
+  printf("%s: %s", what, buffer);
+}
+
+int main() {
+  uint32_t i32 = BinaryenTypeInt32();
+  {
+    uint32_t code[] = {BinaryenConstId(), i32, 1, BinaryenUnaryId(), 1000};
+    expectFatal("unary op", code, 5);
+  }
+  {
+    uint32_t code[] = {BinaryenConstId(),
+                       i32,
+                       1,
+                       BinaryenConstId(),
+                       i32,
+                       2,
+                       BinaryenBinaryId(),
+                       (uint32_t)-1};
+    expectFatal("binary op", code, 8);
+  }
+  {
+    uint32_t code[] = {BinaryenLocalGetId(), 0, 1000};
+    expectFatal("type", code, 3);
+  }
+  {
+    uint32_t code[] = {BinaryenNopId(), 1000};
+    expectFatal("expression id", code, 2);
+  }
+  return 0;
+}
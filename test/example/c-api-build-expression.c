@@ -0,0 +1,232 @@
+// test building expressions from postfix code, and compare it to building
+// them one call at a time. Given a count of statements, this is a benchmark
+// of the two:
+//
+//   c-api-build-expression 1000000
+//
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <binaryen-c.h>
+
+// names[] indexes
+enum { OUT, TOP, HELPER, G };
+static const char* names[] = { "out", "top", "helper", "g" };
+
+// locals: 0 is the param n, 1 is i, 2 is sum
+static BinaryenExpressionRef makeStatements(BinaryenModuleRef module,
+                                            int count) {
+  BinaryenType i32 = BinaryenTypeInt32();
+  BinaryenType i64 = BinaryenTypeInt64();
+  BinaryenType f64 = BinaryenTypeFloat64();
+  BinaryenExpressionRef* list =
+    (BinaryenExpressionRef*)malloc((count + 1) * sizeof(*list));
+  for (int i = 0; i < count; i++) {
+    BinaryenExpressionRef done =
+      BinaryenBinary(module,
+                     BinaryenGeSInt32(),
+                     BinaryenLocalGet(module, 1, i32),
+                     BinaryenLocalGet(module, 0, i32));
+    BinaryenExpressionRef load =
+      BinaryenLoad(module, 4, 0, 0, 0, i32, BinaryenLocalGet(module, 1, i32));
+    BinaryenExpressionRef add = BinaryenBinary(
+      module, BinaryenAddInt32(), BinaryenLocalGet(module, 2, i32), load);
+    BinaryenExpressionRef next =
+      BinaryenBinary(module,
+                     BinaryenAddInt32(),
+                     BinaryenLocalGet(module, 1, i32),
+                     BinaryenConst(module, BinaryenLiteralInt32(4)));
+    BinaryenExpressionRef clz = BinaryenUnary(
+      module, BinaryenClzInt32(), BinaryenLocalGet(module, 2, i32));
+    BinaryenExpressionRef body[4] = {
+      BinaryenBreak(module, names[OUT], done, NULL),
+      BinaryenLocalSet(module, 2, add),
+      BinaryenStore(
+        module, 4, 8, 0, BinaryenLocalTee(module, 1, next), clz, i32),
+      BinaryenBreak(module, names[TOP], NULL, NULL)};
+    BinaryenExpressionRef operands[2] = {
+      BinaryenConst(module, BinaryenLiteralInt64(-2)),
+      BinaryenConst(module, BinaryenLiteralFloat64(0.5))};
+    BinaryenExpressionRef select =
+      BinaryenSelect(module,
+                     BinaryenLocalGet(module, 2, i32),
+                     BinaryenGlobalGet(module, names[G], f64),
+                     BinaryenConst(module, BinaryenLiteralFloat64(1.25)));
+    BinaryenExpressionRef statement[3] = {
+      BinaryenLoop(
+        module,
+        names[TOP],
+        BinaryenBlock(module, NULL, body, 4, BinaryenTypeAuto())),
+      BinaryenDrop(module,
+                   BinaryenCall(module, names[HELPER], operands, 2, i64)),
+      BinaryenGlobalSet(module, names[G], select)};
+    list[i] =
+      BinaryenBlock(module, names[OUT], statement, 3, BinaryenTypeAuto());
+  }
+  list[count] = BinaryenReturn(module, BinaryenLocalGet(module, 2, i32));
+  BinaryenExpressionRef ret =
+    BinaryenBlock(module, NULL, list, count + 1, BinaryenTypeAuto());
+  free(list);
+  return ret;
+}
+
+struct Code {
+  uint32_t* data;
+  size_t size, capacity;
+};
+
+static void emit(struct Code* code, int num, const uint32_t* words) {
+  if (code->size + num > code->capacity) {
+    code->capacity = (code->size + num) * 2;
+    code->data =
+      (uint32_t*)realloc(code->data, code->capacity * sizeof(uint32_t));
+  }
+  memcpy(code->data + code->size, words, num * sizeof(uint32_t));
+  code->size += num;
+}
+
+#define EMIT(...)                                                              \
+  do {                                                                         \
+    uint32_t words[] = {__VA_ARGS__};                                          \
+    emit(code, sizeof(words) / sizeof(words[0]), words);                       \
+  } while (0)
+
+static void emitConstF64(struct Code* code, double value) {
+  uint64_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  EMIT(BinaryenConstId(),
+       BinaryenTypeFloat64(),
+       (uint32_t)bits,
+       (uint32_t)(bits >> 32));
+}
+
+// the same as makeStatements(), in postfix code
+static void emitStatements(struct Code* code, int count) {
+  uint32_t i32 = BinaryenTypeInt32();
+  uint32_t i64 = BinaryenTypeInt64();
+  uint32_t f64 = BinaryenTypeFloat64();
+  uint32_t none = (uint32_t)-1;
+  uint32_t autoType = BinaryenTypeAuto();
+  for (int i = 0; i < count; i++) {
+    // the loop
+    EMIT(BinaryenLocalGetId(), 1, i32);
+    EMIT(BinaryenLocalGetId(), 0, i32);
+    EMIT(BinaryenBinaryId(), BinaryenGeSInt32());
+    EMIT(BinaryenBreakId(), OUT, 0, 1);
+    EMIT(BinaryenLocalGetId(), 2, i32);
+    EMIT(BinaryenLocalGetId(), 1, i32);
+    EMIT(BinaryenLoadId(), 4, 0, 0, 0, i32);
+    EMIT(BinaryenBinaryId(), BinaryenAddInt32());
+    EMIT(BinaryenLocalSetId(), 2, 0);
+    EMIT(BinaryenLocalGetId(), 1, i32);
+    EMIT(BinaryenConstId(), i32, 4);
+    EMIT(BinaryenBinaryId(), BinaryenAddInt32());
+    EMIT(BinaryenLocalSetId(), 1, 1);
+    EMIT(BinaryenLocalGetId(), 2, i32);
+    EMIT(BinaryenUnaryId(), BinaryenClzInt32());
+    EMIT(BinaryenStoreId(), 4, 8, 0, i32);
+    EMIT(BinaryenBreakId(), TOP, 0, 0);
+    EMIT(BinaryenBlockId(), none, 4, autoType);
+    EMIT(BinaryenLoopId(), TOP);
+    // the call
+    EMIT(BinaryenConstId(), i64, (uint32_t)-2, (uint32_t)-1);
+    emitConstF64(code, 0.5);
+    EMIT(BinaryenCallId(), HELPER, 2, i64);
+    EMIT(BinaryenDropId());
+    // the global.set
+    EMIT(BinaryenGlobalGetId(), G, f64);
+    emitConstF64(code, 1.25);
+    EMIT(BinaryenLocalGetId(), 2, i32);
+    EMIT(BinaryenSelectId());
+    EMIT(BinaryenGlobalSetId(), G);
+    EMIT(BinaryenBlockId(), OUT, 3, autoType);
+  }
+  EMIT(BinaryenLocalGetId(), 2, i32);
+  EMIT(BinaryenReturnId(), 1);
+}
+
+static BinaryenModuleRef makeModule() {
+  BinaryenModuleRef module = BinaryenModuleCreate();
+  BinaryenType params[2] = { BinaryenTypeInt64(), BinaryenTypeFloat64() };
+  BinaryenFunctionTypeRef helperType =
+    BinaryenAddFunctionType(module, "helper", BinaryenTypeInt64(), params, 2);
+  BinaryenAddFunction(module,
+                      "helper",
+                      helperType,
+                      NULL,
+                      0,
+                      BinaryenLocalGet(module, 0, BinaryenTypeInt64()));
+  BinaryenAddGlobal(module,
+                    "g",
+                    BinaryenTypeFloat64(),
+                    1,
+                    BinaryenConst(module, BinaryenLiteralFloat64(0)));
+  BinaryenSetMemory(module, 1, 1, NULL, NULL, NULL, NULL, NULL, 0, 0);
+  return module;
+}
+
+static void addSum(BinaryenModuleRef module, BinaryenExpressionRef body) {
+  BinaryenType param = BinaryenTypeInt32();
+  BinaryenFunctionTypeRef sumType =
+    BinaryenAddFunctionType(module, "sum", BinaryenTypeInt32(), &param, 1);
+  BinaryenType vars[2] = { BinaryenTypeInt32(), BinaryenTypeInt32() };
+  BinaryenAddFunction(module, "sum", sumType, vars, 2, body);
+  BinaryenAddFunctionExport(module, "sum", "sum");
+}
+
+static double seconds(clock_t start) {
+  return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+int main(int argc, char** argv) {
+  int count = argc > 1 ? atoi(argv[1]) : 1;
+
+  clock_t start = clock();
+  BinaryenModuleRef direct = makeModule();
+  addSum(direct, makeStatements(direct, count));
+  double directTime = seconds(start);
+
+  start = clock();
+  struct Code code = { NULL, 0, 0 };
+  emitStatements(&code, count);
+  double emitTime = seconds(start);
+  start = clock();
+  BinaryenModuleRef batched = makeModule();
+  addSum(batched,
+         BinaryenBuildExpression(batched, code.data, code.size, names, 4));
+  double batchedTime = seconds(start);
+
+  // the labels repeat when there is more than one statement, which the
+  // validator rejects, but the two modules must still be identical
+  if (count == 1) {
+    assert(BinaryenModuleValidate(direct));
+    assert(BinaryenModuleValidate(batched));
+  }
+  BinaryenOutputBuffer directText = { NULL, 0, 0 };
+  BinaryenOutputBuffer batchedText = { NULL, 0, 0 };
+  BinaryenModuleWriteTextToBuffer(direct, &directText);
+  BinaryenModuleWriteTextToBuffer(batched, &batchedText);
+  assert(directText.size == batchedText.size);
+  assert(memcmp(directText.data, batchedText.data, directText.size) == 0);
+
+  if (argc > 1) {
+    printf("statements: %d, code words: %zu\n", count, code.size);
+    printf("per-expression calls: %f seconds\n", directTime);
+    printf("postfix code: %f seconds (+ %f seconds to emit it)\n",
+           batchedTime,
+           emitTime);
+  } else {
+    fwrite(batchedText.data, 1, batchedText.size, stdout);
+  }
+
+  free(code.data);
+  free(directText.data);
+  free(batchedText.data);
+  BinaryenModuleDispose(direct);
+  BinaryenModuleDispose(batched);
+  return 0;
+}
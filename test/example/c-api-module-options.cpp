@@ -0,0 +1,81 @@
+// test per-module options, with modules built in parallel
+
+#include <cassert>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include <binaryen-c.h>
+
+int NUM_THREADS = 8;
+
+struct Result {
+  int optimizeLevel;
+  int shrinkLevel;
+  int debugInfo;
+  size_t size;
+};
+
+void worker(int i, Result* result) {
+  BinaryenModuleRef module = BinaryenModuleCreate();
+  BinaryenModuleSetOptimizeLevel(module, i % 4);
+  BinaryenModuleSetShrinkLevel(module, i % 3);
+  BinaryenModuleSetDebugInfo(module, i % 2);
+
+  BinaryenType params[2] = { BinaryenTypeInt32(), BinaryenTypeInt32() };
+  BinaryenFunctionTypeRef iii =
+    BinaryenAddFunctionType(module, "iii", BinaryenTypeInt32(), params, 2);
+  BinaryenExpressionRef x = BinaryenLocalGet(module, 0, BinaryenTypeInt32()),
+                        y = BinaryenLocalGet(module, 1, BinaryenTypeInt32());
+  BinaryenExpressionRef add = BinaryenBinary(module, BinaryenAddInt32(), x, y);
+  BinaryenAddFunction(module, "adder", iii, NULL, 0, add);
+  BinaryenAddFunctionExport(module, "adder", "add");
+  assert(BinaryenModuleValidate(module));
+
+  BinaryenModuleOptimize(module);
+  assert(BinaryenModuleValidate(module));
+
+  result->optimizeLevel = BinaryenModuleGetOptimizeLevel(module);
+  result->shrinkLevel = BinaryenModuleGetShrinkLevel(module);
+  result->debugInfo = BinaryenModuleGetDebugInfo(module);
+  char buffer[1024];
+  result->size = BinaryenModuleWrite(module, buffer, sizeof(buffer));
+
+  BinaryenModuleDispose(module);
+}
+
+int main() {
+  BinaryenSetOptimizeLevel(1);
+  BinaryenSetShrinkLevel(0);
+  BinaryenSetDebugInfo(0);
+
+  std::vector<Result> results(NUM_THREADS);
+  std::vector<std::thread> threads;
+  for (int i = 0; i < NUM_THREADS; i++) {
+    threads.emplace_back(worker, i, &results[i]);
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (int i = 0; i < NUM_THREADS; i++) {
+    auto& result = results[i];
+    std::cout << "module " << i << ": optimize " << result.optimizeLevel
+              << ", shrink " << result.shrinkLevel << ", debugInfo "
+              << result.debugInfo << ", size " << result.size << '\n';
+  }
+
+  // The global options are unchanged, and are used by modules that did not
+  // set their own.
+  BinaryenModuleRef module = BinaryenModuleCreate();
+  std::cout << "global: optimize " << BinaryenGetOptimizeLevel() << ", shrink "
+            << BinaryenGetShrinkLevel() << ", debugInfo "
+            << BinaryenGetDebugInfo() << '\n';
+  std::cout << "default module: optimize "
+            << BinaryenModuleGetOptimizeLevel(module) << ", shrink "
+            << BinaryenModuleGetShrinkLevel(module) << ", debugInfo "
+            << BinaryenModuleGetDebugInfo(module) << '\n';
+  BinaryenModuleDispose(module);
+
+  return 0;
+}
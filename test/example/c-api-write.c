@@ -0,0 +1,113 @@
+// test the streaming and growable-buffer write functions
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <binaryen-c.h>
+
+// Counts the chunks passed to it and appends them to a buffer.
+struct Collector {
+  char data[4096];
+  size_t size;
+  int chunks;
+};
+
+static void collect(const char* data, size_t size, void* userData) {
+  struct Collector* collector = (struct Collector*)userData;
+  assert(collector->size + size <= sizeof(collector->data));
+  memcpy(collector->data + collector->size, data, size);
+  collector->size += size;
+  collector->chunks++;
+}
+
+int main() {
+  BinaryenModuleRef module = BinaryenModuleCreate();
+  BinaryenType params[2] = { BinaryenTypeInt32(), BinaryenTypeInt32() };
+  BinaryenFunctionTypeRef iii =
+    BinaryenAddFunctionType(module, "iii", BinaryenTypeInt32(), params, 2);
+  BinaryenExpressionRef x = BinaryenLocalGet(module, 0, BinaryenTypeInt32());
+  BinaryenExpressionRef y = BinaryenLocalGet(module, 1, BinaryenTypeInt32());
+  BinaryenExpressionRef add = BinaryenBinary(module, BinaryenAddInt32(), x, y);
+  BinaryenFunctionRef adder =
+    BinaryenAddFunction(module, "adder", iii, NULL, 0, add);
+  BinaryenModuleAddDebugInfoFileName(module, "main.c");
+  BinaryenFunctionSetDebugLocation(adder, add, 0, 42, 7);
+  BinaryenAddFunctionExport(module, "adder", "add");
+  assert(BinaryenModuleValidate(module));
+
+  // Binary, with a source map.
+  char binary[1024];
+  char sourceMap[1024];
+  BinaryenBufferSizes sizes = BinaryenModuleWriteWithSourceMap(module,
+                                                               "main.wasm.map",
+                                                               binary,
+                                                               sizeof(binary),
+                                                               sourceMap,
+                                                               sizeof(sourceMap));
+  printf("%.*s\n", (int)sizes.sourceMapBytes, sourceMap);
+
+  struct Collector binaryCollector = { {0}, 0, 0 };
+  struct Collector sourceMapCollector = { {0}, 0, 0 };
+  BinaryenModuleWriteWithCallback(module,
+                                  collect,
+                                  &binaryCollector,
+                                  "main.wasm.map",
+                                  collect,
+                                  &sourceMapCollector);
+  printf("binary with callback: %d\n",
+         binaryCollector.size == sizes.outputBytes &&
+           memcmp(binaryCollector.data, binary, sizes.outputBytes) == 0);
+  printf("source map with callback: %d\n",
+         sourceMapCollector.size == sizes.sourceMapBytes &&
+           memcmp(sourceMapCollector.data, sourceMap, sizes.sourceMapBytes) ==
+             0);
+
+  BinaryenOutputBuffer binaryBuffer = { NULL, 0, 0 };
+  BinaryenOutputBuffer sourceMapBuffer = { NULL, 0, 0 };
+  BinaryenModuleWriteToBuffer(
+    module, &binaryBuffer, "main.wasm.map", &sourceMapBuffer);
+  printf("binary to buffer: %d\n",
+         binaryBuffer.size == sizes.outputBytes &&
+           memcmp(binaryBuffer.data, binary, sizes.outputBytes) == 0);
+  printf("source map to buffer: %d\n",
+         sourceMapBuffer.size == sizes.sourceMapBytes &&
+           memcmp(sourceMapBuffer.data, sourceMap, sizes.sourceMapBytes) == 0);
+
+  // Reuse the buffer.
+  binaryBuffer.size = 0;
+  BinaryenModuleWriteToBuffer(module, &binaryBuffer, NULL, NULL);
+  size_t binarySize = BinaryenModuleWrite(module, binary, sizeof(binary));
+  printf("binary to reused buffer: %d\n",
+         binaryBuffer.size == binarySize &&
+           memcmp(binaryBuffer.data, binary, binarySize) == 0);
+
+  // Text.
+  char* text = BinaryenModuleAllocateAndWriteText(module);
+  size_t textSize = strlen(text);
+  struct Collector textCollector = { {0}, 0, 0 };
+  BinaryenModuleWriteTextWithCallback(module, collect, &textCollector);
+  printf("text with callback: %d\n",
+         textCollector.size == textSize &&
+           memcmp(textCollector.data, text, textSize) == 0);
+  BinaryenOutputBuffer textBuffer = { NULL, 0, 0 };
+  BinaryenModuleWriteTextToBuffer(module, &textBuffer);
+  printf("text to buffer: %d\n",
+         textBuffer.size == textSize &&
+           memcmp(textBuffer.data, text, textSize) == 0);
+  char truncated[16];
+  size_t truncatedSize =
+    BinaryenModuleWriteText(module, truncated, sizeof(truncated));
+  printf("truncated text: %d\n",
+         truncatedSize == sizeof(truncated) &&
+           memcmp(truncated, text, sizeof(truncated)) == 0);
+  printf("%s", text);
+
+  free(text);
+  free(binaryBuffer.data);
+  free(sourceMapBuffer.data);
+  free(textBuffer.data);
+  BinaryenModuleDispose(module);
+  return 0;
+}
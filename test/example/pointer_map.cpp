@@ -0,0 +1,94 @@
+#include <cassert>
+#include <iostream>
+#include <map>
+#include <random>
+#include <type_traits>
+
+#include "support/pointer_map.h"
+
+using namespace wasm;
+
+// compare to a std::map on random operations, with keys that collide a lot
+void testRandom() {
+  std::vector<int> storage(1000);
+  std::mt19937 random(42);
+  PointerMap<int*, int> map;
+  std::map<int*, int> expected;
+  for (int i = 0; i < 100000; i++) {
+    auto* key = &storage[random() % (i < 50000 ? storage.size() : 50)];
+    switch (random() % 4) {
+      case 0:
+      case 1: {
+        map[key] = i;
+        expected[key] = i;
+        break;
+      }
+      case 2: {
+        auto erased = map.erase(key);
+        auto expectedErased = expected.erase(key);
+        assert(erased == expectedErased);
+        break;
+      }
+      case 3: {
+        auto iter = map.find(key);
+        auto expectedIter = expected.find(key);
+        if (expectedIter == expected.end()) {
+          assert(iter == map.end());
+          assert(map.count(key) == 0);
+        } else {
+          assert(iter != map.end());
+          assert(iter->first == key);
+          assert(iter->second == expectedIter->second);
+          assert(map.count(key) == 1);
+        }
+        break;
+      }
+    }
+    assert(map.size() == expected.size());
+  }
+  std::map<int*, int> iterated;
+  for (auto& pair : map) {
+    assert(iterated.count(pair.first) == 0);
+    iterated[pair.first] = pair.second;
+  }
+  assert(iterated == expected);
+}
+
+void testBasics() {
+  int a, b;
+  PointerMap<int*, int> map;
+  assert(map.empty());
+  assert(map.find(&a) == map.end());
+  assert(map.begin() == map.end());
+  map[&a] = 1;
+  map[&b]++;
+  assert(map.size() == 2);
+  assert(map[&a] == 1);
+  assert(map[&b] == 1);
+  map.erase(map.find(&a));
+  assert(map.size() == 1);
+  assert(map.count(&a) == 0);
+  PointerMap<int*, int> other = map;
+  assert(other.size() == 1);
+  map.clear();
+  assert(map.empty());
+  assert(map.begin() == map.end());
+  map.swap(other);
+  assert(map.size() == 1);
+  assert(other.empty());
+  assert(map.begin()->first == &b);
+  other = map;
+  assert(other.size() == 1);
+  assert(other[&b] == 1);
+  // as in std::unordered_map, keys cannot be modified through an iterator
+  static_assert(
+    std::is_const<
+      std::remove_reference<decltype(map.begin()->first)>::type>::value,
+    "keys must be const");
+}
+
+int main() {
+  testBasics();
+  testRandom();
+  std::cout << "ok.\n";
+}
@@ -0,0 +1,11 @@
+(module
+  (memory 1 2)
+  (import "env" "import" (func $import))
+  (func $calls-import (param $x i32) (result i32)
+    (call $import)
+    (local.get $x)
+  )
+  (func $no-calls (result i32)
+    (i32.const 1)
+  )
+)
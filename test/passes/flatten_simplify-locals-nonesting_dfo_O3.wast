@@ -109,5 +109,27 @@
   )
   (i32.const -2766)
  )
+ (func "const-fold" (param $var$0 i32) (result i32)
+  (local $var$1 i32)
+  (local.set $var$1
+   (i32.div_u
+    (i32.const 7)
+    (i32.const 2)
+   )
+  )
+  ;; this one traps, so it must not be folded
+  (if
+   (local.get $var$0)
+   (drop
+    (i32.div_s
+     (local.get $var$1)
+     (i32.const 0)
+    )
+   )
+  )
+  (i32.shl
+   (local.get $var$1)
+   (i32.const 2)
+  )
+ )
 )
-
@@ -0,0 +1,9 @@
+(module
+  (memory 1 1)
+  (func $A (param $x i32) (param $y i64) (param $z f32) (param $w f64)
+    (local.set $x (local.get $x))
+    (local.set $y (local.get $y))
+    (local.set $z (local.get $z))
+    (local.set $w (local.get $w))
+  )
+)
@@ -3766,6 +3766,23 @@
       (unreachable)
     )
   )
+  (func $max-bits-after-merge (param $p i32) (result i32)
+    (local $y i32)
+    (local.set $y (i32.load8_u (local.get $p)))
+    ;; the inner mask is removed, as the shl is at most 9 bits, and then the
+    ;; shifts are merged in place. the merged shl is 11 bits, so the outer mask
+    ;; must stay
+    (i32.and
+      (i32.shl
+        (i32.and
+          (i32.shl (local.get $y) (i32.const 1))
+          (i32.const 511)
+        )
+        (i32.const 2)
+      )
+      (i32.const 1023)
+    )
+  )
 )
 (module
   (import "env" "memory" (memory $0 (shared 256 256)))
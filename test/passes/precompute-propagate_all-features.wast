@@ -175,4 +175,20 @@
    (local.set $x (v8x16.load_splat (i32.const 0)))
    (local.get $x)
   )
+  (func $cached-failures (result i32)
+   (local $x i32)
+   (local $y i32)
+   ;; this traps, so neither it nor its parent can be precomputed
+   (drop
+    (i32.add
+     (i32.div_s (i32.const 1) (i32.const 0))
+     (i32.const 2)
+    )
+   )
+   ;; $y can only be computed once $x is known
+   (local.set $y (i32.add (local.get $x) (i32.const 1)))
+   (local.set $x (i32.const 10))
+   (local.set $y (i32.add (local.get $x) (i32.const 1)))
+   (i32.mul (local.get $y) (i32.const 2))
+  )
 )
@@ -0,0 +1,57 @@
+(module
+  (memory 1 1)
+  (data (i32.const 1024) "0123456789abcdef0123456789abcdef")
+  (func $static (param $x i32)
+    ;; constant addresses in the static data need no checks
+    (drop (i32.load (i32.const 1024)))
+    (drop (i32.load offset=28 (i32.const 1024)))
+    ;; past the end of the static data
+    (drop (i32.load offset=29 (i32.const 1024)))
+    ;; in bounds, but not aligned
+    (drop (i32.load (i32.const 1026)))
+    ;; a bounded, aligned index
+    (i32.store
+      (i32.add
+        (i32.const 1024)
+        (i32.shl (i32.and (local.get $x) (i32.const 7)) (i32.const 2))
+      )
+      (i32.const 1)
+    )
+    ;; unbounded
+    (drop (i32.load (local.get $x)))
+  )
+  (func $loop (param $n i32)
+    (local $p i32)
+    (local.set $p (i32.const 1024))
+    (loop $l
+      ;; aligned, but not bounded
+      (drop (i32.load (local.get $p)))
+      (local.set $p (i32.add (local.get $p) (i32.const 4)))
+      (br_if $l (local.get $n))
+    )
+  )
+  (func $ring (param $n i32)
+    (local $i i32)
+    (loop $l
+      ;; the index wraps around, so it stays in bounds
+      (i64.store (i32.add (i32.const 1024) (local.get $i)) (i64.const 0))
+      (local.set $i
+        (i32.and (i32.add (local.get $i) (i32.const 8)) (i32.const 24))
+      )
+      (br_if $l (local.get $n))
+    )
+  )
+)
+(module
+  (memory 1 1)
+  (func $nested (param $x i32) (param $y i32)
+    ;; the value stores, so it needs its own locals
+    (i32.store
+      (local.get $x)
+      (block (result i32)
+        (i32.store offset=4 (local.get $y) (i32.const 1))
+        (i32.load8_u (local.get $y))
+      )
+    )
+  )
+)
@@ -0,0 +1,42 @@
+(module
+  (type $i (func (result i32)))
+  (memory $0 1)
+  (data (i32.const 8) "hello")
+  (table 1 1 funcref)
+  (elem (global.get $offset) $get)
+  (import "env" "offset" (global $offset i32))
+  (global $g (mut i32) (i32.const 42))
+  ;;@ src.cpp:1:1
+  (func $get (type $i) (result i32)
+    ;;@ src.cpp:2:1
+    (drop
+      ;;@ src.cpp:2:2
+      (i32.const 1)
+    )
+    ;;@ src.cpp:3:1
+    (block $out (result i32)
+      ;;@ src.cpp:3:2
+      (nop)
+      ;;@ src.cpp:4:1
+      (i32.add
+        (global.get $g)
+        ;;@ src.cpp:4:2
+        (i32.load
+          (i32.const 8)
+        )
+      )
+    )
+  )
+  (func $loop (param $x i32)
+    (loop $top
+      (br_if $top
+        (local.tee $x
+          (i32.sub
+            (local.get $x)
+            (call $get)
+          )
+        )
+      )
+    )
+  )
+)
@@ -0,0 +1,13 @@
+(module
+ (import "en\"v" "sl\0aeep" (func $sleep))
+ (memory 1 1)
+ (func $back\\slash (export "main")
+  (call $sleep)
+ )
+ (func $quote"d
+  (call $back\\slash)
+ )
+ (func $pure (result i32)
+  (i32.const 1)
+ )
+)
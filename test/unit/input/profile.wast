@@ -0,0 +1,22 @@
+(module
+ (memory 1)
+ (export "main" (func $main))
+ (func $cold (param $x i32) (result i32)
+  (i32.add (local.get $x) (i32.const 1))
+ )
+ (func $hot (param $x i32) (result i32)
+  (if (i32.eqz (local.get $x))
+   (return (call $cold (local.get $x)))
+  )
+  (i32.store (i32.and (local.get $x) (i32.const 255)) (local.get $x))
+  (i32.mul (local.get $x) (i32.const 3))
+ )
+ (func $main (param $n i32)
+  (loop $l
+   (drop (call $hot (local.get $n)))
+   (drop (call $hot (i32.add (local.get $n) (i32.const 8))))
+   (br_if $l (local.tee $n (i32.sub (local.get $n) (i32.const 1))))
+  )
+ )
+)
+(invoke "main" (i32.const 100))
@@ -0,0 +1,20 @@
+var fs = require('fs');
+
+var flushes = [];
+
+var instance = new WebAssembly.Instance(
+  new WebAssembly.Module(fs.readFileSync('a.wasm')), {
+    env: {
+      trace_flush: function(start, size) {
+        // copy the records out, as the buffer will be reused
+        flushes.push(Buffer.from(new Uint8Array(instance.exports.memory.buffer,
+                                                start, size)));
+      }
+    }
+  });
+
+instance.exports.main(3);
+instance.exports.trace_finish();
+
+console.log('flushes: ' + flushes.length);
+fs.writeFileSync('trace.bin', Buffer.concat(flushes));
@@ -0,0 +1,15 @@
+(module
+  (memory $0 1 1)
+  (export "memory" (memory $0))
+  (export "main" (func $main))
+  (func $main (param $n i32)
+    (loop $l
+      (i32.store (i32.const 16) (local.get $n))
+      (br_if $l
+        (local.tee $n
+          (i32.sub (i32.load (i32.const 16)) (i32.const 1))
+        )
+      )
+    )
+  )
+)
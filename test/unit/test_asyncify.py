@@ -1,3 +1,4 @@
+import json
 import os
 import subprocess
 import tempfile
@@ -69,3 +70,42 @@ class AsyncifyTest(utils.BinaryenTestCase):
         self.assertEqual(normal, response)
         without = test(['--pass-arg=asyncify-imports@without.anything'])
         self.assertNotEqual(normal, without)
+
+    def test_asyncify_report(self):
+        # The names and import strings here need escaping in JSON.
+        shared.run_process(shared.WASM_OPT + [self.input_path('asyncify-report.wast'), '--asyncify', '--pass-arg=asyncify-report@report.json', '-o', 'a.wasm'])
+        with open('report.json') as f:
+            report = json.load(f)
+        functions = {func['name']: func for func in report['functions']}
+        self.assertEqual(sorted(functions), ['back\\\\slash', 'pure', 'quote"d'])
+        sleep = 'en\\"v.sl\\0aeep'
+        self.assertEqual(functions['back\\\\slash']['reason'], [sleep])
+        self.assertEqual(functions['quote"d']['reason'], ['back\\\\slash', sleep])
+        self.assertFalse(functions['pure']['instrumented'])
+        self.assertEqual(functions['pure']['reason'], [])
+
+        # The text format cannot give an import a name with a real control
+        # character, so patch one into the import section of a binary.
+        module = '''
+(module
+ (import "env" "sl_eep" (func $sleep))
+ (memory 1 1)
+ (func $main (export "main")
+  (call $sleep)
+ )
+)
+'''
+        with open('b.wast', 'w') as f:
+            f.write(module)
+        shared.run_process(shared.WASM_AS + ['b.wast', '-g', '-o', 'b.wasm'])
+        with open('b.wasm', 'rb') as f:
+            binary = f.read()
+        self.assertEqual(binary.count(b'sl_eep'), 1)
+        with open('b.wasm', 'wb') as f:
+            f.write(binary.replace(b'sl_eep', b'sl\neep'))
+        shared.run_process(shared.WASM_OPT + ['b.wasm', '--asyncify', '--pass-arg=asyncify-report@report.json', '-o', 'c.wasm'])
+        with open('report.json') as f:
+            text = f.read()
+        self.assertIn('"env.sl\\u000aeep"', text)
+        report = json.loads(text)
+        self.assertEqual(report['functions'][0]['reason'], ['env.sl\neep'])
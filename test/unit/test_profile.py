@@ -0,0 +1,25 @@
+import os
+from scripts.test import shared
+from . import utils
+
+
+class ProfileTest(utils.BinaryenTestCase):
+    def test_profile(self):
+        # run the module in the interpreter, writing a profile
+        path = self.input_path('profile.wast')
+        shared.run_process(shared.WASM_SHELL + [path, '--profile', 'profile.txt'])
+        with open('profile.txt') as f:
+            self.assertEqual(f.read(), '200\thot\n1\tmain\n200\tmain\thot\n')
+
+        def optimize(args):
+            return shared.run_process(shared.WASM_OPT + [path, '-o', os.devnull] + args + ['--print'], capture_output=True).stdout
+
+        profile = ['--pass-arg=profile@@profile.txt']
+        # the profile sorts functions by how often they are called
+        ordered = optimize(['--reorder-functions'] + profile)
+        self.assertLess(ordered.index('(func $hot ('), ordered.index('(func $main ('))
+        self.assertLess(ordered.index('(func $main ('), ordered.index('(func $cold ('))
+        # $hot is not small enough to always inline, and has two calls, so it
+        # is only inlined when the profile shows those calls are hot
+        self.assertIn('call $hot', optimize(['--inlining']))
+        self.assertNotIn('call $hot', optimize(['--inlining'] + profile))
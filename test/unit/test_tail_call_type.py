@@ -43,3 +43,26 @@ class TailCallTypeTest(utils.BinaryenTestCase):
         self.assertIn(
             'return_call_indirect callee return type must match caller return type',
             p.stderr)
+
+    def test_return_call_i64_lowering(self):
+        # Lowering an i64 return_call is not implemented, whether the callee
+        # is imported or defined.
+        for callee in ['(import "env" "imp" (func $callee (result i64)))',
+                       '(func $callee (result i64) (i64.const 1))']:
+            module = '''
+    (module
+     %s
+     (func $foo (result i64)
+      (return_call $callee)
+     )
+    )
+''' % callee
+            p = shared.run_process(shared.WASM_OPT +
+                                   ['--enable-tail-call', '--flatten',
+                                    '--i64-to-i32-lowering', '-o', os.devnull],
+                                   input=module, check=False,
+                                   capture_output=True)
+            self.assertNotEqual(p.returncode, 0)
+            self.assertIn(
+                'i64 to i32 lowering of return_call values not yet implemented',
+                p.stderr)
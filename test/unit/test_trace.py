@@ -0,0 +1,30 @@
+import os
+import sys
+
+from scripts.test import shared
+from . import utils
+
+
+class TraceTest(utils.BinaryenTestCase):
+    def trace(self, args):
+        # log execution and memory accesses into the same small buffer, so it
+        # fills up and is flushed several times
+        shared.run_process(shared.WASM_OPT + [self.input_path('trace.wast'), '--log-execution', '--instrument-memory', '--pass-arg=trace-buffer@1024,32', '-o', 'a.wasm'] + args)
+        output = shared.run_process([shared.NODEJS, self.input_path('trace.js')], capture_output=True).stdout
+        decoder = os.path.join(shared.options.binaryen_root, 'scripts', 'decode_trace.py')
+        events = shared.run_process([sys.executable, decoder, 'trace.bin'], capture_output=True).stdout.splitlines()
+        return events, output.strip()
+
+    def test_trace(self):
+        def iteration(n):
+            return ['log_execution 0', 'store_ptr 1 16', 'store_val_i32 1 %d' % n, 'load_ptr 2 16', 'load_val_i32 2 %d' % n]
+
+        events, output = self.trace([])
+        self.assertEqual(events, ['log_execution 1'] + iteration(3) + iteration(2) + iteration(1))
+        # 112 bytes of records fill the 32 byte buffer three times, and
+        # trace_finish flushes the rest
+        self.assertEqual(output, 'flushes: 4')
+        # sampling records the first event and then every Nth one
+        sampled, output = self.trace(['--pass-arg=trace-sample@2'])
+        self.assertEqual(sampled, events[::2])
+        self.assertEqual(output, 'flushes: 2')
@@ -26,75 +26,83 @@ function asmFunc(global, env, buffer) {
  function $0($0_1, $0$hi) {
   $0_1 = $0_1 | 0;
   $0$hi = $0$hi | 0;
-  var i64toi32_i32$3 = 0, i64toi32_i32$5 = 0, i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, $12 = 0, $12$hi = 0, $8 = 0, $8$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$1 = 0, $12 = 0, $12$hi = 0, i64toi32_i32$4 = 0, $8 = 0, $8$hi = 0;
+  i64toi32_i32$0 = $0$hi;
   i64toi32_i32$2 = $0_1;
   i64toi32_i32$1 = 0;
   i64toi32_i32$3 = 0;
-  if ((i64toi32_i32$2 | 0) == (i64toi32_i32$3 | 0) & ($0$hi | 0) == (i64toi32_i32$1 | 0) | 0) {
+  if ((i64toi32_i32$2 | 0) == (i64toi32_i32$3 | 0) & (i64toi32_i32$0 | 0) == (i64toi32_i32$1 | 0) | 0) {
    i64toi32_i32$2 = 0;
    $12 = 1;
    $12$hi = i64toi32_i32$2;
   } else {
    i64toi32_i32$2 = $0$hi;
    i64toi32_i32$3 = $0_1;
+   i64toi32_i32$0 = 0;
    i64toi32_i32$1 = 1;
-   i64toi32_i32$5 = (i64toi32_i32$3 >>> 0 < i64toi32_i32$1 >>> 0) + 0 | 0;
-   i64toi32_i32$5 = $0$hi - i64toi32_i32$5 | 0;
-   i64toi32_i32$5 = $0(i64toi32_i32$3 - i64toi32_i32$1 | 0 | 0, i64toi32_i32$5 | 0) | 0;
-   i64toi32_i32$3 = i64toi32_i32$HIGH_BITS;
-   $8 = i64toi32_i32$5;
-   $8$hi = i64toi32_i32$3;
-   i64toi32_i32$3 = $0$hi;
-   i64toi32_i32$5 = $8$hi;
-   i64toi32_i32$5 = __wasm_i64_mul($0_1 | 0, i64toi32_i32$3 | 0, $8 | 0, i64toi32_i32$5 | 0) | 0;
-   i64toi32_i32$3 = i64toi32_i32$HIGH_BITS;
-   $12 = i64toi32_i32$5;
-   $12$hi = i64toi32_i32$3;
+   i64toi32_i32$4 = i64toi32_i32$3 >>> 0 < i64toi32_i32$1 >>> 0;
+   i64toi32_i32$3 = i64toi32_i32$3 - i64toi32_i32$1 | 0;
+   i64toi32_i32$0 = i64toi32_i32$4 + i64toi32_i32$0 | 0;
+   i64toi32_i32$0 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
+   i64toi32_i32$0 = $0(i64toi32_i32$3 | 0, i64toi32_i32$0 | 0) | 0;
+   i64toi32_i32$2 = i64toi32_i32$HIGH_BITS;
+   $8 = i64toi32_i32$0;
+   $8$hi = i64toi32_i32$2;
+   i64toi32_i32$2 = $0$hi;
+   i64toi32_i32$0 = $8$hi;
+   i64toi32_i32$0 = __wasm_i64_mul($0_1 | 0, i64toi32_i32$2 | 0, $8 | 0, i64toi32_i32$0 | 0) | 0;
+   i64toi32_i32$2 = i64toi32_i32$HIGH_BITS;
+   $12 = i64toi32_i32$0;
+   $12$hi = i64toi32_i32$2;
   }
-  i64toi32_i32$3 = $12$hi;
-  i64toi32_i32$5 = $12;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$3;
-  return i64toi32_i32$5 | 0;
+  i64toi32_i32$2 = $12$hi;
+  i64toi32_i32$0 = $12;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$2;
+  return i64toi32_i32$0 | 0;
  }
  
  function fac_rec_named(n, n$hi) {
   n = n | 0;
   n$hi = n$hi | 0;
-  var i64toi32_i32$3 = 0, i64toi32_i32$5 = 0, i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, $12 = 0, $12$hi = 0, $8 = 0, $8$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$1 = 0, $12 = 0, $12$hi = 0, i64toi32_i32$4 = 0, $8 = 0, $8$hi = 0;
+  i64toi32_i32$0 = n$hi;
   i64toi32_i32$2 = n;
   i64toi32_i32$1 = 0;
   i64toi32_i32$3 = 0;
-  if ((i64toi32_i32$2 | 0) == (i64toi32_i32$3 | 0) & (n$hi | 0) == (i64toi32_i32$1 | 0) | 0) {
+  if ((i64toi32_i32$2 | 0) == (i64toi32_i32$3 | 0) & (i64toi32_i32$0 | 0) == (i64toi32_i32$1 | 0) | 0) {
    i64toi32_i32$2 = 0;
    $12 = 1;
    $12$hi = i64toi32_i32$2;
   } else {
    i64toi32_i32$2 = n$hi;
    i64toi32_i32$3 = n;
+   i64toi32_i32$0 = 0;
    i64toi32_i32$1 = 1;
-   i64toi32_i32$5 = (i64toi32_i32$3 >>> 0 < i64toi32_i32$1 >>> 0) + 0 | 0;
-   i64toi32_i32$5 = n$hi - i64toi32_i32$5 | 0;
-   i64toi32_i32$5 = fac_rec_named(i64toi32_i32$3 - i64toi32_i32$1 | 0 | 0, i64toi32_i32$5 | 0) | 0;
-   i64toi32_i32$3 = i64toi32_i32$HIGH_BITS;
-   $8 = i64toi32_i32$5;
-   $8$hi = i64toi32_i32$3;
-   i64toi32_i32$3 = n$hi;
-   i64toi32_i32$5 = $8$hi;
-   i64toi32_i32$5 = __wasm_i64_mul(n | 0, i64toi32_i32$3 | 0, $8 | 0, i64toi32_i32$5 | 0) | 0;
-   i64toi32_i32$3 = i64toi32_i32$HIGH_BITS;
-   $12 = i64toi32_i32$5;
-   $12$hi = i64toi32_i32$3;
+   i64toi32_i32$4 = i64toi32_i32$3 >>> 0 < i64toi32_i32$1 >>> 0;
+   i64toi32_i32$3 = i64toi32_i32$3 - i64toi32_i32$1 | 0;
+   i64toi32_i32$0 = i64toi32_i32$4 + i64toi32_i32$0 | 0;
+   i64toi32_i32$0 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
+   i64toi32_i32$0 = fac_rec_named(i64toi32_i32$3 | 0, i64toi32_i32$0 | 0) | 0;
+   i64toi32_i32$2 = i64toi32_i32$HIGH_BITS;
+   $8 = i64toi32_i32$0;
+   $8$hi = i64toi32_i32$2;
+   i64toi32_i32$2 = n$hi;
+   i64toi32_i32$0 = $8$hi;
+   i64toi32_i32$0 = __wasm_i64_mul(n | 0, i64toi32_i32$2 | 0, $8 | 0, i64toi32_i32$0 | 0) | 0;
+   i64toi32_i32$2 = i64toi32_i32$HIGH_BITS;
+   $12 = i64toi32_i32$0;
+   $12$hi = i64toi32_i32$2;
   }
-  i64toi32_i32$3 = $12$hi;
-  i64toi32_i32$5 = $12;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$3;
-  return i64toi32_i32$5 | 0;
+  i64toi32_i32$2 = $12$hi;
+  i64toi32_i32$0 = $12;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$2;
+  return i64toi32_i32$0 | 0;
  }
  
  function $2($0_1, $0$hi) {
   $0_1 = $0_1 | 0;
   $0$hi = $0$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, $1$hi = 0, i64toi32_i32$5 = 0, $1 = 0, $2$hi = 0, i64toi32_i32$1 = 0, $2_1 = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, $1$hi = 0, $1 = 0, $2$hi = 0, i64toi32_i32$1 = 0, $2_1 = 0, i64toi32_i32$4 = 0;
   i64toi32_i32$0 = $0$hi;
   $1 = $0_1;
   $1$hi = i64toi32_i32$0;
@@ -122,24 +130,26 @@ function asmFunc(global, env, buffer) {
      i64toi32_i32$3 = $1;
      i64toi32_i32$0 = 0;
      i64toi32_i32$1 = 1;
-     i64toi32_i32$5 = (i64toi32_i32$3 >>> 0 < i64toi32_i32$1 >>> 0) + i64toi32_i32$0 | 0;
-     i64toi32_i32$5 = i64toi32_i32$2 - i64toi32_i32$5 | 0;
-     $1 = i64toi32_i32$3 - i64toi32_i32$1 | 0;
-     $1$hi = i64toi32_i32$5;
+     i64toi32_i32$4 = i64toi32_i32$3 >>> 0 < i64toi32_i32$1 >>> 0;
+     i64toi32_i32$3 = i64toi32_i32$3 - i64toi32_i32$1 | 0;
+     i64toi32_i32$0 = i64toi32_i32$4 + i64toi32_i32$0 | 0;
+     i64toi32_i32$0 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
+     $1 = i64toi32_i32$3;
+     $1$hi = i64toi32_i32$0;
     }
     continue loop_in;
    };
   }
-  i64toi32_i32$5 = $2$hi;
-  i64toi32_i32$3 = $2_1;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$5;
-  return i64toi32_i32$3 | 0;
+  i64toi32_i32$0 = $2$hi;
+  i64toi32_i32$2 = $2_1;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
+  return i64toi32_i32$2 | 0;
  }
  
  function $3(n, n$hi) {
   n = n | 0;
   n$hi = n$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i$hi = 0, i64toi32_i32$5 = 0, i = 0, res$hi = 0, i64toi32_i32$1 = 0, res = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i$hi = 0, i = 0, res$hi = 0, i64toi32_i32$1 = 0, res = 0, i64toi32_i32$4 = 0;
   i64toi32_i32$0 = n$hi;
   i = n;
   i$hi = i64toi32_i32$0;
@@ -167,24 +177,26 @@ function asmFunc(global, env, buffer) {
      i64toi32_i32$3 = i;
      i64toi32_i32$0 = 0;
      i64toi32_i32$1 = 1;
-     i64toi32_i32$5 = (i64toi32_i32$3 >>> 0 < i64toi32_i32$1 >>> 0) + i64toi32_i32$0 | 0;
-     i64toi32_i32$5 = i64toi32_i32$2 - i64toi32_i32$5 | 0;
-     i = i64toi32_i32$3 - i64toi32_i32$1 | 0;
-     i$hi = i64toi32_i32$5;
+     i64toi32_i32$4 = i64toi32_i32$3 >>> 0 < i64toi32_i32$1 >>> 0;
+     i64toi32_i32$3 = i64toi32_i32$3 - i64toi32_i32$1 | 0;
+     i64toi32_i32$0 = i64toi32_i32$4 + i64toi32_i32$0 | 0;
+     i64toi32_i32$0 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
+     i = i64toi32_i32$3;
+     i$hi = i64toi32_i32$0;
     }
     continue loop;
    };
   }
-  i64toi32_i32$5 = res$hi;
-  i64toi32_i32$3 = res;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$5;
-  return i64toi32_i32$3 | 0;
+  i64toi32_i32$0 = res$hi;
+  i64toi32_i32$2 = res;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
+  return i64toi32_i32$2 | 0;
  }
  
  function $4($0_1, $0$hi) {
   $0_1 = $0_1 | 0;
   $0$hi = $0$hi | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$5 = 0, i64toi32_i32$3 = 0, $1$hi = 0, $1 = 0, $10 = 0, $11 = 0, $12 = 0, i64toi32_i32$4 = 0, $13 = 0, $14 = 0, $15 = 0;
+  var i64toi32_i32$2 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, i64toi32_i32$1 = 0, $1$hi = 0, $1 = 0, $8 = 0, $9 = 0, $10 = 0, $11 = 0, $12 = 0, $13 = 0;
   i64toi32_i32$0 = 0;
   $1 = 1;
   $1$hi = i64toi32_i32$0;
@@ -194,21 +206,21 @@ function asmFunc(global, env, buffer) {
    i64toi32_i32$1 = 0;
    i64toi32_i32$3 = 2;
    if ((i64toi32_i32$0 | 0) < (i64toi32_i32$1 | 0)) {
-    $10 = 1
+    $8 = 1
    } else {
     if ((i64toi32_i32$0 | 0) <= (i64toi32_i32$1 | 0)) {
      if (i64toi32_i32$2 >>> 0 >= i64toi32_i32$3 >>> 0) {
-      $11 = 0
+      $9 = 0
      } else {
-      $11 = 1
+      $9 = 1
      }
-     $12 = $11;
+     $10 = $9;
     } else {
-     $12 = 0
+     $10 = 0
     }
-    $10 = $12;
+    $8 = $10;
    }
-   if ($10) {
+   if ($8) {
     break block
    }
    loop_in : while (1) {
@@ -224,41 +236,41 @@ function asmFunc(global, env, buffer) {
     i64toi32_i32$3 = $0_1;
     i64toi32_i32$0 = -1;
     i64toi32_i32$1 = -1;
-    i64toi32_i32$4 = $0_1 + i64toi32_i32$1 | 0;
-    i64toi32_i32$5 = i64toi32_i32$2 + i64toi32_i32$0 | 0;
-    if (i64toi32_i32$4 >>> 0 < i64toi32_i32$1 >>> 0) {
-     i64toi32_i32$5 = i64toi32_i32$5 + 1 | 0
+    i64toi32_i32$3 = i64toi32_i32$3 + i64toi32_i32$1 | 0;
+    i64toi32_i32$2 = i64toi32_i32$2 + i64toi32_i32$0 | 0;
+    if (i64toi32_i32$3 >>> 0 < i64toi32_i32$1 >>> 0) {
+     i64toi32_i32$2 = i64toi32_i32$2 + 1 | 0
     }
-    $0_1 = i64toi32_i32$4;
-    $0$hi = i64toi32_i32$5;
-    i64toi32_i32$2 = $0_1;
-    i64toi32_i32$3 = 0;
-    i64toi32_i32$1 = 1;
-    if ((i64toi32_i32$5 | 0) > (i64toi32_i32$3 | 0)) {
-     $13 = 1
+    $0_1 = i64toi32_i32$3;
+    $0$hi = i64toi32_i32$2;
+    i64toi32_i32$0 = i64toi32_i32$3;
+    i64toi32_i32$1 = 0;
+    i64toi32_i32$3 = 1;
+    if ((i64toi32_i32$2 | 0) > (i64toi32_i32$1 | 0)) {
+     $11 = 1
     } else {
-     if ((i64toi32_i32$5 | 0) >= (i64toi32_i32$3 | 0)) {
-      if (i64toi32_i32$2 >>> 0 <= i64toi32_i32$1 >>> 0) {
-       $14 = 0
+     if ((i64toi32_i32$2 | 0) >= (i64toi32_i32$1 | 0)) {
+      if (i64toi32_i32$0 >>> 0 <= i64toi32_i32$3 >>> 0) {
+       $12 = 0
       } else {
-       $14 = 1
+       $12 = 1
       }
-      $15 = $14;
+      $13 = $12;
      } else {
-      $15 = 0
+      $13 = 0
      }
-     $13 = $15;
+     $11 = $13;
     }
-    if ($13) {
+    if ($11) {
      continue loop_in
     }
     break loop_in;
    };
   }
-  i64toi32_i32$2 = $1$hi;
-  i64toi32_i32$5 = $1;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$2;
-  return i64toi32_i32$5 | 0;
+  i64toi32_i32$0 = $1$hi;
+  i64toi32_i32$2 = $1;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
+  return i64toi32_i32$2 | 0;
  }
  
  function legalstub$0($0_1, $1) {
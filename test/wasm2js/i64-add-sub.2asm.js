@@ -27,18 +27,25 @@ function asmFunc(global, env, buffer) {
   $1$hi = $1$hi | 0;
   r = r | 0;
   r$hi = r$hi | 0;
-  var i64toi32_i32$5 = 0, i64toi32_i32$3 = 0, i64toi32_i32$4 = 0, $5$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$1 = 0, $5$hi = 0;
+  i64toi32_i32$0 = $0$hi;
+  i64toi32_i32$0 = $1$hi;
+  i64toi32_i32$0 = $0$hi;
+  i64toi32_i32$2 = $0;
+  i64toi32_i32$1 = $1$hi;
   i64toi32_i32$3 = $1_1;
-  i64toi32_i32$4 = $0 + i64toi32_i32$3 | 0;
-  i64toi32_i32$5 = $0$hi + $1$hi | 0;
-  if (i64toi32_i32$4 >>> 0 < i64toi32_i32$3 >>> 0) {
-   i64toi32_i32$5 = i64toi32_i32$5 + 1 | 0
+  i64toi32_i32$2 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
+  i64toi32_i32$0 = i64toi32_i32$0 + $1$hi | 0;
+  if (i64toi32_i32$2 >>> 0 < i64toi32_i32$3 >>> 0) {
+   i64toi32_i32$0 = i64toi32_i32$0 + 1 | 0
   }
-  $5$hi = i64toi32_i32$5;
-  i64toi32_i32$5 = r$hi;
-  i64toi32_i32$5 = $5$hi;
-  i64toi32_i32$3 = r;
-  return (i64toi32_i32$4 | 0) == (i64toi32_i32$3 | 0) & (i64toi32_i32$5 | 0) == (r$hi | 0) | 0 | 0;
+  $5$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = r$hi;
+  i64toi32_i32$0 = $5$hi;
+  i64toi32_i32$1 = i64toi32_i32$2;
+  i64toi32_i32$3 = r$hi;
+  i64toi32_i32$2 = r;
+  return (i64toi32_i32$1 | 0) == (i64toi32_i32$2 | 0) & (i64toi32_i32$0 | 0) == (i64toi32_i32$3 | 0) | 0 | 0;
  }
  
  function $2($0, $0$hi, $1_1, $1$hi, r, r$hi) {
@@ -48,21 +55,24 @@ function asmFunc(global, env, buffer) {
   $1$hi = $1$hi | 0;
   r = r | 0;
   r$hi = r$hi | 0;
-  var i64toi32_i32$5 = 0, i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, $5$hi = 0;
+  var i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$4 = 0, $5$hi = 0;
   i64toi32_i32$0 = $0$hi;
   i64toi32_i32$0 = $1$hi;
   i64toi32_i32$0 = $0$hi;
   i64toi32_i32$2 = $0;
+  i64toi32_i32$1 = $1$hi;
   i64toi32_i32$3 = $1_1;
-  i64toi32_i32$5 = (i64toi32_i32$2 >>> 0 < i64toi32_i32$3 >>> 0) + $1$hi | 0;
-  i64toi32_i32$5 = i64toi32_i32$0 - i64toi32_i32$5 | 0;
-  $5$hi = i64toi32_i32$5;
-  i64toi32_i32$5 = r$hi;
-  i64toi32_i32$5 = $5$hi;
-  i64toi32_i32$0 = i64toi32_i32$2 - i64toi32_i32$3 | 0;
-  i64toi32_i32$2 = r$hi;
-  i64toi32_i32$3 = r;
-  return (i64toi32_i32$0 | 0) == (i64toi32_i32$3 | 0) & (i64toi32_i32$5 | 0) == (i64toi32_i32$2 | 0) | 0 | 0;
+  i64toi32_i32$4 = i64toi32_i32$2 >>> 0 < i64toi32_i32$3 >>> 0;
+  i64toi32_i32$2 = i64toi32_i32$2 - i64toi32_i32$3 | 0;
+  i64toi32_i32$1 = i64toi32_i32$4 + i64toi32_i32$1 | 0;
+  i64toi32_i32$1 = i64toi32_i32$0 - i64toi32_i32$1 | 0;
+  $5$hi = i64toi32_i32$1;
+  i64toi32_i32$1 = r$hi;
+  i64toi32_i32$1 = $5$hi;
+  i64toi32_i32$3 = i64toi32_i32$2;
+  i64toi32_i32$0 = r$hi;
+  i64toi32_i32$4 = r;
+  return (i64toi32_i32$2 | 0) == (i64toi32_i32$4 | 0) & (i64toi32_i32$1 | 0) == (i64toi32_i32$0 | 0) | 0 | 0;
  }
  
  function legalstub$1($0, $1_1, $2_1, $3, $4, $5) {
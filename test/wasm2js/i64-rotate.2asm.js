@@ -236,7 +236,7 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$5 = 0, i64toi32_i32$4 = 0, var$2$hi = 0, var$2 = 0, $19 = 0, $20 = 0, $21 = 0, $22 = 0, $6$hi = 0, $8$hi = 0, $10 = 0, $10$hi = 0, $15$hi = 0, $17$hi = 0, $19$hi = 0;
+  var i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, i64toi32_i32$4 = 0, var$2$hi = 0, var$2 = 0, $18 = 0, $19 = 0, $20 = 0, $21 = 0, $6$hi = 0, $8$hi = 0, $10 = 0, $10$hi = 0, $15$hi = 0, $17$hi = 0, $19$hi = 0;
   i64toi32_i32$0 = var$1$hi;
   i64toi32_i32$2 = var$1;
   i64toi32_i32$1 = 0;
@@ -251,15 +251,15 @@ function asmFunc(global, env, buffer) {
   i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
   if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
    i64toi32_i32$2 = 0;
-   $19 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
+   $18 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
   } else {
    i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-   $19 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
+   $18 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
   }
   $6$hi = i64toi32_i32$2;
   i64toi32_i32$2 = var$0$hi;
   i64toi32_i32$2 = $6$hi;
-  i64toi32_i32$1 = $19;
+  i64toi32_i32$1 = $18;
   i64toi32_i32$0 = var$0$hi;
   i64toi32_i32$3 = var$0;
   i64toi32_i32$0 = i64toi32_i32$2 & i64toi32_i32$0 | 0;
@@ -272,69 +272,70 @@ function asmFunc(global, env, buffer) {
   i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
   if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
    i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-   $20 = 0;
+   $19 = 0;
   } else {
    i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$4 | 0) | 0;
-   $20 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
+   $19 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
   }
-  $10 = $20;
+  $10 = $19;
   $10$hi = i64toi32_i32$1;
   i64toi32_i32$1 = var$1$hi;
   i64toi32_i32$1 = 0;
   i64toi32_i32$0 = 0;
   i64toi32_i32$2 = var$1$hi;
   i64toi32_i32$3 = var$1;
-  i64toi32_i32$4 = i64toi32_i32$0 - i64toi32_i32$3 | 0;
-  i64toi32_i32$5 = (i64toi32_i32$0 >>> 0 < i64toi32_i32$3 >>> 0) + i64toi32_i32$2 | 0;
-  i64toi32_i32$5 = i64toi32_i32$1 - i64toi32_i32$5 | 0;
-  i64toi32_i32$1 = i64toi32_i32$4;
-  i64toi32_i32$0 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$0 = i64toi32_i32$5 & i64toi32_i32$0 | 0;
-  var$1 = i64toi32_i32$1 & i64toi32_i32$3 | 0;
-  var$1$hi = i64toi32_i32$0;
-  i64toi32_i32$0 = -1;
-  i64toi32_i32$5 = -1;
-  i64toi32_i32$1 = var$1$hi;
-  i64toi32_i32$3 = var$1;
-  i64toi32_i32$2 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$5 << i64toi32_i32$2 | 0;
-   $21 = 0;
+  i64toi32_i32$4 = i64toi32_i32$0 >>> 0 < i64toi32_i32$3 >>> 0;
+  i64toi32_i32$0 = i64toi32_i32$0 - i64toi32_i32$3 | 0;
+  i64toi32_i32$2 = i64toi32_i32$4 + i64toi32_i32$2 | 0;
+  i64toi32_i32$2 = i64toi32_i32$1 - i64toi32_i32$2 | 0;
+  i64toi32_i32$3 = i64toi32_i32$0;
+  i64toi32_i32$1 = 0;
+  i64toi32_i32$4 = 63;
+  i64toi32_i32$1 = i64toi32_i32$2 & i64toi32_i32$1 | 0;
+  var$1 = i64toi32_i32$0 & i64toi32_i32$4 | 0;
+  var$1$hi = i64toi32_i32$1;
+  i64toi32_i32$1 = -1;
+  i64toi32_i32$2 = -1;
+  i64toi32_i32$3 = var$1$hi;
+  i64toi32_i32$4 = var$1;
+  i64toi32_i32$0 = i64toi32_i32$4 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$4 & 63 | 0) >>> 0) {
+   i64toi32_i32$3 = i64toi32_i32$2 << i64toi32_i32$0 | 0;
+   $20 = 0;
   } else {
-   i64toi32_i32$1 = ((1 << i64toi32_i32$2 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$2 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$2 | 0) | 0;
-   $21 = i64toi32_i32$5 << i64toi32_i32$2 | 0;
+   i64toi32_i32$3 = ((1 << i64toi32_i32$0 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$0 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$0 | 0) | 0;
+   $20 = i64toi32_i32$2 << i64toi32_i32$0 | 0;
   }
-  $15$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$0$hi;
-  i64toi32_i32$1 = $15$hi;
-  i64toi32_i32$0 = $21;
-  i64toi32_i32$5 = var$0$hi;
-  i64toi32_i32$3 = var$0;
-  i64toi32_i32$5 = i64toi32_i32$1 & i64toi32_i32$5 | 0;
-  $17$hi = i64toi32_i32$5;
-  i64toi32_i32$5 = var$1$hi;
-  i64toi32_i32$5 = $17$hi;
-  i64toi32_i32$1 = i64toi32_i32$0 & i64toi32_i32$3 | 0;
-  i64toi32_i32$0 = var$1$hi;
-  i64toi32_i32$3 = var$1;
-  i64toi32_i32$2 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$0 = 0;
-   $22 = i64toi32_i32$5 >>> i64toi32_i32$2 | 0;
+  $15$hi = i64toi32_i32$3;
+  i64toi32_i32$3 = var$0$hi;
+  i64toi32_i32$3 = $15$hi;
+  i64toi32_i32$1 = $20;
+  i64toi32_i32$2 = var$0$hi;
+  i64toi32_i32$4 = var$0;
+  i64toi32_i32$2 = i64toi32_i32$3 & i64toi32_i32$2 | 0;
+  $17$hi = i64toi32_i32$2;
+  i64toi32_i32$2 = var$1$hi;
+  i64toi32_i32$2 = $17$hi;
+  i64toi32_i32$3 = i64toi32_i32$1 & i64toi32_i32$4 | 0;
+  i64toi32_i32$1 = var$1$hi;
+  i64toi32_i32$4 = var$1;
+  i64toi32_i32$0 = i64toi32_i32$4 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$4 & 63 | 0) >>> 0) {
+   i64toi32_i32$1 = 0;
+   $21 = i64toi32_i32$2 >>> i64toi32_i32$0 | 0;
   } else {
-   i64toi32_i32$0 = i64toi32_i32$5 >>> i64toi32_i32$2 | 0;
-   $22 = (((1 << i64toi32_i32$2 | 0) - 1 | 0) & i64toi32_i32$5 | 0) << (32 - i64toi32_i32$2 | 0) | 0 | (i64toi32_i32$1 >>> i64toi32_i32$2 | 0) | 0;
+   i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$0 | 0;
+   $21 = (((1 << i64toi32_i32$0 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$0 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$0 | 0) | 0;
   }
-  $19$hi = i64toi32_i32$0;
-  i64toi32_i32$0 = $10$hi;
-  i64toi32_i32$5 = $10;
-  i64toi32_i32$1 = $19$hi;
-  i64toi32_i32$3 = $22;
-  i64toi32_i32$1 = i64toi32_i32$0 | i64toi32_i32$1 | 0;
-  i64toi32_i32$5 = i64toi32_i32$5 | i64toi32_i32$3 | 0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
-  return i64toi32_i32$5 | 0;
+  $19$hi = i64toi32_i32$1;
+  i64toi32_i32$1 = $10$hi;
+  i64toi32_i32$2 = $10;
+  i64toi32_i32$3 = $19$hi;
+  i64toi32_i32$4 = $21;
+  i64toi32_i32$3 = i64toi32_i32$1 | i64toi32_i32$3 | 0;
+  i64toi32_i32$2 = i64toi32_i32$2 | i64toi32_i32$4 | 0;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$3;
+  return i64toi32_i32$2 | 0;
  }
  
  function __wasm_rotr_i64(var$0, var$0$hi, var$1, var$1$hi) {
@@ -342,7 +343,7 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$5 = 0, i64toi32_i32$4 = 0, var$2$hi = 0, var$2 = 0, $19 = 0, $20 = 0, $21 = 0, $22 = 0, $6$hi = 0, $8$hi = 0, $10 = 0, $10$hi = 0, $15$hi = 0, $17$hi = 0, $19$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$4 = 0, var$2$hi = 0, var$2 = 0, $18 = 0, $19 = 0, $20 = 0, $21 = 0, $6$hi = 0, $8$hi = 0, $10 = 0, $10$hi = 0, $15$hi = 0, $17$hi = 0, $19$hi = 0;
   i64toi32_i32$0 = var$1$hi;
   i64toi32_i32$2 = var$1;
   i64toi32_i32$1 = 0;
@@ -357,15 +358,15 @@ function asmFunc(global, env, buffer) {
   i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
   if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
    i64toi32_i32$2 = i64toi32_i32$0 << i64toi32_i32$4 | 0;
-   $19 = 0;
+   $18 = 0;
   } else {
    i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$0 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-   $19 = i64toi32_i32$0 << i64toi32_i32$4 | 0;
+   $18 = i64toi32_i32$0 << i64toi32_i32$4 | 0;
   }
   $6$hi = i64toi32_i32$2;
   i64toi32_i32$2 = var$0$hi;
   i64toi32_i32$2 = $6$hi;
-  i64toi32_i32$1 = $19;
+  i64toi32_i32$1 = $18;
   i64toi32_i32$0 = var$0$hi;
   i64toi32_i32$3 = var$0;
   i64toi32_i32$0 = i64toi32_i32$2 & i64toi32_i32$0 | 0;
@@ -378,69 +379,70 @@ function asmFunc(global, env, buffer) {
   i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
   if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
    i64toi32_i32$1 = 0;
-   $20 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
+   $19 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
   } else {
    i64toi32_i32$1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-   $20 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+   $19 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
   }
-  $10 = $20;
+  $10 = $19;
   $10$hi = i64toi32_i32$1;
   i64toi32_i32$1 = var$1$hi;
   i64toi32_i32$1 = 0;
   i64toi32_i32$0 = 0;
   i64toi32_i32$2 = var$1$hi;
   i64toi32_i32$3 = var$1;
-  i64toi32_i32$4 = i64toi32_i32$0 - i64toi32_i32$3 | 0;
-  i64toi32_i32$5 = (i64toi32_i32$0 >>> 0 < i64toi32_i32$3 >>> 0) + i64toi32_i32$2 | 0;
-  i64toi32_i32$5 = i64toi32_i32$1 - i64toi32_i32$5 | 0;
-  i64toi32_i32$1 = i64toi32_i32$4;
-  i64toi32_i32$0 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$0 = i64toi32_i32$5 & i64toi32_i32$0 | 0;
-  var$1 = i64toi32_i32$1 & i64toi32_i32$3 | 0;
-  var$1$hi = i64toi32_i32$0;
-  i64toi32_i32$0 = -1;
-  i64toi32_i32$5 = -1;
-  i64toi32_i32$1 = var$1$hi;
-  i64toi32_i32$3 = var$1;
-  i64toi32_i32$2 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = 0;
-   $21 = i64toi32_i32$0 >>> i64toi32_i32$2 | 0;
+  i64toi32_i32$4 = i64toi32_i32$0 >>> 0 < i64toi32_i32$3 >>> 0;
+  i64toi32_i32$0 = i64toi32_i32$0 - i64toi32_i32$3 | 0;
+  i64toi32_i32$2 = i64toi32_i32$4 + i64toi32_i32$2 | 0;
+  i64toi32_i32$2 = i64toi32_i32$1 - i64toi32_i32$2 | 0;
+  i64toi32_i32$3 = i64toi32_i32$0;
+  i64toi32_i32$1 = 0;
+  i64toi32_i32$4 = 63;
+  i64toi32_i32$1 = i64toi32_i32$2 & i64toi32_i32$1 | 0;
+  var$1 = i64toi32_i32$0 & i64toi32_i32$4 | 0;
+  var$1$hi = i64toi32_i32$1;
+  i64toi32_i32$1 = -1;
+  i64toi32_i32$2 = -1;
+  i64toi32_i32$3 = var$1$hi;
+  i64toi32_i32$4 = var$1;
+  i64toi32_i32$0 = i64toi32_i32$4 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$4 & 63 | 0) >>> 0) {
+   i64toi32_i32$3 = 0;
+   $20 = i64toi32_i32$1 >>> i64toi32_i32$0 | 0;
   } else {
-   i64toi32_i32$1 = i64toi32_i32$0 >>> i64toi32_i32$2 | 0;
-   $21 = (((1 << i64toi32_i32$2 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$2 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$2 | 0) | 0;
+   i64toi32_i32$3 = i64toi32_i32$1 >>> i64toi32_i32$0 | 0;
+   $20 = (((1 << i64toi32_i32$0 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$0 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$0 | 0) | 0;
   }
-  $15$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$0$hi;
-  i64toi32_i32$1 = $15$hi;
-  i64toi32_i32$0 = $21;
-  i64toi32_i32$5 = var$0$hi;
-  i64toi32_i32$3 = var$0;
-  i64toi32_i32$5 = i64toi32_i32$1 & i64toi32_i32$5 | 0;
-  $17$hi = i64toi32_i32$5;
-  i64toi32_i32$5 = var$1$hi;
-  i64toi32_i32$5 = $17$hi;
-  i64toi32_i32$1 = i64toi32_i32$0 & i64toi32_i32$3 | 0;
-  i64toi32_i32$0 = var$1$hi;
-  i64toi32_i32$3 = var$1;
-  i64toi32_i32$2 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$0 = i64toi32_i32$1 << i64toi32_i32$2 | 0;
-   $22 = 0;
+  $15$hi = i64toi32_i32$3;
+  i64toi32_i32$3 = var$0$hi;
+  i64toi32_i32$3 = $15$hi;
+  i64toi32_i32$1 = $20;
+  i64toi32_i32$2 = var$0$hi;
+  i64toi32_i32$4 = var$0;
+  i64toi32_i32$2 = i64toi32_i32$3 & i64toi32_i32$2 | 0;
+  $17$hi = i64toi32_i32$2;
+  i64toi32_i32$2 = var$1$hi;
+  i64toi32_i32$2 = $17$hi;
+  i64toi32_i32$3 = i64toi32_i32$1 & i64toi32_i32$4 | 0;
+  i64toi32_i32$1 = var$1$hi;
+  i64toi32_i32$4 = var$1;
+  i64toi32_i32$0 = i64toi32_i32$4 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$4 & 63 | 0) >>> 0) {
+   i64toi32_i32$1 = i64toi32_i32$3 << i64toi32_i32$0 | 0;
+   $21 = 0;
   } else {
-   i64toi32_i32$0 = ((1 << i64toi32_i32$2 | 0) - 1 | 0) & (i64toi32_i32$1 >>> (32 - i64toi32_i32$2 | 0) | 0) | 0 | (i64toi32_i32$5 << i64toi32_i32$2 | 0) | 0;
-   $22 = i64toi32_i32$1 << i64toi32_i32$2 | 0;
+   i64toi32_i32$1 = ((1 << i64toi32_i32$0 | 0) - 1 | 0) & (i64toi32_i32$3 >>> (32 - i64toi32_i32$0 | 0) | 0) | 0 | (i64toi32_i32$2 << i64toi32_i32$0 | 0) | 0;
+   $21 = i64toi32_i32$3 << i64toi32_i32$0 | 0;
   }
-  $19$hi = i64toi32_i32$0;
-  i64toi32_i32$0 = $10$hi;
-  i64toi32_i32$5 = $10;
-  i64toi32_i32$1 = $19$hi;
-  i64toi32_i32$3 = $22;
-  i64toi32_i32$1 = i64toi32_i32$0 | i64toi32_i32$1 | 0;
-  i64toi32_i32$5 = i64toi32_i32$5 | i64toi32_i32$3 | 0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
-  return i64toi32_i32$5 | 0;
+  $19$hi = i64toi32_i32$1;
+  i64toi32_i32$1 = $10$hi;
+  i64toi32_i32$2 = $10;
+  i64toi32_i32$3 = $19$hi;
+  i64toi32_i32$4 = $21;
+  i64toi32_i32$3 = i64toi32_i32$1 | i64toi32_i32$3 | 0;
+  i64toi32_i32$2 = i64toi32_i32$2 | i64toi32_i32$4 | 0;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$3;
+  return i64toi32_i32$2 | 0;
  }
  
  var FUNCTION_TABLE = [];
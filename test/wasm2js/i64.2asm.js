@@ -46,15 +46,20 @@ function asmFunc(global, env, buffer) {
   x$hi = x$hi | 0;
   y = y | 0;
   y$hi = y$hi | 0;
-  var i64toi32_i32$5 = 0, i64toi32_i32$3 = 0, i64toi32_i32$4 = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0;
+  i64toi32_i32$0 = x$hi;
+  i64toi32_i32$0 = y$hi;
+  i64toi32_i32$0 = x$hi;
+  i64toi32_i32$2 = x;
   i64toi32_i32$3 = y;
-  i64toi32_i32$4 = x + i64toi32_i32$3 | 0;
-  i64toi32_i32$5 = x$hi + y$hi | 0;
-  if (i64toi32_i32$4 >>> 0 < i64toi32_i32$3 >>> 0) {
-   i64toi32_i32$5 = i64toi32_i32$5 + 1 | 0
+  i64toi32_i32$2 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
+  i64toi32_i32$0 = i64toi32_i32$0 + y$hi | 0;
+  if (i64toi32_i32$2 >>> 0 < i64toi32_i32$3 >>> 0) {
+   i64toi32_i32$0 = i64toi32_i32$0 + 1 | 0
   }
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$5;
-  return i64toi32_i32$4 | 0;
+  i64toi32_i32$3 = i64toi32_i32$2;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
+  return i64toi32_i32$2 | 0;
  }
  
  function $1(x, x$hi, y, y$hi) {
@@ -62,17 +67,20 @@ function asmFunc(global, env, buffer) {
   x$hi = x$hi | 0;
   y = y | 0;
   y$hi = y$hi | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, i64toi32_i32$3 = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$4 = 0;
   i64toi32_i32$0 = x$hi;
   i64toi32_i32$0 = y$hi;
   i64toi32_i32$0 = x$hi;
   i64toi32_i32$2 = x;
+  i64toi32_i32$1 = y$hi;
   i64toi32_i32$3 = y;
-  i64toi32_i32$5 = (i64toi32_i32$2 >>> 0 < i64toi32_i32$3 >>> 0) + y$hi | 0;
-  i64toi32_i32$5 = i64toi32_i32$0 - i64toi32_i32$5 | 0;
+  i64toi32_i32$4 = i64toi32_i32$2 >>> 0 < i64toi32_i32$3 >>> 0;
   i64toi32_i32$2 = i64toi32_i32$2 - i64toi32_i32$3 | 0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$5;
-  return i64toi32_i32$2 | 0;
+  i64toi32_i32$1 = i64toi32_i32$4 + i64toi32_i32$1 | 0;
+  i64toi32_i32$1 = i64toi32_i32$0 - i64toi32_i32$1 | 0;
+  i64toi32_i32$0 = i64toi32_i32$2;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
+  return i64toi32_i32$0 | 0;
  }
  
  function $2(x, x$hi, y, y$hi) {
@@ -2519,7 +2527,7 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$2$hi = 0, i64toi32_i32$6 = 0, $21_1 = 0, $22_1 = 0, $23_1 = 0, $7$hi = 0, $9_1 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17_1 = 0, $17$hi = 0, $23$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$4 = 0, var$2 = 0, var$2$hi = 0, $19_1 = 0, $20_1 = 0, $21_1 = 0, $7$hi = 0, $9_1 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17_1 = 0, $17$hi = 0, $23$hi = 0;
   i64toi32_i32$0 = var$0$hi;
   i64toi32_i32$2 = var$0;
   i64toi32_i32$1 = 0;
@@ -2527,12 +2535,12 @@ function asmFunc(global, env, buffer) {
   i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
   if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
    i64toi32_i32$1 = i64toi32_i32$0 >> 31 | 0;
-   $21_1 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
+   $19_1 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
   } else {
    i64toi32_i32$1 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
-   $21_1 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+   $19_1 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
   }
-  var$2 = $21_1;
+  var$2 = $19_1;
   var$2$hi = i64toi32_i32$1;
   i64toi32_i32$1 = var$0$hi;
   i64toi32_i32$1 = var$2$hi;
@@ -2546,86 +2554,86 @@ function asmFunc(global, env, buffer) {
   i64toi32_i32$1 = i64toi32_i32$0 ^ i64toi32_i32$3 | 0;
   i64toi32_i32$0 = var$2$hi;
   i64toi32_i32$3 = var$2;
-  i64toi32_i32$4 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$5 = i64toi32_i32$6 + i64toi32_i32$0 | 0;
-  i64toi32_i32$5 = i64toi32_i32$2 - i64toi32_i32$5 | 0;
-  $9_1 = i64toi32_i32$4;
-  $9$hi = i64toi32_i32$5;
-  i64toi32_i32$5 = var$1$hi;
-  i64toi32_i32$2 = var$1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$0 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$5 >> 31 | 0;
-   $22_1 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
-  } else {
-   i64toi32_i32$1 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
-   $22_1 = (((1 << i64toi32_i32$0 | 0) - 1 | 0) & i64toi32_i32$5 | 0) << (32 - i64toi32_i32$0 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$0 | 0) | 0;
-  }
-  var$2 = $22_1;
-  var$2$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$1$hi;
-  i64toi32_i32$1 = var$2$hi;
-  i64toi32_i32$5 = var$2;
-  i64toi32_i32$2 = var$1$hi;
+  i64toi32_i32$4 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
+  i64toi32_i32$1 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
+  i64toi32_i32$0 = i64toi32_i32$4 + i64toi32_i32$0 | 0;
+  i64toi32_i32$0 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
+  $9_1 = i64toi32_i32$1;
+  $9$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = var$1$hi;
   i64toi32_i32$3 = var$1;
-  i64toi32_i32$2 = i64toi32_i32$1 ^ i64toi32_i32$2 | 0;
-  $14$hi = i64toi32_i32$2;
-  i64toi32_i32$2 = i64toi32_i32$1;
-  i64toi32_i32$2 = $14$hi;
-  i64toi32_i32$1 = i64toi32_i32$5 ^ i64toi32_i32$3 | 0;
-  i64toi32_i32$5 = var$2$hi;
-  i64toi32_i32$3 = var$2;
-  i64toi32_i32$0 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$4 = i64toi32_i32$6 + i64toi32_i32$5 | 0;
-  i64toi32_i32$4 = i64toi32_i32$2 - i64toi32_i32$4 | 0;
-  $16$hi = i64toi32_i32$4;
-  i64toi32_i32$4 = $9$hi;
-  i64toi32_i32$1 = $16$hi;
-  i64toi32_i32$1 = __wasm_i64_udiv($9_1 | 0, i64toi32_i32$4 | 0, i64toi32_i32$0 | 0, i64toi32_i32$1 | 0) | 0;
-  i64toi32_i32$4 = i64toi32_i32$HIGH_BITS;
-  $17_1 = i64toi32_i32$1;
-  $17$hi = i64toi32_i32$4;
-  i64toi32_i32$4 = var$1$hi;
-  i64toi32_i32$4 = var$0$hi;
-  i64toi32_i32$4 = var$1$hi;
-  i64toi32_i32$2 = var$1;
-  i64toi32_i32$1 = var$0$hi;
-  i64toi32_i32$3 = var$0;
-  i64toi32_i32$1 = i64toi32_i32$4 ^ i64toi32_i32$1 | 0;
-  i64toi32_i32$4 = i64toi32_i32$2 ^ i64toi32_i32$3 | 0;
   i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$5 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = i64toi32_i32$1 >> 31 | 0;
-   $23_1 = i64toi32_i32$1 >> i64toi32_i32$5 | 0;
+  i64toi32_i32$4 = 63;
+  i64toi32_i32$1 = i64toi32_i32$4 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$4 & 63 | 0) >>> 0) {
+   i64toi32_i32$2 = i64toi32_i32$0 >> 31 | 0;
+   $20_1 = i64toi32_i32$0 >> i64toi32_i32$1 | 0;
   } else {
-   i64toi32_i32$2 = i64toi32_i32$1 >> i64toi32_i32$5 | 0;
-   $23_1 = (((1 << i64toi32_i32$5 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$5 | 0) | 0 | (i64toi32_i32$4 >>> i64toi32_i32$5 | 0) | 0;
+   i64toi32_i32$2 = i64toi32_i32$0 >> i64toi32_i32$1 | 0;
+   $20_1 = (((1 << i64toi32_i32$1 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$1 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$1 | 0) | 0;
   }
-  var$0 = $23_1;
-  var$0$hi = i64toi32_i32$2;
-  i64toi32_i32$2 = $17$hi;
-  i64toi32_i32$1 = $17_1;
-  i64toi32_i32$4 = var$0$hi;
-  i64toi32_i32$3 = var$0;
-  i64toi32_i32$4 = i64toi32_i32$2 ^ i64toi32_i32$4 | 0;
-  $23$hi = i64toi32_i32$4;
-  i64toi32_i32$4 = var$0$hi;
-  i64toi32_i32$4 = $23$hi;
-  i64toi32_i32$2 = i64toi32_i32$1 ^ i64toi32_i32$3 | 0;
-  i64toi32_i32$1 = var$0$hi;
-  i64toi32_i32$5 = i64toi32_i32$2 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$2 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$0 = i64toi32_i32$6 + i64toi32_i32$1 | 0;
-  i64toi32_i32$0 = i64toi32_i32$4 - i64toi32_i32$0 | 0;
-  i64toi32_i32$2 = i64toi32_i32$5;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
-  return i64toi32_i32$2 | 0;
+  var$2 = $20_1;
+  var$2$hi = i64toi32_i32$2;
+  i64toi32_i32$2 = var$1$hi;
+  i64toi32_i32$2 = var$2$hi;
+  i64toi32_i32$0 = var$2;
+  i64toi32_i32$3 = var$1$hi;
+  i64toi32_i32$4 = var$1;
+  i64toi32_i32$3 = i64toi32_i32$2 ^ i64toi32_i32$3 | 0;
+  $14$hi = i64toi32_i32$3;
+  i64toi32_i32$3 = i64toi32_i32$2;
+  i64toi32_i32$3 = $14$hi;
+  i64toi32_i32$2 = i64toi32_i32$0 ^ i64toi32_i32$4 | 0;
+  i64toi32_i32$0 = var$2$hi;
+  i64toi32_i32$4 = var$2;
+  i64toi32_i32$1 = i64toi32_i32$2 >>> 0 < i64toi32_i32$4 >>> 0;
+  i64toi32_i32$2 = i64toi32_i32$2 - i64toi32_i32$4 | 0;
+  i64toi32_i32$0 = i64toi32_i32$1 + i64toi32_i32$0 | 0;
+  i64toi32_i32$0 = i64toi32_i32$3 - i64toi32_i32$0 | 0;
+  $16$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = $9$hi;
+  i64toi32_i32$3 = $16$hi;
+  i64toi32_i32$3 = __wasm_i64_udiv($9_1 | 0, i64toi32_i32$0 | 0, i64toi32_i32$2 | 0, i64toi32_i32$3 | 0) | 0;
+  i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
+  $17_1 = i64toi32_i32$3;
+  $17$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = var$1$hi;
+  i64toi32_i32$0 = var$0$hi;
+  i64toi32_i32$0 = var$1$hi;
+  i64toi32_i32$4 = var$1;
+  i64toi32_i32$3 = var$0$hi;
+  i64toi32_i32$1 = var$0;
+  i64toi32_i32$3 = i64toi32_i32$0 ^ i64toi32_i32$3 | 0;
+  i64toi32_i32$0 = i64toi32_i32$4 ^ i64toi32_i32$1 | 0;
+  i64toi32_i32$4 = 0;
+  i64toi32_i32$1 = 63;
+  i64toi32_i32$2 = i64toi32_i32$1 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$1 & 63 | 0) >>> 0) {
+   i64toi32_i32$4 = i64toi32_i32$3 >> 31 | 0;
+   $21_1 = i64toi32_i32$3 >> i64toi32_i32$2 | 0;
+  } else {
+   i64toi32_i32$4 = i64toi32_i32$3 >> i64toi32_i32$2 | 0;
+   $21_1 = (((1 << i64toi32_i32$2 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$2 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$2 | 0) | 0;
+  }
+  var$0 = $21_1;
+  var$0$hi = i64toi32_i32$4;
+  i64toi32_i32$4 = $17$hi;
+  i64toi32_i32$3 = $17_1;
+  i64toi32_i32$0 = var$0$hi;
+  i64toi32_i32$1 = var$0;
+  i64toi32_i32$0 = i64toi32_i32$4 ^ i64toi32_i32$0 | 0;
+  $23$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = var$0$hi;
+  i64toi32_i32$0 = $23$hi;
+  i64toi32_i32$4 = i64toi32_i32$3 ^ i64toi32_i32$1 | 0;
+  i64toi32_i32$3 = var$0$hi;
+  i64toi32_i32$2 = i64toi32_i32$4 >>> 0 < i64toi32_i32$1 >>> 0;
+  i64toi32_i32$4 = i64toi32_i32$4 - i64toi32_i32$1 | 0;
+  i64toi32_i32$3 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
+  i64toi32_i32$3 = i64toi32_i32$0 - i64toi32_i32$3 | 0;
+  i64toi32_i32$0 = i64toi32_i32$4;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$3;
+  return i64toi32_i32$0 | 0;
  }
  
  function _ZN17compiler_builtins3int4sdiv3Mod4mod_17h2cbb7bbf36e41d68E(var$0, var$0$hi, var$1, var$1$hi) {
@@ -2633,7 +2641,7 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$1 = 0, i64toi32_i32$4 = 0, i64toi32_i32$2 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, i64toi32_i32$5 = 0, var$2$hi = 0, i64toi32_i32$6 = 0, var$2 = 0, $20_1 = 0, $21_1 = 0, $7$hi = 0, $9_1 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17$hi = 0, $19$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, var$2$hi = 0, var$2 = 0, $18_1 = 0, $19_1 = 0, $7$hi = 0, $9_1 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17$hi = 0, $19$hi = 0;
   i64toi32_i32$0 = var$0$hi;
   i64toi32_i32$2 = var$0;
   i64toi32_i32$1 = 0;
@@ -2641,12 +2649,12 @@ function asmFunc(global, env, buffer) {
   i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
   if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
    i64toi32_i32$1 = i64toi32_i32$0 >> 31 | 0;
-   $20_1 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
+   $18_1 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
   } else {
    i64toi32_i32$1 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
-   $20_1 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+   $18_1 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
   }
-  var$2 = $20_1;
+  var$2 = $18_1;
   var$2$hi = i64toi32_i32$1;
   i64toi32_i32$1 = var$0$hi;
   i64toi32_i32$1 = var$2$hi;
@@ -2660,66 +2668,66 @@ function asmFunc(global, env, buffer) {
   i64toi32_i32$1 = i64toi32_i32$0 ^ i64toi32_i32$3 | 0;
   i64toi32_i32$0 = var$2$hi;
   i64toi32_i32$3 = var$2;
-  i64toi32_i32$4 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$5 = i64toi32_i32$6 + i64toi32_i32$0 | 0;
-  i64toi32_i32$5 = i64toi32_i32$2 - i64toi32_i32$5 | 0;
-  $9_1 = i64toi32_i32$4;
-  $9$hi = i64toi32_i32$5;
-  i64toi32_i32$5 = var$1$hi;
-  i64toi32_i32$2 = var$1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$0 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$5 >> 31 | 0;
-   $21_1 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
+  i64toi32_i32$4 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
+  i64toi32_i32$1 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
+  i64toi32_i32$0 = i64toi32_i32$4 + i64toi32_i32$0 | 0;
+  i64toi32_i32$0 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
+  $9_1 = i64toi32_i32$1;
+  $9$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = var$1$hi;
+  i64toi32_i32$3 = var$1;
+  i64toi32_i32$2 = 0;
+  i64toi32_i32$4 = 63;
+  i64toi32_i32$1 = i64toi32_i32$4 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$4 & 63 | 0) >>> 0) {
+   i64toi32_i32$2 = i64toi32_i32$0 >> 31 | 0;
+   $19_1 = i64toi32_i32$0 >> i64toi32_i32$1 | 0;
   } else {
-   i64toi32_i32$1 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
-   $21_1 = (((1 << i64toi32_i32$0 | 0) - 1 | 0) & i64toi32_i32$5 | 0) << (32 - i64toi32_i32$0 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$0 | 0) | 0;
+   i64toi32_i32$2 = i64toi32_i32$0 >> i64toi32_i32$1 | 0;
+   $19_1 = (((1 << i64toi32_i32$1 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$1 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$1 | 0) | 0;
   }
-  var$0 = $21_1;
-  var$0$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$1$hi;
-  i64toi32_i32$1 = var$0$hi;
-  i64toi32_i32$5 = var$0;
+  var$0 = $19_1;
+  var$0$hi = i64toi32_i32$2;
   i64toi32_i32$2 = var$1$hi;
-  i64toi32_i32$3 = var$1;
-  i64toi32_i32$2 = i64toi32_i32$1 ^ i64toi32_i32$2 | 0;
-  $14$hi = i64toi32_i32$2;
-  i64toi32_i32$2 = i64toi32_i32$1;
-  i64toi32_i32$2 = $14$hi;
-  i64toi32_i32$1 = i64toi32_i32$5 ^ i64toi32_i32$3 | 0;
-  i64toi32_i32$5 = var$0$hi;
-  i64toi32_i32$3 = var$0;
-  i64toi32_i32$0 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$4 = i64toi32_i32$6 + i64toi32_i32$5 | 0;
-  i64toi32_i32$4 = i64toi32_i32$2 - i64toi32_i32$4 | 0;
-  $16$hi = i64toi32_i32$4;
-  i64toi32_i32$4 = $9$hi;
-  i64toi32_i32$1 = $16$hi;
-  i64toi32_i32$1 = __wasm_i64_urem($9_1 | 0, i64toi32_i32$4 | 0, i64toi32_i32$0 | 0, i64toi32_i32$1 | 0) | 0;
-  i64toi32_i32$4 = i64toi32_i32$HIGH_BITS;
-  $17$hi = i64toi32_i32$4;
+  i64toi32_i32$2 = var$0$hi;
+  i64toi32_i32$0 = var$0;
+  i64toi32_i32$3 = var$1$hi;
+  i64toi32_i32$4 = var$1;
+  i64toi32_i32$3 = i64toi32_i32$2 ^ i64toi32_i32$3 | 0;
+  $14$hi = i64toi32_i32$3;
+  i64toi32_i32$3 = i64toi32_i32$2;
+  i64toi32_i32$3 = $14$hi;
+  i64toi32_i32$2 = i64toi32_i32$0 ^ i64toi32_i32$4 | 0;
+  i64toi32_i32$0 = var$0$hi;
+  i64toi32_i32$4 = var$0;
+  i64toi32_i32$1 = i64toi32_i32$2 >>> 0 < i64toi32_i32$4 >>> 0;
+  i64toi32_i32$2 = i64toi32_i32$2 - i64toi32_i32$4 | 0;
+  i64toi32_i32$0 = i64toi32_i32$1 + i64toi32_i32$0 | 0;
+  i64toi32_i32$0 = i64toi32_i32$3 - i64toi32_i32$0 | 0;
+  $16$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = $9$hi;
+  i64toi32_i32$3 = $16$hi;
+  i64toi32_i32$3 = __wasm_i64_urem($9_1 | 0, i64toi32_i32$0 | 0, i64toi32_i32$2 | 0, i64toi32_i32$3 | 0) | 0;
+  i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
+  $17$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = var$2$hi;
+  i64toi32_i32$0 = $17$hi;
+  i64toi32_i32$4 = i64toi32_i32$3;
+  i64toi32_i32$3 = var$2$hi;
+  i64toi32_i32$1 = var$2;
+  i64toi32_i32$3 = i64toi32_i32$0 ^ i64toi32_i32$3 | 0;
+  $19$hi = i64toi32_i32$3;
+  i64toi32_i32$3 = var$2$hi;
+  i64toi32_i32$3 = $19$hi;
+  i64toi32_i32$0 = i64toi32_i32$4 ^ i64toi32_i32$1 | 0;
   i64toi32_i32$4 = var$2$hi;
-  i64toi32_i32$4 = $17$hi;
-  i64toi32_i32$2 = i64toi32_i32$1;
-  i64toi32_i32$1 = var$2$hi;
-  i64toi32_i32$3 = var$2;
-  i64toi32_i32$1 = i64toi32_i32$4 ^ i64toi32_i32$1 | 0;
-  $19$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$2$hi;
-  i64toi32_i32$1 = $19$hi;
-  i64toi32_i32$4 = i64toi32_i32$2 ^ i64toi32_i32$3 | 0;
-  i64toi32_i32$2 = var$2$hi;
-  i64toi32_i32$5 = i64toi32_i32$4 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$4 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$0 = i64toi32_i32$6 + i64toi32_i32$2 | 0;
-  i64toi32_i32$0 = i64toi32_i32$1 - i64toi32_i32$0 | 0;
-  i64toi32_i32$4 = i64toi32_i32$5;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
-  return i64toi32_i32$4 | 0;
+  i64toi32_i32$2 = i64toi32_i32$0 >>> 0 < i64toi32_i32$1 >>> 0;
+  i64toi32_i32$0 = i64toi32_i32$0 - i64toi32_i32$1 | 0;
+  i64toi32_i32$4 = i64toi32_i32$2 + i64toi32_i32$4 | 0;
+  i64toi32_i32$4 = i64toi32_i32$3 - i64toi32_i32$4 | 0;
+  i64toi32_i32$3 = i64toi32_i32$0;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$4;
+  return i64toi32_i32$0 | 0;
  }
  
  function _ZN17compiler_builtins3int4udiv10divmod_u6417h6026910b5ed08e40E(var$0, var$0$hi, var$1, var$1$hi) {
@@ -2727,7 +2735,7 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$4 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, i64toi32_i32$6 = 0, $37 = 0, $38 = 0, $39 = 0, $40 = 0, $41 = 0, $42 = 0, $43 = 0, $44 = 0, var$8$hi = 0, $45 = 0, $46 = 0, $47 = 0, $48 = 0, var$7$hi = 0, $49 = 0, $63$hi = 0, $65 = 0, $65$hi = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142$hi = 0, $144 = 0, $144$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0;
+  var i64toi32_i32$4 = 0, i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, var$2 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, $35 = 0, $36 = 0, $37 = 0, $38 = 0, $39 = 0, $40 = 0, $41 = 0, $42 = 0, var$8$hi = 0, $43 = 0, $44 = 0, $45 = 0, $46 = 0, var$7$hi = 0, $47 = 0, $63$hi = 0, $65 = 0, $65$hi = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142$hi = 0, $144 = 0, $144$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0;
   label$1 : {
    label$2 : {
     label$3 : {
@@ -2746,12 +2754,12 @@ function asmFunc(global, env, buffer) {
              i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
              if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
               i64toi32_i32$1 = 0;
-              $37 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
+              $35 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
              } else {
               i64toi32_i32$1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-              $37 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+              $35 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
              }
-             var$2 = $37;
+             var$2 = $35;
              if (var$2) {
               block : {
                i64toi32_i32$1 = var$1$hi;
@@ -2766,12 +2774,12 @@ function asmFunc(global, env, buffer) {
                i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
                if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
                 i64toi32_i32$2 = 0;
-                $38 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
+                $36 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
                } else {
                 i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-                $38 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
+                $36 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
                }
-               var$4 = $38;
+               var$4 = $36;
                if (!var$4) {
                 break label$9
                }
@@ -2808,12 +2816,12 @@ function asmFunc(global, env, buffer) {
             i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
             if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
              i64toi32_i32$1 = 0;
-             $39 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
+             $37 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
             } else {
              i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-             $39 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
+             $37 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
             }
-            var$3 = $39;
+            var$3 = $37;
             i64toi32_i32$1 = var$0$hi;
             if (!var$0) {
              break label$7
@@ -2832,10 +2840,10 @@ function asmFunc(global, env, buffer) {
             i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
             if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
              i64toi32_i32$3 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-             $40 = 0;
+             $38 = 0;
             } else {
              i64toi32_i32$3 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-             $40 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
+             $38 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
             }
             $63$hi = i64toi32_i32$3;
             i64toi32_i32$3 = var$0$hi;
@@ -2846,7 +2854,7 @@ function asmFunc(global, env, buffer) {
             $65 = i64toi32_i32$1 & i64toi32_i32$0 | 0;
             $65$hi = i64toi32_i32$2;
             i64toi32_i32$2 = $63$hi;
-            i64toi32_i32$3 = $40;
+            i64toi32_i32$3 = $38;
             i64toi32_i32$1 = $65$hi;
             i64toi32_i32$0 = $65;
             i64toi32_i32$1 = i64toi32_i32$2 | i64toi32_i32$1 | 0;
@@ -2877,12 +2885,12 @@ function asmFunc(global, env, buffer) {
         i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
         if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
          i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-         $41 = 0;
+         $39 = 0;
         } else {
          i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $41 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
+         $39 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
         }
-        legalfunc$wasm2js_scratch_store_i64($41 | 0, i64toi32_i32$1 | 0);
+        legalfunc$wasm2js_scratch_store_i64($39 | 0, i64toi32_i32$1 | 0);
         i64toi32_i32$1 = 0;
         i64toi32_i32$2 = var$4;
         i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
@@ -2910,12 +2918,12 @@ function asmFunc(global, env, buffer) {
       i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
       if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
        i64toi32_i32$1 = 0;
-       $42 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
+       $40 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
       } else {
        i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-       $42 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
+       $40 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
       }
-      i64toi32_i32$3 = $42;
+      i64toi32_i32$3 = $40;
       i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
       return i64toi32_i32$3 | 0;
      }
@@ -2932,12 +2940,12 @@ function asmFunc(global, env, buffer) {
     i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
     if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
      i64toi32_i32$1 = 0;
-     $43 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
+     $41 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
     } else {
      i64toi32_i32$1 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
-     $43 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+     $41 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
     }
-    var$5 = $43;
+    var$5 = $41;
     var$5$hi = i64toi32_i32$1;
     i64toi32_i32$1 = var$0$hi;
     i64toi32_i32$1 = 0;
@@ -2949,12 +2957,12 @@ function asmFunc(global, env, buffer) {
     i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
     if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
      i64toi32_i32$2 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
-     $44 = 0;
+     $42 = 0;
     } else {
      i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$3 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-     $44 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
+     $42 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
     }
-    var$0 = $44;
+    var$0 = $42;
     var$0$hi = i64toi32_i32$2;
     label$13 : {
      if (var$2) {
@@ -2963,121 +2971,121 @@ function asmFunc(global, env, buffer) {
        i64toi32_i32$1 = var$1;
        i64toi32_i32$3 = -1;
        i64toi32_i32$0 = -1;
-       i64toi32_i32$4 = i64toi32_i32$1 + i64toi32_i32$0 | 0;
-       i64toi32_i32$5 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
-       if (i64toi32_i32$4 >>> 0 < i64toi32_i32$0 >>> 0) {
-        i64toi32_i32$5 = i64toi32_i32$5 + 1 | 0
+       i64toi32_i32$1 = i64toi32_i32$1 + i64toi32_i32$0 | 0;
+       i64toi32_i32$2 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
+       if (i64toi32_i32$1 >>> 0 < i64toi32_i32$0 >>> 0) {
+        i64toi32_i32$2 = i64toi32_i32$2 + 1 | 0
        }
-       var$8 = i64toi32_i32$4;
-       var$8$hi = i64toi32_i32$5;
+       var$8 = i64toi32_i32$1;
+       var$8$hi = i64toi32_i32$2;
        label$15 : while (1) {
-        i64toi32_i32$5 = var$5$hi;
-        i64toi32_i32$2 = var$5;
-        i64toi32_i32$1 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
-         $45 = 0;
+        i64toi32_i32$2 = var$5$hi;
+        i64toi32_i32$3 = var$5;
+        i64toi32_i32$0 = 0;
+        i64toi32_i32$1 = 1;
+        i64toi32_i32$4 = i64toi32_i32$1 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$1 & 63 | 0) >>> 0) {
+         i64toi32_i32$0 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
+         $43 = 0;
         } else {
-         i64toi32_i32$1 = ((1 << i64toi32_i32$3 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$3 | 0) | 0) | 0 | (i64toi32_i32$5 << i64toi32_i32$3 | 0) | 0;
-         $45 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
+         i64toi32_i32$0 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$3 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$2 << i64toi32_i32$4 | 0) | 0;
+         $43 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
         }
-        $140 = $45;
-        $140$hi = i64toi32_i32$1;
-        i64toi32_i32$1 = var$0$hi;
-        i64toi32_i32$5 = var$0;
-        i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 63;
-        i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = 0;
-         $46 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
+        $140 = $43;
+        $140$hi = i64toi32_i32$0;
+        i64toi32_i32$0 = var$0$hi;
+        i64toi32_i32$2 = var$0;
+        i64toi32_i32$3 = 0;
+        i64toi32_i32$1 = 63;
+        i64toi32_i32$4 = i64toi32_i32$1 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$1 & 63 | 0) >>> 0) {
+         i64toi32_i32$3 = 0;
+         $44 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
         } else {
-         i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
-         $46 = (((1 << i64toi32_i32$3 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$3 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$3 | 0) | 0;
+         i64toi32_i32$3 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
+         $44 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
         }
-        $142$hi = i64toi32_i32$2;
-        i64toi32_i32$2 = $140$hi;
-        i64toi32_i32$1 = $140;
-        i64toi32_i32$5 = $142$hi;
-        i64toi32_i32$0 = $46;
-        i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
-        var$5 = i64toi32_i32$1 | i64toi32_i32$0 | 0;
-        var$5$hi = i64toi32_i32$5;
+        $142$hi = i64toi32_i32$3;
+        i64toi32_i32$3 = $140$hi;
+        i64toi32_i32$0 = $140;
+        i64toi32_i32$2 = $142$hi;
+        i64toi32_i32$1 = $44;
+        i64toi32_i32$2 = i64toi32_i32$3 | i64toi32_i32$2 | 0;
+        var$5 = i64toi32_i32$0 | i64toi32_i32$1 | 0;
+        var$5$hi = i64toi32_i32$2;
         $144 = var$5;
-        $144$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = var$8$hi;
-        i64toi32_i32$5 = var$5$hi;
-        i64toi32_i32$5 = var$8$hi;
-        i64toi32_i32$2 = var$8;
-        i64toi32_i32$1 = var$5$hi;
-        i64toi32_i32$0 = var$5;
-        i64toi32_i32$3 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
-        i64toi32_i32$6 = i64toi32_i32$2 >>> 0 < i64toi32_i32$0 >>> 0;
-        i64toi32_i32$4 = i64toi32_i32$6 + i64toi32_i32$1 | 0;
-        i64toi32_i32$4 = i64toi32_i32$5 - i64toi32_i32$4 | 0;
-        i64toi32_i32$5 = i64toi32_i32$3;
+        $144$hi = i64toi32_i32$2;
+        i64toi32_i32$2 = var$8$hi;
+        i64toi32_i32$2 = var$5$hi;
+        i64toi32_i32$2 = var$8$hi;
+        i64toi32_i32$3 = var$8;
+        i64toi32_i32$0 = var$5$hi;
+        i64toi32_i32$1 = var$5;
+        i64toi32_i32$4 = i64toi32_i32$3 >>> 0 < i64toi32_i32$1 >>> 0;
+        i64toi32_i32$3 = i64toi32_i32$3 - i64toi32_i32$1 | 0;
+        i64toi32_i32$0 = i64toi32_i32$4 + i64toi32_i32$0 | 0;
+        i64toi32_i32$0 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
+        i64toi32_i32$1 = i64toi32_i32$3;
         i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 63;
-        i64toi32_i32$1 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = i64toi32_i32$4 >> 31 | 0;
-         $47 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
+        i64toi32_i32$4 = 63;
+        i64toi32_i32$3 = i64toi32_i32$4 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$4 & 63 | 0) >>> 0) {
+         i64toi32_i32$2 = i64toi32_i32$0 >> 31 | 0;
+         $45 = i64toi32_i32$0 >> i64toi32_i32$3 | 0;
         } else {
-         i64toi32_i32$2 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
-         $47 = (((1 << i64toi32_i32$1 | 0) - 1 | 0) & i64toi32_i32$4 | 0) << (32 - i64toi32_i32$1 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$1 | 0) | 0;
+         i64toi32_i32$2 = i64toi32_i32$0 >> i64toi32_i32$3 | 0;
+         $45 = (((1 << i64toi32_i32$3 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$3 | 0) | 0 | (i64toi32_i32$1 >>> i64toi32_i32$3 | 0) | 0;
         }
-        var$6 = $47;
+        var$6 = $45;
         var$6$hi = i64toi32_i32$2;
         i64toi32_i32$2 = var$1$hi;
         i64toi32_i32$2 = var$6$hi;
-        i64toi32_i32$4 = var$6;
-        i64toi32_i32$5 = var$1$hi;
-        i64toi32_i32$0 = var$1;
-        i64toi32_i32$5 = i64toi32_i32$2 & i64toi32_i32$5 | 0;
-        $151 = i64toi32_i32$4 & i64toi32_i32$0 | 0;
-        $151$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = $144$hi;
+        i64toi32_i32$0 = var$6;
+        i64toi32_i32$1 = var$1$hi;
+        i64toi32_i32$4 = var$1;
+        i64toi32_i32$1 = i64toi32_i32$2 & i64toi32_i32$1 | 0;
+        $151 = i64toi32_i32$0 & i64toi32_i32$4 | 0;
+        $151$hi = i64toi32_i32$1;
+        i64toi32_i32$1 = $144$hi;
         i64toi32_i32$2 = $144;
-        i64toi32_i32$4 = $151$hi;
-        i64toi32_i32$0 = $151;
-        i64toi32_i32$1 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
-        i64toi32_i32$6 = i64toi32_i32$2 >>> 0 < i64toi32_i32$0 >>> 0;
-        i64toi32_i32$3 = i64toi32_i32$6 + i64toi32_i32$4 | 0;
-        i64toi32_i32$3 = i64toi32_i32$5 - i64toi32_i32$3 | 0;
-        var$5 = i64toi32_i32$1;
-        var$5$hi = i64toi32_i32$3;
-        i64toi32_i32$3 = var$0$hi;
-        i64toi32_i32$5 = var$0;
-        i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-         $48 = 0;
+        i64toi32_i32$0 = $151$hi;
+        i64toi32_i32$4 = $151;
+        i64toi32_i32$3 = i64toi32_i32$2 >>> 0 < i64toi32_i32$4 >>> 0;
+        i64toi32_i32$2 = i64toi32_i32$2 - i64toi32_i32$4 | 0;
+        i64toi32_i32$0 = i64toi32_i32$3 + i64toi32_i32$0 | 0;
+        i64toi32_i32$0 = i64toi32_i32$1 - i64toi32_i32$0 | 0;
+        var$5 = i64toi32_i32$2;
+        var$5$hi = i64toi32_i32$0;
+        i64toi32_i32$0 = var$0$hi;
+        i64toi32_i32$4 = var$0;
+        i64toi32_i32$1 = 0;
+        i64toi32_i32$3 = 1;
+        i64toi32_i32$2 = i64toi32_i32$3 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
+         i64toi32_i32$1 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
+         $46 = 0;
         } else {
-         i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $48 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
+         i64toi32_i32$1 = ((1 << i64toi32_i32$2 | 0) - 1 | 0) & (i64toi32_i32$4 >>> (32 - i64toi32_i32$2 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$2 | 0) | 0;
+         $46 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
         }
-        $154$hi = i64toi32_i32$2;
-        i64toi32_i32$2 = var$7$hi;
-        i64toi32_i32$2 = $154$hi;
-        i64toi32_i32$3 = $48;
-        i64toi32_i32$5 = var$7$hi;
-        i64toi32_i32$0 = var$7;
-        i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
-        var$0 = i64toi32_i32$3 | i64toi32_i32$0 | 0;
-        var$0$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = var$6$hi;
-        i64toi32_i32$2 = var$6;
-        i64toi32_i32$3 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$3 = i64toi32_i32$5 & i64toi32_i32$3 | 0;
-        var$6 = i64toi32_i32$2 & i64toi32_i32$0 | 0;
-        var$6$hi = i64toi32_i32$3;
+        $154$hi = i64toi32_i32$1;
+        i64toi32_i32$1 = var$7$hi;
+        i64toi32_i32$1 = $154$hi;
+        i64toi32_i32$0 = $46;
+        i64toi32_i32$4 = var$7$hi;
+        i64toi32_i32$3 = var$7;
+        i64toi32_i32$4 = i64toi32_i32$1 | i64toi32_i32$4 | 0;
+        var$0 = i64toi32_i32$0 | i64toi32_i32$3 | 0;
+        var$0$hi = i64toi32_i32$4;
+        i64toi32_i32$4 = var$6$hi;
+        i64toi32_i32$1 = var$6;
+        i64toi32_i32$0 = 0;
+        i64toi32_i32$3 = 1;
+        i64toi32_i32$0 = i64toi32_i32$4 & i64toi32_i32$0 | 0;
+        var$6 = i64toi32_i32$1 & i64toi32_i32$3 | 0;
+        var$6$hi = i64toi32_i32$0;
         var$7 = var$6;
-        var$7$hi = i64toi32_i32$3;
+        var$7$hi = i64toi32_i32$0;
         var$2 = var$2 + -1 | 0;
         if (var$2) {
          continue label$15
@@ -3088,89 +3096,90 @@ function asmFunc(global, env, buffer) {
       }
      }
     }
-    i64toi32_i32$3 = var$5$hi;
-    legalfunc$wasm2js_scratch_store_i64(var$5 | 0, i64toi32_i32$3 | 0);
-    i64toi32_i32$3 = var$0$hi;
-    i64toi32_i32$5 = var$0;
-    i64toi32_i32$2 = 0;
-    i64toi32_i32$0 = 1;
-    i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-    if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-     i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-     $49 = 0;
+    i64toi32_i32$0 = var$5$hi;
+    legalfunc$wasm2js_scratch_store_i64(var$5 | 0, i64toi32_i32$0 | 0);
+    i64toi32_i32$0 = var$0$hi;
+    i64toi32_i32$4 = var$0;
+    i64toi32_i32$1 = 0;
+    i64toi32_i32$3 = 1;
+    i64toi32_i32$2 = i64toi32_i32$3 & 31 | 0;
+    if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
+     i64toi32_i32$1 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
+     $47 = 0;
     } else {
-     i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-     $49 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
+     i64toi32_i32$1 = ((1 << i64toi32_i32$2 | 0) - 1 | 0) & (i64toi32_i32$4 >>> (32 - i64toi32_i32$2 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$2 | 0) | 0;
+     $47 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
     }
-    $165$hi = i64toi32_i32$2;
-    i64toi32_i32$2 = var$6$hi;
-    i64toi32_i32$2 = $165$hi;
-    i64toi32_i32$3 = $49;
-    i64toi32_i32$5 = var$6$hi;
-    i64toi32_i32$0 = var$6;
-    i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
-    i64toi32_i32$3 = i64toi32_i32$3 | i64toi32_i32$0 | 0;
-    i64toi32_i32$HIGH_BITS = i64toi32_i32$5;
-    return i64toi32_i32$3 | 0;
+    $165$hi = i64toi32_i32$1;
+    i64toi32_i32$1 = var$6$hi;
+    i64toi32_i32$1 = $165$hi;
+    i64toi32_i32$0 = $47;
+    i64toi32_i32$4 = var$6$hi;
+    i64toi32_i32$3 = var$6;
+    i64toi32_i32$4 = i64toi32_i32$1 | i64toi32_i32$4 | 0;
+    i64toi32_i32$0 = i64toi32_i32$0 | i64toi32_i32$3 | 0;
+    i64toi32_i32$HIGH_BITS = i64toi32_i32$4;
+    return i64toi32_i32$0 | 0;
    }
-   i64toi32_i32$3 = var$0$hi;
-   legalfunc$wasm2js_scratch_store_i64(var$0 | 0, i64toi32_i32$3 | 0);
-   i64toi32_i32$3 = 0;
+   i64toi32_i32$0 = var$0$hi;
+   legalfunc$wasm2js_scratch_store_i64(var$0 | 0, i64toi32_i32$0 | 0);
+   i64toi32_i32$0 = 0;
    var$0 = 0;
-   var$0$hi = i64toi32_i32$3;
+   var$0$hi = i64toi32_i32$0;
   }
-  i64toi32_i32$3 = var$0$hi;
-  i64toi32_i32$5 = var$0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$3;
-  return i64toi32_i32$5 | 0;
+  i64toi32_i32$0 = var$0$hi;
+  i64toi32_i32$4 = var$0;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
+  return i64toi32_i32$4 | 0;
  }
  
  function __wasm_ctz_i64(var$0, var$0$hi) {
   var$0 = var$0 | 0;
   var$0$hi = var$0$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, i64toi32_i32$5 = 0, i64toi32_i32$4 = 0, i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, $10_1 = 0, $5$hi = 0, $8$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, $9_1 = 0, $5$hi = 0, $8$hi = 0, i64toi32_i32$4 = 0;
   i64toi32_i32$0 = var$0$hi;
   if (!!(var$0 | i64toi32_i32$0 | 0)) {
    i64toi32_i32$0 = var$0$hi;
    i64toi32_i32$2 = var$0;
    i64toi32_i32$1 = -1;
    i64toi32_i32$3 = -1;
-   i64toi32_i32$4 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
-   i64toi32_i32$5 = i64toi32_i32$0 + i64toi32_i32$1 | 0;
-   if (i64toi32_i32$4 >>> 0 < i64toi32_i32$3 >>> 0) {
-    i64toi32_i32$5 = i64toi32_i32$5 + 1 | 0
+   i64toi32_i32$2 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
+   i64toi32_i32$0 = i64toi32_i32$0 + i64toi32_i32$1 | 0;
+   if (i64toi32_i32$2 >>> 0 < i64toi32_i32$3 >>> 0) {
+    i64toi32_i32$0 = i64toi32_i32$0 + 1 | 0
    }
-   $5$hi = i64toi32_i32$5;
-   i64toi32_i32$5 = var$0$hi;
-   i64toi32_i32$5 = $5$hi;
-   i64toi32_i32$0 = i64toi32_i32$4;
-   i64toi32_i32$2 = var$0$hi;
-   i64toi32_i32$3 = var$0;
-   i64toi32_i32$2 = i64toi32_i32$5 ^ i64toi32_i32$2 | 0;
-   i64toi32_i32$0 = i64toi32_i32$0 ^ i64toi32_i32$3 | 0;
-   i64toi32_i32$3 = Math_clz32(i64toi32_i32$2);
-   i64toi32_i32$5 = 0;
-   if ((i64toi32_i32$3 | 0) == (32 | 0)) {
-    $10_1 = Math_clz32(i64toi32_i32$0) + 32 | 0
+   $5$hi = i64toi32_i32$0;
+   i64toi32_i32$0 = var$0$hi;
+   i64toi32_i32$0 = $5$hi;
+   i64toi32_i32$1 = i64toi32_i32$2;
+   i64toi32_i32$3 = var$0$hi;
+   i64toi32_i32$2 = var$0;
+   i64toi32_i32$3 = i64toi32_i32$0 ^ i64toi32_i32$3 | 0;
+   i64toi32_i32$1 = i64toi32_i32$1 ^ i64toi32_i32$2 | 0;
+   i64toi32_i32$2 = Math_clz32(i64toi32_i32$3);
+   i64toi32_i32$0 = 0;
+   if ((i64toi32_i32$2 | 0) == (32 | 0)) {
+    $9_1 = Math_clz32(i64toi32_i32$1) + 32 | 0
    } else {
-    $10_1 = i64toi32_i32$3
+    $9_1 = i64toi32_i32$2
    }
-   $8$hi = i64toi32_i32$5;
-   i64toi32_i32$5 = 0;
-   i64toi32_i32$0 = 63;
-   i64toi32_i32$2 = $8$hi;
-   i64toi32_i32$3 = $10_1;
-   i64toi32_i32$1 = i64toi32_i32$0 - i64toi32_i32$3 | 0;
-   i64toi32_i32$4 = (i64toi32_i32$0 >>> 0 < i64toi32_i32$3 >>> 0) + i64toi32_i32$2 | 0;
-   i64toi32_i32$4 = i64toi32_i32$5 - i64toi32_i32$4 | 0;
+   $8$hi = i64toi32_i32$0;
+   i64toi32_i32$0 = 0;
+   i64toi32_i32$1 = 63;
+   i64toi32_i32$3 = $8$hi;
+   i64toi32_i32$2 = $9_1;
+   i64toi32_i32$4 = i64toi32_i32$1 >>> 0 < i64toi32_i32$2 >>> 0;
+   i64toi32_i32$1 = i64toi32_i32$1 - i64toi32_i32$2 | 0;
+   i64toi32_i32$3 = i64toi32_i32$4 + i64toi32_i32$3 | 0;
+   i64toi32_i32$3 = i64toi32_i32$0 - i64toi32_i32$3 | 0;
    i64toi32_i32$0 = i64toi32_i32$1;
-   i64toi32_i32$HIGH_BITS = i64toi32_i32$4;
+   i64toi32_i32$HIGH_BITS = i64toi32_i32$3;
    return i64toi32_i32$0 | 0;
   }
   i64toi32_i32$0 = 0;
-  i64toi32_i32$4 = 64;
+  i64toi32_i32$3 = 64;
   i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
-  return i64toi32_i32$4 | 0;
+  return i64toi32_i32$3 | 0;
  }
  
  function __wasm_i64_mul(var$0, var$0$hi, var$1, var$1$hi) {
@@ -3258,7 +3267,7 @@ function asmFunc(global, env, buffer) {
  function __wasm_popcnt_i64(var$0, var$0$hi) {
   var$0 = var$0 | 0;
   var$0$hi = var$0$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, i64toi32_i32$5 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, i64toi32_i32$1 = 0, var$1$hi = 0, var$1 = 0, $5_1 = 0, $5$hi = 0, $4_1 = 0, $9$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, var$1$hi = 0, var$1 = 0, $5_1 = 0, $5$hi = 0, $4_1 = 0, i64toi32_i32$2 = 0, $9$hi = 0;
   label$1 : {
    label$2 : while (1) {
     i64toi32_i32$0 = var$1$hi;
@@ -3272,38 +3281,38 @@ function asmFunc(global, env, buffer) {
     }
     i64toi32_i32$0 = $5$hi;
     i64toi32_i32$0 = var$0$hi;
-    i64toi32_i32$2 = var$0;
     i64toi32_i32$1 = 0;
     i64toi32_i32$3 = 1;
-    i64toi32_i32$4 = i64toi32_i32$2 - i64toi32_i32$3 | 0;
-    i64toi32_i32$5 = (i64toi32_i32$2 >>> 0 < i64toi32_i32$3 >>> 0) + i64toi32_i32$1 | 0;
-    i64toi32_i32$5 = i64toi32_i32$0 - i64toi32_i32$5 | 0;
-    $9$hi = i64toi32_i32$5;
-    i64toi32_i32$5 = i64toi32_i32$0;
-    i64toi32_i32$0 = i64toi32_i32$2;
-    i64toi32_i32$2 = $9$hi;
-    i64toi32_i32$3 = i64toi32_i32$4;
-    i64toi32_i32$2 = i64toi32_i32$5 & i64toi32_i32$2 | 0;
-    var$0 = i64toi32_i32$0 & i64toi32_i32$4 | 0;
-    var$0$hi = i64toi32_i32$2;
-    i64toi32_i32$2 = var$1$hi;
-    i64toi32_i32$5 = var$1;
-    i64toi32_i32$0 = 0;
-    i64toi32_i32$3 = 1;
-    i64toi32_i32$1 = i64toi32_i32$5 + i64toi32_i32$3 | 0;
-    i64toi32_i32$4 = i64toi32_i32$2 + i64toi32_i32$0 | 0;
-    if (i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0) {
-     i64toi32_i32$4 = i64toi32_i32$4 + 1 | 0
+    i64toi32_i32$4 = var$0 >>> 0 < i64toi32_i32$3 >>> 0;
+    i64toi32_i32$2 = var$0 - i64toi32_i32$3 | 0;
+    i64toi32_i32$1 = i64toi32_i32$4 + i64toi32_i32$1 | 0;
+    i64toi32_i32$1 = i64toi32_i32$0 - i64toi32_i32$1 | 0;
+    $9$hi = i64toi32_i32$1;
+    i64toi32_i32$1 = i64toi32_i32$0;
+    i64toi32_i32$3 = var$0;
+    i64toi32_i32$0 = $9$hi;
+    i64toi32_i32$4 = i64toi32_i32$2;
+    i64toi32_i32$0 = i64toi32_i32$1 & i64toi32_i32$0 | 0;
+    var$0 = var$0 & i64toi32_i32$4 | 0;
+    var$0$hi = i64toi32_i32$0;
+    i64toi32_i32$0 = var$1$hi;
+    i64toi32_i32$1 = var$1;
+    i64toi32_i32$3 = 0;
+    i64toi32_i32$4 = 1;
+    i64toi32_i32$1 = i64toi32_i32$1 + i64toi32_i32$4 | 0;
+    i64toi32_i32$0 = i64toi32_i32$0 + i64toi32_i32$3 | 0;
+    if (i64toi32_i32$1 >>> 0 < i64toi32_i32$4 >>> 0) {
+     i64toi32_i32$0 = i64toi32_i32$0 + 1 | 0
     }
     var$1 = i64toi32_i32$1;
-    var$1$hi = i64toi32_i32$4;
+    var$1$hi = i64toi32_i32$0;
     continue label$2;
    };
   }
-  i64toi32_i32$4 = $5$hi;
-  i64toi32_i32$5 = $5_1;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$4;
-  return i64toi32_i32$5 | 0;
+  i64toi32_i32$0 = $5$hi;
+  i64toi32_i32$4 = $5_1;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
+  return i64toi32_i32$4 | 0;
  }
  
  function __wasm_rotl_i64(var$0, var$0$hi, var$1, var$1$hi) {
@@ -3311,7 +3320,7 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$5 = 0, i64toi32_i32$4 = 0, var$2$hi = 0, var$2 = 0, $19_1 = 0, $20_1 = 0, $21_1 = 0, $22_1 = 0, $6$hi = 0, $8$hi = 0, $10_1 = 0, $10$hi = 0, $15$hi = 0, $17$hi = 0, $19$hi = 0;
+  var i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, i64toi32_i32$4 = 0, var$2$hi = 0, var$2 = 0, $18_1 = 0, $19_1 = 0, $20_1 = 0, $21_1 = 0, $6$hi = 0, $8$hi = 0, $10_1 = 0, $10$hi = 0, $15$hi = 0, $17$hi = 0, $19$hi = 0;
   i64toi32_i32$0 = var$1$hi;
   i64toi32_i32$2 = var$1;
   i64toi32_i32$1 = 0;
@@ -3326,15 +3335,15 @@ function asmFunc(global, env, buffer) {
   i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
   if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
    i64toi32_i32$2 = 0;
-   $19_1 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
+   $18_1 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
   } else {
    i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-   $19_1 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
+   $18_1 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
   }
   $6$hi = i64toi32_i32$2;
   i64toi32_i32$2 = var$0$hi;
   i64toi32_i32$2 = $6$hi;
-  i64toi32_i32$1 = $19_1;
+  i64toi32_i32$1 = $18_1;
   i64toi32_i32$0 = var$0$hi;
   i64toi32_i32$3 = var$0;
   i64toi32_i32$0 = i64toi32_i32$2 & i64toi32_i32$0 | 0;
@@ -3347,69 +3356,70 @@ function asmFunc(global, env, buffer) {
   i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
   if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
    i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-   $20_1 = 0;
+   $19_1 = 0;
   } else {
    i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$4 | 0) | 0;
-   $20_1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
+   $19_1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
   }
-  $10_1 = $20_1;
+  $10_1 = $19_1;
   $10$hi = i64toi32_i32$1;
   i64toi32_i32$1 = var$1$hi;
   i64toi32_i32$1 = 0;
   i64toi32_i32$0 = 0;
   i64toi32_i32$2 = var$1$hi;
   i64toi32_i32$3 = var$1;
-  i64toi32_i32$4 = i64toi32_i32$0 - i64toi32_i32$3 | 0;
-  i64toi32_i32$5 = (i64toi32_i32$0 >>> 0 < i64toi32_i32$3 >>> 0) + i64toi32_i32$2 | 0;
-  i64toi32_i32$5 = i64toi32_i32$1 - i64toi32_i32$5 | 0;
-  i64toi32_i32$1 = i64toi32_i32$4;
-  i64toi32_i32$0 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$0 = i64toi32_i32$5 & i64toi32_i32$0 | 0;
-  var$1 = i64toi32_i32$1 & i64toi32_i32$3 | 0;
-  var$1$hi = i64toi32_i32$0;
-  i64toi32_i32$0 = -1;
-  i64toi32_i32$5 = -1;
-  i64toi32_i32$1 = var$1$hi;
-  i64toi32_i32$3 = var$1;
-  i64toi32_i32$2 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$5 << i64toi32_i32$2 | 0;
-   $21_1 = 0;
+  i64toi32_i32$4 = i64toi32_i32$0 >>> 0 < i64toi32_i32$3 >>> 0;
+  i64toi32_i32$0 = i64toi32_i32$0 - i64toi32_i32$3 | 0;
+  i64toi32_i32$2 = i64toi32_i32$4 + i64toi32_i32$2 | 0;
+  i64toi32_i32$2 = i64toi32_i32$1 - i64toi32_i32$2 | 0;
+  i64toi32_i32$3 = i64toi32_i32$0;
+  i64toi32_i32$1 = 0;
+  i64toi32_i32$4 = 63;
+  i64toi32_i32$1 = i64toi32_i32$2 & i64toi32_i32$1 | 0;
+  var$1 = i64toi32_i32$0 & i64toi32_i32$4 | 0;
+  var$1$hi = i64toi32_i32$1;
+  i64toi32_i32$1 = -1;
+  i64toi32_i32$2 = -1;
+  i64toi32_i32$3 = var$1$hi;
+  i64toi32_i32$4 = var$1;
+  i64toi32_i32$0 = i64toi32_i32$4 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$4 & 63 | 0) >>> 0) {
+   i64toi32_i32$3 = i64toi32_i32$2 << i64toi32_i32$0 | 0;
+   $20_1 = 0;
   } else {
-   i64toi32_i32$1 = ((1 << i64toi32_i32$2 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$2 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$2 | 0) | 0;
-   $21_1 = i64toi32_i32$5 << i64toi32_i32$2 | 0;
+   i64toi32_i32$3 = ((1 << i64toi32_i32$0 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$0 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$0 | 0) | 0;
+   $20_1 = i64toi32_i32$2 << i64toi32_i32$0 | 0;
   }
-  $15$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$0$hi;
-  i64toi32_i32$1 = $15$hi;
-  i64toi32_i32$0 = $21_1;
-  i64toi32_i32$5 = var$0$hi;
-  i64toi32_i32$3 = var$0;
-  i64toi32_i32$5 = i64toi32_i32$1 & i64toi32_i32$5 | 0;
-  $17$hi = i64toi32_i32$5;
-  i64toi32_i32$5 = var$1$hi;
-  i64toi32_i32$5 = $17$hi;
-  i64toi32_i32$1 = i64toi32_i32$0 & i64toi32_i32$3 | 0;
-  i64toi32_i32$0 = var$1$hi;
-  i64toi32_i32$3 = var$1;
-  i64toi32_i32$2 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$0 = 0;
-   $22_1 = i64toi32_i32$5 >>> i64toi32_i32$2 | 0;
+  $15$hi = i64toi32_i32$3;
+  i64toi32_i32$3 = var$0$hi;
+  i64toi32_i32$3 = $15$hi;
+  i64toi32_i32$1 = $20_1;
+  i64toi32_i32$2 = var$0$hi;
+  i64toi32_i32$4 = var$0;
+  i64toi32_i32$2 = i64toi32_i32$3 & i64toi32_i32$2 | 0;
+  $17$hi = i64toi32_i32$2;
+  i64toi32_i32$2 = var$1$hi;
+  i64toi32_i32$2 = $17$hi;
+  i64toi32_i32$3 = i64toi32_i32$1 & i64toi32_i32$4 | 0;
+  i64toi32_i32$1 = var$1$hi;
+  i64toi32_i32$4 = var$1;
+  i64toi32_i32$0 = i64toi32_i32$4 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$4 & 63 | 0) >>> 0) {
+   i64toi32_i32$1 = 0;
+   $21_1 = i64toi32_i32$2 >>> i64toi32_i32$0 | 0;
   } else {
-   i64toi32_i32$0 = i64toi32_i32$5 >>> i64toi32_i32$2 | 0;
-   $22_1 = (((1 << i64toi32_i32$2 | 0) - 1 | 0) & i64toi32_i32$5 | 0) << (32 - i64toi32_i32$2 | 0) | 0 | (i64toi32_i32$1 >>> i64toi32_i32$2 | 0) | 0;
+   i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$0 | 0;
+   $21_1 = (((1 << i64toi32_i32$0 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$0 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$0 | 0) | 0;
   }
-  $19$hi = i64toi32_i32$0;
-  i64toi32_i32$0 = $10$hi;
-  i64toi32_i32$5 = $10_1;
-  i64toi32_i32$1 = $19$hi;
-  i64toi32_i32$3 = $22_1;
-  i64toi32_i32$1 = i64toi32_i32$0 | i64toi32_i32$1 | 0;
-  i64toi32_i32$5 = i64toi32_i32$5 | i64toi32_i32$3 | 0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
-  return i64toi32_i32$5 | 0;
+  $19$hi = i64toi32_i32$1;
+  i64toi32_i32$1 = $10$hi;
+  i64toi32_i32$2 = $10_1;
+  i64toi32_i32$3 = $19$hi;
+  i64toi32_i32$4 = $21_1;
+  i64toi32_i32$3 = i64toi32_i32$1 | i64toi32_i32$3 | 0;
+  i64toi32_i32$2 = i64toi32_i32$2 | i64toi32_i32$4 | 0;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$3;
+  return i64toi32_i32$2 | 0;
  }
  
  function __wasm_rotr_i64(var$0, var$0$hi, var$1, var$1$hi) {
@@ -3417,7 +3427,7 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$5 = 0, i64toi32_i32$4 = 0, var$2$hi = 0, var$2 = 0, $19_1 = 0, $20_1 = 0, $21_1 = 0, $22_1 = 0, $6$hi = 0, $8$hi = 0, $10_1 = 0, $10$hi = 0, $15$hi = 0, $17$hi = 0, $19$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$4 = 0, var$2$hi = 0, var$2 = 0, $18_1 = 0, $19_1 = 0, $20_1 = 0, $21_1 = 0, $6$hi = 0, $8$hi = 0, $10_1 = 0, $10$hi = 0, $15$hi = 0, $17$hi = 0, $19$hi = 0;
   i64toi32_i32$0 = var$1$hi;
   i64toi32_i32$2 = var$1;
   i64toi32_i32$1 = 0;
@@ -3432,15 +3442,15 @@ function asmFunc(global, env, buffer) {
   i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
   if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
    i64toi32_i32$2 = i64toi32_i32$0 << i64toi32_i32$4 | 0;
-   $19_1 = 0;
+   $18_1 = 0;
   } else {
    i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$0 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-   $19_1 = i64toi32_i32$0 << i64toi32_i32$4 | 0;
+   $18_1 = i64toi32_i32$0 << i64toi32_i32$4 | 0;
   }
   $6$hi = i64toi32_i32$2;
   i64toi32_i32$2 = var$0$hi;
   i64toi32_i32$2 = $6$hi;
-  i64toi32_i32$1 = $19_1;
+  i64toi32_i32$1 = $18_1;
   i64toi32_i32$0 = var$0$hi;
   i64toi32_i32$3 = var$0;
   i64toi32_i32$0 = i64toi32_i32$2 & i64toi32_i32$0 | 0;
@@ -3453,69 +3463,70 @@ function asmFunc(global, env, buffer) {
   i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
   if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
    i64toi32_i32$1 = 0;
-   $20_1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
+   $19_1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
   } else {
    i64toi32_i32$1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-   $20_1 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+   $19_1 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
   }
-  $10_1 = $20_1;
+  $10_1 = $19_1;
   $10$hi = i64toi32_i32$1;
   i64toi32_i32$1 = var$1$hi;
   i64toi32_i32$1 = 0;
   i64toi32_i32$0 = 0;
   i64toi32_i32$2 = var$1$hi;
   i64toi32_i32$3 = var$1;
-  i64toi32_i32$4 = i64toi32_i32$0 - i64toi32_i32$3 | 0;
-  i64toi32_i32$5 = (i64toi32_i32$0 >>> 0 < i64toi32_i32$3 >>> 0) + i64toi32_i32$2 | 0;
-  i64toi32_i32$5 = i64toi32_i32$1 - i64toi32_i32$5 | 0;
-  i64toi32_i32$1 = i64toi32_i32$4;
-  i64toi32_i32$0 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$0 = i64toi32_i32$5 & i64toi32_i32$0 | 0;
-  var$1 = i64toi32_i32$1 & i64toi32_i32$3 | 0;
-  var$1$hi = i64toi32_i32$0;
-  i64toi32_i32$0 = -1;
-  i64toi32_i32$5 = -1;
-  i64toi32_i32$1 = var$1$hi;
-  i64toi32_i32$3 = var$1;
-  i64toi32_i32$2 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = 0;
-   $21_1 = i64toi32_i32$0 >>> i64toi32_i32$2 | 0;
+  i64toi32_i32$4 = i64toi32_i32$0 >>> 0 < i64toi32_i32$3 >>> 0;
+  i64toi32_i32$0 = i64toi32_i32$0 - i64toi32_i32$3 | 0;
+  i64toi32_i32$2 = i64toi32_i32$4 + i64toi32_i32$2 | 0;
+  i64toi32_i32$2 = i64toi32_i32$1 - i64toi32_i32$2 | 0;
+  i64toi32_i32$3 = i64toi32_i32$0;
+  i64toi32_i32$1 = 0;
+  i64toi32_i32$4 = 63;
+  i64toi32_i32$1 = i64toi32_i32$2 & i64toi32_i32$1 | 0;
+  var$1 = i64toi32_i32$0 & i64toi32_i32$4 | 0;
+  var$1$hi = i64toi32_i32$1;
+  i64toi32_i32$1 = -1;
+  i64toi32_i32$2 = -1;
+  i64toi32_i32$3 = var$1$hi;
+  i64toi32_i32$4 = var$1;
+  i64toi32_i32$0 = i64toi32_i32$4 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$4 & 63 | 0) >>> 0) {
+   i64toi32_i32$3 = 0;
+   $20_1 = i64toi32_i32$1 >>> i64toi32_i32$0 | 0;
   } else {
-   i64toi32_i32$1 = i64toi32_i32$0 >>> i64toi32_i32$2 | 0;
-   $21_1 = (((1 << i64toi32_i32$2 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$2 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$2 | 0) | 0;
+   i64toi32_i32$3 = i64toi32_i32$1 >>> i64toi32_i32$0 | 0;
+   $20_1 = (((1 << i64toi32_i32$0 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$0 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$0 | 0) | 0;
   }
-  $15$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$0$hi;
-  i64toi32_i32$1 = $15$hi;
-  i64toi32_i32$0 = $21_1;
-  i64toi32_i32$5 = var$0$hi;
-  i64toi32_i32$3 = var$0;
-  i64toi32_i32$5 = i64toi32_i32$1 & i64toi32_i32$5 | 0;
-  $17$hi = i64toi32_i32$5;
-  i64toi32_i32$5 = var$1$hi;
-  i64toi32_i32$5 = $17$hi;
-  i64toi32_i32$1 = i64toi32_i32$0 & i64toi32_i32$3 | 0;
-  i64toi32_i32$0 = var$1$hi;
-  i64toi32_i32$3 = var$1;
-  i64toi32_i32$2 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$0 = i64toi32_i32$1 << i64toi32_i32$2 | 0;
-   $22_1 = 0;
+  $15$hi = i64toi32_i32$3;
+  i64toi32_i32$3 = var$0$hi;
+  i64toi32_i32$3 = $15$hi;
+  i64toi32_i32$1 = $20_1;
+  i64toi32_i32$2 = var$0$hi;
+  i64toi32_i32$4 = var$0;
+  i64toi32_i32$2 = i64toi32_i32$3 & i64toi32_i32$2 | 0;
+  $17$hi = i64toi32_i32$2;
+  i64toi32_i32$2 = var$1$hi;
+  i64toi32_i32$2 = $17$hi;
+  i64toi32_i32$3 = i64toi32_i32$1 & i64toi32_i32$4 | 0;
+  i64toi32_i32$1 = var$1$hi;
+  i64toi32_i32$4 = var$1;
+  i64toi32_i32$0 = i64toi32_i32$4 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$4 & 63 | 0) >>> 0) {
+   i64toi32_i32$1 = i64toi32_i32$3 << i64toi32_i32$0 | 0;
+   $21_1 = 0;
   } else {
-   i64toi32_i32$0 = ((1 << i64toi32_i32$2 | 0) - 1 | 0) & (i64toi32_i32$1 >>> (32 - i64toi32_i32$2 | 0) | 0) | 0 | (i64toi32_i32$5 << i64toi32_i32$2 | 0) | 0;
-   $22_1 = i64toi32_i32$1 << i64toi32_i32$2 | 0;
+   i64toi32_i32$1 = ((1 << i64toi32_i32$0 | 0) - 1 | 0) & (i64toi32_i32$3 >>> (32 - i64toi32_i32$0 | 0) | 0) | 0 | (i64toi32_i32$2 << i64toi32_i32$0 | 0) | 0;
+   $21_1 = i64toi32_i32$3 << i64toi32_i32$0 | 0;
   }
-  $19$hi = i64toi32_i32$0;
-  i64toi32_i32$0 = $10$hi;
-  i64toi32_i32$5 = $10_1;
-  i64toi32_i32$1 = $19$hi;
-  i64toi32_i32$3 = $22_1;
-  i64toi32_i32$1 = i64toi32_i32$0 | i64toi32_i32$1 | 0;
-  i64toi32_i32$5 = i64toi32_i32$5 | i64toi32_i32$3 | 0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
-  return i64toi32_i32$5 | 0;
+  $19$hi = i64toi32_i32$1;
+  i64toi32_i32$1 = $10$hi;
+  i64toi32_i32$2 = $10_1;
+  i64toi32_i32$3 = $19$hi;
+  i64toi32_i32$4 = $21_1;
+  i64toi32_i32$3 = i64toi32_i32$1 | i64toi32_i32$3 | 0;
+  i64toi32_i32$2 = i64toi32_i32$2 | i64toi32_i32$4 | 0;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$3;
+  return i64toi32_i32$2 | 0;
  }
  
  function __wasm_ctz_i32(var$0) {
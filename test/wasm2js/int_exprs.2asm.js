@@ -37,48 +37,47 @@ function asmFunc(global, env, buffer) {
   x$hi = x$hi | 0;
   y = y | 0;
   y$hi = y$hi | 0;
-  var i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, i64toi32_i32$5 = 0, i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, $13 = 0, $14 = 0, $15 = 0, $3_1 = 0, $3$hi = 0, $5$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$3 = 0, $11 = 0, $12 = 0, $13 = 0, $3_1 = 0, $3$hi = 0, $5$hi = 0;
   i64toi32_i32$0 = x$hi;
   i64toi32_i32$2 = x;
   i64toi32_i32$1 = 0;
   i64toi32_i32$3 = 1;
-  i64toi32_i32$4 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
-  i64toi32_i32$5 = i64toi32_i32$0 + i64toi32_i32$1 | 0;
-  if (i64toi32_i32$4 >>> 0 < i64toi32_i32$3 >>> 0) {
-   i64toi32_i32$5 = i64toi32_i32$5 + 1 | 0
-  }
-  $3_1 = i64toi32_i32$4;
-  $3$hi = i64toi32_i32$5;
-  i64toi32_i32$5 = y$hi;
-  i64toi32_i32$0 = y;
-  i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 1;
-  i64toi32_i32$1 = i64toi32_i32$0 + i64toi32_i32$3 | 0;
-  i64toi32_i32$4 = i64toi32_i32$5 + i64toi32_i32$2 | 0;
-  if (i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0) {
-   i64toi32_i32$4 = i64toi32_i32$4 + 1 | 0
-  }
-  $5$hi = i64toi32_i32$4;
-  i64toi32_i32$4 = $3$hi;
-  i64toi32_i32$5 = $3_1;
-  i64toi32_i32$0 = $5$hi;
-  i64toi32_i32$3 = i64toi32_i32$1;
-  if ((i64toi32_i32$4 | 0) < (i64toi32_i32$0 | 0)) {
-   $13 = 1
-  } else {
-   if ((i64toi32_i32$4 | 0) <= (i64toi32_i32$0 | 0)) {
-    if (i64toi32_i32$5 >>> 0 >= i64toi32_i32$3 >>> 0) {
-     $14 = 0
+  i64toi32_i32$2 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
+  i64toi32_i32$0 = i64toi32_i32$0 + i64toi32_i32$1 | 0;
+  if (i64toi32_i32$2 >>> 0 < i64toi32_i32$3 >>> 0) {
+   i64toi32_i32$0 = i64toi32_i32$0 + 1 | 0
+  }
+  $3_1 = i64toi32_i32$2;
+  $3$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = y$hi;
+  i64toi32_i32$1 = y;
+  i64toi32_i32$3 = 0;
+  i64toi32_i32$2 = 1;
+  i64toi32_i32$1 = i64toi32_i32$1 + i64toi32_i32$2 | 0;
+  i64toi32_i32$0 = i64toi32_i32$0 + i64toi32_i32$3 | 0;
+  if (i64toi32_i32$1 >>> 0 < i64toi32_i32$2 >>> 0) {
+   i64toi32_i32$0 = i64toi32_i32$0 + 1 | 0
+  }
+  $5$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = $3$hi;
+  i64toi32_i32$3 = $3_1;
+  i64toi32_i32$2 = $5$hi;
+  if ((i64toi32_i32$0 | 0) < (i64toi32_i32$2 | 0)) {
+   $11 = 1
+  } else {
+   if ((i64toi32_i32$0 | 0) <= (i64toi32_i32$2 | 0)) {
+    if (i64toi32_i32$3 >>> 0 >= i64toi32_i32$1 >>> 0) {
+     $12 = 0
     } else {
-     $14 = 1
+     $12 = 1
     }
-    $15 = $14;
+    $13 = $12;
    } else {
-    $15 = 0
+    $13 = 0
    }
-   $13 = $15;
+   $11 = $13;
   }
-  return $13 | 0;
+  return $11 | 0;
  }
  
  function $3(x, x$hi, y, y$hi) {
@@ -86,33 +85,32 @@ function asmFunc(global, env, buffer) {
   x$hi = x$hi | 0;
   y = y | 0;
   y$hi = y$hi | 0;
-  var i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, i64toi32_i32$5 = 0, i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, $3_1 = 0, $3$hi = 0, $5$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$3 = 0, $3_1 = 0, $3$hi = 0, $5$hi = 0;
   i64toi32_i32$0 = x$hi;
   i64toi32_i32$2 = x;
   i64toi32_i32$1 = 0;
   i64toi32_i32$3 = 1;
-  i64toi32_i32$4 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
-  i64toi32_i32$5 = i64toi32_i32$0 + i64toi32_i32$1 | 0;
-  if (i64toi32_i32$4 >>> 0 < i64toi32_i32$3 >>> 0) {
-   i64toi32_i32$5 = i64toi32_i32$5 + 1 | 0
-  }
-  $3_1 = i64toi32_i32$4;
-  $3$hi = i64toi32_i32$5;
-  i64toi32_i32$5 = y$hi;
-  i64toi32_i32$0 = y;
-  i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 1;
-  i64toi32_i32$1 = i64toi32_i32$0 + i64toi32_i32$3 | 0;
-  i64toi32_i32$4 = i64toi32_i32$5 + i64toi32_i32$2 | 0;
-  if (i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0) {
-   i64toi32_i32$4 = i64toi32_i32$4 + 1 | 0
+  i64toi32_i32$2 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
+  i64toi32_i32$0 = i64toi32_i32$0 + i64toi32_i32$1 | 0;
+  if (i64toi32_i32$2 >>> 0 < i64toi32_i32$3 >>> 0) {
+   i64toi32_i32$0 = i64toi32_i32$0 + 1 | 0
+  }
+  $3_1 = i64toi32_i32$2;
+  $3$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = y$hi;
+  i64toi32_i32$1 = y;
+  i64toi32_i32$3 = 0;
+  i64toi32_i32$2 = 1;
+  i64toi32_i32$1 = i64toi32_i32$1 + i64toi32_i32$2 | 0;
+  i64toi32_i32$0 = i64toi32_i32$0 + i64toi32_i32$3 | 0;
+  if (i64toi32_i32$1 >>> 0 < i64toi32_i32$2 >>> 0) {
+   i64toi32_i32$0 = i64toi32_i32$0 + 1 | 0
   }
-  $5$hi = i64toi32_i32$4;
-  i64toi32_i32$4 = $3$hi;
-  i64toi32_i32$5 = $3_1;
-  i64toi32_i32$0 = $5$hi;
-  i64toi32_i32$3 = i64toi32_i32$1;
-  return i64toi32_i32$4 >>> 0 < i64toi32_i32$0 >>> 0 | ((i64toi32_i32$4 | 0) == (i64toi32_i32$0 | 0) & i64toi32_i32$5 >>> 0 < i64toi32_i32$3 >>> 0 | 0) | 0 | 0;
+  $5$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = $3$hi;
+  i64toi32_i32$3 = $3_1;
+  i64toi32_i32$2 = $5$hi;
+  return i64toi32_i32$0 >>> 0 < i64toi32_i32$2 >>> 0 | ((i64toi32_i32$0 | 0) == (i64toi32_i32$2 | 0) & i64toi32_i32$3 >>> 0 < i64toi32_i32$1 >>> 0 | 0) | 0 | 0;
  }
  
  function legalstub$2($0_1, $1_1, $2_1, $3_1) {
@@ -1094,7 +1092,7 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$2$hi = 0, i64toi32_i32$6 = 0, $21 = 0, $22 = 0, $23 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17 = 0, $17$hi = 0, $23$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$4 = 0, var$2 = 0, var$2$hi = 0, $19 = 0, $20 = 0, $21 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17 = 0, $17$hi = 0, $23$hi = 0;
   i64toi32_i32$0 = var$0$hi;
   i64toi32_i32$2 = var$0;
   i64toi32_i32$1 = 0;
@@ -1102,12 +1100,12 @@ function asmFunc(global, env, buffer) {
   i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
   if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
    i64toi32_i32$1 = i64toi32_i32$0 >> 31 | 0;
-   $21 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
+   $19 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
   } else {
    i64toi32_i32$1 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
-   $21 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+   $19 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
   }
-  var$2 = $21;
+  var$2 = $19;
   var$2$hi = i64toi32_i32$1;
   i64toi32_i32$1 = var$0$hi;
   i64toi32_i32$1 = var$2$hi;
@@ -1121,86 +1119,86 @@ function asmFunc(global, env, buffer) {
   i64toi32_i32$1 = i64toi32_i32$0 ^ i64toi32_i32$3 | 0;
   i64toi32_i32$0 = var$2$hi;
   i64toi32_i32$3 = var$2;
-  i64toi32_i32$4 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$5 = i64toi32_i32$6 + i64toi32_i32$0 | 0;
-  i64toi32_i32$5 = i64toi32_i32$2 - i64toi32_i32$5 | 0;
-  $9 = i64toi32_i32$4;
-  $9$hi = i64toi32_i32$5;
-  i64toi32_i32$5 = var$1$hi;
-  i64toi32_i32$2 = var$1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$0 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$5 >> 31 | 0;
-   $22 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
-  } else {
-   i64toi32_i32$1 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
-   $22 = (((1 << i64toi32_i32$0 | 0) - 1 | 0) & i64toi32_i32$5 | 0) << (32 - i64toi32_i32$0 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$0 | 0) | 0;
-  }
-  var$2 = $22;
-  var$2$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$1$hi;
-  i64toi32_i32$1 = var$2$hi;
-  i64toi32_i32$5 = var$2;
-  i64toi32_i32$2 = var$1$hi;
+  i64toi32_i32$4 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
+  i64toi32_i32$1 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
+  i64toi32_i32$0 = i64toi32_i32$4 + i64toi32_i32$0 | 0;
+  i64toi32_i32$0 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
+  $9 = i64toi32_i32$1;
+  $9$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = var$1$hi;
   i64toi32_i32$3 = var$1;
-  i64toi32_i32$2 = i64toi32_i32$1 ^ i64toi32_i32$2 | 0;
-  $14$hi = i64toi32_i32$2;
-  i64toi32_i32$2 = i64toi32_i32$1;
-  i64toi32_i32$2 = $14$hi;
-  i64toi32_i32$1 = i64toi32_i32$5 ^ i64toi32_i32$3 | 0;
-  i64toi32_i32$5 = var$2$hi;
-  i64toi32_i32$3 = var$2;
-  i64toi32_i32$0 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$4 = i64toi32_i32$6 + i64toi32_i32$5 | 0;
-  i64toi32_i32$4 = i64toi32_i32$2 - i64toi32_i32$4 | 0;
-  $16$hi = i64toi32_i32$4;
-  i64toi32_i32$4 = $9$hi;
-  i64toi32_i32$1 = $16$hi;
-  i64toi32_i32$1 = __wasm_i64_udiv($9 | 0, i64toi32_i32$4 | 0, i64toi32_i32$0 | 0, i64toi32_i32$1 | 0) | 0;
-  i64toi32_i32$4 = i64toi32_i32$HIGH_BITS;
-  $17 = i64toi32_i32$1;
-  $17$hi = i64toi32_i32$4;
-  i64toi32_i32$4 = var$1$hi;
-  i64toi32_i32$4 = var$0$hi;
-  i64toi32_i32$4 = var$1$hi;
-  i64toi32_i32$2 = var$1;
-  i64toi32_i32$1 = var$0$hi;
-  i64toi32_i32$3 = var$0;
-  i64toi32_i32$1 = i64toi32_i32$4 ^ i64toi32_i32$1 | 0;
-  i64toi32_i32$4 = i64toi32_i32$2 ^ i64toi32_i32$3 | 0;
   i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$5 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = i64toi32_i32$1 >> 31 | 0;
-   $23 = i64toi32_i32$1 >> i64toi32_i32$5 | 0;
+  i64toi32_i32$4 = 63;
+  i64toi32_i32$1 = i64toi32_i32$4 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$4 & 63 | 0) >>> 0) {
+   i64toi32_i32$2 = i64toi32_i32$0 >> 31 | 0;
+   $20 = i64toi32_i32$0 >> i64toi32_i32$1 | 0;
   } else {
-   i64toi32_i32$2 = i64toi32_i32$1 >> i64toi32_i32$5 | 0;
-   $23 = (((1 << i64toi32_i32$5 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$5 | 0) | 0 | (i64toi32_i32$4 >>> i64toi32_i32$5 | 0) | 0;
+   i64toi32_i32$2 = i64toi32_i32$0 >> i64toi32_i32$1 | 0;
+   $20 = (((1 << i64toi32_i32$1 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$1 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$1 | 0) | 0;
   }
-  var$0 = $23;
-  var$0$hi = i64toi32_i32$2;
-  i64toi32_i32$2 = $17$hi;
-  i64toi32_i32$1 = $17;
-  i64toi32_i32$4 = var$0$hi;
-  i64toi32_i32$3 = var$0;
-  i64toi32_i32$4 = i64toi32_i32$2 ^ i64toi32_i32$4 | 0;
-  $23$hi = i64toi32_i32$4;
-  i64toi32_i32$4 = var$0$hi;
-  i64toi32_i32$4 = $23$hi;
-  i64toi32_i32$2 = i64toi32_i32$1 ^ i64toi32_i32$3 | 0;
-  i64toi32_i32$1 = var$0$hi;
-  i64toi32_i32$5 = i64toi32_i32$2 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$2 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$0 = i64toi32_i32$6 + i64toi32_i32$1 | 0;
-  i64toi32_i32$0 = i64toi32_i32$4 - i64toi32_i32$0 | 0;
-  i64toi32_i32$2 = i64toi32_i32$5;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
-  return i64toi32_i32$2 | 0;
+  var$2 = $20;
+  var$2$hi = i64toi32_i32$2;
+  i64toi32_i32$2 = var$1$hi;
+  i64toi32_i32$2 = var$2$hi;
+  i64toi32_i32$0 = var$2;
+  i64toi32_i32$3 = var$1$hi;
+  i64toi32_i32$4 = var$1;
+  i64toi32_i32$3 = i64toi32_i32$2 ^ i64toi32_i32$3 | 0;
+  $14$hi = i64toi32_i32$3;
+  i64toi32_i32$3 = i64toi32_i32$2;
+  i64toi32_i32$3 = $14$hi;
+  i64toi32_i32$2 = i64toi32_i32$0 ^ i64toi32_i32$4 | 0;
+  i64toi32_i32$0 = var$2$hi;
+  i64toi32_i32$4 = var$2;
+  i64toi32_i32$1 = i64toi32_i32$2 >>> 0 < i64toi32_i32$4 >>> 0;
+  i64toi32_i32$2 = i64toi32_i32$2 - i64toi32_i32$4 | 0;
+  i64toi32_i32$0 = i64toi32_i32$1 + i64toi32_i32$0 | 0;
+  i64toi32_i32$0 = i64toi32_i32$3 - i64toi32_i32$0 | 0;
+  $16$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = $9$hi;
+  i64toi32_i32$3 = $16$hi;
+  i64toi32_i32$3 = __wasm_i64_udiv($9 | 0, i64toi32_i32$0 | 0, i64toi32_i32$2 | 0, i64toi32_i32$3 | 0) | 0;
+  i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
+  $17 = i64toi32_i32$3;
+  $17$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = var$1$hi;
+  i64toi32_i32$0 = var$0$hi;
+  i64toi32_i32$0 = var$1$hi;
+  i64toi32_i32$4 = var$1;
+  i64toi32_i32$3 = var$0$hi;
+  i64toi32_i32$1 = var$0;
+  i64toi32_i32$3 = i64toi32_i32$0 ^ i64toi32_i32$3 | 0;
+  i64toi32_i32$0 = i64toi32_i32$4 ^ i64toi32_i32$1 | 0;
+  i64toi32_i32$4 = 0;
+  i64toi32_i32$1 = 63;
+  i64toi32_i32$2 = i64toi32_i32$1 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$1 & 63 | 0) >>> 0) {
+   i64toi32_i32$4 = i64toi32_i32$3 >> 31 | 0;
+   $21 = i64toi32_i32$3 >> i64toi32_i32$2 | 0;
+  } else {
+   i64toi32_i32$4 = i64toi32_i32$3 >> i64toi32_i32$2 | 0;
+   $21 = (((1 << i64toi32_i32$2 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$2 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$2 | 0) | 0;
+  }
+  var$0 = $21;
+  var$0$hi = i64toi32_i32$4;
+  i64toi32_i32$4 = $17$hi;
+  i64toi32_i32$3 = $17;
+  i64toi32_i32$0 = var$0$hi;
+  i64toi32_i32$1 = var$0;
+  i64toi32_i32$0 = i64toi32_i32$4 ^ i64toi32_i32$0 | 0;
+  $23$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = var$0$hi;
+  i64toi32_i32$0 = $23$hi;
+  i64toi32_i32$4 = i64toi32_i32$3 ^ i64toi32_i32$1 | 0;
+  i64toi32_i32$3 = var$0$hi;
+  i64toi32_i32$2 = i64toi32_i32$4 >>> 0 < i64toi32_i32$1 >>> 0;
+  i64toi32_i32$4 = i64toi32_i32$4 - i64toi32_i32$1 | 0;
+  i64toi32_i32$3 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
+  i64toi32_i32$3 = i64toi32_i32$0 - i64toi32_i32$3 | 0;
+  i64toi32_i32$0 = i64toi32_i32$4;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$3;
+  return i64toi32_i32$0 | 0;
  }
  
  function _ZN17compiler_builtins3int4udiv10divmod_u6417h6026910b5ed08e40E(var$0, var$0$hi, var$1, var$1$hi) {
@@ -1208,7 +1206,7 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$4 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, i64toi32_i32$6 = 0, $37 = 0, $38 = 0, $39 = 0, $40 = 0, $41 = 0, $42 = 0, $43 = 0, $44 = 0, var$8$hi = 0, $45 = 0, $46 = 0, $47 = 0, $48 = 0, var$7$hi = 0, $49 = 0, $63$hi = 0, $65 = 0, $65$hi = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142$hi = 0, $144 = 0, $144$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0;
+  var i64toi32_i32$4 = 0, i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, var$2 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, $35 = 0, $36 = 0, $37 = 0, $38 = 0, $39 = 0, $40 = 0, $41 = 0, $42 = 0, var$8$hi = 0, $43 = 0, $44 = 0, $45 = 0, $46 = 0, var$7$hi = 0, $47 = 0, $63$hi = 0, $65 = 0, $65$hi = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142$hi = 0, $144 = 0, $144$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0;
   label$1 : {
    label$2 : {
     label$3 : {
@@ -1227,12 +1225,12 @@ function asmFunc(global, env, buffer) {
              i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
              if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
               i64toi32_i32$1 = 0;
-              $37 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
+              $35 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
              } else {
               i64toi32_i32$1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-              $37 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+              $35 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
              }
-             var$2 = $37;
+             var$2 = $35;
              if (var$2) {
               block : {
                i64toi32_i32$1 = var$1$hi;
@@ -1247,12 +1245,12 @@ function asmFunc(global, env, buffer) {
                i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
                if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
                 i64toi32_i32$2 = 0;
-                $38 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
+                $36 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
                } else {
                 i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-                $38 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
+                $36 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
                }
-               var$4 = $38;
+               var$4 = $36;
                if (!var$4) {
                 break label$9
                }
@@ -1289,12 +1287,12 @@ function asmFunc(global, env, buffer) {
             i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
             if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
              i64toi32_i32$1 = 0;
-             $39 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
+             $37 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
             } else {
              i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-             $39 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
+             $37 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
             }
-            var$3 = $39;
+            var$3 = $37;
             i64toi32_i32$1 = var$0$hi;
             if (!var$0) {
              break label$7
@@ -1313,10 +1311,10 @@ function asmFunc(global, env, buffer) {
             i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
             if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
              i64toi32_i32$3 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-             $40 = 0;
+             $38 = 0;
             } else {
              i64toi32_i32$3 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-             $40 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
+             $38 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
             }
             $63$hi = i64toi32_i32$3;
             i64toi32_i32$3 = var$0$hi;
@@ -1327,7 +1325,7 @@ function asmFunc(global, env, buffer) {
             $65 = i64toi32_i32$1 & i64toi32_i32$0 | 0;
             $65$hi = i64toi32_i32$2;
             i64toi32_i32$2 = $63$hi;
-            i64toi32_i32$3 = $40;
+            i64toi32_i32$3 = $38;
             i64toi32_i32$1 = $65$hi;
             i64toi32_i32$0 = $65;
             i64toi32_i32$1 = i64toi32_i32$2 | i64toi32_i32$1 | 0;
@@ -1358,12 +1356,12 @@ function asmFunc(global, env, buffer) {
         i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
         if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
          i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-         $41 = 0;
+         $39 = 0;
         } else {
          i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $41 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
+         $39 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
         }
-        legalfunc$wasm2js_scratch_store_i64($41 | 0, i64toi32_i32$1 | 0);
+        legalfunc$wasm2js_scratch_store_i64($39 | 0, i64toi32_i32$1 | 0);
         i64toi32_i32$1 = 0;
         i64toi32_i32$2 = var$4;
         i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
@@ -1391,12 +1389,12 @@ function asmFunc(global, env, buffer) {
       i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
       if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
        i64toi32_i32$1 = 0;
-       $42 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
+       $40 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
       } else {
        i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-       $42 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
+       $40 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
       }
-      i64toi32_i32$3 = $42;
+      i64toi32_i32$3 = $40;
       i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
       return i64toi32_i32$3 | 0;
      }
@@ -1413,12 +1411,12 @@ function asmFunc(global, env, buffer) {
     i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
     if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
      i64toi32_i32$1 = 0;
-     $43 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
+     $41 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
     } else {
      i64toi32_i32$1 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
-     $43 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+     $41 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
     }
-    var$5 = $43;
+    var$5 = $41;
     var$5$hi = i64toi32_i32$1;
     i64toi32_i32$1 = var$0$hi;
     i64toi32_i32$1 = 0;
@@ -1430,12 +1428,12 @@ function asmFunc(global, env, buffer) {
     i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
     if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
      i64toi32_i32$2 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
-     $44 = 0;
+     $42 = 0;
     } else {
      i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$3 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-     $44 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
+     $42 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
     }
-    var$0 = $44;
+    var$0 = $42;
     var$0$hi = i64toi32_i32$2;
     label$13 : {
      if (var$2) {
@@ -1444,121 +1442,121 @@ function asmFunc(global, env, buffer) {
        i64toi32_i32$1 = var$1;
        i64toi32_i32$3 = -1;
        i64toi32_i32$0 = -1;
-       i64toi32_i32$4 = i64toi32_i32$1 + i64toi32_i32$0 | 0;
-       i64toi32_i32$5 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
-       if (i64toi32_i32$4 >>> 0 < i64toi32_i32$0 >>> 0) {
-        i64toi32_i32$5 = i64toi32_i32$5 + 1 | 0
+       i64toi32_i32$1 = i64toi32_i32$1 + i64toi32_i32$0 | 0;
+       i64toi32_i32$2 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
+       if (i64toi32_i32$1 >>> 0 < i64toi32_i32$0 >>> 0) {
+        i64toi32_i32$2 = i64toi32_i32$2 + 1 | 0
        }
-       var$8 = i64toi32_i32$4;
-       var$8$hi = i64toi32_i32$5;
+       var$8 = i64toi32_i32$1;
+       var$8$hi = i64toi32_i32$2;
        label$15 : while (1) {
-        i64toi32_i32$5 = var$5$hi;
-        i64toi32_i32$2 = var$5;
-        i64toi32_i32$1 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
-         $45 = 0;
+        i64toi32_i32$2 = var$5$hi;
+        i64toi32_i32$3 = var$5;
+        i64toi32_i32$0 = 0;
+        i64toi32_i32$1 = 1;
+        i64toi32_i32$4 = i64toi32_i32$1 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$1 & 63 | 0) >>> 0) {
+         i64toi32_i32$0 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
+         $43 = 0;
         } else {
-         i64toi32_i32$1 = ((1 << i64toi32_i32$3 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$3 | 0) | 0) | 0 | (i64toi32_i32$5 << i64toi32_i32$3 | 0) | 0;
-         $45 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
+         i64toi32_i32$0 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$3 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$2 << i64toi32_i32$4 | 0) | 0;
+         $43 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
         }
-        $140 = $45;
-        $140$hi = i64toi32_i32$1;
-        i64toi32_i32$1 = var$0$hi;
-        i64toi32_i32$5 = var$0;
-        i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 63;
-        i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = 0;
-         $46 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
+        $140 = $43;
+        $140$hi = i64toi32_i32$0;
+        i64toi32_i32$0 = var$0$hi;
+        i64toi32_i32$2 = var$0;
+        i64toi32_i32$3 = 0;
+        i64toi32_i32$1 = 63;
+        i64toi32_i32$4 = i64toi32_i32$1 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$1 & 63 | 0) >>> 0) {
+         i64toi32_i32$3 = 0;
+         $44 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
         } else {
-         i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
-         $46 = (((1 << i64toi32_i32$3 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$3 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$3 | 0) | 0;
+         i64toi32_i32$3 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
+         $44 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
         }
-        $142$hi = i64toi32_i32$2;
-        i64toi32_i32$2 = $140$hi;
-        i64toi32_i32$1 = $140;
-        i64toi32_i32$5 = $142$hi;
-        i64toi32_i32$0 = $46;
-        i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
-        var$5 = i64toi32_i32$1 | i64toi32_i32$0 | 0;
-        var$5$hi = i64toi32_i32$5;
+        $142$hi = i64toi32_i32$3;
+        i64toi32_i32$3 = $140$hi;
+        i64toi32_i32$0 = $140;
+        i64toi32_i32$2 = $142$hi;
+        i64toi32_i32$1 = $44;
+        i64toi32_i32$2 = i64toi32_i32$3 | i64toi32_i32$2 | 0;
+        var$5 = i64toi32_i32$0 | i64toi32_i32$1 | 0;
+        var$5$hi = i64toi32_i32$2;
         $144 = var$5;
-        $144$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = var$8$hi;
-        i64toi32_i32$5 = var$5$hi;
-        i64toi32_i32$5 = var$8$hi;
-        i64toi32_i32$2 = var$8;
-        i64toi32_i32$1 = var$5$hi;
-        i64toi32_i32$0 = var$5;
-        i64toi32_i32$3 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
-        i64toi32_i32$6 = i64toi32_i32$2 >>> 0 < i64toi32_i32$0 >>> 0;
-        i64toi32_i32$4 = i64toi32_i32$6 + i64toi32_i32$1 | 0;
-        i64toi32_i32$4 = i64toi32_i32$5 - i64toi32_i32$4 | 0;
-        i64toi32_i32$5 = i64toi32_i32$3;
+        $144$hi = i64toi32_i32$2;
+        i64toi32_i32$2 = var$8$hi;
+        i64toi32_i32$2 = var$5$hi;
+        i64toi32_i32$2 = var$8$hi;
+        i64toi32_i32$3 = var$8;
+        i64toi32_i32$0 = var$5$hi;
+        i64toi32_i32$1 = var$5;
+        i64toi32_i32$4 = i64toi32_i32$3 >>> 0 < i64toi32_i32$1 >>> 0;
+        i64toi32_i32$3 = i64toi32_i32$3 - i64toi32_i32$1 | 0;
+        i64toi32_i32$0 = i64toi32_i32$4 + i64toi32_i32$0 | 0;
+        i64toi32_i32$0 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
+        i64toi32_i32$1 = i64toi32_i32$3;
         i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 63;
-        i64toi32_i32$1 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = i64toi32_i32$4 >> 31 | 0;
-         $47 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
+        i64toi32_i32$4 = 63;
+        i64toi32_i32$3 = i64toi32_i32$4 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$4 & 63 | 0) >>> 0) {
+         i64toi32_i32$2 = i64toi32_i32$0 >> 31 | 0;
+         $45 = i64toi32_i32$0 >> i64toi32_i32$3 | 0;
         } else {
-         i64toi32_i32$2 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
-         $47 = (((1 << i64toi32_i32$1 | 0) - 1 | 0) & i64toi32_i32$4 | 0) << (32 - i64toi32_i32$1 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$1 | 0) | 0;
+         i64toi32_i32$2 = i64toi32_i32$0 >> i64toi32_i32$3 | 0;
+         $45 = (((1 << i64toi32_i32$3 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$3 | 0) | 0 | (i64toi32_i32$1 >>> i64toi32_i32$3 | 0) | 0;
         }
-        var$6 = $47;
+        var$6 = $45;
         var$6$hi = i64toi32_i32$2;
         i64toi32_i32$2 = var$1$hi;
         i64toi32_i32$2 = var$6$hi;
-        i64toi32_i32$4 = var$6;
-        i64toi32_i32$5 = var$1$hi;
-        i64toi32_i32$0 = var$1;
-        i64toi32_i32$5 = i64toi32_i32$2 & i64toi32_i32$5 | 0;
-        $151 = i64toi32_i32$4 & i64toi32_i32$0 | 0;
-        $151$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = $144$hi;
+        i64toi32_i32$0 = var$6;
+        i64toi32_i32$1 = var$1$hi;
+        i64toi32_i32$4 = var$1;
+        i64toi32_i32$1 = i64toi32_i32$2 & i64toi32_i32$1 | 0;
+        $151 = i64toi32_i32$0 & i64toi32_i32$4 | 0;
+        $151$hi = i64toi32_i32$1;
+        i64toi32_i32$1 = $144$hi;
         i64toi32_i32$2 = $144;
-        i64toi32_i32$4 = $151$hi;
-        i64toi32_i32$0 = $151;
-        i64toi32_i32$1 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
-        i64toi32_i32$6 = i64toi32_i32$2 >>> 0 < i64toi32_i32$0 >>> 0;
-        i64toi32_i32$3 = i64toi32_i32$6 + i64toi32_i32$4 | 0;
-        i64toi32_i32$3 = i64toi32_i32$5 - i64toi32_i32$3 | 0;
-        var$5 = i64toi32_i32$1;
-        var$5$hi = i64toi32_i32$3;
-        i64toi32_i32$3 = var$0$hi;
-        i64toi32_i32$5 = var$0;
-        i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-         $48 = 0;
+        i64toi32_i32$0 = $151$hi;
+        i64toi32_i32$4 = $151;
+        i64toi32_i32$3 = i64toi32_i32$2 >>> 0 < i64toi32_i32$4 >>> 0;
+        i64toi32_i32$2 = i64toi32_i32$2 - i64toi32_i32$4 | 0;
+        i64toi32_i32$0 = i64toi32_i32$3 + i64toi32_i32$0 | 0;
+        i64toi32_i32$0 = i64toi32_i32$1 - i64toi32_i32$0 | 0;
+        var$5 = i64toi32_i32$2;
+        var$5$hi = i64toi32_i32$0;
+        i64toi32_i32$0 = var$0$hi;
+        i64toi32_i32$4 = var$0;
+        i64toi32_i32$1 = 0;
+        i64toi32_i32$3 = 1;
+        i64toi32_i32$2 = i64toi32_i32$3 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
+         i64toi32_i32$1 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
+         $46 = 0;
         } else {
-         i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $48 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
+         i64toi32_i32$1 = ((1 << i64toi32_i32$2 | 0) - 1 | 0) & (i64toi32_i32$4 >>> (32 - i64toi32_i32$2 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$2 | 0) | 0;
+         $46 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
         }
-        $154$hi = i64toi32_i32$2;
-        i64toi32_i32$2 = var$7$hi;
-        i64toi32_i32$2 = $154$hi;
-        i64toi32_i32$3 = $48;
-        i64toi32_i32$5 = var$7$hi;
-        i64toi32_i32$0 = var$7;
-        i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
-        var$0 = i64toi32_i32$3 | i64toi32_i32$0 | 0;
-        var$0$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = var$6$hi;
-        i64toi32_i32$2 = var$6;
-        i64toi32_i32$3 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$3 = i64toi32_i32$5 & i64toi32_i32$3 | 0;
-        var$6 = i64toi32_i32$2 & i64toi32_i32$0 | 0;
-        var$6$hi = i64toi32_i32$3;
+        $154$hi = i64toi32_i32$1;
+        i64toi32_i32$1 = var$7$hi;
+        i64toi32_i32$1 = $154$hi;
+        i64toi32_i32$0 = $46;
+        i64toi32_i32$4 = var$7$hi;
+        i64toi32_i32$3 = var$7;
+        i64toi32_i32$4 = i64toi32_i32$1 | i64toi32_i32$4 | 0;
+        var$0 = i64toi32_i32$0 | i64toi32_i32$3 | 0;
+        var$0$hi = i64toi32_i32$4;
+        i64toi32_i32$4 = var$6$hi;
+        i64toi32_i32$1 = var$6;
+        i64toi32_i32$0 = 0;
+        i64toi32_i32$3 = 1;
+        i64toi32_i32$0 = i64toi32_i32$4 & i64toi32_i32$0 | 0;
+        var$6 = i64toi32_i32$1 & i64toi32_i32$3 | 0;
+        var$6$hi = i64toi32_i32$0;
         var$7 = var$6;
-        var$7$hi = i64toi32_i32$3;
+        var$7$hi = i64toi32_i32$0;
         var$2 = var$2 + -1 | 0;
         if (var$2) {
          continue label$15
@@ -1569,41 +1567,41 @@ function asmFunc(global, env, buffer) {
       }
      }
     }
-    i64toi32_i32$3 = var$5$hi;
-    legalfunc$wasm2js_scratch_store_i64(var$5 | 0, i64toi32_i32$3 | 0);
-    i64toi32_i32$3 = var$0$hi;
-    i64toi32_i32$5 = var$0;
-    i64toi32_i32$2 = 0;
-    i64toi32_i32$0 = 1;
-    i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-    if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-     i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-     $49 = 0;
+    i64toi32_i32$0 = var$5$hi;
+    legalfunc$wasm2js_scratch_store_i64(var$5 | 0, i64toi32_i32$0 | 0);
+    i64toi32_i32$0 = var$0$hi;
+    i64toi32_i32$4 = var$0;
+    i64toi32_i32$1 = 0;
+    i64toi32_i32$3 = 1;
+    i64toi32_i32$2 = i64toi32_i32$3 & 31 | 0;
+    if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
+     i64toi32_i32$1 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
+     $47 = 0;
     } else {
-     i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-     $49 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
+     i64toi32_i32$1 = ((1 << i64toi32_i32$2 | 0) - 1 | 0) & (i64toi32_i32$4 >>> (32 - i64toi32_i32$2 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$2 | 0) | 0;
+     $47 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
     }
-    $165$hi = i64toi32_i32$2;
-    i64toi32_i32$2 = var$6$hi;
-    i64toi32_i32$2 = $165$hi;
-    i64toi32_i32$3 = $49;
-    i64toi32_i32$5 = var$6$hi;
-    i64toi32_i32$0 = var$6;
-    i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
-    i64toi32_i32$3 = i64toi32_i32$3 | i64toi32_i32$0 | 0;
-    i64toi32_i32$HIGH_BITS = i64toi32_i32$5;
-    return i64toi32_i32$3 | 0;
+    $165$hi = i64toi32_i32$1;
+    i64toi32_i32$1 = var$6$hi;
+    i64toi32_i32$1 = $165$hi;
+    i64toi32_i32$0 = $47;
+    i64toi32_i32$4 = var$6$hi;
+    i64toi32_i32$3 = var$6;
+    i64toi32_i32$4 = i64toi32_i32$1 | i64toi32_i32$4 | 0;
+    i64toi32_i32$0 = i64toi32_i32$0 | i64toi32_i32$3 | 0;
+    i64toi32_i32$HIGH_BITS = i64toi32_i32$4;
+    return i64toi32_i32$0 | 0;
    }
-   i64toi32_i32$3 = var$0$hi;
-   legalfunc$wasm2js_scratch_store_i64(var$0 | 0, i64toi32_i32$3 | 0);
-   i64toi32_i32$3 = 0;
+   i64toi32_i32$0 = var$0$hi;
+   legalfunc$wasm2js_scratch_store_i64(var$0 | 0, i64toi32_i32$0 | 0);
+   i64toi32_i32$0 = 0;
    var$0 = 0;
-   var$0$hi = i64toi32_i32$3;
+   var$0$hi = i64toi32_i32$0;
   }
-  i64toi32_i32$3 = var$0$hi;
-  i64toi32_i32$5 = var$0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$3;
-  return i64toi32_i32$5 | 0;
+  i64toi32_i32$0 = var$0$hi;
+  i64toi32_i32$4 = var$0;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
+  return i64toi32_i32$4 | 0;
  }
  
  function __wasm_i64_mul(var$0, var$0$hi, var$1, var$1$hi) {
@@ -1862,7 +1860,7 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$2$hi = 0, i64toi32_i32$6 = 0, $21 = 0, $22 = 0, $23 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17 = 0, $17$hi = 0, $23$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$4 = 0, var$2 = 0, var$2$hi = 0, $19 = 0, $20 = 0, $21 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17 = 0, $17$hi = 0, $23$hi = 0;
   i64toi32_i32$0 = var$0$hi;
   i64toi32_i32$2 = var$0;
   i64toi32_i32$1 = 0;
@@ -1870,12 +1868,12 @@ function asmFunc(global, env, buffer) {
   i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
   if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
    i64toi32_i32$1 = i64toi32_i32$0 >> 31 | 0;
-   $21 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
+   $19 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
   } else {
    i64toi32_i32$1 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
-   $21 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+   $19 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
   }
-  var$2 = $21;
+  var$2 = $19;
   var$2$hi = i64toi32_i32$1;
   i64toi32_i32$1 = var$0$hi;
   i64toi32_i32$1 = var$2$hi;
@@ -1889,86 +1887,86 @@ function asmFunc(global, env, buffer) {
   i64toi32_i32$1 = i64toi32_i32$0 ^ i64toi32_i32$3 | 0;
   i64toi32_i32$0 = var$2$hi;
   i64toi32_i32$3 = var$2;
-  i64toi32_i32$4 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$5 = i64toi32_i32$6 + i64toi32_i32$0 | 0;
-  i64toi32_i32$5 = i64toi32_i32$2 - i64toi32_i32$5 | 0;
-  $9 = i64toi32_i32$4;
-  $9$hi = i64toi32_i32$5;
-  i64toi32_i32$5 = var$1$hi;
-  i64toi32_i32$2 = var$1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$0 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$5 >> 31 | 0;
-   $22 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
-  } else {
-   i64toi32_i32$1 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
-   $22 = (((1 << i64toi32_i32$0 | 0) - 1 | 0) & i64toi32_i32$5 | 0) << (32 - i64toi32_i32$0 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$0 | 0) | 0;
-  }
-  var$2 = $22;
-  var$2$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$1$hi;
-  i64toi32_i32$1 = var$2$hi;
-  i64toi32_i32$5 = var$2;
-  i64toi32_i32$2 = var$1$hi;
+  i64toi32_i32$4 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
+  i64toi32_i32$1 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
+  i64toi32_i32$0 = i64toi32_i32$4 + i64toi32_i32$0 | 0;
+  i64toi32_i32$0 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
+  $9 = i64toi32_i32$1;
+  $9$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = var$1$hi;
   i64toi32_i32$3 = var$1;
-  i64toi32_i32$2 = i64toi32_i32$1 ^ i64toi32_i32$2 | 0;
-  $14$hi = i64toi32_i32$2;
-  i64toi32_i32$2 = i64toi32_i32$1;
-  i64toi32_i32$2 = $14$hi;
-  i64toi32_i32$1 = i64toi32_i32$5 ^ i64toi32_i32$3 | 0;
-  i64toi32_i32$5 = var$2$hi;
-  i64toi32_i32$3 = var$2;
-  i64toi32_i32$0 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$4 = i64toi32_i32$6 + i64toi32_i32$5 | 0;
-  i64toi32_i32$4 = i64toi32_i32$2 - i64toi32_i32$4 | 0;
-  $16$hi = i64toi32_i32$4;
-  i64toi32_i32$4 = $9$hi;
-  i64toi32_i32$1 = $16$hi;
-  i64toi32_i32$1 = __wasm_i64_udiv($9 | 0, i64toi32_i32$4 | 0, i64toi32_i32$0 | 0, i64toi32_i32$1 | 0) | 0;
-  i64toi32_i32$4 = i64toi32_i32$HIGH_BITS;
-  $17 = i64toi32_i32$1;
-  $17$hi = i64toi32_i32$4;
-  i64toi32_i32$4 = var$1$hi;
-  i64toi32_i32$4 = var$0$hi;
-  i64toi32_i32$4 = var$1$hi;
-  i64toi32_i32$2 = var$1;
-  i64toi32_i32$1 = var$0$hi;
-  i64toi32_i32$3 = var$0;
-  i64toi32_i32$1 = i64toi32_i32$4 ^ i64toi32_i32$1 | 0;
-  i64toi32_i32$4 = i64toi32_i32$2 ^ i64toi32_i32$3 | 0;
   i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$5 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = i64toi32_i32$1 >> 31 | 0;
-   $23 = i64toi32_i32$1 >> i64toi32_i32$5 | 0;
+  i64toi32_i32$4 = 63;
+  i64toi32_i32$1 = i64toi32_i32$4 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$4 & 63 | 0) >>> 0) {
+   i64toi32_i32$2 = i64toi32_i32$0 >> 31 | 0;
+   $20 = i64toi32_i32$0 >> i64toi32_i32$1 | 0;
   } else {
-   i64toi32_i32$2 = i64toi32_i32$1 >> i64toi32_i32$5 | 0;
-   $23 = (((1 << i64toi32_i32$5 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$5 | 0) | 0 | (i64toi32_i32$4 >>> i64toi32_i32$5 | 0) | 0;
+   i64toi32_i32$2 = i64toi32_i32$0 >> i64toi32_i32$1 | 0;
+   $20 = (((1 << i64toi32_i32$1 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$1 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$1 | 0) | 0;
   }
-  var$0 = $23;
-  var$0$hi = i64toi32_i32$2;
-  i64toi32_i32$2 = $17$hi;
-  i64toi32_i32$1 = $17;
-  i64toi32_i32$4 = var$0$hi;
-  i64toi32_i32$3 = var$0;
-  i64toi32_i32$4 = i64toi32_i32$2 ^ i64toi32_i32$4 | 0;
-  $23$hi = i64toi32_i32$4;
-  i64toi32_i32$4 = var$0$hi;
-  i64toi32_i32$4 = $23$hi;
-  i64toi32_i32$2 = i64toi32_i32$1 ^ i64toi32_i32$3 | 0;
-  i64toi32_i32$1 = var$0$hi;
-  i64toi32_i32$5 = i64toi32_i32$2 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$2 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$0 = i64toi32_i32$6 + i64toi32_i32$1 | 0;
-  i64toi32_i32$0 = i64toi32_i32$4 - i64toi32_i32$0 | 0;
-  i64toi32_i32$2 = i64toi32_i32$5;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
-  return i64toi32_i32$2 | 0;
+  var$2 = $20;
+  var$2$hi = i64toi32_i32$2;
+  i64toi32_i32$2 = var$1$hi;
+  i64toi32_i32$2 = var$2$hi;
+  i64toi32_i32$0 = var$2;
+  i64toi32_i32$3 = var$1$hi;
+  i64toi32_i32$4 = var$1;
+  i64toi32_i32$3 = i64toi32_i32$2 ^ i64toi32_i32$3 | 0;
+  $14$hi = i64toi32_i32$3;
+  i64toi32_i32$3 = i64toi32_i32$2;
+  i64toi32_i32$3 = $14$hi;
+  i64toi32_i32$2 = i64toi32_i32$0 ^ i64toi32_i32$4 | 0;
+  i64toi32_i32$0 = var$2$hi;
+  i64toi32_i32$4 = var$2;
+  i64toi32_i32$1 = i64toi32_i32$2 >>> 0 < i64toi32_i32$4 >>> 0;
+  i64toi32_i32$2 = i64toi32_i32$2 - i64toi32_i32$4 | 0;
+  i64toi32_i32$0 = i64toi32_i32$1 + i64toi32_i32$0 | 0;
+  i64toi32_i32$0 = i64toi32_i32$3 - i64toi32_i32$0 | 0;
+  $16$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = $9$hi;
+  i64toi32_i32$3 = $16$hi;
+  i64toi32_i32$3 = __wasm_i64_udiv($9 | 0, i64toi32_i32$0 | 0, i64toi32_i32$2 | 0, i64toi32_i32$3 | 0) | 0;
+  i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
+  $17 = i64toi32_i32$3;
+  $17$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = var$1$hi;
+  i64toi32_i32$0 = var$0$hi;
+  i64toi32_i32$0 = var$1$hi;
+  i64toi32_i32$4 = var$1;
+  i64toi32_i32$3 = var$0$hi;
+  i64toi32_i32$1 = var$0;
+  i64toi32_i32$3 = i64toi32_i32$0 ^ i64toi32_i32$3 | 0;
+  i64toi32_i32$0 = i64toi32_i32$4 ^ i64toi32_i32$1 | 0;
+  i64toi32_i32$4 = 0;
+  i64toi32_i32$1 = 63;
+  i64toi32_i32$2 = i64toi32_i32$1 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$1 & 63 | 0) >>> 0) {
+   i64toi32_i32$4 = i64toi32_i32$3 >> 31 | 0;
+   $21 = i64toi32_i32$3 >> i64toi32_i32$2 | 0;
+  } else {
+   i64toi32_i32$4 = i64toi32_i32$3 >> i64toi32_i32$2 | 0;
+   $21 = (((1 << i64toi32_i32$2 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$2 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$2 | 0) | 0;
+  }
+  var$0 = $21;
+  var$0$hi = i64toi32_i32$4;
+  i64toi32_i32$4 = $17$hi;
+  i64toi32_i32$3 = $17;
+  i64toi32_i32$0 = var$0$hi;
+  i64toi32_i32$1 = var$0;
+  i64toi32_i32$0 = i64toi32_i32$4 ^ i64toi32_i32$0 | 0;
+  $23$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = var$0$hi;
+  i64toi32_i32$0 = $23$hi;
+  i64toi32_i32$4 = i64toi32_i32$3 ^ i64toi32_i32$1 | 0;
+  i64toi32_i32$3 = var$0$hi;
+  i64toi32_i32$2 = i64toi32_i32$4 >>> 0 < i64toi32_i32$1 >>> 0;
+  i64toi32_i32$4 = i64toi32_i32$4 - i64toi32_i32$1 | 0;
+  i64toi32_i32$3 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
+  i64toi32_i32$3 = i64toi32_i32$0 - i64toi32_i32$3 | 0;
+  i64toi32_i32$0 = i64toi32_i32$4;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$3;
+  return i64toi32_i32$0 | 0;
  }
  
  function _ZN17compiler_builtins3int4udiv10divmod_u6417h6026910b5ed08e40E(var$0, var$0$hi, var$1, var$1$hi) {
@@ -1976,7 +1974,7 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$4 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, i64toi32_i32$6 = 0, $37 = 0, $38 = 0, $39 = 0, $40 = 0, $41 = 0, $42 = 0, $43 = 0, $44 = 0, var$8$hi = 0, $45 = 0, $46 = 0, $47 = 0, $48 = 0, var$7$hi = 0, $49 = 0, $63$hi = 0, $65 = 0, $65$hi = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142$hi = 0, $144 = 0, $144$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0;
+  var i64toi32_i32$4 = 0, i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, var$2 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, $35 = 0, $36 = 0, $37 = 0, $38 = 0, $39 = 0, $40 = 0, $41 = 0, $42 = 0, var$8$hi = 0, $43 = 0, $44 = 0, $45 = 0, $46 = 0, var$7$hi = 0, $47 = 0, $63$hi = 0, $65 = 0, $65$hi = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142$hi = 0, $144 = 0, $144$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0;
   label$1 : {
    label$2 : {
     label$3 : {
@@ -1995,12 +1993,12 @@ function asmFunc(global, env, buffer) {
              i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
              if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
               i64toi32_i32$1 = 0;
-              $37 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
+              $35 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
              } else {
               i64toi32_i32$1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-              $37 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+              $35 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
              }
-             var$2 = $37;
+             var$2 = $35;
              if (var$2) {
               block : {
                i64toi32_i32$1 = var$1$hi;
@@ -2015,12 +2013,12 @@ function asmFunc(global, env, buffer) {
                i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
                if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
                 i64toi32_i32$2 = 0;
-                $38 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
+                $36 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
                } else {
                 i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-                $38 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
+                $36 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
                }
-               var$4 = $38;
+               var$4 = $36;
                if (!var$4) {
                 break label$9
                }
@@ -2057,12 +2055,12 @@ function asmFunc(global, env, buffer) {
             i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
             if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
              i64toi32_i32$1 = 0;
-             $39 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
+             $37 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
             } else {
              i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-             $39 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
+             $37 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
             }
-            var$3 = $39;
+            var$3 = $37;
             i64toi32_i32$1 = var$0$hi;
             if (!var$0) {
              break label$7
@@ -2081,10 +2079,10 @@ function asmFunc(global, env, buffer) {
             i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
             if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
              i64toi32_i32$3 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-             $40 = 0;
+             $38 = 0;
             } else {
              i64toi32_i32$3 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-             $40 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
+             $38 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
             }
             $63$hi = i64toi32_i32$3;
             i64toi32_i32$3 = var$0$hi;
@@ -2095,7 +2093,7 @@ function asmFunc(global, env, buffer) {
             $65 = i64toi32_i32$1 & i64toi32_i32$0 | 0;
             $65$hi = i64toi32_i32$2;
             i64toi32_i32$2 = $63$hi;
-            i64toi32_i32$3 = $40;
+            i64toi32_i32$3 = $38;
             i64toi32_i32$1 = $65$hi;
             i64toi32_i32$0 = $65;
             i64toi32_i32$1 = i64toi32_i32$2 | i64toi32_i32$1 | 0;
@@ -2126,12 +2124,12 @@ function asmFunc(global, env, buffer) {
         i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
         if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
          i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-         $41 = 0;
+         $39 = 0;
         } else {
          i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $41 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
+         $39 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
         }
-        legalfunc$wasm2js_scratch_store_i64($41 | 0, i64toi32_i32$1 | 0);
+        legalfunc$wasm2js_scratch_store_i64($39 | 0, i64toi32_i32$1 | 0);
         i64toi32_i32$1 = 0;
         i64toi32_i32$2 = var$4;
         i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
@@ -2159,12 +2157,12 @@ function asmFunc(global, env, buffer) {
       i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
       if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
        i64toi32_i32$1 = 0;
-       $42 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
+       $40 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
       } else {
        i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-       $42 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
+       $40 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
       }
-      i64toi32_i32$3 = $42;
+      i64toi32_i32$3 = $40;
       i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
       return i64toi32_i32$3 | 0;
      }
@@ -2181,12 +2179,12 @@ function asmFunc(global, env, buffer) {
     i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
     if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
      i64toi32_i32$1 = 0;
-     $43 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
+     $41 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
     } else {
      i64toi32_i32$1 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
-     $43 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+     $41 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
     }
-    var$5 = $43;
+    var$5 = $41;
     var$5$hi = i64toi32_i32$1;
     i64toi32_i32$1 = var$0$hi;
     i64toi32_i32$1 = 0;
@@ -2198,12 +2196,12 @@ function asmFunc(global, env, buffer) {
     i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
     if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
      i64toi32_i32$2 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
-     $44 = 0;
+     $42 = 0;
     } else {
      i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$3 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-     $44 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
+     $42 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
     }
-    var$0 = $44;
+    var$0 = $42;
     var$0$hi = i64toi32_i32$2;
     label$13 : {
      if (var$2) {
@@ -2212,121 +2210,121 @@ function asmFunc(global, env, buffer) {
        i64toi32_i32$1 = var$1;
        i64toi32_i32$3 = -1;
        i64toi32_i32$0 = -1;
-       i64toi32_i32$4 = i64toi32_i32$1 + i64toi32_i32$0 | 0;
-       i64toi32_i32$5 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
-       if (i64toi32_i32$4 >>> 0 < i64toi32_i32$0 >>> 0) {
-        i64toi32_i32$5 = i64toi32_i32$5 + 1 | 0
+       i64toi32_i32$1 = i64toi32_i32$1 + i64toi32_i32$0 | 0;
+       i64toi32_i32$2 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
+       if (i64toi32_i32$1 >>> 0 < i64toi32_i32$0 >>> 0) {
+        i64toi32_i32$2 = i64toi32_i32$2 + 1 | 0
        }
-       var$8 = i64toi32_i32$4;
-       var$8$hi = i64toi32_i32$5;
+       var$8 = i64toi32_i32$1;
+       var$8$hi = i64toi32_i32$2;
        label$15 : while (1) {
-        i64toi32_i32$5 = var$5$hi;
-        i64toi32_i32$2 = var$5;
-        i64toi32_i32$1 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
-         $45 = 0;
+        i64toi32_i32$2 = var$5$hi;
+        i64toi32_i32$3 = var$5;
+        i64toi32_i32$0 = 0;
+        i64toi32_i32$1 = 1;
+        i64toi32_i32$4 = i64toi32_i32$1 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$1 & 63 | 0) >>> 0) {
+         i64toi32_i32$0 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
+         $43 = 0;
         } else {
-         i64toi32_i32$1 = ((1 << i64toi32_i32$3 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$3 | 0) | 0) | 0 | (i64toi32_i32$5 << i64toi32_i32$3 | 0) | 0;
-         $45 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
+         i64toi32_i32$0 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$3 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$2 << i64toi32_i32$4 | 0) | 0;
+         $43 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
         }
-        $140 = $45;
-        $140$hi = i64toi32_i32$1;
-        i64toi32_i32$1 = var$0$hi;
-        i64toi32_i32$5 = var$0;
-        i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 63;
-        i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = 0;
-         $46 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
+        $140 = $43;
+        $140$hi = i64toi32_i32$0;
+        i64toi32_i32$0 = var$0$hi;
+        i64toi32_i32$2 = var$0;
+        i64toi32_i32$3 = 0;
+        i64toi32_i32$1 = 63;
+        i64toi32_i32$4 = i64toi32_i32$1 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$1 & 63 | 0) >>> 0) {
+         i64toi32_i32$3 = 0;
+         $44 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
         } else {
-         i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
-         $46 = (((1 << i64toi32_i32$3 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$3 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$3 | 0) | 0;
+         i64toi32_i32$3 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
+         $44 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
         }
-        $142$hi = i64toi32_i32$2;
-        i64toi32_i32$2 = $140$hi;
-        i64toi32_i32$1 = $140;
-        i64toi32_i32$5 = $142$hi;
-        i64toi32_i32$0 = $46;
-        i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
-        var$5 = i64toi32_i32$1 | i64toi32_i32$0 | 0;
-        var$5$hi = i64toi32_i32$5;
+        $142$hi = i64toi32_i32$3;
+        i64toi32_i32$3 = $140$hi;
+        i64toi32_i32$0 = $140;
+        i64toi32_i32$2 = $142$hi;
+        i64toi32_i32$1 = $44;
+        i64toi32_i32$2 = i64toi32_i32$3 | i64toi32_i32$2 | 0;
+        var$5 = i64toi32_i32$0 | i64toi32_i32$1 | 0;
+        var$5$hi = i64toi32_i32$2;
         $144 = var$5;
-        $144$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = var$8$hi;
-        i64toi32_i32$5 = var$5$hi;
-        i64toi32_i32$5 = var$8$hi;
-        i64toi32_i32$2 = var$8;
-        i64toi32_i32$1 = var$5$hi;
-        i64toi32_i32$0 = var$5;
-        i64toi32_i32$3 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
-        i64toi32_i32$6 = i64toi32_i32$2 >>> 0 < i64toi32_i32$0 >>> 0;
-        i64toi32_i32$4 = i64toi32_i32$6 + i64toi32_i32$1 | 0;
-        i64toi32_i32$4 = i64toi32_i32$5 - i64toi32_i32$4 | 0;
-        i64toi32_i32$5 = i64toi32_i32$3;
+        $144$hi = i64toi32_i32$2;
+        i64toi32_i32$2 = var$8$hi;
+        i64toi32_i32$2 = var$5$hi;
+        i64toi32_i32$2 = var$8$hi;
+        i64toi32_i32$3 = var$8;
+        i64toi32_i32$0 = var$5$hi;
+        i64toi32_i32$1 = var$5;
+        i64toi32_i32$4 = i64toi32_i32$3 >>> 0 < i64toi32_i32$1 >>> 0;
+        i64toi32_i32$3 = i64toi32_i32$3 - i64toi32_i32$1 | 0;
+        i64toi32_i32$0 = i64toi32_i32$4 + i64toi32_i32$0 | 0;
+        i64toi32_i32$0 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
+        i64toi32_i32$1 = i64toi32_i32$3;
         i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 63;
-        i64toi32_i32$1 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = i64toi32_i32$4 >> 31 | 0;
-         $47 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
+        i64toi32_i32$4 = 63;
+        i64toi32_i32$3 = i64toi32_i32$4 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$4 & 63 | 0) >>> 0) {
+         i64toi32_i32$2 = i64toi32_i32$0 >> 31 | 0;
+         $45 = i64toi32_i32$0 >> i64toi32_i32$3 | 0;
         } else {
-         i64toi32_i32$2 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
-         $47 = (((1 << i64toi32_i32$1 | 0) - 1 | 0) & i64toi32_i32$4 | 0) << (32 - i64toi32_i32$1 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$1 | 0) | 0;
+         i64toi32_i32$2 = i64toi32_i32$0 >> i64toi32_i32$3 | 0;
+         $45 = (((1 << i64toi32_i32$3 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$3 | 0) | 0 | (i64toi32_i32$1 >>> i64toi32_i32$3 | 0) | 0;
         }
-        var$6 = $47;
+        var$6 = $45;
         var$6$hi = i64toi32_i32$2;
         i64toi32_i32$2 = var$1$hi;
         i64toi32_i32$2 = var$6$hi;
-        i64toi32_i32$4 = var$6;
-        i64toi32_i32$5 = var$1$hi;
-        i64toi32_i32$0 = var$1;
-        i64toi32_i32$5 = i64toi32_i32$2 & i64toi32_i32$5 | 0;
-        $151 = i64toi32_i32$4 & i64toi32_i32$0 | 0;
-        $151$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = $144$hi;
+        i64toi32_i32$0 = var$6;
+        i64toi32_i32$1 = var$1$hi;
+        i64toi32_i32$4 = var$1;
+        i64toi32_i32$1 = i64toi32_i32$2 & i64toi32_i32$1 | 0;
+        $151 = i64toi32_i32$0 & i64toi32_i32$4 | 0;
+        $151$hi = i64toi32_i32$1;
+        i64toi32_i32$1 = $144$hi;
         i64toi32_i32$2 = $144;
-        i64toi32_i32$4 = $151$hi;
-        i64toi32_i32$0 = $151;
-        i64toi32_i32$1 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
-        i64toi32_i32$6 = i64toi32_i32$2 >>> 0 < i64toi32_i32$0 >>> 0;
-        i64toi32_i32$3 = i64toi32_i32$6 + i64toi32_i32$4 | 0;
-        i64toi32_i32$3 = i64toi32_i32$5 - i64toi32_i32$3 | 0;
-        var$5 = i64toi32_i32$1;
-        var$5$hi = i64toi32_i32$3;
-        i64toi32_i32$3 = var$0$hi;
-        i64toi32_i32$5 = var$0;
-        i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-         $48 = 0;
+        i64toi32_i32$0 = $151$hi;
+        i64toi32_i32$4 = $151;
+        i64toi32_i32$3 = i64toi32_i32$2 >>> 0 < i64toi32_i32$4 >>> 0;
+        i64toi32_i32$2 = i64toi32_i32$2 - i64toi32_i32$4 | 0;
+        i64toi32_i32$0 = i64toi32_i32$3 + i64toi32_i32$0 | 0;
+        i64toi32_i32$0 = i64toi32_i32$1 - i64toi32_i32$0 | 0;
+        var$5 = i64toi32_i32$2;
+        var$5$hi = i64toi32_i32$0;
+        i64toi32_i32$0 = var$0$hi;
+        i64toi32_i32$4 = var$0;
+        i64toi32_i32$1 = 0;
+        i64toi32_i32$3 = 1;
+        i64toi32_i32$2 = i64toi32_i32$3 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
+         i64toi32_i32$1 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
+         $46 = 0;
         } else {
-         i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $48 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
+         i64toi32_i32$1 = ((1 << i64toi32_i32$2 | 0) - 1 | 0) & (i64toi32_i32$4 >>> (32 - i64toi32_i32$2 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$2 | 0) | 0;
+         $46 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
         }
-        $154$hi = i64toi32_i32$2;
-        i64toi32_i32$2 = var$7$hi;
-        i64toi32_i32$2 = $154$hi;
-        i64toi32_i32$3 = $48;
-        i64toi32_i32$5 = var$7$hi;
-        i64toi32_i32$0 = var$7;
-        i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
-        var$0 = i64toi32_i32$3 | i64toi32_i32$0 | 0;
-        var$0$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = var$6$hi;
-        i64toi32_i32$2 = var$6;
-        i64toi32_i32$3 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$3 = i64toi32_i32$5 & i64toi32_i32$3 | 0;
-        var$6 = i64toi32_i32$2 & i64toi32_i32$0 | 0;
-        var$6$hi = i64toi32_i32$3;
+        $154$hi = i64toi32_i32$1;
+        i64toi32_i32$1 = var$7$hi;
+        i64toi32_i32$1 = $154$hi;
+        i64toi32_i32$0 = $46;
+        i64toi32_i32$4 = var$7$hi;
+        i64toi32_i32$3 = var$7;
+        i64toi32_i32$4 = i64toi32_i32$1 | i64toi32_i32$4 | 0;
+        var$0 = i64toi32_i32$0 | i64toi32_i32$3 | 0;
+        var$0$hi = i64toi32_i32$4;
+        i64toi32_i32$4 = var$6$hi;
+        i64toi32_i32$1 = var$6;
+        i64toi32_i32$0 = 0;
+        i64toi32_i32$3 = 1;
+        i64toi32_i32$0 = i64toi32_i32$4 & i64toi32_i32$0 | 0;
+        var$6 = i64toi32_i32$1 & i64toi32_i32$3 | 0;
+        var$6$hi = i64toi32_i32$0;
         var$7 = var$6;
-        var$7$hi = i64toi32_i32$3;
+        var$7$hi = i64toi32_i32$0;
         var$2 = var$2 + -1 | 0;
         if (var$2) {
          continue label$15
@@ -2337,41 +2335,41 @@ function asmFunc(global, env, buffer) {
       }
      }
     }
-    i64toi32_i32$3 = var$5$hi;
-    legalfunc$wasm2js_scratch_store_i64(var$5 | 0, i64toi32_i32$3 | 0);
-    i64toi32_i32$3 = var$0$hi;
-    i64toi32_i32$5 = var$0;
-    i64toi32_i32$2 = 0;
-    i64toi32_i32$0 = 1;
-    i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-    if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-     i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-     $49 = 0;
+    i64toi32_i32$0 = var$5$hi;
+    legalfunc$wasm2js_scratch_store_i64(var$5 | 0, i64toi32_i32$0 | 0);
+    i64toi32_i32$0 = var$0$hi;
+    i64toi32_i32$4 = var$0;
+    i64toi32_i32$1 = 0;
+    i64toi32_i32$3 = 1;
+    i64toi32_i32$2 = i64toi32_i32$3 & 31 | 0;
+    if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
+     i64toi32_i32$1 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
+     $47 = 0;
     } else {
-     i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-     $49 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
+     i64toi32_i32$1 = ((1 << i64toi32_i32$2 | 0) - 1 | 0) & (i64toi32_i32$4 >>> (32 - i64toi32_i32$2 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$2 | 0) | 0;
+     $47 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
     }
-    $165$hi = i64toi32_i32$2;
-    i64toi32_i32$2 = var$6$hi;
-    i64toi32_i32$2 = $165$hi;
-    i64toi32_i32$3 = $49;
-    i64toi32_i32$5 = var$6$hi;
-    i64toi32_i32$0 = var$6;
-    i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
-    i64toi32_i32$3 = i64toi32_i32$3 | i64toi32_i32$0 | 0;
-    i64toi32_i32$HIGH_BITS = i64toi32_i32$5;
-    return i64toi32_i32$3 | 0;
+    $165$hi = i64toi32_i32$1;
+    i64toi32_i32$1 = var$6$hi;
+    i64toi32_i32$1 = $165$hi;
+    i64toi32_i32$0 = $47;
+    i64toi32_i32$4 = var$6$hi;
+    i64toi32_i32$3 = var$6;
+    i64toi32_i32$4 = i64toi32_i32$1 | i64toi32_i32$4 | 0;
+    i64toi32_i32$0 = i64toi32_i32$0 | i64toi32_i32$3 | 0;
+    i64toi32_i32$HIGH_BITS = i64toi32_i32$4;
+    return i64toi32_i32$0 | 0;
    }
-   i64toi32_i32$3 = var$0$hi;
-   legalfunc$wasm2js_scratch_store_i64(var$0 | 0, i64toi32_i32$3 | 0);
-   i64toi32_i32$3 = 0;
+   i64toi32_i32$0 = var$0$hi;
+   legalfunc$wasm2js_scratch_store_i64(var$0 | 0, i64toi32_i32$0 | 0);
+   i64toi32_i32$0 = 0;
    var$0 = 0;
-   var$0$hi = i64toi32_i32$3;
+   var$0$hi = i64toi32_i32$0;
   }
-  i64toi32_i32$3 = var$0$hi;
-  i64toi32_i32$5 = var$0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$3;
-  return i64toi32_i32$5 | 0;
+  i64toi32_i32$0 = var$0$hi;
+  i64toi32_i32$4 = var$0;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
+  return i64toi32_i32$4 | 0;
  }
  
  function __wasm_i64_sdiv(var$0, var$0$hi, var$1, var$1$hi) {
@@ -2649,7 +2647,7 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$1 = 0, i64toi32_i32$4 = 0, i64toi32_i32$2 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, i64toi32_i32$5 = 0, var$2$hi = 0, i64toi32_i32$6 = 0, var$2 = 0, $20 = 0, $21 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17$hi = 0, $19$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, var$2$hi = 0, var$2 = 0, $18 = 0, $19 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17$hi = 0, $19$hi = 0;
   i64toi32_i32$0 = var$0$hi;
   i64toi32_i32$2 = var$0;
   i64toi32_i32$1 = 0;
@@ -2657,12 +2655,12 @@ function asmFunc(global, env, buffer) {
   i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
   if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
    i64toi32_i32$1 = i64toi32_i32$0 >> 31 | 0;
-   $20 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
+   $18 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
   } else {
    i64toi32_i32$1 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
-   $20 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+   $18 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
   }
-  var$2 = $20;
+  var$2 = $18;
   var$2$hi = i64toi32_i32$1;
   i64toi32_i32$1 = var$0$hi;
   i64toi32_i32$1 = var$2$hi;
@@ -2676,66 +2674,66 @@ function asmFunc(global, env, buffer) {
   i64toi32_i32$1 = i64toi32_i32$0 ^ i64toi32_i32$3 | 0;
   i64toi32_i32$0 = var$2$hi;
   i64toi32_i32$3 = var$2;
-  i64toi32_i32$4 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$5 = i64toi32_i32$6 + i64toi32_i32$0 | 0;
-  i64toi32_i32$5 = i64toi32_i32$2 - i64toi32_i32$5 | 0;
-  $9 = i64toi32_i32$4;
-  $9$hi = i64toi32_i32$5;
-  i64toi32_i32$5 = var$1$hi;
-  i64toi32_i32$2 = var$1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$0 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$5 >> 31 | 0;
-   $21 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
+  i64toi32_i32$4 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
+  i64toi32_i32$1 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
+  i64toi32_i32$0 = i64toi32_i32$4 + i64toi32_i32$0 | 0;
+  i64toi32_i32$0 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
+  $9 = i64toi32_i32$1;
+  $9$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = var$1$hi;
+  i64toi32_i32$3 = var$1;
+  i64toi32_i32$2 = 0;
+  i64toi32_i32$4 = 63;
+  i64toi32_i32$1 = i64toi32_i32$4 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$4 & 63 | 0) >>> 0) {
+   i64toi32_i32$2 = i64toi32_i32$0 >> 31 | 0;
+   $19 = i64toi32_i32$0 >> i64toi32_i32$1 | 0;
   } else {
-   i64toi32_i32$1 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
-   $21 = (((1 << i64toi32_i32$0 | 0) - 1 | 0) & i64toi32_i32$5 | 0) << (32 - i64toi32_i32$0 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$0 | 0) | 0;
+   i64toi32_i32$2 = i64toi32_i32$0 >> i64toi32_i32$1 | 0;
+   $19 = (((1 << i64toi32_i32$1 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$1 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$1 | 0) | 0;
   }
-  var$0 = $21;
-  var$0$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$1$hi;
-  i64toi32_i32$1 = var$0$hi;
-  i64toi32_i32$5 = var$0;
+  var$0 = $19;
+  var$0$hi = i64toi32_i32$2;
   i64toi32_i32$2 = var$1$hi;
-  i64toi32_i32$3 = var$1;
-  i64toi32_i32$2 = i64toi32_i32$1 ^ i64toi32_i32$2 | 0;
-  $14$hi = i64toi32_i32$2;
-  i64toi32_i32$2 = i64toi32_i32$1;
-  i64toi32_i32$2 = $14$hi;
-  i64toi32_i32$1 = i64toi32_i32$5 ^ i64toi32_i32$3 | 0;
-  i64toi32_i32$5 = var$0$hi;
-  i64toi32_i32$3 = var$0;
-  i64toi32_i32$0 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$4 = i64toi32_i32$6 + i64toi32_i32$5 | 0;
-  i64toi32_i32$4 = i64toi32_i32$2 - i64toi32_i32$4 | 0;
-  $16$hi = i64toi32_i32$4;
-  i64toi32_i32$4 = $9$hi;
-  i64toi32_i32$1 = $16$hi;
-  i64toi32_i32$1 = __wasm_i64_urem($9 | 0, i64toi32_i32$4 | 0, i64toi32_i32$0 | 0, i64toi32_i32$1 | 0) | 0;
-  i64toi32_i32$4 = i64toi32_i32$HIGH_BITS;
-  $17$hi = i64toi32_i32$4;
+  i64toi32_i32$2 = var$0$hi;
+  i64toi32_i32$0 = var$0;
+  i64toi32_i32$3 = var$1$hi;
+  i64toi32_i32$4 = var$1;
+  i64toi32_i32$3 = i64toi32_i32$2 ^ i64toi32_i32$3 | 0;
+  $14$hi = i64toi32_i32$3;
+  i64toi32_i32$3 = i64toi32_i32$2;
+  i64toi32_i32$3 = $14$hi;
+  i64toi32_i32$2 = i64toi32_i32$0 ^ i64toi32_i32$4 | 0;
+  i64toi32_i32$0 = var$0$hi;
+  i64toi32_i32$4 = var$0;
+  i64toi32_i32$1 = i64toi32_i32$2 >>> 0 < i64toi32_i32$4 >>> 0;
+  i64toi32_i32$2 = i64toi32_i32$2 - i64toi32_i32$4 | 0;
+  i64toi32_i32$0 = i64toi32_i32$1 + i64toi32_i32$0 | 0;
+  i64toi32_i32$0 = i64toi32_i32$3 - i64toi32_i32$0 | 0;
+  $16$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = $9$hi;
+  i64toi32_i32$3 = $16$hi;
+  i64toi32_i32$3 = __wasm_i64_urem($9 | 0, i64toi32_i32$0 | 0, i64toi32_i32$2 | 0, i64toi32_i32$3 | 0) | 0;
+  i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
+  $17$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = var$2$hi;
+  i64toi32_i32$0 = $17$hi;
+  i64toi32_i32$4 = i64toi32_i32$3;
+  i64toi32_i32$3 = var$2$hi;
+  i64toi32_i32$1 = var$2;
+  i64toi32_i32$3 = i64toi32_i32$0 ^ i64toi32_i32$3 | 0;
+  $19$hi = i64toi32_i32$3;
+  i64toi32_i32$3 = var$2$hi;
+  i64toi32_i32$3 = $19$hi;
+  i64toi32_i32$0 = i64toi32_i32$4 ^ i64toi32_i32$1 | 0;
   i64toi32_i32$4 = var$2$hi;
-  i64toi32_i32$4 = $17$hi;
-  i64toi32_i32$2 = i64toi32_i32$1;
-  i64toi32_i32$1 = var$2$hi;
-  i64toi32_i32$3 = var$2;
-  i64toi32_i32$1 = i64toi32_i32$4 ^ i64toi32_i32$1 | 0;
-  $19$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$2$hi;
-  i64toi32_i32$1 = $19$hi;
-  i64toi32_i32$4 = i64toi32_i32$2 ^ i64toi32_i32$3 | 0;
-  i64toi32_i32$2 = var$2$hi;
-  i64toi32_i32$5 = i64toi32_i32$4 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$4 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$0 = i64toi32_i32$6 + i64toi32_i32$2 | 0;
-  i64toi32_i32$0 = i64toi32_i32$1 - i64toi32_i32$0 | 0;
-  i64toi32_i32$4 = i64toi32_i32$5;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
-  return i64toi32_i32$4 | 0;
+  i64toi32_i32$2 = i64toi32_i32$0 >>> 0 < i64toi32_i32$1 >>> 0;
+  i64toi32_i32$0 = i64toi32_i32$0 - i64toi32_i32$1 | 0;
+  i64toi32_i32$4 = i64toi32_i32$2 + i64toi32_i32$4 | 0;
+  i64toi32_i32$4 = i64toi32_i32$3 - i64toi32_i32$4 | 0;
+  i64toi32_i32$3 = i64toi32_i32$0;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$4;
+  return i64toi32_i32$0 | 0;
  }
  
  function _ZN17compiler_builtins3int4udiv10divmod_u6417h6026910b5ed08e40E(var$0, var$0$hi, var$1, var$1$hi) {
@@ -2743,7 +2741,7 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$4 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, i64toi32_i32$6 = 0, $37 = 0, $38 = 0, $39 = 0, $40 = 0, $41 = 0, $42 = 0, $43 = 0, $44 = 0, var$8$hi = 0, $45 = 0, $46 = 0, $47 = 0, $48 = 0, var$7$hi = 0, $49 = 0, $63$hi = 0, $65 = 0, $65$hi = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142$hi = 0, $144 = 0, $144$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0;
+  var i64toi32_i32$4 = 0, i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, var$2 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, $35 = 0, $36 = 0, $37 = 0, $38 = 0, $39 = 0, $40 = 0, $41 = 0, $42 = 0, var$8$hi = 0, $43 = 0, $44 = 0, $45 = 0, $46 = 0, var$7$hi = 0, $47 = 0, $63$hi = 0, $65 = 0, $65$hi = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142$hi = 0, $144 = 0, $144$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0;
   label$1 : {
    label$2 : {
     label$3 : {
@@ -2762,12 +2760,12 @@ function asmFunc(global, env, buffer) {
              i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
              if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
               i64toi32_i32$1 = 0;
-              $37 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
+              $35 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
              } else {
               i64toi32_i32$1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-              $37 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+              $35 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
              }
-             var$2 = $37;
+             var$2 = $35;
              if (var$2) {
               block : {
                i64toi32_i32$1 = var$1$hi;
@@ -2782,12 +2780,12 @@ function asmFunc(global, env, buffer) {
                i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
                if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
                 i64toi32_i32$2 = 0;
-                $38 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
+                $36 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
                } else {
                 i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-                $38 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
+                $36 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
                }
-               var$4 = $38;
+               var$4 = $36;
                if (!var$4) {
                 break label$9
                }
@@ -2824,12 +2822,12 @@ function asmFunc(global, env, buffer) {
             i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
             if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
              i64toi32_i32$1 = 0;
-             $39 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
+             $37 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
             } else {
              i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-             $39 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
+             $37 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
             }
-            var$3 = $39;
+            var$3 = $37;
             i64toi32_i32$1 = var$0$hi;
             if (!var$0) {
              break label$7
@@ -2848,10 +2846,10 @@ function asmFunc(global, env, buffer) {
             i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
             if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
              i64toi32_i32$3 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-             $40 = 0;
+             $38 = 0;
             } else {
              i64toi32_i32$3 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-             $40 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
+             $38 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
             }
             $63$hi = i64toi32_i32$3;
             i64toi32_i32$3 = var$0$hi;
@@ -2862,7 +2860,7 @@ function asmFunc(global, env, buffer) {
             $65 = i64toi32_i32$1 & i64toi32_i32$0 | 0;
             $65$hi = i64toi32_i32$2;
             i64toi32_i32$2 = $63$hi;
-            i64toi32_i32$3 = $40;
+            i64toi32_i32$3 = $38;
             i64toi32_i32$1 = $65$hi;
             i64toi32_i32$0 = $65;
             i64toi32_i32$1 = i64toi32_i32$2 | i64toi32_i32$1 | 0;
@@ -2893,12 +2891,12 @@ function asmFunc(global, env, buffer) {
         i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
         if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
          i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-         $41 = 0;
+         $39 = 0;
         } else {
          i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $41 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
+         $39 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
         }
-        legalfunc$wasm2js_scratch_store_i64($41 | 0, i64toi32_i32$1 | 0);
+        legalfunc$wasm2js_scratch_store_i64($39 | 0, i64toi32_i32$1 | 0);
         i64toi32_i32$1 = 0;
         i64toi32_i32$2 = var$4;
         i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
@@ -2926,12 +2924,12 @@ function asmFunc(global, env, buffer) {
       i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
       if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
        i64toi32_i32$1 = 0;
-       $42 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
+       $40 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
       } else {
        i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-       $42 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
+       $40 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
       }
-      i64toi32_i32$3 = $42;
+      i64toi32_i32$3 = $40;
       i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
       return i64toi32_i32$3 | 0;
      }
@@ -2948,12 +2946,12 @@ function asmFunc(global, env, buffer) {
     i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
     if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
      i64toi32_i32$1 = 0;
-     $43 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
+     $41 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
     } else {
      i64toi32_i32$1 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
-     $43 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+     $41 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
     }
-    var$5 = $43;
+    var$5 = $41;
     var$5$hi = i64toi32_i32$1;
     i64toi32_i32$1 = var$0$hi;
     i64toi32_i32$1 = 0;
@@ -2965,12 +2963,12 @@ function asmFunc(global, env, buffer) {
     i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
     if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
      i64toi32_i32$2 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
-     $44 = 0;
+     $42 = 0;
     } else {
      i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$3 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-     $44 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
+     $42 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
     }
-    var$0 = $44;
+    var$0 = $42;
     var$0$hi = i64toi32_i32$2;
     label$13 : {
      if (var$2) {
@@ -2979,121 +2977,121 @@ function asmFunc(global, env, buffer) {
        i64toi32_i32$1 = var$1;
        i64toi32_i32$3 = -1;
        i64toi32_i32$0 = -1;
-       i64toi32_i32$4 = i64toi32_i32$1 + i64toi32_i32$0 | 0;
-       i64toi32_i32$5 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
-       if (i64toi32_i32$4 >>> 0 < i64toi32_i32$0 >>> 0) {
-        i64toi32_i32$5 = i64toi32_i32$5 + 1 | 0
+       i64toi32_i32$1 = i64toi32_i32$1 + i64toi32_i32$0 | 0;
+       i64toi32_i32$2 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
+       if (i64toi32_i32$1 >>> 0 < i64toi32_i32$0 >>> 0) {
+        i64toi32_i32$2 = i64toi32_i32$2 + 1 | 0
        }
-       var$8 = i64toi32_i32$4;
-       var$8$hi = i64toi32_i32$5;
+       var$8 = i64toi32_i32$1;
+       var$8$hi = i64toi32_i32$2;
        label$15 : while (1) {
-        i64toi32_i32$5 = var$5$hi;
-        i64toi32_i32$2 = var$5;
-        i64toi32_i32$1 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
-         $45 = 0;
+        i64toi32_i32$2 = var$5$hi;
+        i64toi32_i32$3 = var$5;
+        i64toi32_i32$0 = 0;
+        i64toi32_i32$1 = 1;
+        i64toi32_i32$4 = i64toi32_i32$1 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$1 & 63 | 0) >>> 0) {
+         i64toi32_i32$0 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
+         $43 = 0;
         } else {
-         i64toi32_i32$1 = ((1 << i64toi32_i32$3 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$3 | 0) | 0) | 0 | (i64toi32_i32$5 << i64toi32_i32$3 | 0) | 0;
-         $45 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
+         i64toi32_i32$0 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$3 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$2 << i64toi32_i32$4 | 0) | 0;
+         $43 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
         }
-        $140 = $45;
-        $140$hi = i64toi32_i32$1;
-        i64toi32_i32$1 = var$0$hi;
-        i64toi32_i32$5 = var$0;
-        i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 63;
-        i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = 0;
-         $46 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
+        $140 = $43;
+        $140$hi = i64toi32_i32$0;
+        i64toi32_i32$0 = var$0$hi;
+        i64toi32_i32$2 = var$0;
+        i64toi32_i32$3 = 0;
+        i64toi32_i32$1 = 63;
+        i64toi32_i32$4 = i64toi32_i32$1 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$1 & 63 | 0) >>> 0) {
+         i64toi32_i32$3 = 0;
+         $44 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
         } else {
-         i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
-         $46 = (((1 << i64toi32_i32$3 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$3 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$3 | 0) | 0;
+         i64toi32_i32$3 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
+         $44 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
         }
-        $142$hi = i64toi32_i32$2;
-        i64toi32_i32$2 = $140$hi;
-        i64toi32_i32$1 = $140;
-        i64toi32_i32$5 = $142$hi;
-        i64toi32_i32$0 = $46;
-        i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
-        var$5 = i64toi32_i32$1 | i64toi32_i32$0 | 0;
-        var$5$hi = i64toi32_i32$5;
+        $142$hi = i64toi32_i32$3;
+        i64toi32_i32$3 = $140$hi;
+        i64toi32_i32$0 = $140;
+        i64toi32_i32$2 = $142$hi;
+        i64toi32_i32$1 = $44;
+        i64toi32_i32$2 = i64toi32_i32$3 | i64toi32_i32$2 | 0;
+        var$5 = i64toi32_i32$0 | i64toi32_i32$1 | 0;
+        var$5$hi = i64toi32_i32$2;
         $144 = var$5;
-        $144$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = var$8$hi;
-        i64toi32_i32$5 = var$5$hi;
-        i64toi32_i32$5 = var$8$hi;
-        i64toi32_i32$2 = var$8;
-        i64toi32_i32$1 = var$5$hi;
-        i64toi32_i32$0 = var$5;
-        i64toi32_i32$3 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
-        i64toi32_i32$6 = i64toi32_i32$2 >>> 0 < i64toi32_i32$0 >>> 0;
-        i64toi32_i32$4 = i64toi32_i32$6 + i64toi32_i32$1 | 0;
-        i64toi32_i32$4 = i64toi32_i32$5 - i64toi32_i32$4 | 0;
-        i64toi32_i32$5 = i64toi32_i32$3;
+        $144$hi = i64toi32_i32$2;
+        i64toi32_i32$2 = var$8$hi;
+        i64toi32_i32$2 = var$5$hi;
+        i64toi32_i32$2 = var$8$hi;
+        i64toi32_i32$3 = var$8;
+        i64toi32_i32$0 = var$5$hi;
+        i64toi32_i32$1 = var$5;
+        i64toi32_i32$4 = i64toi32_i32$3 >>> 0 < i64toi32_i32$1 >>> 0;
+        i64toi32_i32$3 = i64toi32_i32$3 - i64toi32_i32$1 | 0;
+        i64toi32_i32$0 = i64toi32_i32$4 + i64toi32_i32$0 | 0;
+        i64toi32_i32$0 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
+        i64toi32_i32$1 = i64toi32_i32$3;
         i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 63;
-        i64toi32_i32$1 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = i64toi32_i32$4 >> 31 | 0;
-         $47 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
+        i64toi32_i32$4 = 63;
+        i64toi32_i32$3 = i64toi32_i32$4 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$4 & 63 | 0) >>> 0) {
+         i64toi32_i32$2 = i64toi32_i32$0 >> 31 | 0;
+         $45 = i64toi32_i32$0 >> i64toi32_i32$3 | 0;
         } else {
-         i64toi32_i32$2 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
-         $47 = (((1 << i64toi32_i32$1 | 0) - 1 | 0) & i64toi32_i32$4 | 0) << (32 - i64toi32_i32$1 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$1 | 0) | 0;
+         i64toi32_i32$2 = i64toi32_i32$0 >> i64toi32_i32$3 | 0;
+         $45 = (((1 << i64toi32_i32$3 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$3 | 0) | 0 | (i64toi32_i32$1 >>> i64toi32_i32$3 | 0) | 0;
         }
-        var$6 = $47;
+        var$6 = $45;
         var$6$hi = i64toi32_i32$2;
         i64toi32_i32$2 = var$1$hi;
         i64toi32_i32$2 = var$6$hi;
-        i64toi32_i32$4 = var$6;
-        i64toi32_i32$5 = var$1$hi;
-        i64toi32_i32$0 = var$1;
-        i64toi32_i32$5 = i64toi32_i32$2 & i64toi32_i32$5 | 0;
-        $151 = i64toi32_i32$4 & i64toi32_i32$0 | 0;
-        $151$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = $144$hi;
+        i64toi32_i32$0 = var$6;
+        i64toi32_i32$1 = var$1$hi;
+        i64toi32_i32$4 = var$1;
+        i64toi32_i32$1 = i64toi32_i32$2 & i64toi32_i32$1 | 0;
+        $151 = i64toi32_i32$0 & i64toi32_i32$4 | 0;
+        $151$hi = i64toi32_i32$1;
+        i64toi32_i32$1 = $144$hi;
         i64toi32_i32$2 = $144;
-        i64toi32_i32$4 = $151$hi;
-        i64toi32_i32$0 = $151;
-        i64toi32_i32$1 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
-        i64toi32_i32$6 = i64toi32_i32$2 >>> 0 < i64toi32_i32$0 >>> 0;
-        i64toi32_i32$3 = i64toi32_i32$6 + i64toi32_i32$4 | 0;
-        i64toi32_i32$3 = i64toi32_i32$5 - i64toi32_i32$3 | 0;
-        var$5 = i64toi32_i32$1;
-        var$5$hi = i64toi32_i32$3;
-        i64toi32_i32$3 = var$0$hi;
-        i64toi32_i32$5 = var$0;
-        i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-         $48 = 0;
+        i64toi32_i32$0 = $151$hi;
+        i64toi32_i32$4 = $151;
+        i64toi32_i32$3 = i64toi32_i32$2 >>> 0 < i64toi32_i32$4 >>> 0;
+        i64toi32_i32$2 = i64toi32_i32$2 - i64toi32_i32$4 | 0;
+        i64toi32_i32$0 = i64toi32_i32$3 + i64toi32_i32$0 | 0;
+        i64toi32_i32$0 = i64toi32_i32$1 - i64toi32_i32$0 | 0;
+        var$5 = i64toi32_i32$2;
+        var$5$hi = i64toi32_i32$0;
+        i64toi32_i32$0 = var$0$hi;
+        i64toi32_i32$4 = var$0;
+        i64toi32_i32$1 = 0;
+        i64toi32_i32$3 = 1;
+        i64toi32_i32$2 = i64toi32_i32$3 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
+         i64toi32_i32$1 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
+         $46 = 0;
         } else {
-         i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $48 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
+         i64toi32_i32$1 = ((1 << i64toi32_i32$2 | 0) - 1 | 0) & (i64toi32_i32$4 >>> (32 - i64toi32_i32$2 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$2 | 0) | 0;
+         $46 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
         }
-        $154$hi = i64toi32_i32$2;
-        i64toi32_i32$2 = var$7$hi;
-        i64toi32_i32$2 = $154$hi;
-        i64toi32_i32$3 = $48;
-        i64toi32_i32$5 = var$7$hi;
-        i64toi32_i32$0 = var$7;
-        i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
-        var$0 = i64toi32_i32$3 | i64toi32_i32$0 | 0;
-        var$0$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = var$6$hi;
-        i64toi32_i32$2 = var$6;
-        i64toi32_i32$3 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$3 = i64toi32_i32$5 & i64toi32_i32$3 | 0;
-        var$6 = i64toi32_i32$2 & i64toi32_i32$0 | 0;
-        var$6$hi = i64toi32_i32$3;
+        $154$hi = i64toi32_i32$1;
+        i64toi32_i32$1 = var$7$hi;
+        i64toi32_i32$1 = $154$hi;
+        i64toi32_i32$0 = $46;
+        i64toi32_i32$4 = var$7$hi;
+        i64toi32_i32$3 = var$7;
+        i64toi32_i32$4 = i64toi32_i32$1 | i64toi32_i32$4 | 0;
+        var$0 = i64toi32_i32$0 | i64toi32_i32$3 | 0;
+        var$0$hi = i64toi32_i32$4;
+        i64toi32_i32$4 = var$6$hi;
+        i64toi32_i32$1 = var$6;
+        i64toi32_i32$0 = 0;
+        i64toi32_i32$3 = 1;
+        i64toi32_i32$0 = i64toi32_i32$4 & i64toi32_i32$0 | 0;
+        var$6 = i64toi32_i32$1 & i64toi32_i32$3 | 0;
+        var$6$hi = i64toi32_i32$0;
         var$7 = var$6;
-        var$7$hi = i64toi32_i32$3;
+        var$7$hi = i64toi32_i32$0;
         var$2 = var$2 + -1 | 0;
         if (var$2) {
          continue label$15
@@ -3104,41 +3102,41 @@ function asmFunc(global, env, buffer) {
       }
      }
     }
-    i64toi32_i32$3 = var$5$hi;
-    legalfunc$wasm2js_scratch_store_i64(var$5 | 0, i64toi32_i32$3 | 0);
-    i64toi32_i32$3 = var$0$hi;
-    i64toi32_i32$5 = var$0;
-    i64toi32_i32$2 = 0;
-    i64toi32_i32$0 = 1;
-    i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-    if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-     i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-     $49 = 0;
+    i64toi32_i32$0 = var$5$hi;
+    legalfunc$wasm2js_scratch_store_i64(var$5 | 0, i64toi32_i32$0 | 0);
+    i64toi32_i32$0 = var$0$hi;
+    i64toi32_i32$4 = var$0;
+    i64toi32_i32$1 = 0;
+    i64toi32_i32$3 = 1;
+    i64toi32_i32$2 = i64toi32_i32$3 & 31 | 0;
+    if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
+     i64toi32_i32$1 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
+     $47 = 0;
     } else {
-     i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-     $49 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
+     i64toi32_i32$1 = ((1 << i64toi32_i32$2 | 0) - 1 | 0) & (i64toi32_i32$4 >>> (32 - i64toi32_i32$2 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$2 | 0) | 0;
+     $47 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
     }
-    $165$hi = i64toi32_i32$2;
-    i64toi32_i32$2 = var$6$hi;
-    i64toi32_i32$2 = $165$hi;
-    i64toi32_i32$3 = $49;
-    i64toi32_i32$5 = var$6$hi;
-    i64toi32_i32$0 = var$6;
-    i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
-    i64toi32_i32$3 = i64toi32_i32$3 | i64toi32_i32$0 | 0;
-    i64toi32_i32$HIGH_BITS = i64toi32_i32$5;
-    return i64toi32_i32$3 | 0;
+    $165$hi = i64toi32_i32$1;
+    i64toi32_i32$1 = var$6$hi;
+    i64toi32_i32$1 = $165$hi;
+    i64toi32_i32$0 = $47;
+    i64toi32_i32$4 = var$6$hi;
+    i64toi32_i32$3 = var$6;
+    i64toi32_i32$4 = i64toi32_i32$1 | i64toi32_i32$4 | 0;
+    i64toi32_i32$0 = i64toi32_i32$0 | i64toi32_i32$3 | 0;
+    i64toi32_i32$HIGH_BITS = i64toi32_i32$4;
+    return i64toi32_i32$0 | 0;
    }
-   i64toi32_i32$3 = var$0$hi;
-   legalfunc$wasm2js_scratch_store_i64(var$0 | 0, i64toi32_i32$3 | 0);
-   i64toi32_i32$3 = 0;
+   i64toi32_i32$0 = var$0$hi;
+   legalfunc$wasm2js_scratch_store_i64(var$0 | 0, i64toi32_i32$0 | 0);
+   i64toi32_i32$0 = 0;
    var$0 = 0;
-   var$0$hi = i64toi32_i32$3;
+   var$0$hi = i64toi32_i32$0;
   }
-  i64toi32_i32$3 = var$0$hi;
-  i64toi32_i32$5 = var$0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$3;
-  return i64toi32_i32$5 | 0;
+  i64toi32_i32$0 = var$0$hi;
+  i64toi32_i32$4 = var$0;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
+  return i64toi32_i32$4 | 0;
  }
  
  function __wasm_i64_srem(var$0, var$0$hi, var$1, var$1$hi) {
@@ -3461,7 +3459,7 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$2$hi = 0, i64toi32_i32$6 = 0, $21 = 0, $22 = 0, $23 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17 = 0, $17$hi = 0, $23$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$4 = 0, var$2 = 0, var$2$hi = 0, $19 = 0, $20 = 0, $21 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17 = 0, $17$hi = 0, $23$hi = 0;
   i64toi32_i32$0 = var$0$hi;
   i64toi32_i32$2 = var$0;
   i64toi32_i32$1 = 0;
@@ -3469,12 +3467,12 @@ function asmFunc(global, env, buffer) {
   i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
   if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
    i64toi32_i32$1 = i64toi32_i32$0 >> 31 | 0;
-   $21 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
+   $19 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
   } else {
    i64toi32_i32$1 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
-   $21 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+   $19 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
   }
-  var$2 = $21;
+  var$2 = $19;
   var$2$hi = i64toi32_i32$1;
   i64toi32_i32$1 = var$0$hi;
   i64toi32_i32$1 = var$2$hi;
@@ -3488,86 +3486,86 @@ function asmFunc(global, env, buffer) {
   i64toi32_i32$1 = i64toi32_i32$0 ^ i64toi32_i32$3 | 0;
   i64toi32_i32$0 = var$2$hi;
   i64toi32_i32$3 = var$2;
-  i64toi32_i32$4 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$5 = i64toi32_i32$6 + i64toi32_i32$0 | 0;
-  i64toi32_i32$5 = i64toi32_i32$2 - i64toi32_i32$5 | 0;
-  $9 = i64toi32_i32$4;
-  $9$hi = i64toi32_i32$5;
-  i64toi32_i32$5 = var$1$hi;
-  i64toi32_i32$2 = var$1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$0 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$5 >> 31 | 0;
-   $22 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
-  } else {
-   i64toi32_i32$1 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
-   $22 = (((1 << i64toi32_i32$0 | 0) - 1 | 0) & i64toi32_i32$5 | 0) << (32 - i64toi32_i32$0 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$0 | 0) | 0;
-  }
-  var$2 = $22;
-  var$2$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$1$hi;
-  i64toi32_i32$1 = var$2$hi;
-  i64toi32_i32$5 = var$2;
-  i64toi32_i32$2 = var$1$hi;
+  i64toi32_i32$4 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
+  i64toi32_i32$1 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
+  i64toi32_i32$0 = i64toi32_i32$4 + i64toi32_i32$0 | 0;
+  i64toi32_i32$0 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
+  $9 = i64toi32_i32$1;
+  $9$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = var$1$hi;
   i64toi32_i32$3 = var$1;
-  i64toi32_i32$2 = i64toi32_i32$1 ^ i64toi32_i32$2 | 0;
-  $14$hi = i64toi32_i32$2;
-  i64toi32_i32$2 = i64toi32_i32$1;
-  i64toi32_i32$2 = $14$hi;
-  i64toi32_i32$1 = i64toi32_i32$5 ^ i64toi32_i32$3 | 0;
-  i64toi32_i32$5 = var$2$hi;
-  i64toi32_i32$3 = var$2;
-  i64toi32_i32$0 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$4 = i64toi32_i32$6 + i64toi32_i32$5 | 0;
-  i64toi32_i32$4 = i64toi32_i32$2 - i64toi32_i32$4 | 0;
-  $16$hi = i64toi32_i32$4;
-  i64toi32_i32$4 = $9$hi;
-  i64toi32_i32$1 = $16$hi;
-  i64toi32_i32$1 = __wasm_i64_udiv($9 | 0, i64toi32_i32$4 | 0, i64toi32_i32$0 | 0, i64toi32_i32$1 | 0) | 0;
-  i64toi32_i32$4 = i64toi32_i32$HIGH_BITS;
-  $17 = i64toi32_i32$1;
-  $17$hi = i64toi32_i32$4;
-  i64toi32_i32$4 = var$1$hi;
-  i64toi32_i32$4 = var$0$hi;
-  i64toi32_i32$4 = var$1$hi;
-  i64toi32_i32$2 = var$1;
-  i64toi32_i32$1 = var$0$hi;
-  i64toi32_i32$3 = var$0;
-  i64toi32_i32$1 = i64toi32_i32$4 ^ i64toi32_i32$1 | 0;
-  i64toi32_i32$4 = i64toi32_i32$2 ^ i64toi32_i32$3 | 0;
   i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$5 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = i64toi32_i32$1 >> 31 | 0;
-   $23 = i64toi32_i32$1 >> i64toi32_i32$5 | 0;
+  i64toi32_i32$4 = 63;
+  i64toi32_i32$1 = i64toi32_i32$4 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$4 & 63 | 0) >>> 0) {
+   i64toi32_i32$2 = i64toi32_i32$0 >> 31 | 0;
+   $20 = i64toi32_i32$0 >> i64toi32_i32$1 | 0;
   } else {
-   i64toi32_i32$2 = i64toi32_i32$1 >> i64toi32_i32$5 | 0;
-   $23 = (((1 << i64toi32_i32$5 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$5 | 0) | 0 | (i64toi32_i32$4 >>> i64toi32_i32$5 | 0) | 0;
+   i64toi32_i32$2 = i64toi32_i32$0 >> i64toi32_i32$1 | 0;
+   $20 = (((1 << i64toi32_i32$1 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$1 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$1 | 0) | 0;
   }
-  var$0 = $23;
-  var$0$hi = i64toi32_i32$2;
-  i64toi32_i32$2 = $17$hi;
-  i64toi32_i32$1 = $17;
-  i64toi32_i32$4 = var$0$hi;
-  i64toi32_i32$3 = var$0;
-  i64toi32_i32$4 = i64toi32_i32$2 ^ i64toi32_i32$4 | 0;
-  $23$hi = i64toi32_i32$4;
-  i64toi32_i32$4 = var$0$hi;
-  i64toi32_i32$4 = $23$hi;
-  i64toi32_i32$2 = i64toi32_i32$1 ^ i64toi32_i32$3 | 0;
-  i64toi32_i32$1 = var$0$hi;
-  i64toi32_i32$5 = i64toi32_i32$2 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$2 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$0 = i64toi32_i32$6 + i64toi32_i32$1 | 0;
-  i64toi32_i32$0 = i64toi32_i32$4 - i64toi32_i32$0 | 0;
-  i64toi32_i32$2 = i64toi32_i32$5;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
-  return i64toi32_i32$2 | 0;
+  var$2 = $20;
+  var$2$hi = i64toi32_i32$2;
+  i64toi32_i32$2 = var$1$hi;
+  i64toi32_i32$2 = var$2$hi;
+  i64toi32_i32$0 = var$2;
+  i64toi32_i32$3 = var$1$hi;
+  i64toi32_i32$4 = var$1;
+  i64toi32_i32$3 = i64toi32_i32$2 ^ i64toi32_i32$3 | 0;
+  $14$hi = i64toi32_i32$3;
+  i64toi32_i32$3 = i64toi32_i32$2;
+  i64toi32_i32$3 = $14$hi;
+  i64toi32_i32$2 = i64toi32_i32$0 ^ i64toi32_i32$4 | 0;
+  i64toi32_i32$0 = var$2$hi;
+  i64toi32_i32$4 = var$2;
+  i64toi32_i32$1 = i64toi32_i32$2 >>> 0 < i64toi32_i32$4 >>> 0;
+  i64toi32_i32$2 = i64toi32_i32$2 - i64toi32_i32$4 | 0;
+  i64toi32_i32$0 = i64toi32_i32$1 + i64toi32_i32$0 | 0;
+  i64toi32_i32$0 = i64toi32_i32$3 - i64toi32_i32$0 | 0;
+  $16$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = $9$hi;
+  i64toi32_i32$3 = $16$hi;
+  i64toi32_i32$3 = __wasm_i64_udiv($9 | 0, i64toi32_i32$0 | 0, i64toi32_i32$2 | 0, i64toi32_i32$3 | 0) | 0;
+  i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
+  $17 = i64toi32_i32$3;
+  $17$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = var$1$hi;
+  i64toi32_i32$0 = var$0$hi;
+  i64toi32_i32$0 = var$1$hi;
+  i64toi32_i32$4 = var$1;
+  i64toi32_i32$3 = var$0$hi;
+  i64toi32_i32$1 = var$0;
+  i64toi32_i32$3 = i64toi32_i32$0 ^ i64toi32_i32$3 | 0;
+  i64toi32_i32$0 = i64toi32_i32$4 ^ i64toi32_i32$1 | 0;
+  i64toi32_i32$4 = 0;
+  i64toi32_i32$1 = 63;
+  i64toi32_i32$2 = i64toi32_i32$1 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$1 & 63 | 0) >>> 0) {
+   i64toi32_i32$4 = i64toi32_i32$3 >> 31 | 0;
+   $21 = i64toi32_i32$3 >> i64toi32_i32$2 | 0;
+  } else {
+   i64toi32_i32$4 = i64toi32_i32$3 >> i64toi32_i32$2 | 0;
+   $21 = (((1 << i64toi32_i32$2 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$2 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$2 | 0) | 0;
+  }
+  var$0 = $21;
+  var$0$hi = i64toi32_i32$4;
+  i64toi32_i32$4 = $17$hi;
+  i64toi32_i32$3 = $17;
+  i64toi32_i32$0 = var$0$hi;
+  i64toi32_i32$1 = var$0;
+  i64toi32_i32$0 = i64toi32_i32$4 ^ i64toi32_i32$0 | 0;
+  $23$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = var$0$hi;
+  i64toi32_i32$0 = $23$hi;
+  i64toi32_i32$4 = i64toi32_i32$3 ^ i64toi32_i32$1 | 0;
+  i64toi32_i32$3 = var$0$hi;
+  i64toi32_i32$2 = i64toi32_i32$4 >>> 0 < i64toi32_i32$1 >>> 0;
+  i64toi32_i32$4 = i64toi32_i32$4 - i64toi32_i32$1 | 0;
+  i64toi32_i32$3 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
+  i64toi32_i32$3 = i64toi32_i32$0 - i64toi32_i32$3 | 0;
+  i64toi32_i32$0 = i64toi32_i32$4;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$3;
+  return i64toi32_i32$0 | 0;
  }
  
  function _ZN17compiler_builtins3int4udiv10divmod_u6417h6026910b5ed08e40E(var$0, var$0$hi, var$1, var$1$hi) {
@@ -3575,7 +3573,7 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$4 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, i64toi32_i32$6 = 0, $37 = 0, $38 = 0, $39 = 0, $40 = 0, $41 = 0, $42 = 0, $43 = 0, $44 = 0, var$8$hi = 0, $45 = 0, $46 = 0, $47 = 0, $48 = 0, var$7$hi = 0, $49 = 0, $63$hi = 0, $65 = 0, $65$hi = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142$hi = 0, $144 = 0, $144$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0;
+  var i64toi32_i32$4 = 0, i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, var$2 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, $35 = 0, $36 = 0, $37 = 0, $38 = 0, $39 = 0, $40 = 0, $41 = 0, $42 = 0, var$8$hi = 0, $43 = 0, $44 = 0, $45 = 0, $46 = 0, var$7$hi = 0, $47 = 0, $63$hi = 0, $65 = 0, $65$hi = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142$hi = 0, $144 = 0, $144$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0;
   label$1 : {
    label$2 : {
     label$3 : {
@@ -3594,12 +3592,12 @@ function asmFunc(global, env, buffer) {
              i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
              if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
               i64toi32_i32$1 = 0;
-              $37 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
+              $35 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
              } else {
               i64toi32_i32$1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-              $37 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+              $35 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
              }
-             var$2 = $37;
+             var$2 = $35;
              if (var$2) {
               block : {
                i64toi32_i32$1 = var$1$hi;
@@ -3614,12 +3612,12 @@ function asmFunc(global, env, buffer) {
                i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
                if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
                 i64toi32_i32$2 = 0;
-                $38 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
+                $36 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
                } else {
                 i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-                $38 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
+                $36 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
                }
-               var$4 = $38;
+               var$4 = $36;
                if (!var$4) {
                 break label$9
                }
@@ -3656,12 +3654,12 @@ function asmFunc(global, env, buffer) {
             i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
             if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
              i64toi32_i32$1 = 0;
-             $39 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
+             $37 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
             } else {
              i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-             $39 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
+             $37 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
             }
-            var$3 = $39;
+            var$3 = $37;
             i64toi32_i32$1 = var$0$hi;
             if (!var$0) {
              break label$7
@@ -3680,10 +3678,10 @@ function asmFunc(global, env, buffer) {
             i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
             if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
              i64toi32_i32$3 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-             $40 = 0;
+             $38 = 0;
             } else {
              i64toi32_i32$3 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-             $40 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
+             $38 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
             }
             $63$hi = i64toi32_i32$3;
             i64toi32_i32$3 = var$0$hi;
@@ -3694,7 +3692,7 @@ function asmFunc(global, env, buffer) {
             $65 = i64toi32_i32$1 & i64toi32_i32$0 | 0;
             $65$hi = i64toi32_i32$2;
             i64toi32_i32$2 = $63$hi;
-            i64toi32_i32$3 = $40;
+            i64toi32_i32$3 = $38;
             i64toi32_i32$1 = $65$hi;
             i64toi32_i32$0 = $65;
             i64toi32_i32$1 = i64toi32_i32$2 | i64toi32_i32$1 | 0;
@@ -3725,12 +3723,12 @@ function asmFunc(global, env, buffer) {
         i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
         if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
          i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-         $41 = 0;
+         $39 = 0;
         } else {
          i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $41 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
+         $39 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
         }
-        legalfunc$wasm2js_scratch_store_i64($41 | 0, i64toi32_i32$1 | 0);
+        legalfunc$wasm2js_scratch_store_i64($39 | 0, i64toi32_i32$1 | 0);
         i64toi32_i32$1 = 0;
         i64toi32_i32$2 = var$4;
         i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
@@ -3758,12 +3756,12 @@ function asmFunc(global, env, buffer) {
       i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
       if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
        i64toi32_i32$1 = 0;
-       $42 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
+       $40 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
       } else {
        i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-       $42 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
+       $40 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
       }
-      i64toi32_i32$3 = $42;
+      i64toi32_i32$3 = $40;
       i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
       return i64toi32_i32$3 | 0;
      }
@@ -3780,12 +3778,12 @@ function asmFunc(global, env, buffer) {
     i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
     if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
      i64toi32_i32$1 = 0;
-     $43 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
+     $41 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
     } else {
      i64toi32_i32$1 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
-     $43 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+     $41 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
     }
-    var$5 = $43;
+    var$5 = $41;
     var$5$hi = i64toi32_i32$1;
     i64toi32_i32$1 = var$0$hi;
     i64toi32_i32$1 = 0;
@@ -3797,12 +3795,12 @@ function asmFunc(global, env, buffer) {
     i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
     if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
      i64toi32_i32$2 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
-     $44 = 0;
+     $42 = 0;
     } else {
      i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$3 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-     $44 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
+     $42 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
     }
-    var$0 = $44;
+    var$0 = $42;
     var$0$hi = i64toi32_i32$2;
     label$13 : {
      if (var$2) {
@@ -3811,121 +3809,121 @@ function asmFunc(global, env, buffer) {
        i64toi32_i32$1 = var$1;
        i64toi32_i32$3 = -1;
        i64toi32_i32$0 = -1;
-       i64toi32_i32$4 = i64toi32_i32$1 + i64toi32_i32$0 | 0;
-       i64toi32_i32$5 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
-       if (i64toi32_i32$4 >>> 0 < i64toi32_i32$0 >>> 0) {
-        i64toi32_i32$5 = i64toi32_i32$5 + 1 | 0
+       i64toi32_i32$1 = i64toi32_i32$1 + i64toi32_i32$0 | 0;
+       i64toi32_i32$2 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
+       if (i64toi32_i32$1 >>> 0 < i64toi32_i32$0 >>> 0) {
+        i64toi32_i32$2 = i64toi32_i32$2 + 1 | 0
        }
-       var$8 = i64toi32_i32$4;
-       var$8$hi = i64toi32_i32$5;
+       var$8 = i64toi32_i32$1;
+       var$8$hi = i64toi32_i32$2;
        label$15 : while (1) {
-        i64toi32_i32$5 = var$5$hi;
-        i64toi32_i32$2 = var$5;
-        i64toi32_i32$1 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
-         $45 = 0;
+        i64toi32_i32$2 = var$5$hi;
+        i64toi32_i32$3 = var$5;
+        i64toi32_i32$0 = 0;
+        i64toi32_i32$1 = 1;
+        i64toi32_i32$4 = i64toi32_i32$1 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$1 & 63 | 0) >>> 0) {
+         i64toi32_i32$0 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
+         $43 = 0;
         } else {
-         i64toi32_i32$1 = ((1 << i64toi32_i32$3 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$3 | 0) | 0) | 0 | (i64toi32_i32$5 << i64toi32_i32$3 | 0) | 0;
-         $45 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
+         i64toi32_i32$0 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$3 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$2 << i64toi32_i32$4 | 0) | 0;
+         $43 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
         }
-        $140 = $45;
-        $140$hi = i64toi32_i32$1;
-        i64toi32_i32$1 = var$0$hi;
-        i64toi32_i32$5 = var$0;
-        i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 63;
-        i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = 0;
-         $46 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
+        $140 = $43;
+        $140$hi = i64toi32_i32$0;
+        i64toi32_i32$0 = var$0$hi;
+        i64toi32_i32$2 = var$0;
+        i64toi32_i32$3 = 0;
+        i64toi32_i32$1 = 63;
+        i64toi32_i32$4 = i64toi32_i32$1 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$1 & 63 | 0) >>> 0) {
+         i64toi32_i32$3 = 0;
+         $44 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
         } else {
-         i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
-         $46 = (((1 << i64toi32_i32$3 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$3 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$3 | 0) | 0;
+         i64toi32_i32$3 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
+         $44 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
         }
-        $142$hi = i64toi32_i32$2;
-        i64toi32_i32$2 = $140$hi;
-        i64toi32_i32$1 = $140;
-        i64toi32_i32$5 = $142$hi;
-        i64toi32_i32$0 = $46;
-        i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
-        var$5 = i64toi32_i32$1 | i64toi32_i32$0 | 0;
-        var$5$hi = i64toi32_i32$5;
+        $142$hi = i64toi32_i32$3;
+        i64toi32_i32$3 = $140$hi;
+        i64toi32_i32$0 = $140;
+        i64toi32_i32$2 = $142$hi;
+        i64toi32_i32$1 = $44;
+        i64toi32_i32$2 = i64toi32_i32$3 | i64toi32_i32$2 | 0;
+        var$5 = i64toi32_i32$0 | i64toi32_i32$1 | 0;
+        var$5$hi = i64toi32_i32$2;
         $144 = var$5;
-        $144$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = var$8$hi;
-        i64toi32_i32$5 = var$5$hi;
-        i64toi32_i32$5 = var$8$hi;
-        i64toi32_i32$2 = var$8;
-        i64toi32_i32$1 = var$5$hi;
-        i64toi32_i32$0 = var$5;
-        i64toi32_i32$3 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
-        i64toi32_i32$6 = i64toi32_i32$2 >>> 0 < i64toi32_i32$0 >>> 0;
-        i64toi32_i32$4 = i64toi32_i32$6 + i64toi32_i32$1 | 0;
-        i64toi32_i32$4 = i64toi32_i32$5 - i64toi32_i32$4 | 0;
-        i64toi32_i32$5 = i64toi32_i32$3;
+        $144$hi = i64toi32_i32$2;
+        i64toi32_i32$2 = var$8$hi;
+        i64toi32_i32$2 = var$5$hi;
+        i64toi32_i32$2 = var$8$hi;
+        i64toi32_i32$3 = var$8;
+        i64toi32_i32$0 = var$5$hi;
+        i64toi32_i32$1 = var$5;
+        i64toi32_i32$4 = i64toi32_i32$3 >>> 0 < i64toi32_i32$1 >>> 0;
+        i64toi32_i32$3 = i64toi32_i32$3 - i64toi32_i32$1 | 0;
+        i64toi32_i32$0 = i64toi32_i32$4 + i64toi32_i32$0 | 0;
+        i64toi32_i32$0 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
+        i64toi32_i32$1 = i64toi32_i32$3;
         i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 63;
-        i64toi32_i32$1 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = i64toi32_i32$4 >> 31 | 0;
-         $47 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
+        i64toi32_i32$4 = 63;
+        i64toi32_i32$3 = i64toi32_i32$4 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$4 & 63 | 0) >>> 0) {
+         i64toi32_i32$2 = i64toi32_i32$0 >> 31 | 0;
+         $45 = i64toi32_i32$0 >> i64toi32_i32$3 | 0;
         } else {
-         i64toi32_i32$2 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
-         $47 = (((1 << i64toi32_i32$1 | 0) - 1 | 0) & i64toi32_i32$4 | 0) << (32 - i64toi32_i32$1 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$1 | 0) | 0;
+         i64toi32_i32$2 = i64toi32_i32$0 >> i64toi32_i32$3 | 0;
+         $45 = (((1 << i64toi32_i32$3 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$3 | 0) | 0 | (i64toi32_i32$1 >>> i64toi32_i32$3 | 0) | 0;
         }
-        var$6 = $47;
+        var$6 = $45;
         var$6$hi = i64toi32_i32$2;
         i64toi32_i32$2 = var$1$hi;
         i64toi32_i32$2 = var$6$hi;
-        i64toi32_i32$4 = var$6;
-        i64toi32_i32$5 = var$1$hi;
-        i64toi32_i32$0 = var$1;
-        i64toi32_i32$5 = i64toi32_i32$2 & i64toi32_i32$5 | 0;
-        $151 = i64toi32_i32$4 & i64toi32_i32$0 | 0;
-        $151$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = $144$hi;
+        i64toi32_i32$0 = var$6;
+        i64toi32_i32$1 = var$1$hi;
+        i64toi32_i32$4 = var$1;
+        i64toi32_i32$1 = i64toi32_i32$2 & i64toi32_i32$1 | 0;
+        $151 = i64toi32_i32$0 & i64toi32_i32$4 | 0;
+        $151$hi = i64toi32_i32$1;
+        i64toi32_i32$1 = $144$hi;
         i64toi32_i32$2 = $144;
-        i64toi32_i32$4 = $151$hi;
-        i64toi32_i32$0 = $151;
-        i64toi32_i32$1 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
-        i64toi32_i32$6 = i64toi32_i32$2 >>> 0 < i64toi32_i32$0 >>> 0;
-        i64toi32_i32$3 = i64toi32_i32$6 + i64toi32_i32$4 | 0;
-        i64toi32_i32$3 = i64toi32_i32$5 - i64toi32_i32$3 | 0;
-        var$5 = i64toi32_i32$1;
-        var$5$hi = i64toi32_i32$3;
-        i64toi32_i32$3 = var$0$hi;
-        i64toi32_i32$5 = var$0;
-        i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-         $48 = 0;
+        i64toi32_i32$0 = $151$hi;
+        i64toi32_i32$4 = $151;
+        i64toi32_i32$3 = i64toi32_i32$2 >>> 0 < i64toi32_i32$4 >>> 0;
+        i64toi32_i32$2 = i64toi32_i32$2 - i64toi32_i32$4 | 0;
+        i64toi32_i32$0 = i64toi32_i32$3 + i64toi32_i32$0 | 0;
+        i64toi32_i32$0 = i64toi32_i32$1 - i64toi32_i32$0 | 0;
+        var$5 = i64toi32_i32$2;
+        var$5$hi = i64toi32_i32$0;
+        i64toi32_i32$0 = var$0$hi;
+        i64toi32_i32$4 = var$0;
+        i64toi32_i32$1 = 0;
+        i64toi32_i32$3 = 1;
+        i64toi32_i32$2 = i64toi32_i32$3 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
+         i64toi32_i32$1 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
+         $46 = 0;
         } else {
-         i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $48 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
+         i64toi32_i32$1 = ((1 << i64toi32_i32$2 | 0) - 1 | 0) & (i64toi32_i32$4 >>> (32 - i64toi32_i32$2 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$2 | 0) | 0;
+         $46 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
         }
-        $154$hi = i64toi32_i32$2;
-        i64toi32_i32$2 = var$7$hi;
-        i64toi32_i32$2 = $154$hi;
-        i64toi32_i32$3 = $48;
-        i64toi32_i32$5 = var$7$hi;
-        i64toi32_i32$0 = var$7;
-        i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
-        var$0 = i64toi32_i32$3 | i64toi32_i32$0 | 0;
-        var$0$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = var$6$hi;
-        i64toi32_i32$2 = var$6;
-        i64toi32_i32$3 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$3 = i64toi32_i32$5 & i64toi32_i32$3 | 0;
-        var$6 = i64toi32_i32$2 & i64toi32_i32$0 | 0;
-        var$6$hi = i64toi32_i32$3;
+        $154$hi = i64toi32_i32$1;
+        i64toi32_i32$1 = var$7$hi;
+        i64toi32_i32$1 = $154$hi;
+        i64toi32_i32$0 = $46;
+        i64toi32_i32$4 = var$7$hi;
+        i64toi32_i32$3 = var$7;
+        i64toi32_i32$4 = i64toi32_i32$1 | i64toi32_i32$4 | 0;
+        var$0 = i64toi32_i32$0 | i64toi32_i32$3 | 0;
+        var$0$hi = i64toi32_i32$4;
+        i64toi32_i32$4 = var$6$hi;
+        i64toi32_i32$1 = var$6;
+        i64toi32_i32$0 = 0;
+        i64toi32_i32$3 = 1;
+        i64toi32_i32$0 = i64toi32_i32$4 & i64toi32_i32$0 | 0;
+        var$6 = i64toi32_i32$1 & i64toi32_i32$3 | 0;
+        var$6$hi = i64toi32_i32$0;
         var$7 = var$6;
-        var$7$hi = i64toi32_i32$3;
+        var$7$hi = i64toi32_i32$0;
         var$2 = var$2 + -1 | 0;
         if (var$2) {
          continue label$15
@@ -3936,41 +3934,41 @@ function asmFunc(global, env, buffer) {
       }
      }
     }
-    i64toi32_i32$3 = var$5$hi;
-    legalfunc$wasm2js_scratch_store_i64(var$5 | 0, i64toi32_i32$3 | 0);
-    i64toi32_i32$3 = var$0$hi;
-    i64toi32_i32$5 = var$0;
-    i64toi32_i32$2 = 0;
-    i64toi32_i32$0 = 1;
-    i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-    if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-     i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-     $49 = 0;
+    i64toi32_i32$0 = var$5$hi;
+    legalfunc$wasm2js_scratch_store_i64(var$5 | 0, i64toi32_i32$0 | 0);
+    i64toi32_i32$0 = var$0$hi;
+    i64toi32_i32$4 = var$0;
+    i64toi32_i32$1 = 0;
+    i64toi32_i32$3 = 1;
+    i64toi32_i32$2 = i64toi32_i32$3 & 31 | 0;
+    if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
+     i64toi32_i32$1 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
+     $47 = 0;
     } else {
-     i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-     $49 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
+     i64toi32_i32$1 = ((1 << i64toi32_i32$2 | 0) - 1 | 0) & (i64toi32_i32$4 >>> (32 - i64toi32_i32$2 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$2 | 0) | 0;
+     $47 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
     }
-    $165$hi = i64toi32_i32$2;
-    i64toi32_i32$2 = var$6$hi;
-    i64toi32_i32$2 = $165$hi;
-    i64toi32_i32$3 = $49;
-    i64toi32_i32$5 = var$6$hi;
-    i64toi32_i32$0 = var$6;
-    i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
-    i64toi32_i32$3 = i64toi32_i32$3 | i64toi32_i32$0 | 0;
-    i64toi32_i32$HIGH_BITS = i64toi32_i32$5;
-    return i64toi32_i32$3 | 0;
+    $165$hi = i64toi32_i32$1;
+    i64toi32_i32$1 = var$6$hi;
+    i64toi32_i32$1 = $165$hi;
+    i64toi32_i32$0 = $47;
+    i64toi32_i32$4 = var$6$hi;
+    i64toi32_i32$3 = var$6;
+    i64toi32_i32$4 = i64toi32_i32$1 | i64toi32_i32$4 | 0;
+    i64toi32_i32$0 = i64toi32_i32$0 | i64toi32_i32$3 | 0;
+    i64toi32_i32$HIGH_BITS = i64toi32_i32$4;
+    return i64toi32_i32$0 | 0;
    }
-   i64toi32_i32$3 = var$0$hi;
-   legalfunc$wasm2js_scratch_store_i64(var$0 | 0, i64toi32_i32$3 | 0);
-   i64toi32_i32$3 = 0;
+   i64toi32_i32$0 = var$0$hi;
+   legalfunc$wasm2js_scratch_store_i64(var$0 | 0, i64toi32_i32$0 | 0);
+   i64toi32_i32$0 = 0;
    var$0 = 0;
-   var$0$hi = i64toi32_i32$3;
+   var$0$hi = i64toi32_i32$0;
   }
-  i64toi32_i32$3 = var$0$hi;
-  i64toi32_i32$5 = var$0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$3;
-  return i64toi32_i32$5 | 0;
+  i64toi32_i32$0 = var$0$hi;
+  i64toi32_i32$4 = var$0;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
+  return i64toi32_i32$4 | 0;
  }
  
  function __wasm_i64_mul(var$0, var$0$hi, var$1, var$1$hi) {
@@ -4167,7 +4165,7 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$2$hi = 0, i64toi32_i32$6 = 0, $21 = 0, $22 = 0, $23 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17 = 0, $17$hi = 0, $23$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$4 = 0, var$2 = 0, var$2$hi = 0, $19 = 0, $20 = 0, $21 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17 = 0, $17$hi = 0, $23$hi = 0;
   i64toi32_i32$0 = var$0$hi;
   i64toi32_i32$2 = var$0;
   i64toi32_i32$1 = 0;
@@ -4175,12 +4173,12 @@ function asmFunc(global, env, buffer) {
   i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
   if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
    i64toi32_i32$1 = i64toi32_i32$0 >> 31 | 0;
-   $21 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
+   $19 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
   } else {
    i64toi32_i32$1 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
-   $21 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+   $19 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
   }
-  var$2 = $21;
+  var$2 = $19;
   var$2$hi = i64toi32_i32$1;
   i64toi32_i32$1 = var$0$hi;
   i64toi32_i32$1 = var$2$hi;
@@ -4194,86 +4192,86 @@ function asmFunc(global, env, buffer) {
   i64toi32_i32$1 = i64toi32_i32$0 ^ i64toi32_i32$3 | 0;
   i64toi32_i32$0 = var$2$hi;
   i64toi32_i32$3 = var$2;
-  i64toi32_i32$4 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$5 = i64toi32_i32$6 + i64toi32_i32$0 | 0;
-  i64toi32_i32$5 = i64toi32_i32$2 - i64toi32_i32$5 | 0;
-  $9 = i64toi32_i32$4;
-  $9$hi = i64toi32_i32$5;
-  i64toi32_i32$5 = var$1$hi;
-  i64toi32_i32$2 = var$1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$0 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$5 >> 31 | 0;
-   $22 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
+  i64toi32_i32$4 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
+  i64toi32_i32$1 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
+  i64toi32_i32$0 = i64toi32_i32$4 + i64toi32_i32$0 | 0;
+  i64toi32_i32$0 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
+  $9 = i64toi32_i32$1;
+  $9$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = var$1$hi;
+  i64toi32_i32$3 = var$1;
+  i64toi32_i32$2 = 0;
+  i64toi32_i32$4 = 63;
+  i64toi32_i32$1 = i64toi32_i32$4 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$4 & 63 | 0) >>> 0) {
+   i64toi32_i32$2 = i64toi32_i32$0 >> 31 | 0;
+   $20 = i64toi32_i32$0 >> i64toi32_i32$1 | 0;
   } else {
-   i64toi32_i32$1 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
-   $22 = (((1 << i64toi32_i32$0 | 0) - 1 | 0) & i64toi32_i32$5 | 0) << (32 - i64toi32_i32$0 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$0 | 0) | 0;
+   i64toi32_i32$2 = i64toi32_i32$0 >> i64toi32_i32$1 | 0;
+   $20 = (((1 << i64toi32_i32$1 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$1 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$1 | 0) | 0;
   }
-  var$2 = $22;
-  var$2$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$1$hi;
-  i64toi32_i32$1 = var$2$hi;
-  i64toi32_i32$5 = var$2;
+  var$2 = $20;
+  var$2$hi = i64toi32_i32$2;
   i64toi32_i32$2 = var$1$hi;
-  i64toi32_i32$3 = var$1;
-  i64toi32_i32$2 = i64toi32_i32$1 ^ i64toi32_i32$2 | 0;
-  $14$hi = i64toi32_i32$2;
-  i64toi32_i32$2 = i64toi32_i32$1;
-  i64toi32_i32$2 = $14$hi;
-  i64toi32_i32$1 = i64toi32_i32$5 ^ i64toi32_i32$3 | 0;
-  i64toi32_i32$5 = var$2$hi;
-  i64toi32_i32$3 = var$2;
-  i64toi32_i32$0 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$4 = i64toi32_i32$6 + i64toi32_i32$5 | 0;
-  i64toi32_i32$4 = i64toi32_i32$2 - i64toi32_i32$4 | 0;
-  $16$hi = i64toi32_i32$4;
-  i64toi32_i32$4 = $9$hi;
-  i64toi32_i32$1 = $16$hi;
-  i64toi32_i32$1 = __wasm_i64_udiv($9 | 0, i64toi32_i32$4 | 0, i64toi32_i32$0 | 0, i64toi32_i32$1 | 0) | 0;
-  i64toi32_i32$4 = i64toi32_i32$HIGH_BITS;
-  $17 = i64toi32_i32$1;
-  $17$hi = i64toi32_i32$4;
-  i64toi32_i32$4 = var$1$hi;
-  i64toi32_i32$4 = var$0$hi;
-  i64toi32_i32$4 = var$1$hi;
-  i64toi32_i32$2 = var$1;
-  i64toi32_i32$1 = var$0$hi;
-  i64toi32_i32$3 = var$0;
-  i64toi32_i32$1 = i64toi32_i32$4 ^ i64toi32_i32$1 | 0;
-  i64toi32_i32$4 = i64toi32_i32$2 ^ i64toi32_i32$3 | 0;
-  i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$5 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = i64toi32_i32$1 >> 31 | 0;
-   $23 = i64toi32_i32$1 >> i64toi32_i32$5 | 0;
-  } else {
-   i64toi32_i32$2 = i64toi32_i32$1 >> i64toi32_i32$5 | 0;
-   $23 = (((1 << i64toi32_i32$5 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$5 | 0) | 0 | (i64toi32_i32$4 >>> i64toi32_i32$5 | 0) | 0;
+  i64toi32_i32$2 = var$2$hi;
+  i64toi32_i32$0 = var$2;
+  i64toi32_i32$3 = var$1$hi;
+  i64toi32_i32$4 = var$1;
+  i64toi32_i32$3 = i64toi32_i32$2 ^ i64toi32_i32$3 | 0;
+  $14$hi = i64toi32_i32$3;
+  i64toi32_i32$3 = i64toi32_i32$2;
+  i64toi32_i32$3 = $14$hi;
+  i64toi32_i32$2 = i64toi32_i32$0 ^ i64toi32_i32$4 | 0;
+  i64toi32_i32$0 = var$2$hi;
+  i64toi32_i32$4 = var$2;
+  i64toi32_i32$1 = i64toi32_i32$2 >>> 0 < i64toi32_i32$4 >>> 0;
+  i64toi32_i32$2 = i64toi32_i32$2 - i64toi32_i32$4 | 0;
+  i64toi32_i32$0 = i64toi32_i32$1 + i64toi32_i32$0 | 0;
+  i64toi32_i32$0 = i64toi32_i32$3 - i64toi32_i32$0 | 0;
+  $16$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = $9$hi;
+  i64toi32_i32$3 = $16$hi;
+  i64toi32_i32$3 = __wasm_i64_udiv($9 | 0, i64toi32_i32$0 | 0, i64toi32_i32$2 | 0, i64toi32_i32$3 | 0) | 0;
+  i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
+  $17 = i64toi32_i32$3;
+  $17$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = var$1$hi;
+  i64toi32_i32$0 = var$0$hi;
+  i64toi32_i32$0 = var$1$hi;
+  i64toi32_i32$4 = var$1;
+  i64toi32_i32$3 = var$0$hi;
+  i64toi32_i32$1 = var$0;
+  i64toi32_i32$3 = i64toi32_i32$0 ^ i64toi32_i32$3 | 0;
+  i64toi32_i32$0 = i64toi32_i32$4 ^ i64toi32_i32$1 | 0;
+  i64toi32_i32$4 = 0;
+  i64toi32_i32$1 = 63;
+  i64toi32_i32$2 = i64toi32_i32$1 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$1 & 63 | 0) >>> 0) {
+   i64toi32_i32$4 = i64toi32_i32$3 >> 31 | 0;
+   $21 = i64toi32_i32$3 >> i64toi32_i32$2 | 0;
+  } else {
+   i64toi32_i32$4 = i64toi32_i32$3 >> i64toi32_i32$2 | 0;
+   $21 = (((1 << i64toi32_i32$2 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$2 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$2 | 0) | 0;
   }
-  var$0 = $23;
-  var$0$hi = i64toi32_i32$2;
-  i64toi32_i32$2 = $17$hi;
-  i64toi32_i32$1 = $17;
-  i64toi32_i32$4 = var$0$hi;
-  i64toi32_i32$3 = var$0;
-  i64toi32_i32$4 = i64toi32_i32$2 ^ i64toi32_i32$4 | 0;
-  $23$hi = i64toi32_i32$4;
-  i64toi32_i32$4 = var$0$hi;
-  i64toi32_i32$4 = $23$hi;
-  i64toi32_i32$2 = i64toi32_i32$1 ^ i64toi32_i32$3 | 0;
-  i64toi32_i32$1 = var$0$hi;
-  i64toi32_i32$5 = i64toi32_i32$2 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$2 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$0 = i64toi32_i32$6 + i64toi32_i32$1 | 0;
-  i64toi32_i32$0 = i64toi32_i32$4 - i64toi32_i32$0 | 0;
-  i64toi32_i32$2 = i64toi32_i32$5;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
-  return i64toi32_i32$2 | 0;
+  var$0 = $21;
+  var$0$hi = i64toi32_i32$4;
+  i64toi32_i32$4 = $17$hi;
+  i64toi32_i32$3 = $17;
+  i64toi32_i32$0 = var$0$hi;
+  i64toi32_i32$1 = var$0;
+  i64toi32_i32$0 = i64toi32_i32$4 ^ i64toi32_i32$0 | 0;
+  $23$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = var$0$hi;
+  i64toi32_i32$0 = $23$hi;
+  i64toi32_i32$4 = i64toi32_i32$3 ^ i64toi32_i32$1 | 0;
+  i64toi32_i32$3 = var$0$hi;
+  i64toi32_i32$2 = i64toi32_i32$4 >>> 0 < i64toi32_i32$1 >>> 0;
+  i64toi32_i32$4 = i64toi32_i32$4 - i64toi32_i32$1 | 0;
+  i64toi32_i32$3 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
+  i64toi32_i32$3 = i64toi32_i32$0 - i64toi32_i32$3 | 0;
+  i64toi32_i32$0 = i64toi32_i32$4;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$3;
+  return i64toi32_i32$0 | 0;
  }
  
  function __wasm_i64_sdiv(var$0, var$0$hi, var$1, var$1$hi) {
@@ -4297,7 +4295,7 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$4 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, i64toi32_i32$6 = 0, $37 = 0, $38 = 0, $39 = 0, $40 = 0, $41 = 0, $42 = 0, $43 = 0, $44 = 0, var$8$hi = 0, $45 = 0, $46 = 0, $47 = 0, $48 = 0, var$7$hi = 0, $49 = 0, $63$hi = 0, $65 = 0, $65$hi = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142$hi = 0, $144 = 0, $144$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0;
+  var i64toi32_i32$4 = 0, i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, var$2 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, $35 = 0, $36 = 0, $37 = 0, $38 = 0, $39 = 0, $40 = 0, $41 = 0, $42 = 0, var$8$hi = 0, $43 = 0, $44 = 0, $45 = 0, $46 = 0, var$7$hi = 0, $47 = 0, $63$hi = 0, $65 = 0, $65$hi = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142$hi = 0, $144 = 0, $144$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0;
   label$1 : {
    label$2 : {
     label$3 : {
@@ -4316,12 +4314,12 @@ function asmFunc(global, env, buffer) {
              i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
              if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
               i64toi32_i32$1 = 0;
-              $37 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
+              $35 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
              } else {
               i64toi32_i32$1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-              $37 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+              $35 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
              }
-             var$2 = $37;
+             var$2 = $35;
              if (var$2) {
               block : {
                i64toi32_i32$1 = var$1$hi;
@@ -4336,12 +4334,12 @@ function asmFunc(global, env, buffer) {
                i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
                if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
                 i64toi32_i32$2 = 0;
-                $38 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
+                $36 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
                } else {
                 i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-                $38 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
+                $36 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
                }
-               var$4 = $38;
+               var$4 = $36;
                if (!var$4) {
                 break label$9
                }
@@ -4378,12 +4376,12 @@ function asmFunc(global, env, buffer) {
             i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
             if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
              i64toi32_i32$1 = 0;
-             $39 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
+             $37 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
             } else {
              i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-             $39 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
+             $37 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
             }
-            var$3 = $39;
+            var$3 = $37;
             i64toi32_i32$1 = var$0$hi;
             if (!var$0) {
              break label$7
@@ -4402,10 +4400,10 @@ function asmFunc(global, env, buffer) {
             i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
             if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
              i64toi32_i32$3 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-             $40 = 0;
+             $38 = 0;
             } else {
              i64toi32_i32$3 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-             $40 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
+             $38 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
             }
             $63$hi = i64toi32_i32$3;
             i64toi32_i32$3 = var$0$hi;
@@ -4416,7 +4414,7 @@ function asmFunc(global, env, buffer) {
             $65 = i64toi32_i32$1 & i64toi32_i32$0 | 0;
             $65$hi = i64toi32_i32$2;
             i64toi32_i32$2 = $63$hi;
-            i64toi32_i32$3 = $40;
+            i64toi32_i32$3 = $38;
             i64toi32_i32$1 = $65$hi;
             i64toi32_i32$0 = $65;
             i64toi32_i32$1 = i64toi32_i32$2 | i64toi32_i32$1 | 0;
@@ -4447,12 +4445,12 @@ function asmFunc(global, env, buffer) {
         i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
         if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
          i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-         $41 = 0;
+         $39 = 0;
         } else {
          i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $41 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
+         $39 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
         }
-        legalfunc$wasm2js_scratch_store_i64($41 | 0, i64toi32_i32$1 | 0);
+        legalfunc$wasm2js_scratch_store_i64($39 | 0, i64toi32_i32$1 | 0);
         i64toi32_i32$1 = 0;
         i64toi32_i32$2 = var$4;
         i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
@@ -4480,12 +4478,12 @@ function asmFunc(global, env, buffer) {
       i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
       if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
        i64toi32_i32$1 = 0;
-       $42 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
+       $40 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
       } else {
        i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-       $42 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
+       $40 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
       }
-      i64toi32_i32$3 = $42;
+      i64toi32_i32$3 = $40;
       i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
       return i64toi32_i32$3 | 0;
      }
@@ -4502,12 +4500,12 @@ function asmFunc(global, env, buffer) {
     i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
     if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
      i64toi32_i32$1 = 0;
-     $43 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
+     $41 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
     } else {
      i64toi32_i32$1 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
-     $43 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+     $41 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
     }
-    var$5 = $43;
+    var$5 = $41;
     var$5$hi = i64toi32_i32$1;
     i64toi32_i32$1 = var$0$hi;
     i64toi32_i32$1 = 0;
@@ -4519,12 +4517,12 @@ function asmFunc(global, env, buffer) {
     i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
     if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
      i64toi32_i32$2 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
-     $44 = 0;
+     $42 = 0;
     } else {
      i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$3 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-     $44 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
+     $42 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
     }
-    var$0 = $44;
+    var$0 = $42;
     var$0$hi = i64toi32_i32$2;
     label$13 : {
      if (var$2) {
@@ -4533,121 +4531,121 @@ function asmFunc(global, env, buffer) {
        i64toi32_i32$1 = var$1;
        i64toi32_i32$3 = -1;
        i64toi32_i32$0 = -1;
-       i64toi32_i32$4 = i64toi32_i32$1 + i64toi32_i32$0 | 0;
-       i64toi32_i32$5 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
-       if (i64toi32_i32$4 >>> 0 < i64toi32_i32$0 >>> 0) {
-        i64toi32_i32$5 = i64toi32_i32$5 + 1 | 0
+       i64toi32_i32$1 = i64toi32_i32$1 + i64toi32_i32$0 | 0;
+       i64toi32_i32$2 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
+       if (i64toi32_i32$1 >>> 0 < i64toi32_i32$0 >>> 0) {
+        i64toi32_i32$2 = i64toi32_i32$2 + 1 | 0
        }
-       var$8 = i64toi32_i32$4;
-       var$8$hi = i64toi32_i32$5;
+       var$8 = i64toi32_i32$1;
+       var$8$hi = i64toi32_i32$2;
        label$15 : while (1) {
-        i64toi32_i32$5 = var$5$hi;
-        i64toi32_i32$2 = var$5;
-        i64toi32_i32$1 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
-         $45 = 0;
+        i64toi32_i32$2 = var$5$hi;
+        i64toi32_i32$3 = var$5;
+        i64toi32_i32$0 = 0;
+        i64toi32_i32$1 = 1;
+        i64toi32_i32$4 = i64toi32_i32$1 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$1 & 63 | 0) >>> 0) {
+         i64toi32_i32$0 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
+         $43 = 0;
         } else {
-         i64toi32_i32$1 = ((1 << i64toi32_i32$3 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$3 | 0) | 0) | 0 | (i64toi32_i32$5 << i64toi32_i32$3 | 0) | 0;
-         $45 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
+         i64toi32_i32$0 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$3 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$2 << i64toi32_i32$4 | 0) | 0;
+         $43 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
         }
-        $140 = $45;
-        $140$hi = i64toi32_i32$1;
-        i64toi32_i32$1 = var$0$hi;
-        i64toi32_i32$5 = var$0;
-        i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 63;
-        i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = 0;
-         $46 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
+        $140 = $43;
+        $140$hi = i64toi32_i32$0;
+        i64toi32_i32$0 = var$0$hi;
+        i64toi32_i32$2 = var$0;
+        i64toi32_i32$3 = 0;
+        i64toi32_i32$1 = 63;
+        i64toi32_i32$4 = i64toi32_i32$1 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$1 & 63 | 0) >>> 0) {
+         i64toi32_i32$3 = 0;
+         $44 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
         } else {
-         i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
-         $46 = (((1 << i64toi32_i32$3 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$3 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$3 | 0) | 0;
+         i64toi32_i32$3 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
+         $44 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
         }
-        $142$hi = i64toi32_i32$2;
-        i64toi32_i32$2 = $140$hi;
-        i64toi32_i32$1 = $140;
-        i64toi32_i32$5 = $142$hi;
-        i64toi32_i32$0 = $46;
-        i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
-        var$5 = i64toi32_i32$1 | i64toi32_i32$0 | 0;
-        var$5$hi = i64toi32_i32$5;
+        $142$hi = i64toi32_i32$3;
+        i64toi32_i32$3 = $140$hi;
+        i64toi32_i32$0 = $140;
+        i64toi32_i32$2 = $142$hi;
+        i64toi32_i32$1 = $44;
+        i64toi32_i32$2 = i64toi32_i32$3 | i64toi32_i32$2 | 0;
+        var$5 = i64toi32_i32$0 | i64toi32_i32$1 | 0;
+        var$5$hi = i64toi32_i32$2;
         $144 = var$5;
-        $144$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = var$8$hi;
-        i64toi32_i32$5 = var$5$hi;
-        i64toi32_i32$5 = var$8$hi;
-        i64toi32_i32$2 = var$8;
-        i64toi32_i32$1 = var$5$hi;
-        i64toi32_i32$0 = var$5;
-        i64toi32_i32$3 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
-        i64toi32_i32$6 = i64toi32_i32$2 >>> 0 < i64toi32_i32$0 >>> 0;
-        i64toi32_i32$4 = i64toi32_i32$6 + i64toi32_i32$1 | 0;
-        i64toi32_i32$4 = i64toi32_i32$5 - i64toi32_i32$4 | 0;
-        i64toi32_i32$5 = i64toi32_i32$3;
+        $144$hi = i64toi32_i32$2;
+        i64toi32_i32$2 = var$8$hi;
+        i64toi32_i32$2 = var$5$hi;
+        i64toi32_i32$2 = var$8$hi;
+        i64toi32_i32$3 = var$8;
+        i64toi32_i32$0 = var$5$hi;
+        i64toi32_i32$1 = var$5;
+        i64toi32_i32$4 = i64toi32_i32$3 >>> 0 < i64toi32_i32$1 >>> 0;
+        i64toi32_i32$3 = i64toi32_i32$3 - i64toi32_i32$1 | 0;
+        i64toi32_i32$0 = i64toi32_i32$4 + i64toi32_i32$0 | 0;
+        i64toi32_i32$0 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
+        i64toi32_i32$1 = i64toi32_i32$3;
         i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 63;
-        i64toi32_i32$1 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = i64toi32_i32$4 >> 31 | 0;
-         $47 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
+        i64toi32_i32$4 = 63;
+        i64toi32_i32$3 = i64toi32_i32$4 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$4 & 63 | 0) >>> 0) {
+         i64toi32_i32$2 = i64toi32_i32$0 >> 31 | 0;
+         $45 = i64toi32_i32$0 >> i64toi32_i32$3 | 0;
         } else {
-         i64toi32_i32$2 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
-         $47 = (((1 << i64toi32_i32$1 | 0) - 1 | 0) & i64toi32_i32$4 | 0) << (32 - i64toi32_i32$1 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$1 | 0) | 0;
+         i64toi32_i32$2 = i64toi32_i32$0 >> i64toi32_i32$3 | 0;
+         $45 = (((1 << i64toi32_i32$3 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$3 | 0) | 0 | (i64toi32_i32$1 >>> i64toi32_i32$3 | 0) | 0;
         }
-        var$6 = $47;
+        var$6 = $45;
         var$6$hi = i64toi32_i32$2;
         i64toi32_i32$2 = var$1$hi;
         i64toi32_i32$2 = var$6$hi;
-        i64toi32_i32$4 = var$6;
-        i64toi32_i32$5 = var$1$hi;
-        i64toi32_i32$0 = var$1;
-        i64toi32_i32$5 = i64toi32_i32$2 & i64toi32_i32$5 | 0;
-        $151 = i64toi32_i32$4 & i64toi32_i32$0 | 0;
-        $151$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = $144$hi;
+        i64toi32_i32$0 = var$6;
+        i64toi32_i32$1 = var$1$hi;
+        i64toi32_i32$4 = var$1;
+        i64toi32_i32$1 = i64toi32_i32$2 & i64toi32_i32$1 | 0;
+        $151 = i64toi32_i32$0 & i64toi32_i32$4 | 0;
+        $151$hi = i64toi32_i32$1;
+        i64toi32_i32$1 = $144$hi;
         i64toi32_i32$2 = $144;
-        i64toi32_i32$4 = $151$hi;
-        i64toi32_i32$0 = $151;
-        i64toi32_i32$1 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
-        i64toi32_i32$6 = i64toi32_i32$2 >>> 0 < i64toi32_i32$0 >>> 0;
-        i64toi32_i32$3 = i64toi32_i32$6 + i64toi32_i32$4 | 0;
-        i64toi32_i32$3 = i64toi32_i32$5 - i64toi32_i32$3 | 0;
-        var$5 = i64toi32_i32$1;
-        var$5$hi = i64toi32_i32$3;
-        i64toi32_i32$3 = var$0$hi;
-        i64toi32_i32$5 = var$0;
-        i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-         $48 = 0;
+        i64toi32_i32$0 = $151$hi;
+        i64toi32_i32$4 = $151;
+        i64toi32_i32$3 = i64toi32_i32$2 >>> 0 < i64toi32_i32$4 >>> 0;
+        i64toi32_i32$2 = i64toi32_i32$2 - i64toi32_i32$4 | 0;
+        i64toi32_i32$0 = i64toi32_i32$3 + i64toi32_i32$0 | 0;
+        i64toi32_i32$0 = i64toi32_i32$1 - i64toi32_i32$0 | 0;
+        var$5 = i64toi32_i32$2;
+        var$5$hi = i64toi32_i32$0;
+        i64toi32_i32$0 = var$0$hi;
+        i64toi32_i32$4 = var$0;
+        i64toi32_i32$1 = 0;
+        i64toi32_i32$3 = 1;
+        i64toi32_i32$2 = i64toi32_i32$3 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
+         i64toi32_i32$1 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
+         $46 = 0;
         } else {
-         i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $48 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
+         i64toi32_i32$1 = ((1 << i64toi32_i32$2 | 0) - 1 | 0) & (i64toi32_i32$4 >>> (32 - i64toi32_i32$2 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$2 | 0) | 0;
+         $46 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
         }
-        $154$hi = i64toi32_i32$2;
-        i64toi32_i32$2 = var$7$hi;
-        i64toi32_i32$2 = $154$hi;
-        i64toi32_i32$3 = $48;
-        i64toi32_i32$5 = var$7$hi;
-        i64toi32_i32$0 = var$7;
-        i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
-        var$0 = i64toi32_i32$3 | i64toi32_i32$0 | 0;
-        var$0$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = var$6$hi;
-        i64toi32_i32$2 = var$6;
-        i64toi32_i32$3 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$3 = i64toi32_i32$5 & i64toi32_i32$3 | 0;
-        var$6 = i64toi32_i32$2 & i64toi32_i32$0 | 0;
-        var$6$hi = i64toi32_i32$3;
+        $154$hi = i64toi32_i32$1;
+        i64toi32_i32$1 = var$7$hi;
+        i64toi32_i32$1 = $154$hi;
+        i64toi32_i32$0 = $46;
+        i64toi32_i32$4 = var$7$hi;
+        i64toi32_i32$3 = var$7;
+        i64toi32_i32$4 = i64toi32_i32$1 | i64toi32_i32$4 | 0;
+        var$0 = i64toi32_i32$0 | i64toi32_i32$3 | 0;
+        var$0$hi = i64toi32_i32$4;
+        i64toi32_i32$4 = var$6$hi;
+        i64toi32_i32$1 = var$6;
+        i64toi32_i32$0 = 0;
+        i64toi32_i32$3 = 1;
+        i64toi32_i32$0 = i64toi32_i32$4 & i64toi32_i32$0 | 0;
+        var$6 = i64toi32_i32$1 & i64toi32_i32$3 | 0;
+        var$6$hi = i64toi32_i32$0;
         var$7 = var$6;
-        var$7$hi = i64toi32_i32$3;
+        var$7$hi = i64toi32_i32$0;
         var$2 = var$2 + -1 | 0;
         if (var$2) {
          continue label$15
@@ -4658,41 +4656,41 @@ function asmFunc(global, env, buffer) {
       }
      }
     }
-    i64toi32_i32$3 = var$5$hi;
-    legalfunc$wasm2js_scratch_store_i64(var$5 | 0, i64toi32_i32$3 | 0);
-    i64toi32_i32$3 = var$0$hi;
-    i64toi32_i32$5 = var$0;
-    i64toi32_i32$2 = 0;
-    i64toi32_i32$0 = 1;
-    i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-    if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-     i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-     $49 = 0;
+    i64toi32_i32$0 = var$5$hi;
+    legalfunc$wasm2js_scratch_store_i64(var$5 | 0, i64toi32_i32$0 | 0);
+    i64toi32_i32$0 = var$0$hi;
+    i64toi32_i32$4 = var$0;
+    i64toi32_i32$1 = 0;
+    i64toi32_i32$3 = 1;
+    i64toi32_i32$2 = i64toi32_i32$3 & 31 | 0;
+    if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
+     i64toi32_i32$1 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
+     $47 = 0;
     } else {
-     i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-     $49 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
+     i64toi32_i32$1 = ((1 << i64toi32_i32$2 | 0) - 1 | 0) & (i64toi32_i32$4 >>> (32 - i64toi32_i32$2 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$2 | 0) | 0;
+     $47 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
     }
-    $165$hi = i64toi32_i32$2;
-    i64toi32_i32$2 = var$6$hi;
-    i64toi32_i32$2 = $165$hi;
-    i64toi32_i32$3 = $49;
-    i64toi32_i32$5 = var$6$hi;
-    i64toi32_i32$0 = var$6;
-    i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
-    i64toi32_i32$3 = i64toi32_i32$3 | i64toi32_i32$0 | 0;
-    i64toi32_i32$HIGH_BITS = i64toi32_i32$5;
-    return i64toi32_i32$3 | 0;
+    $165$hi = i64toi32_i32$1;
+    i64toi32_i32$1 = var$6$hi;
+    i64toi32_i32$1 = $165$hi;
+    i64toi32_i32$0 = $47;
+    i64toi32_i32$4 = var$6$hi;
+    i64toi32_i32$3 = var$6;
+    i64toi32_i32$4 = i64toi32_i32$1 | i64toi32_i32$4 | 0;
+    i64toi32_i32$0 = i64toi32_i32$0 | i64toi32_i32$3 | 0;
+    i64toi32_i32$HIGH_BITS = i64toi32_i32$4;
+    return i64toi32_i32$0 | 0;
    }
-   i64toi32_i32$3 = var$0$hi;
-   legalfunc$wasm2js_scratch_store_i64(var$0 | 0, i64toi32_i32$3 | 0);
-   i64toi32_i32$3 = 0;
+   i64toi32_i32$0 = var$0$hi;
+   legalfunc$wasm2js_scratch_store_i64(var$0 | 0, i64toi32_i32$0 | 0);
+   i64toi32_i32$0 = 0;
    var$0 = 0;
-   var$0$hi = i64toi32_i32$3;
+   var$0$hi = i64toi32_i32$0;
   }
-  i64toi32_i32$3 = var$0$hi;
-  i64toi32_i32$5 = var$0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$3;
-  return i64toi32_i32$5 | 0;
+  i64toi32_i32$0 = var$0$hi;
+  i64toi32_i32$4 = var$0;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
+  return i64toi32_i32$4 | 0;
  }
  
  function __wasm_i64_udiv(var$0, var$0$hi, var$1, var$1$hi) {
@@ -4888,7 +4886,7 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$1 = 0, i64toi32_i32$4 = 0, i64toi32_i32$2 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, i64toi32_i32$5 = 0, var$2$hi = 0, i64toi32_i32$6 = 0, var$2 = 0, $20 = 0, $21 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17$hi = 0, $19$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, var$2$hi = 0, var$2 = 0, $18 = 0, $19 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17$hi = 0, $19$hi = 0;
   i64toi32_i32$0 = var$0$hi;
   i64toi32_i32$2 = var$0;
   i64toi32_i32$1 = 0;
@@ -4896,12 +4894,12 @@ function asmFunc(global, env, buffer) {
   i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
   if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
    i64toi32_i32$1 = i64toi32_i32$0 >> 31 | 0;
-   $20 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
+   $18 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
   } else {
    i64toi32_i32$1 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
-   $20 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+   $18 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
   }
-  var$2 = $20;
+  var$2 = $18;
   var$2$hi = i64toi32_i32$1;
   i64toi32_i32$1 = var$0$hi;
   i64toi32_i32$1 = var$2$hi;
@@ -4915,66 +4913,66 @@ function asmFunc(global, env, buffer) {
   i64toi32_i32$1 = i64toi32_i32$0 ^ i64toi32_i32$3 | 0;
   i64toi32_i32$0 = var$2$hi;
   i64toi32_i32$3 = var$2;
-  i64toi32_i32$4 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$5 = i64toi32_i32$6 + i64toi32_i32$0 | 0;
-  i64toi32_i32$5 = i64toi32_i32$2 - i64toi32_i32$5 | 0;
-  $9 = i64toi32_i32$4;
-  $9$hi = i64toi32_i32$5;
-  i64toi32_i32$5 = var$1$hi;
-  i64toi32_i32$2 = var$1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$0 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$5 >> 31 | 0;
-   $21 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
+  i64toi32_i32$4 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
+  i64toi32_i32$1 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
+  i64toi32_i32$0 = i64toi32_i32$4 + i64toi32_i32$0 | 0;
+  i64toi32_i32$0 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
+  $9 = i64toi32_i32$1;
+  $9$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = var$1$hi;
+  i64toi32_i32$3 = var$1;
+  i64toi32_i32$2 = 0;
+  i64toi32_i32$4 = 63;
+  i64toi32_i32$1 = i64toi32_i32$4 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$4 & 63 | 0) >>> 0) {
+   i64toi32_i32$2 = i64toi32_i32$0 >> 31 | 0;
+   $19 = i64toi32_i32$0 >> i64toi32_i32$1 | 0;
   } else {
-   i64toi32_i32$1 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
-   $21 = (((1 << i64toi32_i32$0 | 0) - 1 | 0) & i64toi32_i32$5 | 0) << (32 - i64toi32_i32$0 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$0 | 0) | 0;
+   i64toi32_i32$2 = i64toi32_i32$0 >> i64toi32_i32$1 | 0;
+   $19 = (((1 << i64toi32_i32$1 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$1 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$1 | 0) | 0;
   }
-  var$0 = $21;
-  var$0$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$1$hi;
-  i64toi32_i32$1 = var$0$hi;
-  i64toi32_i32$5 = var$0;
+  var$0 = $19;
+  var$0$hi = i64toi32_i32$2;
   i64toi32_i32$2 = var$1$hi;
-  i64toi32_i32$3 = var$1;
-  i64toi32_i32$2 = i64toi32_i32$1 ^ i64toi32_i32$2 | 0;
-  $14$hi = i64toi32_i32$2;
-  i64toi32_i32$2 = i64toi32_i32$1;
-  i64toi32_i32$2 = $14$hi;
-  i64toi32_i32$1 = i64toi32_i32$5 ^ i64toi32_i32$3 | 0;
-  i64toi32_i32$5 = var$0$hi;
-  i64toi32_i32$3 = var$0;
-  i64toi32_i32$0 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$4 = i64toi32_i32$6 + i64toi32_i32$5 | 0;
-  i64toi32_i32$4 = i64toi32_i32$2 - i64toi32_i32$4 | 0;
-  $16$hi = i64toi32_i32$4;
-  i64toi32_i32$4 = $9$hi;
-  i64toi32_i32$1 = $16$hi;
-  i64toi32_i32$1 = __wasm_i64_urem($9 | 0, i64toi32_i32$4 | 0, i64toi32_i32$0 | 0, i64toi32_i32$1 | 0) | 0;
-  i64toi32_i32$4 = i64toi32_i32$HIGH_BITS;
-  $17$hi = i64toi32_i32$4;
+  i64toi32_i32$2 = var$0$hi;
+  i64toi32_i32$0 = var$0;
+  i64toi32_i32$3 = var$1$hi;
+  i64toi32_i32$4 = var$1;
+  i64toi32_i32$3 = i64toi32_i32$2 ^ i64toi32_i32$3 | 0;
+  $14$hi = i64toi32_i32$3;
+  i64toi32_i32$3 = i64toi32_i32$2;
+  i64toi32_i32$3 = $14$hi;
+  i64toi32_i32$2 = i64toi32_i32$0 ^ i64toi32_i32$4 | 0;
+  i64toi32_i32$0 = var$0$hi;
+  i64toi32_i32$4 = var$0;
+  i64toi32_i32$1 = i64toi32_i32$2 >>> 0 < i64toi32_i32$4 >>> 0;
+  i64toi32_i32$2 = i64toi32_i32$2 - i64toi32_i32$4 | 0;
+  i64toi32_i32$0 = i64toi32_i32$1 + i64toi32_i32$0 | 0;
+  i64toi32_i32$0 = i64toi32_i32$3 - i64toi32_i32$0 | 0;
+  $16$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = $9$hi;
+  i64toi32_i32$3 = $16$hi;
+  i64toi32_i32$3 = __wasm_i64_urem($9 | 0, i64toi32_i32$0 | 0, i64toi32_i32$2 | 0, i64toi32_i32$3 | 0) | 0;
+  i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
+  $17$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = var$2$hi;
+  i64toi32_i32$0 = $17$hi;
+  i64toi32_i32$4 = i64toi32_i32$3;
+  i64toi32_i32$3 = var$2$hi;
+  i64toi32_i32$1 = var$2;
+  i64toi32_i32$3 = i64toi32_i32$0 ^ i64toi32_i32$3 | 0;
+  $19$hi = i64toi32_i32$3;
+  i64toi32_i32$3 = var$2$hi;
+  i64toi32_i32$3 = $19$hi;
+  i64toi32_i32$0 = i64toi32_i32$4 ^ i64toi32_i32$1 | 0;
   i64toi32_i32$4 = var$2$hi;
-  i64toi32_i32$4 = $17$hi;
-  i64toi32_i32$2 = i64toi32_i32$1;
-  i64toi32_i32$1 = var$2$hi;
-  i64toi32_i32$3 = var$2;
-  i64toi32_i32$1 = i64toi32_i32$4 ^ i64toi32_i32$1 | 0;
-  $19$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$2$hi;
-  i64toi32_i32$1 = $19$hi;
-  i64toi32_i32$4 = i64toi32_i32$2 ^ i64toi32_i32$3 | 0;
-  i64toi32_i32$2 = var$2$hi;
-  i64toi32_i32$5 = i64toi32_i32$4 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$4 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$0 = i64toi32_i32$6 + i64toi32_i32$2 | 0;
-  i64toi32_i32$0 = i64toi32_i32$1 - i64toi32_i32$0 | 0;
-  i64toi32_i32$4 = i64toi32_i32$5;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
-  return i64toi32_i32$4 | 0;
+  i64toi32_i32$2 = i64toi32_i32$0 >>> 0 < i64toi32_i32$1 >>> 0;
+  i64toi32_i32$0 = i64toi32_i32$0 - i64toi32_i32$1 | 0;
+  i64toi32_i32$4 = i64toi32_i32$2 + i64toi32_i32$4 | 0;
+  i64toi32_i32$4 = i64toi32_i32$3 - i64toi32_i32$4 | 0;
+  i64toi32_i32$3 = i64toi32_i32$0;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$4;
+  return i64toi32_i32$0 | 0;
  }
  
  function __wasm_i64_srem(var$0, var$0$hi, var$1, var$1$hi) {
@@ -4998,7 +4996,7 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$4 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, i64toi32_i32$6 = 0, $37 = 0, $38 = 0, $39 = 0, $40 = 0, $41 = 0, $42 = 0, $43 = 0, $44 = 0, var$8$hi = 0, $45 = 0, $46 = 0, $47 = 0, $48 = 0, var$7$hi = 0, $49 = 0, $63$hi = 0, $65 = 0, $65$hi = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142$hi = 0, $144 = 0, $144$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0;
+  var i64toi32_i32$4 = 0, i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, var$2 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, $35 = 0, $36 = 0, $37 = 0, $38 = 0, $39 = 0, $40 = 0, $41 = 0, $42 = 0, var$8$hi = 0, $43 = 0, $44 = 0, $45 = 0, $46 = 0, var$7$hi = 0, $47 = 0, $63$hi = 0, $65 = 0, $65$hi = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142$hi = 0, $144 = 0, $144$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0;
   label$1 : {
    label$2 : {
     label$3 : {
@@ -5017,12 +5015,12 @@ function asmFunc(global, env, buffer) {
              i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
              if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
               i64toi32_i32$1 = 0;
-              $37 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
+              $35 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
              } else {
               i64toi32_i32$1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-              $37 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+              $35 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
              }
-             var$2 = $37;
+             var$2 = $35;
              if (var$2) {
               block : {
                i64toi32_i32$1 = var$1$hi;
@@ -5037,12 +5035,12 @@ function asmFunc(global, env, buffer) {
                i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
                if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
                 i64toi32_i32$2 = 0;
-                $38 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
+                $36 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
                } else {
                 i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-                $38 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
+                $36 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
                }
-               var$4 = $38;
+               var$4 = $36;
                if (!var$4) {
                 break label$9
                }
@@ -5079,12 +5077,12 @@ function asmFunc(global, env, buffer) {
             i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
             if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
              i64toi32_i32$1 = 0;
-             $39 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
+             $37 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
             } else {
              i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-             $39 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
+             $37 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
             }
-            var$3 = $39;
+            var$3 = $37;
             i64toi32_i32$1 = var$0$hi;
             if (!var$0) {
              break label$7
@@ -5103,10 +5101,10 @@ function asmFunc(global, env, buffer) {
             i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
             if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
              i64toi32_i32$3 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-             $40 = 0;
+             $38 = 0;
             } else {
              i64toi32_i32$3 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-             $40 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
+             $38 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
             }
             $63$hi = i64toi32_i32$3;
             i64toi32_i32$3 = var$0$hi;
@@ -5117,7 +5115,7 @@ function asmFunc(global, env, buffer) {
             $65 = i64toi32_i32$1 & i64toi32_i32$0 | 0;
             $65$hi = i64toi32_i32$2;
             i64toi32_i32$2 = $63$hi;
-            i64toi32_i32$3 = $40;
+            i64toi32_i32$3 = $38;
             i64toi32_i32$1 = $65$hi;
             i64toi32_i32$0 = $65;
             i64toi32_i32$1 = i64toi32_i32$2 | i64toi32_i32$1 | 0;
@@ -5148,12 +5146,12 @@ function asmFunc(global, env, buffer) {
         i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
         if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
          i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-         $41 = 0;
+         $39 = 0;
         } else {
          i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $41 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
+         $39 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
         }
-        legalfunc$wasm2js_scratch_store_i64($41 | 0, i64toi32_i32$1 | 0);
+        legalfunc$wasm2js_scratch_store_i64($39 | 0, i64toi32_i32$1 | 0);
         i64toi32_i32$1 = 0;
         i64toi32_i32$2 = var$4;
         i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
@@ -5181,12 +5179,12 @@ function asmFunc(global, env, buffer) {
       i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
       if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
        i64toi32_i32$1 = 0;
-       $42 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
+       $40 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
       } else {
        i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-       $42 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
+       $40 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
       }
-      i64toi32_i32$3 = $42;
+      i64toi32_i32$3 = $40;
       i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
       return i64toi32_i32$3 | 0;
      }
@@ -5203,12 +5201,12 @@ function asmFunc(global, env, buffer) {
     i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
     if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
      i64toi32_i32$1 = 0;
-     $43 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
+     $41 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
     } else {
      i64toi32_i32$1 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
-     $43 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+     $41 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
     }
-    var$5 = $43;
+    var$5 = $41;
     var$5$hi = i64toi32_i32$1;
     i64toi32_i32$1 = var$0$hi;
     i64toi32_i32$1 = 0;
@@ -5220,12 +5218,12 @@ function asmFunc(global, env, buffer) {
     i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
     if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
      i64toi32_i32$2 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
-     $44 = 0;
+     $42 = 0;
     } else {
      i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$3 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-     $44 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
+     $42 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
     }
-    var$0 = $44;
+    var$0 = $42;
     var$0$hi = i64toi32_i32$2;
     label$13 : {
      if (var$2) {
@@ -5234,121 +5232,121 @@ function asmFunc(global, env, buffer) {
        i64toi32_i32$1 = var$1;
        i64toi32_i32$3 = -1;
        i64toi32_i32$0 = -1;
-       i64toi32_i32$4 = i64toi32_i32$1 + i64toi32_i32$0 | 0;
-       i64toi32_i32$5 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
-       if (i64toi32_i32$4 >>> 0 < i64toi32_i32$0 >>> 0) {
-        i64toi32_i32$5 = i64toi32_i32$5 + 1 | 0
+       i64toi32_i32$1 = i64toi32_i32$1 + i64toi32_i32$0 | 0;
+       i64toi32_i32$2 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
+       if (i64toi32_i32$1 >>> 0 < i64toi32_i32$0 >>> 0) {
+        i64toi32_i32$2 = i64toi32_i32$2 + 1 | 0
        }
-       var$8 = i64toi32_i32$4;
-       var$8$hi = i64toi32_i32$5;
+       var$8 = i64toi32_i32$1;
+       var$8$hi = i64toi32_i32$2;
        label$15 : while (1) {
-        i64toi32_i32$5 = var$5$hi;
-        i64toi32_i32$2 = var$5;
-        i64toi32_i32$1 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
-         $45 = 0;
+        i64toi32_i32$2 = var$5$hi;
+        i64toi32_i32$3 = var$5;
+        i64toi32_i32$0 = 0;
+        i64toi32_i32$1 = 1;
+        i64toi32_i32$4 = i64toi32_i32$1 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$1 & 63 | 0) >>> 0) {
+         i64toi32_i32$0 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
+         $43 = 0;
         } else {
-         i64toi32_i32$1 = ((1 << i64toi32_i32$3 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$3 | 0) | 0) | 0 | (i64toi32_i32$5 << i64toi32_i32$3 | 0) | 0;
-         $45 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
+         i64toi32_i32$0 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$3 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$2 << i64toi32_i32$4 | 0) | 0;
+         $43 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
         }
-        $140 = $45;
-        $140$hi = i64toi32_i32$1;
-        i64toi32_i32$1 = var$0$hi;
-        i64toi32_i32$5 = var$0;
-        i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 63;
-        i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = 0;
-         $46 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
+        $140 = $43;
+        $140$hi = i64toi32_i32$0;
+        i64toi32_i32$0 = var$0$hi;
+        i64toi32_i32$2 = var$0;
+        i64toi32_i32$3 = 0;
+        i64toi32_i32$1 = 63;
+        i64toi32_i32$4 = i64toi32_i32$1 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$1 & 63 | 0) >>> 0) {
+         i64toi32_i32$3 = 0;
+         $44 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
         } else {
-         i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
-         $46 = (((1 << i64toi32_i32$3 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$3 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$3 | 0) | 0;
+         i64toi32_i32$3 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
+         $44 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
         }
-        $142$hi = i64toi32_i32$2;
-        i64toi32_i32$2 = $140$hi;
-        i64toi32_i32$1 = $140;
-        i64toi32_i32$5 = $142$hi;
-        i64toi32_i32$0 = $46;
-        i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
-        var$5 = i64toi32_i32$1 | i64toi32_i32$0 | 0;
-        var$5$hi = i64toi32_i32$5;
+        $142$hi = i64toi32_i32$3;
+        i64toi32_i32$3 = $140$hi;
+        i64toi32_i32$0 = $140;
+        i64toi32_i32$2 = $142$hi;
+        i64toi32_i32$1 = $44;
+        i64toi32_i32$2 = i64toi32_i32$3 | i64toi32_i32$2 | 0;
+        var$5 = i64toi32_i32$0 | i64toi32_i32$1 | 0;
+        var$5$hi = i64toi32_i32$2;
         $144 = var$5;
-        $144$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = var$8$hi;
-        i64toi32_i32$5 = var$5$hi;
-        i64toi32_i32$5 = var$8$hi;
-        i64toi32_i32$2 = var$8;
-        i64toi32_i32$1 = var$5$hi;
-        i64toi32_i32$0 = var$5;
-        i64toi32_i32$3 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
-        i64toi32_i32$6 = i64toi32_i32$2 >>> 0 < i64toi32_i32$0 >>> 0;
-        i64toi32_i32$4 = i64toi32_i32$6 + i64toi32_i32$1 | 0;
-        i64toi32_i32$4 = i64toi32_i32$5 - i64toi32_i32$4 | 0;
-        i64toi32_i32$5 = i64toi32_i32$3;
+        $144$hi = i64toi32_i32$2;
+        i64toi32_i32$2 = var$8$hi;
+        i64toi32_i32$2 = var$5$hi;
+        i64toi32_i32$2 = var$8$hi;
+        i64toi32_i32$3 = var$8;
+        i64toi32_i32$0 = var$5$hi;
+        i64toi32_i32$1 = var$5;
+        i64toi32_i32$4 = i64toi32_i32$3 >>> 0 < i64toi32_i32$1 >>> 0;
+        i64toi32_i32$3 = i64toi32_i32$3 - i64toi32_i32$1 | 0;
+        i64toi32_i32$0 = i64toi32_i32$4 + i64toi32_i32$0 | 0;
+        i64toi32_i32$0 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
+        i64toi32_i32$1 = i64toi32_i32$3;
         i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 63;
-        i64toi32_i32$1 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = i64toi32_i32$4 >> 31 | 0;
-         $47 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
+        i64toi32_i32$4 = 63;
+        i64toi32_i32$3 = i64toi32_i32$4 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$4 & 63 | 0) >>> 0) {
+         i64toi32_i32$2 = i64toi32_i32$0 >> 31 | 0;
+         $45 = i64toi32_i32$0 >> i64toi32_i32$3 | 0;
         } else {
-         i64toi32_i32$2 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
-         $47 = (((1 << i64toi32_i32$1 | 0) - 1 | 0) & i64toi32_i32$4 | 0) << (32 - i64toi32_i32$1 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$1 | 0) | 0;
+         i64toi32_i32$2 = i64toi32_i32$0 >> i64toi32_i32$3 | 0;
+         $45 = (((1 << i64toi32_i32$3 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$3 | 0) | 0 | (i64toi32_i32$1 >>> i64toi32_i32$3 | 0) | 0;
         }
-        var$6 = $47;
+        var$6 = $45;
         var$6$hi = i64toi32_i32$2;
         i64toi32_i32$2 = var$1$hi;
         i64toi32_i32$2 = var$6$hi;
-        i64toi32_i32$4 = var$6;
-        i64toi32_i32$5 = var$1$hi;
-        i64toi32_i32$0 = var$1;
-        i64toi32_i32$5 = i64toi32_i32$2 & i64toi32_i32$5 | 0;
-        $151 = i64toi32_i32$4 & i64toi32_i32$0 | 0;
-        $151$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = $144$hi;
+        i64toi32_i32$0 = var$6;
+        i64toi32_i32$1 = var$1$hi;
+        i64toi32_i32$4 = var$1;
+        i64toi32_i32$1 = i64toi32_i32$2 & i64toi32_i32$1 | 0;
+        $151 = i64toi32_i32$0 & i64toi32_i32$4 | 0;
+        $151$hi = i64toi32_i32$1;
+        i64toi32_i32$1 = $144$hi;
         i64toi32_i32$2 = $144;
-        i64toi32_i32$4 = $151$hi;
-        i64toi32_i32$0 = $151;
-        i64toi32_i32$1 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
-        i64toi32_i32$6 = i64toi32_i32$2 >>> 0 < i64toi32_i32$0 >>> 0;
-        i64toi32_i32$3 = i64toi32_i32$6 + i64toi32_i32$4 | 0;
-        i64toi32_i32$3 = i64toi32_i32$5 - i64toi32_i32$3 | 0;
-        var$5 = i64toi32_i32$1;
-        var$5$hi = i64toi32_i32$3;
-        i64toi32_i32$3 = var$0$hi;
-        i64toi32_i32$5 = var$0;
-        i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-         $48 = 0;
+        i64toi32_i32$0 = $151$hi;
+        i64toi32_i32$4 = $151;
+        i64toi32_i32$3 = i64toi32_i32$2 >>> 0 < i64toi32_i32$4 >>> 0;
+        i64toi32_i32$2 = i64toi32_i32$2 - i64toi32_i32$4 | 0;
+        i64toi32_i32$0 = i64toi32_i32$3 + i64toi32_i32$0 | 0;
+        i64toi32_i32$0 = i64toi32_i32$1 - i64toi32_i32$0 | 0;
+        var$5 = i64toi32_i32$2;
+        var$5$hi = i64toi32_i32$0;
+        i64toi32_i32$0 = var$0$hi;
+        i64toi32_i32$4 = var$0;
+        i64toi32_i32$1 = 0;
+        i64toi32_i32$3 = 1;
+        i64toi32_i32$2 = i64toi32_i32$3 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
+         i64toi32_i32$1 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
+         $46 = 0;
         } else {
-         i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $48 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
+         i64toi32_i32$1 = ((1 << i64toi32_i32$2 | 0) - 1 | 0) & (i64toi32_i32$4 >>> (32 - i64toi32_i32$2 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$2 | 0) | 0;
+         $46 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
         }
-        $154$hi = i64toi32_i32$2;
-        i64toi32_i32$2 = var$7$hi;
-        i64toi32_i32$2 = $154$hi;
-        i64toi32_i32$3 = $48;
-        i64toi32_i32$5 = var$7$hi;
-        i64toi32_i32$0 = var$7;
-        i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
-        var$0 = i64toi32_i32$3 | i64toi32_i32$0 | 0;
-        var$0$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = var$6$hi;
-        i64toi32_i32$2 = var$6;
-        i64toi32_i32$3 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$3 = i64toi32_i32$5 & i64toi32_i32$3 | 0;
-        var$6 = i64toi32_i32$2 & i64toi32_i32$0 | 0;
-        var$6$hi = i64toi32_i32$3;
+        $154$hi = i64toi32_i32$1;
+        i64toi32_i32$1 = var$7$hi;
+        i64toi32_i32$1 = $154$hi;
+        i64toi32_i32$0 = $46;
+        i64toi32_i32$4 = var$7$hi;
+        i64toi32_i32$3 = var$7;
+        i64toi32_i32$4 = i64toi32_i32$1 | i64toi32_i32$4 | 0;
+        var$0 = i64toi32_i32$0 | i64toi32_i32$3 | 0;
+        var$0$hi = i64toi32_i32$4;
+        i64toi32_i32$4 = var$6$hi;
+        i64toi32_i32$1 = var$6;
+        i64toi32_i32$0 = 0;
+        i64toi32_i32$3 = 1;
+        i64toi32_i32$0 = i64toi32_i32$4 & i64toi32_i32$0 | 0;
+        var$6 = i64toi32_i32$1 & i64toi32_i32$3 | 0;
+        var$6$hi = i64toi32_i32$0;
         var$7 = var$6;
-        var$7$hi = i64toi32_i32$3;
+        var$7$hi = i64toi32_i32$0;
         var$2 = var$2 + -1 | 0;
         if (var$2) {
          continue label$15
@@ -5359,41 +5357,41 @@ function asmFunc(global, env, buffer) {
       }
      }
     }
-    i64toi32_i32$3 = var$5$hi;
-    legalfunc$wasm2js_scratch_store_i64(var$5 | 0, i64toi32_i32$3 | 0);
-    i64toi32_i32$3 = var$0$hi;
-    i64toi32_i32$5 = var$0;
-    i64toi32_i32$2 = 0;
-    i64toi32_i32$0 = 1;
-    i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-    if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-     i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-     $49 = 0;
+    i64toi32_i32$0 = var$5$hi;
+    legalfunc$wasm2js_scratch_store_i64(var$5 | 0, i64toi32_i32$0 | 0);
+    i64toi32_i32$0 = var$0$hi;
+    i64toi32_i32$4 = var$0;
+    i64toi32_i32$1 = 0;
+    i64toi32_i32$3 = 1;
+    i64toi32_i32$2 = i64toi32_i32$3 & 31 | 0;
+    if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
+     i64toi32_i32$1 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
+     $47 = 0;
     } else {
-     i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-     $49 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
+     i64toi32_i32$1 = ((1 << i64toi32_i32$2 | 0) - 1 | 0) & (i64toi32_i32$4 >>> (32 - i64toi32_i32$2 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$2 | 0) | 0;
+     $47 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
     }
-    $165$hi = i64toi32_i32$2;
-    i64toi32_i32$2 = var$6$hi;
-    i64toi32_i32$2 = $165$hi;
-    i64toi32_i32$3 = $49;
-    i64toi32_i32$5 = var$6$hi;
-    i64toi32_i32$0 = var$6;
-    i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
-    i64toi32_i32$3 = i64toi32_i32$3 | i64toi32_i32$0 | 0;
-    i64toi32_i32$HIGH_BITS = i64toi32_i32$5;
-    return i64toi32_i32$3 | 0;
+    $165$hi = i64toi32_i32$1;
+    i64toi32_i32$1 = var$6$hi;
+    i64toi32_i32$1 = $165$hi;
+    i64toi32_i32$0 = $47;
+    i64toi32_i32$4 = var$6$hi;
+    i64toi32_i32$3 = var$6;
+    i64toi32_i32$4 = i64toi32_i32$1 | i64toi32_i32$4 | 0;
+    i64toi32_i32$0 = i64toi32_i32$0 | i64toi32_i32$3 | 0;
+    i64toi32_i32$HIGH_BITS = i64toi32_i32$4;
+    return i64toi32_i32$0 | 0;
    }
-   i64toi32_i32$3 = var$0$hi;
-   legalfunc$wasm2js_scratch_store_i64(var$0 | 0, i64toi32_i32$3 | 0);
-   i64toi32_i32$3 = 0;
+   i64toi32_i32$0 = var$0$hi;
+   legalfunc$wasm2js_scratch_store_i64(var$0 | 0, i64toi32_i32$0 | 0);
+   i64toi32_i32$0 = 0;
    var$0 = 0;
-   var$0$hi = i64toi32_i32$3;
+   var$0$hi = i64toi32_i32$0;
   }
-  i64toi32_i32$3 = var$0$hi;
-  i64toi32_i32$5 = var$0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$3;
-  return i64toi32_i32$5 | 0;
+  i64toi32_i32$0 = var$0$hi;
+  i64toi32_i32$4 = var$0;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
+  return i64toi32_i32$4 | 0;
  }
  
  function __wasm_i64_urem(var$0, var$0$hi, var$1, var$1$hi) {
@@ -5618,7 +5616,7 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$2$hi = 0, i64toi32_i32$6 = 0, $21 = 0, $22 = 0, $23 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17 = 0, $17$hi = 0, $23$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$4 = 0, var$2 = 0, var$2$hi = 0, $19 = 0, $20 = 0, $21 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17 = 0, $17$hi = 0, $23$hi = 0;
   i64toi32_i32$0 = var$0$hi;
   i64toi32_i32$2 = var$0;
   i64toi32_i32$1 = 0;
@@ -5626,12 +5624,12 @@ function asmFunc(global, env, buffer) {
   i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
   if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
    i64toi32_i32$1 = i64toi32_i32$0 >> 31 | 0;
-   $21 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
+   $19 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
   } else {
    i64toi32_i32$1 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
-   $21 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+   $19 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
   }
-  var$2 = $21;
+  var$2 = $19;
   var$2$hi = i64toi32_i32$1;
   i64toi32_i32$1 = var$0$hi;
   i64toi32_i32$1 = var$2$hi;
@@ -5645,86 +5643,86 @@ function asmFunc(global, env, buffer) {
   i64toi32_i32$1 = i64toi32_i32$0 ^ i64toi32_i32$3 | 0;
   i64toi32_i32$0 = var$2$hi;
   i64toi32_i32$3 = var$2;
-  i64toi32_i32$4 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$5 = i64toi32_i32$6 + i64toi32_i32$0 | 0;
-  i64toi32_i32$5 = i64toi32_i32$2 - i64toi32_i32$5 | 0;
-  $9 = i64toi32_i32$4;
-  $9$hi = i64toi32_i32$5;
-  i64toi32_i32$5 = var$1$hi;
-  i64toi32_i32$2 = var$1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$0 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$5 >> 31 | 0;
-   $22 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
-  } else {
-   i64toi32_i32$1 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
-   $22 = (((1 << i64toi32_i32$0 | 0) - 1 | 0) & i64toi32_i32$5 | 0) << (32 - i64toi32_i32$0 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$0 | 0) | 0;
-  }
-  var$2 = $22;
-  var$2$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$1$hi;
-  i64toi32_i32$1 = var$2$hi;
-  i64toi32_i32$5 = var$2;
-  i64toi32_i32$2 = var$1$hi;
+  i64toi32_i32$4 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
+  i64toi32_i32$1 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
+  i64toi32_i32$0 = i64toi32_i32$4 + i64toi32_i32$0 | 0;
+  i64toi32_i32$0 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
+  $9 = i64toi32_i32$1;
+  $9$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = var$1$hi;
   i64toi32_i32$3 = var$1;
-  i64toi32_i32$2 = i64toi32_i32$1 ^ i64toi32_i32$2 | 0;
-  $14$hi = i64toi32_i32$2;
-  i64toi32_i32$2 = i64toi32_i32$1;
-  i64toi32_i32$2 = $14$hi;
-  i64toi32_i32$1 = i64toi32_i32$5 ^ i64toi32_i32$3 | 0;
-  i64toi32_i32$5 = var$2$hi;
-  i64toi32_i32$3 = var$2;
-  i64toi32_i32$0 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$4 = i64toi32_i32$6 + i64toi32_i32$5 | 0;
-  i64toi32_i32$4 = i64toi32_i32$2 - i64toi32_i32$4 | 0;
-  $16$hi = i64toi32_i32$4;
-  i64toi32_i32$4 = $9$hi;
-  i64toi32_i32$1 = $16$hi;
-  i64toi32_i32$1 = __wasm_i64_udiv($9 | 0, i64toi32_i32$4 | 0, i64toi32_i32$0 | 0, i64toi32_i32$1 | 0) | 0;
-  i64toi32_i32$4 = i64toi32_i32$HIGH_BITS;
-  $17 = i64toi32_i32$1;
-  $17$hi = i64toi32_i32$4;
-  i64toi32_i32$4 = var$1$hi;
-  i64toi32_i32$4 = var$0$hi;
-  i64toi32_i32$4 = var$1$hi;
-  i64toi32_i32$2 = var$1;
-  i64toi32_i32$1 = var$0$hi;
-  i64toi32_i32$3 = var$0;
-  i64toi32_i32$1 = i64toi32_i32$4 ^ i64toi32_i32$1 | 0;
-  i64toi32_i32$4 = i64toi32_i32$2 ^ i64toi32_i32$3 | 0;
   i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$5 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = i64toi32_i32$1 >> 31 | 0;
-   $23 = i64toi32_i32$1 >> i64toi32_i32$5 | 0;
+  i64toi32_i32$4 = 63;
+  i64toi32_i32$1 = i64toi32_i32$4 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$4 & 63 | 0) >>> 0) {
+   i64toi32_i32$2 = i64toi32_i32$0 >> 31 | 0;
+   $20 = i64toi32_i32$0 >> i64toi32_i32$1 | 0;
   } else {
-   i64toi32_i32$2 = i64toi32_i32$1 >> i64toi32_i32$5 | 0;
-   $23 = (((1 << i64toi32_i32$5 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$5 | 0) | 0 | (i64toi32_i32$4 >>> i64toi32_i32$5 | 0) | 0;
+   i64toi32_i32$2 = i64toi32_i32$0 >> i64toi32_i32$1 | 0;
+   $20 = (((1 << i64toi32_i32$1 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$1 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$1 | 0) | 0;
   }
-  var$0 = $23;
-  var$0$hi = i64toi32_i32$2;
-  i64toi32_i32$2 = $17$hi;
-  i64toi32_i32$1 = $17;
-  i64toi32_i32$4 = var$0$hi;
-  i64toi32_i32$3 = var$0;
-  i64toi32_i32$4 = i64toi32_i32$2 ^ i64toi32_i32$4 | 0;
-  $23$hi = i64toi32_i32$4;
-  i64toi32_i32$4 = var$0$hi;
-  i64toi32_i32$4 = $23$hi;
-  i64toi32_i32$2 = i64toi32_i32$1 ^ i64toi32_i32$3 | 0;
-  i64toi32_i32$1 = var$0$hi;
-  i64toi32_i32$5 = i64toi32_i32$2 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$2 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$0 = i64toi32_i32$6 + i64toi32_i32$1 | 0;
-  i64toi32_i32$0 = i64toi32_i32$4 - i64toi32_i32$0 | 0;
-  i64toi32_i32$2 = i64toi32_i32$5;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
-  return i64toi32_i32$2 | 0;
+  var$2 = $20;
+  var$2$hi = i64toi32_i32$2;
+  i64toi32_i32$2 = var$1$hi;
+  i64toi32_i32$2 = var$2$hi;
+  i64toi32_i32$0 = var$2;
+  i64toi32_i32$3 = var$1$hi;
+  i64toi32_i32$4 = var$1;
+  i64toi32_i32$3 = i64toi32_i32$2 ^ i64toi32_i32$3 | 0;
+  $14$hi = i64toi32_i32$3;
+  i64toi32_i32$3 = i64toi32_i32$2;
+  i64toi32_i32$3 = $14$hi;
+  i64toi32_i32$2 = i64toi32_i32$0 ^ i64toi32_i32$4 | 0;
+  i64toi32_i32$0 = var$2$hi;
+  i64toi32_i32$4 = var$2;
+  i64toi32_i32$1 = i64toi32_i32$2 >>> 0 < i64toi32_i32$4 >>> 0;
+  i64toi32_i32$2 = i64toi32_i32$2 - i64toi32_i32$4 | 0;
+  i64toi32_i32$0 = i64toi32_i32$1 + i64toi32_i32$0 | 0;
+  i64toi32_i32$0 = i64toi32_i32$3 - i64toi32_i32$0 | 0;
+  $16$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = $9$hi;
+  i64toi32_i32$3 = $16$hi;
+  i64toi32_i32$3 = __wasm_i64_udiv($9 | 0, i64toi32_i32$0 | 0, i64toi32_i32$2 | 0, i64toi32_i32$3 | 0) | 0;
+  i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
+  $17 = i64toi32_i32$3;
+  $17$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = var$1$hi;
+  i64toi32_i32$0 = var$0$hi;
+  i64toi32_i32$0 = var$1$hi;
+  i64toi32_i32$4 = var$1;
+  i64toi32_i32$3 = var$0$hi;
+  i64toi32_i32$1 = var$0;
+  i64toi32_i32$3 = i64toi32_i32$0 ^ i64toi32_i32$3 | 0;
+  i64toi32_i32$0 = i64toi32_i32$4 ^ i64toi32_i32$1 | 0;
+  i64toi32_i32$4 = 0;
+  i64toi32_i32$1 = 63;
+  i64toi32_i32$2 = i64toi32_i32$1 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$1 & 63 | 0) >>> 0) {
+   i64toi32_i32$4 = i64toi32_i32$3 >> 31 | 0;
+   $21 = i64toi32_i32$3 >> i64toi32_i32$2 | 0;
+  } else {
+   i64toi32_i32$4 = i64toi32_i32$3 >> i64toi32_i32$2 | 0;
+   $21 = (((1 << i64toi32_i32$2 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$2 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$2 | 0) | 0;
+  }
+  var$0 = $21;
+  var$0$hi = i64toi32_i32$4;
+  i64toi32_i32$4 = $17$hi;
+  i64toi32_i32$3 = $17;
+  i64toi32_i32$0 = var$0$hi;
+  i64toi32_i32$1 = var$0;
+  i64toi32_i32$0 = i64toi32_i32$4 ^ i64toi32_i32$0 | 0;
+  $23$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = var$0$hi;
+  i64toi32_i32$0 = $23$hi;
+  i64toi32_i32$4 = i64toi32_i32$3 ^ i64toi32_i32$1 | 0;
+  i64toi32_i32$3 = var$0$hi;
+  i64toi32_i32$2 = i64toi32_i32$4 >>> 0 < i64toi32_i32$1 >>> 0;
+  i64toi32_i32$4 = i64toi32_i32$4 - i64toi32_i32$1 | 0;
+  i64toi32_i32$3 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
+  i64toi32_i32$3 = i64toi32_i32$0 - i64toi32_i32$3 | 0;
+  i64toi32_i32$0 = i64toi32_i32$4;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$3;
+  return i64toi32_i32$0 | 0;
  }
  
  function _ZN17compiler_builtins3int4udiv10divmod_u6417h6026910b5ed08e40E(var$0, var$0$hi, var$1, var$1$hi) {
@@ -5732,7 +5730,7 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$4 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, i64toi32_i32$6 = 0, $37 = 0, $38 = 0, $39 = 0, $40 = 0, $41 = 0, $42 = 0, $43 = 0, $44 = 0, var$8$hi = 0, $45 = 0, $46 = 0, $47 = 0, $48 = 0, var$7$hi = 0, $49 = 0, $63$hi = 0, $65 = 0, $65$hi = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142$hi = 0, $144 = 0, $144$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0;
+  var i64toi32_i32$4 = 0, i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, var$2 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, $35 = 0, $36 = 0, $37 = 0, $38 = 0, $39 = 0, $40 = 0, $41 = 0, $42 = 0, var$8$hi = 0, $43 = 0, $44 = 0, $45 = 0, $46 = 0, var$7$hi = 0, $47 = 0, $63$hi = 0, $65 = 0, $65$hi = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142$hi = 0, $144 = 0, $144$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0;
   label$1 : {
    label$2 : {
     label$3 : {
@@ -5751,12 +5749,12 @@ function asmFunc(global, env, buffer) {
              i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
              if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
               i64toi32_i32$1 = 0;
-              $37 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
+              $35 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
              } else {
               i64toi32_i32$1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-              $37 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+              $35 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
              }
-             var$2 = $37;
+             var$2 = $35;
              if (var$2) {
               block : {
                i64toi32_i32$1 = var$1$hi;
@@ -5771,12 +5769,12 @@ function asmFunc(global, env, buffer) {
                i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
                if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
                 i64toi32_i32$2 = 0;
-                $38 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
+                $36 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
                } else {
                 i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-                $38 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
+                $36 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
                }
-               var$4 = $38;
+               var$4 = $36;
                if (!var$4) {
                 break label$9
                }
@@ -5813,12 +5811,12 @@ function asmFunc(global, env, buffer) {
             i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
             if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
              i64toi32_i32$1 = 0;
-             $39 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
+             $37 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
             } else {
              i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-             $39 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
+             $37 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
             }
-            var$3 = $39;
+            var$3 = $37;
             i64toi32_i32$1 = var$0$hi;
             if (!var$0) {
              break label$7
@@ -5837,10 +5835,10 @@ function asmFunc(global, env, buffer) {
             i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
             if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
              i64toi32_i32$3 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-             $40 = 0;
+             $38 = 0;
             } else {
              i64toi32_i32$3 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-             $40 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
+             $38 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
             }
             $63$hi = i64toi32_i32$3;
             i64toi32_i32$3 = var$0$hi;
@@ -5851,7 +5849,7 @@ function asmFunc(global, env, buffer) {
             $65 = i64toi32_i32$1 & i64toi32_i32$0 | 0;
             $65$hi = i64toi32_i32$2;
             i64toi32_i32$2 = $63$hi;
-            i64toi32_i32$3 = $40;
+            i64toi32_i32$3 = $38;
             i64toi32_i32$1 = $65$hi;
             i64toi32_i32$0 = $65;
             i64toi32_i32$1 = i64toi32_i32$2 | i64toi32_i32$1 | 0;
@@ -5882,12 +5880,12 @@ function asmFunc(global, env, buffer) {
         i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
         if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
          i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-         $41 = 0;
+         $39 = 0;
         } else {
          i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $41 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
+         $39 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
         }
-        legalfunc$wasm2js_scratch_store_i64($41 | 0, i64toi32_i32$1 | 0);
+        legalfunc$wasm2js_scratch_store_i64($39 | 0, i64toi32_i32$1 | 0);
         i64toi32_i32$1 = 0;
         i64toi32_i32$2 = var$4;
         i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
@@ -5915,12 +5913,12 @@ function asmFunc(global, env, buffer) {
       i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
       if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
        i64toi32_i32$1 = 0;
-       $42 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
+       $40 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
       } else {
        i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-       $42 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
+       $40 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
       }
-      i64toi32_i32$3 = $42;
+      i64toi32_i32$3 = $40;
       i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
       return i64toi32_i32$3 | 0;
      }
@@ -5937,12 +5935,12 @@ function asmFunc(global, env, buffer) {
     i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
     if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
      i64toi32_i32$1 = 0;
-     $43 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
+     $41 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
     } else {
      i64toi32_i32$1 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
-     $43 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+     $41 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
     }
-    var$5 = $43;
+    var$5 = $41;
     var$5$hi = i64toi32_i32$1;
     i64toi32_i32$1 = var$0$hi;
     i64toi32_i32$1 = 0;
@@ -5954,12 +5952,12 @@ function asmFunc(global, env, buffer) {
     i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
     if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
      i64toi32_i32$2 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
-     $44 = 0;
+     $42 = 0;
     } else {
      i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$3 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-     $44 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
+     $42 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
     }
-    var$0 = $44;
+    var$0 = $42;
     var$0$hi = i64toi32_i32$2;
     label$13 : {
      if (var$2) {
@@ -5968,121 +5966,121 @@ function asmFunc(global, env, buffer) {
        i64toi32_i32$1 = var$1;
        i64toi32_i32$3 = -1;
        i64toi32_i32$0 = -1;
-       i64toi32_i32$4 = i64toi32_i32$1 + i64toi32_i32$0 | 0;
-       i64toi32_i32$5 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
-       if (i64toi32_i32$4 >>> 0 < i64toi32_i32$0 >>> 0) {
-        i64toi32_i32$5 = i64toi32_i32$5 + 1 | 0
+       i64toi32_i32$1 = i64toi32_i32$1 + i64toi32_i32$0 | 0;
+       i64toi32_i32$2 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
+       if (i64toi32_i32$1 >>> 0 < i64toi32_i32$0 >>> 0) {
+        i64toi32_i32$2 = i64toi32_i32$2 + 1 | 0
        }
-       var$8 = i64toi32_i32$4;
-       var$8$hi = i64toi32_i32$5;
+       var$8 = i64toi32_i32$1;
+       var$8$hi = i64toi32_i32$2;
        label$15 : while (1) {
-        i64toi32_i32$5 = var$5$hi;
-        i64toi32_i32$2 = var$5;
-        i64toi32_i32$1 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
-         $45 = 0;
+        i64toi32_i32$2 = var$5$hi;
+        i64toi32_i32$3 = var$5;
+        i64toi32_i32$0 = 0;
+        i64toi32_i32$1 = 1;
+        i64toi32_i32$4 = i64toi32_i32$1 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$1 & 63 | 0) >>> 0) {
+         i64toi32_i32$0 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
+         $43 = 0;
         } else {
-         i64toi32_i32$1 = ((1 << i64toi32_i32$3 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$3 | 0) | 0) | 0 | (i64toi32_i32$5 << i64toi32_i32$3 | 0) | 0;
-         $45 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
+         i64toi32_i32$0 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$3 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$2 << i64toi32_i32$4 | 0) | 0;
+         $43 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
         }
-        $140 = $45;
-        $140$hi = i64toi32_i32$1;
-        i64toi32_i32$1 = var$0$hi;
-        i64toi32_i32$5 = var$0;
-        i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 63;
-        i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = 0;
-         $46 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
+        $140 = $43;
+        $140$hi = i64toi32_i32$0;
+        i64toi32_i32$0 = var$0$hi;
+        i64toi32_i32$2 = var$0;
+        i64toi32_i32$3 = 0;
+        i64toi32_i32$1 = 63;
+        i64toi32_i32$4 = i64toi32_i32$1 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$1 & 63 | 0) >>> 0) {
+         i64toi32_i32$3 = 0;
+         $44 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
         } else {
-         i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
-         $46 = (((1 << i64toi32_i32$3 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$3 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$3 | 0) | 0;
+         i64toi32_i32$3 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
+         $44 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
         }
-        $142$hi = i64toi32_i32$2;
-        i64toi32_i32$2 = $140$hi;
-        i64toi32_i32$1 = $140;
-        i64toi32_i32$5 = $142$hi;
-        i64toi32_i32$0 = $46;
-        i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
-        var$5 = i64toi32_i32$1 | i64toi32_i32$0 | 0;
-        var$5$hi = i64toi32_i32$5;
+        $142$hi = i64toi32_i32$3;
+        i64toi32_i32$3 = $140$hi;
+        i64toi32_i32$0 = $140;
+        i64toi32_i32$2 = $142$hi;
+        i64toi32_i32$1 = $44;
+        i64toi32_i32$2 = i64toi32_i32$3 | i64toi32_i32$2 | 0;
+        var$5 = i64toi32_i32$0 | i64toi32_i32$1 | 0;
+        var$5$hi = i64toi32_i32$2;
         $144 = var$5;
-        $144$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = var$8$hi;
-        i64toi32_i32$5 = var$5$hi;
-        i64toi32_i32$5 = var$8$hi;
-        i64toi32_i32$2 = var$8;
-        i64toi32_i32$1 = var$5$hi;
-        i64toi32_i32$0 = var$5;
-        i64toi32_i32$3 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
-        i64toi32_i32$6 = i64toi32_i32$2 >>> 0 < i64toi32_i32$0 >>> 0;
-        i64toi32_i32$4 = i64toi32_i32$6 + i64toi32_i32$1 | 0;
-        i64toi32_i32$4 = i64toi32_i32$5 - i64toi32_i32$4 | 0;
-        i64toi32_i32$5 = i64toi32_i32$3;
+        $144$hi = i64toi32_i32$2;
+        i64toi32_i32$2 = var$8$hi;
+        i64toi32_i32$2 = var$5$hi;
+        i64toi32_i32$2 = var$8$hi;
+        i64toi32_i32$3 = var$8;
+        i64toi32_i32$0 = var$5$hi;
+        i64toi32_i32$1 = var$5;
+        i64toi32_i32$4 = i64toi32_i32$3 >>> 0 < i64toi32_i32$1 >>> 0;
+        i64toi32_i32$3 = i64toi32_i32$3 - i64toi32_i32$1 | 0;
+        i64toi32_i32$0 = i64toi32_i32$4 + i64toi32_i32$0 | 0;
+        i64toi32_i32$0 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
+        i64toi32_i32$1 = i64toi32_i32$3;
         i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 63;
-        i64toi32_i32$1 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = i64toi32_i32$4 >> 31 | 0;
-         $47 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
+        i64toi32_i32$4 = 63;
+        i64toi32_i32$3 = i64toi32_i32$4 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$4 & 63 | 0) >>> 0) {
+         i64toi32_i32$2 = i64toi32_i32$0 >> 31 | 0;
+         $45 = i64toi32_i32$0 >> i64toi32_i32$3 | 0;
         } else {
-         i64toi32_i32$2 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
-         $47 = (((1 << i64toi32_i32$1 | 0) - 1 | 0) & i64toi32_i32$4 | 0) << (32 - i64toi32_i32$1 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$1 | 0) | 0;
+         i64toi32_i32$2 = i64toi32_i32$0 >> i64toi32_i32$3 | 0;
+         $45 = (((1 << i64toi32_i32$3 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$3 | 0) | 0 | (i64toi32_i32$1 >>> i64toi32_i32$3 | 0) | 0;
         }
-        var$6 = $47;
+        var$6 = $45;
         var$6$hi = i64toi32_i32$2;
         i64toi32_i32$2 = var$1$hi;
         i64toi32_i32$2 = var$6$hi;
-        i64toi32_i32$4 = var$6;
-        i64toi32_i32$5 = var$1$hi;
-        i64toi32_i32$0 = var$1;
-        i64toi32_i32$5 = i64toi32_i32$2 & i64toi32_i32$5 | 0;
-        $151 = i64toi32_i32$4 & i64toi32_i32$0 | 0;
-        $151$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = $144$hi;
+        i64toi32_i32$0 = var$6;
+        i64toi32_i32$1 = var$1$hi;
+        i64toi32_i32$4 = var$1;
+        i64toi32_i32$1 = i64toi32_i32$2 & i64toi32_i32$1 | 0;
+        $151 = i64toi32_i32$0 & i64toi32_i32$4 | 0;
+        $151$hi = i64toi32_i32$1;
+        i64toi32_i32$1 = $144$hi;
         i64toi32_i32$2 = $144;
-        i64toi32_i32$4 = $151$hi;
-        i64toi32_i32$0 = $151;
-        i64toi32_i32$1 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
-        i64toi32_i32$6 = i64toi32_i32$2 >>> 0 < i64toi32_i32$0 >>> 0;
-        i64toi32_i32$3 = i64toi32_i32$6 + i64toi32_i32$4 | 0;
-        i64toi32_i32$3 = i64toi32_i32$5 - i64toi32_i32$3 | 0;
-        var$5 = i64toi32_i32$1;
-        var$5$hi = i64toi32_i32$3;
-        i64toi32_i32$3 = var$0$hi;
-        i64toi32_i32$5 = var$0;
-        i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-         $48 = 0;
+        i64toi32_i32$0 = $151$hi;
+        i64toi32_i32$4 = $151;
+        i64toi32_i32$3 = i64toi32_i32$2 >>> 0 < i64toi32_i32$4 >>> 0;
+        i64toi32_i32$2 = i64toi32_i32$2 - i64toi32_i32$4 | 0;
+        i64toi32_i32$0 = i64toi32_i32$3 + i64toi32_i32$0 | 0;
+        i64toi32_i32$0 = i64toi32_i32$1 - i64toi32_i32$0 | 0;
+        var$5 = i64toi32_i32$2;
+        var$5$hi = i64toi32_i32$0;
+        i64toi32_i32$0 = var$0$hi;
+        i64toi32_i32$4 = var$0;
+        i64toi32_i32$1 = 0;
+        i64toi32_i32$3 = 1;
+        i64toi32_i32$2 = i64toi32_i32$3 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
+         i64toi32_i32$1 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
+         $46 = 0;
         } else {
-         i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $48 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
+         i64toi32_i32$1 = ((1 << i64toi32_i32$2 | 0) - 1 | 0) & (i64toi32_i32$4 >>> (32 - i64toi32_i32$2 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$2 | 0) | 0;
+         $46 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
         }
-        $154$hi = i64toi32_i32$2;
-        i64toi32_i32$2 = var$7$hi;
-        i64toi32_i32$2 = $154$hi;
-        i64toi32_i32$3 = $48;
-        i64toi32_i32$5 = var$7$hi;
-        i64toi32_i32$0 = var$7;
-        i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
-        var$0 = i64toi32_i32$3 | i64toi32_i32$0 | 0;
-        var$0$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = var$6$hi;
-        i64toi32_i32$2 = var$6;
-        i64toi32_i32$3 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$3 = i64toi32_i32$5 & i64toi32_i32$3 | 0;
-        var$6 = i64toi32_i32$2 & i64toi32_i32$0 | 0;
-        var$6$hi = i64toi32_i32$3;
+        $154$hi = i64toi32_i32$1;
+        i64toi32_i32$1 = var$7$hi;
+        i64toi32_i32$1 = $154$hi;
+        i64toi32_i32$0 = $46;
+        i64toi32_i32$4 = var$7$hi;
+        i64toi32_i32$3 = var$7;
+        i64toi32_i32$4 = i64toi32_i32$1 | i64toi32_i32$4 | 0;
+        var$0 = i64toi32_i32$0 | i64toi32_i32$3 | 0;
+        var$0$hi = i64toi32_i32$4;
+        i64toi32_i32$4 = var$6$hi;
+        i64toi32_i32$1 = var$6;
+        i64toi32_i32$0 = 0;
+        i64toi32_i32$3 = 1;
+        i64toi32_i32$0 = i64toi32_i32$4 & i64toi32_i32$0 | 0;
+        var$6 = i64toi32_i32$1 & i64toi32_i32$3 | 0;
+        var$6$hi = i64toi32_i32$0;
         var$7 = var$6;
-        var$7$hi = i64toi32_i32$3;
+        var$7$hi = i64toi32_i32$0;
         var$2 = var$2 + -1 | 0;
         if (var$2) {
          continue label$15
@@ -6093,41 +6091,41 @@ function asmFunc(global, env, buffer) {
       }
      }
     }
-    i64toi32_i32$3 = var$5$hi;
-    legalfunc$wasm2js_scratch_store_i64(var$5 | 0, i64toi32_i32$3 | 0);
-    i64toi32_i32$3 = var$0$hi;
-    i64toi32_i32$5 = var$0;
-    i64toi32_i32$2 = 0;
-    i64toi32_i32$0 = 1;
-    i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-    if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-     i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-     $49 = 0;
+    i64toi32_i32$0 = var$5$hi;
+    legalfunc$wasm2js_scratch_store_i64(var$5 | 0, i64toi32_i32$0 | 0);
+    i64toi32_i32$0 = var$0$hi;
+    i64toi32_i32$4 = var$0;
+    i64toi32_i32$1 = 0;
+    i64toi32_i32$3 = 1;
+    i64toi32_i32$2 = i64toi32_i32$3 & 31 | 0;
+    if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
+     i64toi32_i32$1 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
+     $47 = 0;
     } else {
-     i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-     $49 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
+     i64toi32_i32$1 = ((1 << i64toi32_i32$2 | 0) - 1 | 0) & (i64toi32_i32$4 >>> (32 - i64toi32_i32$2 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$2 | 0) | 0;
+     $47 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
     }
-    $165$hi = i64toi32_i32$2;
-    i64toi32_i32$2 = var$6$hi;
-    i64toi32_i32$2 = $165$hi;
-    i64toi32_i32$3 = $49;
-    i64toi32_i32$5 = var$6$hi;
-    i64toi32_i32$0 = var$6;
-    i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
-    i64toi32_i32$3 = i64toi32_i32$3 | i64toi32_i32$0 | 0;
-    i64toi32_i32$HIGH_BITS = i64toi32_i32$5;
-    return i64toi32_i32$3 | 0;
+    $165$hi = i64toi32_i32$1;
+    i64toi32_i32$1 = var$6$hi;
+    i64toi32_i32$1 = $165$hi;
+    i64toi32_i32$0 = $47;
+    i64toi32_i32$4 = var$6$hi;
+    i64toi32_i32$3 = var$6;
+    i64toi32_i32$4 = i64toi32_i32$1 | i64toi32_i32$4 | 0;
+    i64toi32_i32$0 = i64toi32_i32$0 | i64toi32_i32$3 | 0;
+    i64toi32_i32$HIGH_BITS = i64toi32_i32$4;
+    return i64toi32_i32$0 | 0;
    }
-   i64toi32_i32$3 = var$0$hi;
-   legalfunc$wasm2js_scratch_store_i64(var$0 | 0, i64toi32_i32$3 | 0);
-   i64toi32_i32$3 = 0;
+   i64toi32_i32$0 = var$0$hi;
+   legalfunc$wasm2js_scratch_store_i64(var$0 | 0, i64toi32_i32$0 | 0);
+   i64toi32_i32$0 = 0;
    var$0 = 0;
-   var$0$hi = i64toi32_i32$3;
+   var$0$hi = i64toi32_i32$0;
   }
-  i64toi32_i32$3 = var$0$hi;
-  i64toi32_i32$5 = var$0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$3;
-  return i64toi32_i32$5 | 0;
+  i64toi32_i32$0 = var$0$hi;
+  i64toi32_i32$4 = var$0;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
+  return i64toi32_i32$4 | 0;
  }
  
  function __wasm_i64_sdiv(var$0, var$0$hi, var$1, var$1$hi) {
@@ -6370,7 +6368,7 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$2$hi = 0, i64toi32_i32$6 = 0, $21 = 0, $22 = 0, $23 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17 = 0, $17$hi = 0, $23$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$4 = 0, var$2 = 0, var$2$hi = 0, $19 = 0, $20 = 0, $21 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17 = 0, $17$hi = 0, $23$hi = 0;
   i64toi32_i32$0 = var$0$hi;
   i64toi32_i32$2 = var$0;
   i64toi32_i32$1 = 0;
@@ -6378,12 +6376,12 @@ function asmFunc(global, env, buffer) {
   i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
   if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
    i64toi32_i32$1 = i64toi32_i32$0 >> 31 | 0;
-   $21 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
+   $19 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
   } else {
    i64toi32_i32$1 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
-   $21 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+   $19 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
   }
-  var$2 = $21;
+  var$2 = $19;
   var$2$hi = i64toi32_i32$1;
   i64toi32_i32$1 = var$0$hi;
   i64toi32_i32$1 = var$2$hi;
@@ -6397,86 +6395,86 @@ function asmFunc(global, env, buffer) {
   i64toi32_i32$1 = i64toi32_i32$0 ^ i64toi32_i32$3 | 0;
   i64toi32_i32$0 = var$2$hi;
   i64toi32_i32$3 = var$2;
-  i64toi32_i32$4 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$5 = i64toi32_i32$6 + i64toi32_i32$0 | 0;
-  i64toi32_i32$5 = i64toi32_i32$2 - i64toi32_i32$5 | 0;
-  $9 = i64toi32_i32$4;
-  $9$hi = i64toi32_i32$5;
-  i64toi32_i32$5 = var$1$hi;
-  i64toi32_i32$2 = var$1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$0 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$5 >> 31 | 0;
-   $22 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
-  } else {
-   i64toi32_i32$1 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
-   $22 = (((1 << i64toi32_i32$0 | 0) - 1 | 0) & i64toi32_i32$5 | 0) << (32 - i64toi32_i32$0 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$0 | 0) | 0;
-  }
-  var$2 = $22;
-  var$2$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$1$hi;
-  i64toi32_i32$1 = var$2$hi;
-  i64toi32_i32$5 = var$2;
-  i64toi32_i32$2 = var$1$hi;
+  i64toi32_i32$4 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
+  i64toi32_i32$1 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
+  i64toi32_i32$0 = i64toi32_i32$4 + i64toi32_i32$0 | 0;
+  i64toi32_i32$0 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
+  $9 = i64toi32_i32$1;
+  $9$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = var$1$hi;
   i64toi32_i32$3 = var$1;
-  i64toi32_i32$2 = i64toi32_i32$1 ^ i64toi32_i32$2 | 0;
-  $14$hi = i64toi32_i32$2;
-  i64toi32_i32$2 = i64toi32_i32$1;
-  i64toi32_i32$2 = $14$hi;
-  i64toi32_i32$1 = i64toi32_i32$5 ^ i64toi32_i32$3 | 0;
-  i64toi32_i32$5 = var$2$hi;
-  i64toi32_i32$3 = var$2;
-  i64toi32_i32$0 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$4 = i64toi32_i32$6 + i64toi32_i32$5 | 0;
-  i64toi32_i32$4 = i64toi32_i32$2 - i64toi32_i32$4 | 0;
-  $16$hi = i64toi32_i32$4;
-  i64toi32_i32$4 = $9$hi;
-  i64toi32_i32$1 = $16$hi;
-  i64toi32_i32$1 = __wasm_i64_udiv($9 | 0, i64toi32_i32$4 | 0, i64toi32_i32$0 | 0, i64toi32_i32$1 | 0) | 0;
-  i64toi32_i32$4 = i64toi32_i32$HIGH_BITS;
-  $17 = i64toi32_i32$1;
-  $17$hi = i64toi32_i32$4;
-  i64toi32_i32$4 = var$1$hi;
-  i64toi32_i32$4 = var$0$hi;
-  i64toi32_i32$4 = var$1$hi;
-  i64toi32_i32$2 = var$1;
-  i64toi32_i32$1 = var$0$hi;
-  i64toi32_i32$3 = var$0;
-  i64toi32_i32$1 = i64toi32_i32$4 ^ i64toi32_i32$1 | 0;
-  i64toi32_i32$4 = i64toi32_i32$2 ^ i64toi32_i32$3 | 0;
   i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$5 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = i64toi32_i32$1 >> 31 | 0;
-   $23 = i64toi32_i32$1 >> i64toi32_i32$5 | 0;
+  i64toi32_i32$4 = 63;
+  i64toi32_i32$1 = i64toi32_i32$4 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$4 & 63 | 0) >>> 0) {
+   i64toi32_i32$2 = i64toi32_i32$0 >> 31 | 0;
+   $20 = i64toi32_i32$0 >> i64toi32_i32$1 | 0;
   } else {
-   i64toi32_i32$2 = i64toi32_i32$1 >> i64toi32_i32$5 | 0;
-   $23 = (((1 << i64toi32_i32$5 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$5 | 0) | 0 | (i64toi32_i32$4 >>> i64toi32_i32$5 | 0) | 0;
+   i64toi32_i32$2 = i64toi32_i32$0 >> i64toi32_i32$1 | 0;
+   $20 = (((1 << i64toi32_i32$1 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$1 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$1 | 0) | 0;
   }
-  var$0 = $23;
-  var$0$hi = i64toi32_i32$2;
-  i64toi32_i32$2 = $17$hi;
-  i64toi32_i32$1 = $17;
-  i64toi32_i32$4 = var$0$hi;
-  i64toi32_i32$3 = var$0;
-  i64toi32_i32$4 = i64toi32_i32$2 ^ i64toi32_i32$4 | 0;
-  $23$hi = i64toi32_i32$4;
-  i64toi32_i32$4 = var$0$hi;
-  i64toi32_i32$4 = $23$hi;
-  i64toi32_i32$2 = i64toi32_i32$1 ^ i64toi32_i32$3 | 0;
-  i64toi32_i32$1 = var$0$hi;
-  i64toi32_i32$5 = i64toi32_i32$2 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$2 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$0 = i64toi32_i32$6 + i64toi32_i32$1 | 0;
-  i64toi32_i32$0 = i64toi32_i32$4 - i64toi32_i32$0 | 0;
-  i64toi32_i32$2 = i64toi32_i32$5;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
-  return i64toi32_i32$2 | 0;
+  var$2 = $20;
+  var$2$hi = i64toi32_i32$2;
+  i64toi32_i32$2 = var$1$hi;
+  i64toi32_i32$2 = var$2$hi;
+  i64toi32_i32$0 = var$2;
+  i64toi32_i32$3 = var$1$hi;
+  i64toi32_i32$4 = var$1;
+  i64toi32_i32$3 = i64toi32_i32$2 ^ i64toi32_i32$3 | 0;
+  $14$hi = i64toi32_i32$3;
+  i64toi32_i32$3 = i64toi32_i32$2;
+  i64toi32_i32$3 = $14$hi;
+  i64toi32_i32$2 = i64toi32_i32$0 ^ i64toi32_i32$4 | 0;
+  i64toi32_i32$0 = var$2$hi;
+  i64toi32_i32$4 = var$2;
+  i64toi32_i32$1 = i64toi32_i32$2 >>> 0 < i64toi32_i32$4 >>> 0;
+  i64toi32_i32$2 = i64toi32_i32$2 - i64toi32_i32$4 | 0;
+  i64toi32_i32$0 = i64toi32_i32$1 + i64toi32_i32$0 | 0;
+  i64toi32_i32$0 = i64toi32_i32$3 - i64toi32_i32$0 | 0;
+  $16$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = $9$hi;
+  i64toi32_i32$3 = $16$hi;
+  i64toi32_i32$3 = __wasm_i64_udiv($9 | 0, i64toi32_i32$0 | 0, i64toi32_i32$2 | 0, i64toi32_i32$3 | 0) | 0;
+  i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
+  $17 = i64toi32_i32$3;
+  $17$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = var$1$hi;
+  i64toi32_i32$0 = var$0$hi;
+  i64toi32_i32$0 = var$1$hi;
+  i64toi32_i32$4 = var$1;
+  i64toi32_i32$3 = var$0$hi;
+  i64toi32_i32$1 = var$0;
+  i64toi32_i32$3 = i64toi32_i32$0 ^ i64toi32_i32$3 | 0;
+  i64toi32_i32$0 = i64toi32_i32$4 ^ i64toi32_i32$1 | 0;
+  i64toi32_i32$4 = 0;
+  i64toi32_i32$1 = 63;
+  i64toi32_i32$2 = i64toi32_i32$1 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$1 & 63 | 0) >>> 0) {
+   i64toi32_i32$4 = i64toi32_i32$3 >> 31 | 0;
+   $21 = i64toi32_i32$3 >> i64toi32_i32$2 | 0;
+  } else {
+   i64toi32_i32$4 = i64toi32_i32$3 >> i64toi32_i32$2 | 0;
+   $21 = (((1 << i64toi32_i32$2 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$2 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$2 | 0) | 0;
+  }
+  var$0 = $21;
+  var$0$hi = i64toi32_i32$4;
+  i64toi32_i32$4 = $17$hi;
+  i64toi32_i32$3 = $17;
+  i64toi32_i32$0 = var$0$hi;
+  i64toi32_i32$1 = var$0;
+  i64toi32_i32$0 = i64toi32_i32$4 ^ i64toi32_i32$0 | 0;
+  $23$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = var$0$hi;
+  i64toi32_i32$0 = $23$hi;
+  i64toi32_i32$4 = i64toi32_i32$3 ^ i64toi32_i32$1 | 0;
+  i64toi32_i32$3 = var$0$hi;
+  i64toi32_i32$2 = i64toi32_i32$4 >>> 0 < i64toi32_i32$1 >>> 0;
+  i64toi32_i32$4 = i64toi32_i32$4 - i64toi32_i32$1 | 0;
+  i64toi32_i32$3 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
+  i64toi32_i32$3 = i64toi32_i32$0 - i64toi32_i32$3 | 0;
+  i64toi32_i32$0 = i64toi32_i32$4;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$3;
+  return i64toi32_i32$0 | 0;
  }
  
  function _ZN17compiler_builtins3int4udiv10divmod_u6417h6026910b5ed08e40E(var$0, var$0$hi, var$1, var$1$hi) {
@@ -6484,7 +6482,7 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$4 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, i64toi32_i32$6 = 0, $37 = 0, $38 = 0, $39 = 0, $40 = 0, $41 = 0, $42 = 0, $43 = 0, $44 = 0, var$8$hi = 0, $45 = 0, $46 = 0, $47 = 0, $48 = 0, var$7$hi = 0, $49 = 0, $63$hi = 0, $65 = 0, $65$hi = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142$hi = 0, $144 = 0, $144$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0;
+  var i64toi32_i32$4 = 0, i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, var$2 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, $35 = 0, $36 = 0, $37 = 0, $38 = 0, $39 = 0, $40 = 0, $41 = 0, $42 = 0, var$8$hi = 0, $43 = 0, $44 = 0, $45 = 0, $46 = 0, var$7$hi = 0, $47 = 0, $63$hi = 0, $65 = 0, $65$hi = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142$hi = 0, $144 = 0, $144$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0;
   label$1 : {
    label$2 : {
     label$3 : {
@@ -6503,12 +6501,12 @@ function asmFunc(global, env, buffer) {
              i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
              if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
               i64toi32_i32$1 = 0;
-              $37 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
+              $35 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
              } else {
               i64toi32_i32$1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-              $37 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+              $35 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
              }
-             var$2 = $37;
+             var$2 = $35;
              if (var$2) {
               block : {
                i64toi32_i32$1 = var$1$hi;
@@ -6523,12 +6521,12 @@ function asmFunc(global, env, buffer) {
                i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
                if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
                 i64toi32_i32$2 = 0;
-                $38 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
+                $36 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
                } else {
                 i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-                $38 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
+                $36 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
                }
-               var$4 = $38;
+               var$4 = $36;
                if (!var$4) {
                 break label$9
                }
@@ -6565,12 +6563,12 @@ function asmFunc(global, env, buffer) {
             i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
             if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
              i64toi32_i32$1 = 0;
-             $39 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
+             $37 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
             } else {
              i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-             $39 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
+             $37 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
             }
-            var$3 = $39;
+            var$3 = $37;
             i64toi32_i32$1 = var$0$hi;
             if (!var$0) {
              break label$7
@@ -6589,10 +6587,10 @@ function asmFunc(global, env, buffer) {
             i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
             if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
              i64toi32_i32$3 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-             $40 = 0;
+             $38 = 0;
             } else {
              i64toi32_i32$3 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-             $40 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
+             $38 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
             }
             $63$hi = i64toi32_i32$3;
             i64toi32_i32$3 = var$0$hi;
@@ -6603,7 +6601,7 @@ function asmFunc(global, env, buffer) {
             $65 = i64toi32_i32$1 & i64toi32_i32$0 | 0;
             $65$hi = i64toi32_i32$2;
             i64toi32_i32$2 = $63$hi;
-            i64toi32_i32$3 = $40;
+            i64toi32_i32$3 = $38;
             i64toi32_i32$1 = $65$hi;
             i64toi32_i32$0 = $65;
             i64toi32_i32$1 = i64toi32_i32$2 | i64toi32_i32$1 | 0;
@@ -6634,12 +6632,12 @@ function asmFunc(global, env, buffer) {
         i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
         if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
          i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-         $41 = 0;
+         $39 = 0;
         } else {
          i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $41 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
+         $39 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
         }
-        legalfunc$wasm2js_scratch_store_i64($41 | 0, i64toi32_i32$1 | 0);
+        legalfunc$wasm2js_scratch_store_i64($39 | 0, i64toi32_i32$1 | 0);
         i64toi32_i32$1 = 0;
         i64toi32_i32$2 = var$4;
         i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
@@ -6667,12 +6665,12 @@ function asmFunc(global, env, buffer) {
       i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
       if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
        i64toi32_i32$1 = 0;
-       $42 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
+       $40 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
       } else {
        i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-       $42 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
+       $40 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
       }
-      i64toi32_i32$3 = $42;
+      i64toi32_i32$3 = $40;
       i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
       return i64toi32_i32$3 | 0;
      }
@@ -6689,12 +6687,12 @@ function asmFunc(global, env, buffer) {
     i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
     if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
      i64toi32_i32$1 = 0;
-     $43 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
+     $41 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
     } else {
      i64toi32_i32$1 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
-     $43 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+     $41 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
     }
-    var$5 = $43;
+    var$5 = $41;
     var$5$hi = i64toi32_i32$1;
     i64toi32_i32$1 = var$0$hi;
     i64toi32_i32$1 = 0;
@@ -6706,12 +6704,12 @@ function asmFunc(global, env, buffer) {
     i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
     if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
      i64toi32_i32$2 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
-     $44 = 0;
+     $42 = 0;
     } else {
      i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$3 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-     $44 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
+     $42 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
     }
-    var$0 = $44;
+    var$0 = $42;
     var$0$hi = i64toi32_i32$2;
     label$13 : {
      if (var$2) {
@@ -6720,121 +6718,121 @@ function asmFunc(global, env, buffer) {
        i64toi32_i32$1 = var$1;
        i64toi32_i32$3 = -1;
        i64toi32_i32$0 = -1;
-       i64toi32_i32$4 = i64toi32_i32$1 + i64toi32_i32$0 | 0;
-       i64toi32_i32$5 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
-       if (i64toi32_i32$4 >>> 0 < i64toi32_i32$0 >>> 0) {
-        i64toi32_i32$5 = i64toi32_i32$5 + 1 | 0
+       i64toi32_i32$1 = i64toi32_i32$1 + i64toi32_i32$0 | 0;
+       i64toi32_i32$2 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
+       if (i64toi32_i32$1 >>> 0 < i64toi32_i32$0 >>> 0) {
+        i64toi32_i32$2 = i64toi32_i32$2 + 1 | 0
        }
-       var$8 = i64toi32_i32$4;
-       var$8$hi = i64toi32_i32$5;
+       var$8 = i64toi32_i32$1;
+       var$8$hi = i64toi32_i32$2;
        label$15 : while (1) {
-        i64toi32_i32$5 = var$5$hi;
-        i64toi32_i32$2 = var$5;
-        i64toi32_i32$1 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
-         $45 = 0;
+        i64toi32_i32$2 = var$5$hi;
+        i64toi32_i32$3 = var$5;
+        i64toi32_i32$0 = 0;
+        i64toi32_i32$1 = 1;
+        i64toi32_i32$4 = i64toi32_i32$1 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$1 & 63 | 0) >>> 0) {
+         i64toi32_i32$0 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
+         $43 = 0;
         } else {
-         i64toi32_i32$1 = ((1 << i64toi32_i32$3 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$3 | 0) | 0) | 0 | (i64toi32_i32$5 << i64toi32_i32$3 | 0) | 0;
-         $45 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
+         i64toi32_i32$0 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$3 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$2 << i64toi32_i32$4 | 0) | 0;
+         $43 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
         }
-        $140 = $45;
-        $140$hi = i64toi32_i32$1;
-        i64toi32_i32$1 = var$0$hi;
-        i64toi32_i32$5 = var$0;
-        i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 63;
-        i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = 0;
-         $46 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
+        $140 = $43;
+        $140$hi = i64toi32_i32$0;
+        i64toi32_i32$0 = var$0$hi;
+        i64toi32_i32$2 = var$0;
+        i64toi32_i32$3 = 0;
+        i64toi32_i32$1 = 63;
+        i64toi32_i32$4 = i64toi32_i32$1 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$1 & 63 | 0) >>> 0) {
+         i64toi32_i32$3 = 0;
+         $44 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
         } else {
-         i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
-         $46 = (((1 << i64toi32_i32$3 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$3 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$3 | 0) | 0;
+         i64toi32_i32$3 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
+         $44 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
         }
-        $142$hi = i64toi32_i32$2;
-        i64toi32_i32$2 = $140$hi;
-        i64toi32_i32$1 = $140;
-        i64toi32_i32$5 = $142$hi;
-        i64toi32_i32$0 = $46;
-        i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
-        var$5 = i64toi32_i32$1 | i64toi32_i32$0 | 0;
-        var$5$hi = i64toi32_i32$5;
+        $142$hi = i64toi32_i32$3;
+        i64toi32_i32$3 = $140$hi;
+        i64toi32_i32$0 = $140;
+        i64toi32_i32$2 = $142$hi;
+        i64toi32_i32$1 = $44;
+        i64toi32_i32$2 = i64toi32_i32$3 | i64toi32_i32$2 | 0;
+        var$5 = i64toi32_i32$0 | i64toi32_i32$1 | 0;
+        var$5$hi = i64toi32_i32$2;
         $144 = var$5;
-        $144$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = var$8$hi;
-        i64toi32_i32$5 = var$5$hi;
-        i64toi32_i32$5 = var$8$hi;
-        i64toi32_i32$2 = var$8;
-        i64toi32_i32$1 = var$5$hi;
-        i64toi32_i32$0 = var$5;
-        i64toi32_i32$3 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
-        i64toi32_i32$6 = i64toi32_i32$2 >>> 0 < i64toi32_i32$0 >>> 0;
-        i64toi32_i32$4 = i64toi32_i32$6 + i64toi32_i32$1 | 0;
-        i64toi32_i32$4 = i64toi32_i32$5 - i64toi32_i32$4 | 0;
-        i64toi32_i32$5 = i64toi32_i32$3;
+        $144$hi = i64toi32_i32$2;
+        i64toi32_i32$2 = var$8$hi;
+        i64toi32_i32$2 = var$5$hi;
+        i64toi32_i32$2 = var$8$hi;
+        i64toi32_i32$3 = var$8;
+        i64toi32_i32$0 = var$5$hi;
+        i64toi32_i32$1 = var$5;
+        i64toi32_i32$4 = i64toi32_i32$3 >>> 0 < i64toi32_i32$1 >>> 0;
+        i64toi32_i32$3 = i64toi32_i32$3 - i64toi32_i32$1 | 0;
+        i64toi32_i32$0 = i64toi32_i32$4 + i64toi32_i32$0 | 0;
+        i64toi32_i32$0 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
+        i64toi32_i32$1 = i64toi32_i32$3;
         i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 63;
-        i64toi32_i32$1 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = i64toi32_i32$4 >> 31 | 0;
-         $47 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
+        i64toi32_i32$4 = 63;
+        i64toi32_i32$3 = i64toi32_i32$4 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$4 & 63 | 0) >>> 0) {
+         i64toi32_i32$2 = i64toi32_i32$0 >> 31 | 0;
+         $45 = i64toi32_i32$0 >> i64toi32_i32$3 | 0;
         } else {
-         i64toi32_i32$2 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
-         $47 = (((1 << i64toi32_i32$1 | 0) - 1 | 0) & i64toi32_i32$4 | 0) << (32 - i64toi32_i32$1 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$1 | 0) | 0;
+         i64toi32_i32$2 = i64toi32_i32$0 >> i64toi32_i32$3 | 0;
+         $45 = (((1 << i64toi32_i32$3 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$3 | 0) | 0 | (i64toi32_i32$1 >>> i64toi32_i32$3 | 0) | 0;
         }
-        var$6 = $47;
+        var$6 = $45;
         var$6$hi = i64toi32_i32$2;
         i64toi32_i32$2 = var$1$hi;
         i64toi32_i32$2 = var$6$hi;
-        i64toi32_i32$4 = var$6;
-        i64toi32_i32$5 = var$1$hi;
-        i64toi32_i32$0 = var$1;
-        i64toi32_i32$5 = i64toi32_i32$2 & i64toi32_i32$5 | 0;
-        $151 = i64toi32_i32$4 & i64toi32_i32$0 | 0;
-        $151$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = $144$hi;
+        i64toi32_i32$0 = var$6;
+        i64toi32_i32$1 = var$1$hi;
+        i64toi32_i32$4 = var$1;
+        i64toi32_i32$1 = i64toi32_i32$2 & i64toi32_i32$1 | 0;
+        $151 = i64toi32_i32$0 & i64toi32_i32$4 | 0;
+        $151$hi = i64toi32_i32$1;
+        i64toi32_i32$1 = $144$hi;
         i64toi32_i32$2 = $144;
-        i64toi32_i32$4 = $151$hi;
-        i64toi32_i32$0 = $151;
-        i64toi32_i32$1 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
-        i64toi32_i32$6 = i64toi32_i32$2 >>> 0 < i64toi32_i32$0 >>> 0;
-        i64toi32_i32$3 = i64toi32_i32$6 + i64toi32_i32$4 | 0;
-        i64toi32_i32$3 = i64toi32_i32$5 - i64toi32_i32$3 | 0;
-        var$5 = i64toi32_i32$1;
-        var$5$hi = i64toi32_i32$3;
-        i64toi32_i32$3 = var$0$hi;
-        i64toi32_i32$5 = var$0;
-        i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-         $48 = 0;
+        i64toi32_i32$0 = $151$hi;
+        i64toi32_i32$4 = $151;
+        i64toi32_i32$3 = i64toi32_i32$2 >>> 0 < i64toi32_i32$4 >>> 0;
+        i64toi32_i32$2 = i64toi32_i32$2 - i64toi32_i32$4 | 0;
+        i64toi32_i32$0 = i64toi32_i32$3 + i64toi32_i32$0 | 0;
+        i64toi32_i32$0 = i64toi32_i32$1 - i64toi32_i32$0 | 0;
+        var$5 = i64toi32_i32$2;
+        var$5$hi = i64toi32_i32$0;
+        i64toi32_i32$0 = var$0$hi;
+        i64toi32_i32$4 = var$0;
+        i64toi32_i32$1 = 0;
+        i64toi32_i32$3 = 1;
+        i64toi32_i32$2 = i64toi32_i32$3 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
+         i64toi32_i32$1 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
+         $46 = 0;
         } else {
-         i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $48 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
+         i64toi32_i32$1 = ((1 << i64toi32_i32$2 | 0) - 1 | 0) & (i64toi32_i32$4 >>> (32 - i64toi32_i32$2 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$2 | 0) | 0;
+         $46 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
         }
-        $154$hi = i64toi32_i32$2;
-        i64toi32_i32$2 = var$7$hi;
-        i64toi32_i32$2 = $154$hi;
-        i64toi32_i32$3 = $48;
-        i64toi32_i32$5 = var$7$hi;
-        i64toi32_i32$0 = var$7;
-        i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
-        var$0 = i64toi32_i32$3 | i64toi32_i32$0 | 0;
-        var$0$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = var$6$hi;
-        i64toi32_i32$2 = var$6;
-        i64toi32_i32$3 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$3 = i64toi32_i32$5 & i64toi32_i32$3 | 0;
-        var$6 = i64toi32_i32$2 & i64toi32_i32$0 | 0;
-        var$6$hi = i64toi32_i32$3;
+        $154$hi = i64toi32_i32$1;
+        i64toi32_i32$1 = var$7$hi;
+        i64toi32_i32$1 = $154$hi;
+        i64toi32_i32$0 = $46;
+        i64toi32_i32$4 = var$7$hi;
+        i64toi32_i32$3 = var$7;
+        i64toi32_i32$4 = i64toi32_i32$1 | i64toi32_i32$4 | 0;
+        var$0 = i64toi32_i32$0 | i64toi32_i32$3 | 0;
+        var$0$hi = i64toi32_i32$4;
+        i64toi32_i32$4 = var$6$hi;
+        i64toi32_i32$1 = var$6;
+        i64toi32_i32$0 = 0;
+        i64toi32_i32$3 = 1;
+        i64toi32_i32$0 = i64toi32_i32$4 & i64toi32_i32$0 | 0;
+        var$6 = i64toi32_i32$1 & i64toi32_i32$3 | 0;
+        var$6$hi = i64toi32_i32$0;
         var$7 = var$6;
-        var$7$hi = i64toi32_i32$3;
+        var$7$hi = i64toi32_i32$0;
         var$2 = var$2 + -1 | 0;
         if (var$2) {
          continue label$15
@@ -6845,41 +6843,41 @@ function asmFunc(global, env, buffer) {
       }
      }
     }
-    i64toi32_i32$3 = var$5$hi;
-    legalfunc$wasm2js_scratch_store_i64(var$5 | 0, i64toi32_i32$3 | 0);
-    i64toi32_i32$3 = var$0$hi;
-    i64toi32_i32$5 = var$0;
-    i64toi32_i32$2 = 0;
-    i64toi32_i32$0 = 1;
-    i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-    if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-     i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-     $49 = 0;
+    i64toi32_i32$0 = var$5$hi;
+    legalfunc$wasm2js_scratch_store_i64(var$5 | 0, i64toi32_i32$0 | 0);
+    i64toi32_i32$0 = var$0$hi;
+    i64toi32_i32$4 = var$0;
+    i64toi32_i32$1 = 0;
+    i64toi32_i32$3 = 1;
+    i64toi32_i32$2 = i64toi32_i32$3 & 31 | 0;
+    if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
+     i64toi32_i32$1 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
+     $47 = 0;
     } else {
-     i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-     $49 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
+     i64toi32_i32$1 = ((1 << i64toi32_i32$2 | 0) - 1 | 0) & (i64toi32_i32$4 >>> (32 - i64toi32_i32$2 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$2 | 0) | 0;
+     $47 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
     }
-    $165$hi = i64toi32_i32$2;
-    i64toi32_i32$2 = var$6$hi;
-    i64toi32_i32$2 = $165$hi;
-    i64toi32_i32$3 = $49;
-    i64toi32_i32$5 = var$6$hi;
-    i64toi32_i32$0 = var$6;
-    i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
-    i64toi32_i32$3 = i64toi32_i32$3 | i64toi32_i32$0 | 0;
-    i64toi32_i32$HIGH_BITS = i64toi32_i32$5;
-    return i64toi32_i32$3 | 0;
+    $165$hi = i64toi32_i32$1;
+    i64toi32_i32$1 = var$6$hi;
+    i64toi32_i32$1 = $165$hi;
+    i64toi32_i32$0 = $47;
+    i64toi32_i32$4 = var$6$hi;
+    i64toi32_i32$3 = var$6;
+    i64toi32_i32$4 = i64toi32_i32$1 | i64toi32_i32$4 | 0;
+    i64toi32_i32$0 = i64toi32_i32$0 | i64toi32_i32$3 | 0;
+    i64toi32_i32$HIGH_BITS = i64toi32_i32$4;
+    return i64toi32_i32$0 | 0;
    }
-   i64toi32_i32$3 = var$0$hi;
-   legalfunc$wasm2js_scratch_store_i64(var$0 | 0, i64toi32_i32$3 | 0);
-   i64toi32_i32$3 = 0;
+   i64toi32_i32$0 = var$0$hi;
+   legalfunc$wasm2js_scratch_store_i64(var$0 | 0, i64toi32_i32$0 | 0);
+   i64toi32_i32$0 = 0;
    var$0 = 0;
-   var$0$hi = i64toi32_i32$3;
+   var$0$hi = i64toi32_i32$0;
   }
-  i64toi32_i32$3 = var$0$hi;
-  i64toi32_i32$5 = var$0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$3;
-  return i64toi32_i32$5 | 0;
+  i64toi32_i32$0 = var$0$hi;
+  i64toi32_i32$4 = var$0;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
+  return i64toi32_i32$4 | 0;
  }
  
  function __wasm_i64_sdiv(var$0, var$0$hi, var$1, var$1$hi) {
@@ -7122,7 +7120,7 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$2$hi = 0, i64toi32_i32$6 = 0, $21 = 0, $22 = 0, $23 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17 = 0, $17$hi = 0, $23$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$4 = 0, var$2 = 0, var$2$hi = 0, $19 = 0, $20 = 0, $21 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17 = 0, $17$hi = 0, $23$hi = 0;
   i64toi32_i32$0 = var$0$hi;
   i64toi32_i32$2 = var$0;
   i64toi32_i32$1 = 0;
@@ -7130,12 +7128,12 @@ function asmFunc(global, env, buffer) {
   i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
   if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
    i64toi32_i32$1 = i64toi32_i32$0 >> 31 | 0;
-   $21 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
+   $19 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
   } else {
    i64toi32_i32$1 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
-   $21 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+   $19 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
   }
-  var$2 = $21;
+  var$2 = $19;
   var$2$hi = i64toi32_i32$1;
   i64toi32_i32$1 = var$0$hi;
   i64toi32_i32$1 = var$2$hi;
@@ -7149,86 +7147,86 @@ function asmFunc(global, env, buffer) {
   i64toi32_i32$1 = i64toi32_i32$0 ^ i64toi32_i32$3 | 0;
   i64toi32_i32$0 = var$2$hi;
   i64toi32_i32$3 = var$2;
-  i64toi32_i32$4 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$5 = i64toi32_i32$6 + i64toi32_i32$0 | 0;
-  i64toi32_i32$5 = i64toi32_i32$2 - i64toi32_i32$5 | 0;
-  $9 = i64toi32_i32$4;
-  $9$hi = i64toi32_i32$5;
-  i64toi32_i32$5 = var$1$hi;
-  i64toi32_i32$2 = var$1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$0 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$5 >> 31 | 0;
-   $22 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
-  } else {
-   i64toi32_i32$1 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
-   $22 = (((1 << i64toi32_i32$0 | 0) - 1 | 0) & i64toi32_i32$5 | 0) << (32 - i64toi32_i32$0 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$0 | 0) | 0;
-  }
-  var$2 = $22;
-  var$2$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$1$hi;
-  i64toi32_i32$1 = var$2$hi;
-  i64toi32_i32$5 = var$2;
-  i64toi32_i32$2 = var$1$hi;
+  i64toi32_i32$4 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
+  i64toi32_i32$1 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
+  i64toi32_i32$0 = i64toi32_i32$4 + i64toi32_i32$0 | 0;
+  i64toi32_i32$0 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
+  $9 = i64toi32_i32$1;
+  $9$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = var$1$hi;
   i64toi32_i32$3 = var$1;
-  i64toi32_i32$2 = i64toi32_i32$1 ^ i64toi32_i32$2 | 0;
-  $14$hi = i64toi32_i32$2;
-  i64toi32_i32$2 = i64toi32_i32$1;
-  i64toi32_i32$2 = $14$hi;
-  i64toi32_i32$1 = i64toi32_i32$5 ^ i64toi32_i32$3 | 0;
-  i64toi32_i32$5 = var$2$hi;
-  i64toi32_i32$3 = var$2;
-  i64toi32_i32$0 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$4 = i64toi32_i32$6 + i64toi32_i32$5 | 0;
-  i64toi32_i32$4 = i64toi32_i32$2 - i64toi32_i32$4 | 0;
-  $16$hi = i64toi32_i32$4;
-  i64toi32_i32$4 = $9$hi;
-  i64toi32_i32$1 = $16$hi;
-  i64toi32_i32$1 = __wasm_i64_udiv($9 | 0, i64toi32_i32$4 | 0, i64toi32_i32$0 | 0, i64toi32_i32$1 | 0) | 0;
-  i64toi32_i32$4 = i64toi32_i32$HIGH_BITS;
-  $17 = i64toi32_i32$1;
-  $17$hi = i64toi32_i32$4;
-  i64toi32_i32$4 = var$1$hi;
-  i64toi32_i32$4 = var$0$hi;
-  i64toi32_i32$4 = var$1$hi;
-  i64toi32_i32$2 = var$1;
-  i64toi32_i32$1 = var$0$hi;
-  i64toi32_i32$3 = var$0;
-  i64toi32_i32$1 = i64toi32_i32$4 ^ i64toi32_i32$1 | 0;
-  i64toi32_i32$4 = i64toi32_i32$2 ^ i64toi32_i32$3 | 0;
   i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$5 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = i64toi32_i32$1 >> 31 | 0;
-   $23 = i64toi32_i32$1 >> i64toi32_i32$5 | 0;
+  i64toi32_i32$4 = 63;
+  i64toi32_i32$1 = i64toi32_i32$4 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$4 & 63 | 0) >>> 0) {
+   i64toi32_i32$2 = i64toi32_i32$0 >> 31 | 0;
+   $20 = i64toi32_i32$0 >> i64toi32_i32$1 | 0;
   } else {
-   i64toi32_i32$2 = i64toi32_i32$1 >> i64toi32_i32$5 | 0;
-   $23 = (((1 << i64toi32_i32$5 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$5 | 0) | 0 | (i64toi32_i32$4 >>> i64toi32_i32$5 | 0) | 0;
+   i64toi32_i32$2 = i64toi32_i32$0 >> i64toi32_i32$1 | 0;
+   $20 = (((1 << i64toi32_i32$1 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$1 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$1 | 0) | 0;
   }
-  var$0 = $23;
-  var$0$hi = i64toi32_i32$2;
-  i64toi32_i32$2 = $17$hi;
-  i64toi32_i32$1 = $17;
-  i64toi32_i32$4 = var$0$hi;
-  i64toi32_i32$3 = var$0;
-  i64toi32_i32$4 = i64toi32_i32$2 ^ i64toi32_i32$4 | 0;
-  $23$hi = i64toi32_i32$4;
-  i64toi32_i32$4 = var$0$hi;
-  i64toi32_i32$4 = $23$hi;
-  i64toi32_i32$2 = i64toi32_i32$1 ^ i64toi32_i32$3 | 0;
-  i64toi32_i32$1 = var$0$hi;
-  i64toi32_i32$5 = i64toi32_i32$2 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$2 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$0 = i64toi32_i32$6 + i64toi32_i32$1 | 0;
-  i64toi32_i32$0 = i64toi32_i32$4 - i64toi32_i32$0 | 0;
-  i64toi32_i32$2 = i64toi32_i32$5;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
-  return i64toi32_i32$2 | 0;
+  var$2 = $20;
+  var$2$hi = i64toi32_i32$2;
+  i64toi32_i32$2 = var$1$hi;
+  i64toi32_i32$2 = var$2$hi;
+  i64toi32_i32$0 = var$2;
+  i64toi32_i32$3 = var$1$hi;
+  i64toi32_i32$4 = var$1;
+  i64toi32_i32$3 = i64toi32_i32$2 ^ i64toi32_i32$3 | 0;
+  $14$hi = i64toi32_i32$3;
+  i64toi32_i32$3 = i64toi32_i32$2;
+  i64toi32_i32$3 = $14$hi;
+  i64toi32_i32$2 = i64toi32_i32$0 ^ i64toi32_i32$4 | 0;
+  i64toi32_i32$0 = var$2$hi;
+  i64toi32_i32$4 = var$2;
+  i64toi32_i32$1 = i64toi32_i32$2 >>> 0 < i64toi32_i32$4 >>> 0;
+  i64toi32_i32$2 = i64toi32_i32$2 - i64toi32_i32$4 | 0;
+  i64toi32_i32$0 = i64toi32_i32$1 + i64toi32_i32$0 | 0;
+  i64toi32_i32$0 = i64toi32_i32$3 - i64toi32_i32$0 | 0;
+  $16$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = $9$hi;
+  i64toi32_i32$3 = $16$hi;
+  i64toi32_i32$3 = __wasm_i64_udiv($9 | 0, i64toi32_i32$0 | 0, i64toi32_i32$2 | 0, i64toi32_i32$3 | 0) | 0;
+  i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
+  $17 = i64toi32_i32$3;
+  $17$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = var$1$hi;
+  i64toi32_i32$0 = var$0$hi;
+  i64toi32_i32$0 = var$1$hi;
+  i64toi32_i32$4 = var$1;
+  i64toi32_i32$3 = var$0$hi;
+  i64toi32_i32$1 = var$0;
+  i64toi32_i32$3 = i64toi32_i32$0 ^ i64toi32_i32$3 | 0;
+  i64toi32_i32$0 = i64toi32_i32$4 ^ i64toi32_i32$1 | 0;
+  i64toi32_i32$4 = 0;
+  i64toi32_i32$1 = 63;
+  i64toi32_i32$2 = i64toi32_i32$1 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$1 & 63 | 0) >>> 0) {
+   i64toi32_i32$4 = i64toi32_i32$3 >> 31 | 0;
+   $21 = i64toi32_i32$3 >> i64toi32_i32$2 | 0;
+  } else {
+   i64toi32_i32$4 = i64toi32_i32$3 >> i64toi32_i32$2 | 0;
+   $21 = (((1 << i64toi32_i32$2 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$2 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$2 | 0) | 0;
+  }
+  var$0 = $21;
+  var$0$hi = i64toi32_i32$4;
+  i64toi32_i32$4 = $17$hi;
+  i64toi32_i32$3 = $17;
+  i64toi32_i32$0 = var$0$hi;
+  i64toi32_i32$1 = var$0;
+  i64toi32_i32$0 = i64toi32_i32$4 ^ i64toi32_i32$0 | 0;
+  $23$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = var$0$hi;
+  i64toi32_i32$0 = $23$hi;
+  i64toi32_i32$4 = i64toi32_i32$3 ^ i64toi32_i32$1 | 0;
+  i64toi32_i32$3 = var$0$hi;
+  i64toi32_i32$2 = i64toi32_i32$4 >>> 0 < i64toi32_i32$1 >>> 0;
+  i64toi32_i32$4 = i64toi32_i32$4 - i64toi32_i32$1 | 0;
+  i64toi32_i32$3 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
+  i64toi32_i32$3 = i64toi32_i32$0 - i64toi32_i32$3 | 0;
+  i64toi32_i32$0 = i64toi32_i32$4;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$3;
+  return i64toi32_i32$0 | 0;
  }
  
  function _ZN17compiler_builtins3int4udiv10divmod_u6417h6026910b5ed08e40E(var$0, var$0$hi, var$1, var$1$hi) {
@@ -7236,7 +7234,7 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$4 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, i64toi32_i32$6 = 0, $37 = 0, $38 = 0, $39 = 0, $40 = 0, $41 = 0, $42 = 0, $43 = 0, $44 = 0, var$8$hi = 0, $45 = 0, $46 = 0, $47 = 0, $48 = 0, var$7$hi = 0, $49 = 0, $63$hi = 0, $65 = 0, $65$hi = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142$hi = 0, $144 = 0, $144$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0;
+  var i64toi32_i32$4 = 0, i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, var$2 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, $35 = 0, $36 = 0, $37 = 0, $38 = 0, $39 = 0, $40 = 0, $41 = 0, $42 = 0, var$8$hi = 0, $43 = 0, $44 = 0, $45 = 0, $46 = 0, var$7$hi = 0, $47 = 0, $63$hi = 0, $65 = 0, $65$hi = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142$hi = 0, $144 = 0, $144$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0;
   label$1 : {
    label$2 : {
     label$3 : {
@@ -7255,12 +7253,12 @@ function asmFunc(global, env, buffer) {
              i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
              if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
               i64toi32_i32$1 = 0;
-              $37 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
+              $35 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
              } else {
               i64toi32_i32$1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-              $37 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+              $35 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
              }
-             var$2 = $37;
+             var$2 = $35;
              if (var$2) {
               block : {
                i64toi32_i32$1 = var$1$hi;
@@ -7275,12 +7273,12 @@ function asmFunc(global, env, buffer) {
                i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
                if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
                 i64toi32_i32$2 = 0;
-                $38 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
+                $36 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
                } else {
                 i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-                $38 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
+                $36 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
                }
-               var$4 = $38;
+               var$4 = $36;
                if (!var$4) {
                 break label$9
                }
@@ -7317,12 +7315,12 @@ function asmFunc(global, env, buffer) {
             i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
             if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
              i64toi32_i32$1 = 0;
-             $39 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
+             $37 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
             } else {
              i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-             $39 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
+             $37 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
             }
-            var$3 = $39;
+            var$3 = $37;
             i64toi32_i32$1 = var$0$hi;
             if (!var$0) {
              break label$7
@@ -7341,10 +7339,10 @@ function asmFunc(global, env, buffer) {
             i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
             if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
              i64toi32_i32$3 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-             $40 = 0;
+             $38 = 0;
             } else {
              i64toi32_i32$3 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-             $40 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
+             $38 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
             }
             $63$hi = i64toi32_i32$3;
             i64toi32_i32$3 = var$0$hi;
@@ -7355,7 +7353,7 @@ function asmFunc(global, env, buffer) {
             $65 = i64toi32_i32$1 & i64toi32_i32$0 | 0;
             $65$hi = i64toi32_i32$2;
             i64toi32_i32$2 = $63$hi;
-            i64toi32_i32$3 = $40;
+            i64toi32_i32$3 = $38;
             i64toi32_i32$1 = $65$hi;
             i64toi32_i32$0 = $65;
             i64toi32_i32$1 = i64toi32_i32$2 | i64toi32_i32$1 | 0;
@@ -7386,12 +7384,12 @@ function asmFunc(global, env, buffer) {
         i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
         if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
          i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-         $41 = 0;
+         $39 = 0;
         } else {
          i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $41 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
+         $39 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
         }
-        legalfunc$wasm2js_scratch_store_i64($41 | 0, i64toi32_i32$1 | 0);
+        legalfunc$wasm2js_scratch_store_i64($39 | 0, i64toi32_i32$1 | 0);
         i64toi32_i32$1 = 0;
         i64toi32_i32$2 = var$4;
         i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
@@ -7419,12 +7417,12 @@ function asmFunc(global, env, buffer) {
       i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
       if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
        i64toi32_i32$1 = 0;
-       $42 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
+       $40 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
       } else {
        i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-       $42 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
+       $40 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
       }
-      i64toi32_i32$3 = $42;
+      i64toi32_i32$3 = $40;
       i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
       return i64toi32_i32$3 | 0;
      }
@@ -7441,12 +7439,12 @@ function asmFunc(global, env, buffer) {
     i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
     if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
      i64toi32_i32$1 = 0;
-     $43 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
+     $41 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
     } else {
      i64toi32_i32$1 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
-     $43 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+     $41 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
     }
-    var$5 = $43;
+    var$5 = $41;
     var$5$hi = i64toi32_i32$1;
     i64toi32_i32$1 = var$0$hi;
     i64toi32_i32$1 = 0;
@@ -7458,12 +7456,12 @@ function asmFunc(global, env, buffer) {
     i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
     if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
      i64toi32_i32$2 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
-     $44 = 0;
+     $42 = 0;
     } else {
      i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$3 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-     $44 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
+     $42 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
     }
-    var$0 = $44;
+    var$0 = $42;
     var$0$hi = i64toi32_i32$2;
     label$13 : {
      if (var$2) {
@@ -7472,121 +7470,121 @@ function asmFunc(global, env, buffer) {
        i64toi32_i32$1 = var$1;
        i64toi32_i32$3 = -1;
        i64toi32_i32$0 = -1;
-       i64toi32_i32$4 = i64toi32_i32$1 + i64toi32_i32$0 | 0;
-       i64toi32_i32$5 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
-       if (i64toi32_i32$4 >>> 0 < i64toi32_i32$0 >>> 0) {
-        i64toi32_i32$5 = i64toi32_i32$5 + 1 | 0
+       i64toi32_i32$1 = i64toi32_i32$1 + i64toi32_i32$0 | 0;
+       i64toi32_i32$2 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
+       if (i64toi32_i32$1 >>> 0 < i64toi32_i32$0 >>> 0) {
+        i64toi32_i32$2 = i64toi32_i32$2 + 1 | 0
        }
-       var$8 = i64toi32_i32$4;
-       var$8$hi = i64toi32_i32$5;
+       var$8 = i64toi32_i32$1;
+       var$8$hi = i64toi32_i32$2;
        label$15 : while (1) {
-        i64toi32_i32$5 = var$5$hi;
-        i64toi32_i32$2 = var$5;
-        i64toi32_i32$1 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
-         $45 = 0;
+        i64toi32_i32$2 = var$5$hi;
+        i64toi32_i32$3 = var$5;
+        i64toi32_i32$0 = 0;
+        i64toi32_i32$1 = 1;
+        i64toi32_i32$4 = i64toi32_i32$1 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$1 & 63 | 0) >>> 0) {
+         i64toi32_i32$0 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
+         $43 = 0;
         } else {
-         i64toi32_i32$1 = ((1 << i64toi32_i32$3 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$3 | 0) | 0) | 0 | (i64toi32_i32$5 << i64toi32_i32$3 | 0) | 0;
-         $45 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
+         i64toi32_i32$0 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$3 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$2 << i64toi32_i32$4 | 0) | 0;
+         $43 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
         }
-        $140 = $45;
-        $140$hi = i64toi32_i32$1;
-        i64toi32_i32$1 = var$0$hi;
-        i64toi32_i32$5 = var$0;
-        i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 63;
-        i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = 0;
-         $46 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
+        $140 = $43;
+        $140$hi = i64toi32_i32$0;
+        i64toi32_i32$0 = var$0$hi;
+        i64toi32_i32$2 = var$0;
+        i64toi32_i32$3 = 0;
+        i64toi32_i32$1 = 63;
+        i64toi32_i32$4 = i64toi32_i32$1 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$1 & 63 | 0) >>> 0) {
+         i64toi32_i32$3 = 0;
+         $44 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
         } else {
-         i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
-         $46 = (((1 << i64toi32_i32$3 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$3 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$3 | 0) | 0;
+         i64toi32_i32$3 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
+         $44 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
         }
-        $142$hi = i64toi32_i32$2;
-        i64toi32_i32$2 = $140$hi;
-        i64toi32_i32$1 = $140;
-        i64toi32_i32$5 = $142$hi;
-        i64toi32_i32$0 = $46;
-        i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
-        var$5 = i64toi32_i32$1 | i64toi32_i32$0 | 0;
-        var$5$hi = i64toi32_i32$5;
+        $142$hi = i64toi32_i32$3;
+        i64toi32_i32$3 = $140$hi;
+        i64toi32_i32$0 = $140;
+        i64toi32_i32$2 = $142$hi;
+        i64toi32_i32$1 = $44;
+        i64toi32_i32$2 = i64toi32_i32$3 | i64toi32_i32$2 | 0;
+        var$5 = i64toi32_i32$0 | i64toi32_i32$1 | 0;
+        var$5$hi = i64toi32_i32$2;
         $144 = var$5;
-        $144$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = var$8$hi;
-        i64toi32_i32$5 = var$5$hi;
-        i64toi32_i32$5 = var$8$hi;
-        i64toi32_i32$2 = var$8;
-        i64toi32_i32$1 = var$5$hi;
-        i64toi32_i32$0 = var$5;
-        i64toi32_i32$3 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
-        i64toi32_i32$6 = i64toi32_i32$2 >>> 0 < i64toi32_i32$0 >>> 0;
-        i64toi32_i32$4 = i64toi32_i32$6 + i64toi32_i32$1 | 0;
-        i64toi32_i32$4 = i64toi32_i32$5 - i64toi32_i32$4 | 0;
-        i64toi32_i32$5 = i64toi32_i32$3;
+        $144$hi = i64toi32_i32$2;
+        i64toi32_i32$2 = var$8$hi;
+        i64toi32_i32$2 = var$5$hi;
+        i64toi32_i32$2 = var$8$hi;
+        i64toi32_i32$3 = var$8;
+        i64toi32_i32$0 = var$5$hi;
+        i64toi32_i32$1 = var$5;
+        i64toi32_i32$4 = i64toi32_i32$3 >>> 0 < i64toi32_i32$1 >>> 0;
+        i64toi32_i32$3 = i64toi32_i32$3 - i64toi32_i32$1 | 0;
+        i64toi32_i32$0 = i64toi32_i32$4 + i64toi32_i32$0 | 0;
+        i64toi32_i32$0 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
+        i64toi32_i32$1 = i64toi32_i32$3;
         i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 63;
-        i64toi32_i32$1 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = i64toi32_i32$4 >> 31 | 0;
-         $47 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
+        i64toi32_i32$4 = 63;
+        i64toi32_i32$3 = i64toi32_i32$4 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$4 & 63 | 0) >>> 0) {
+         i64toi32_i32$2 = i64toi32_i32$0 >> 31 | 0;
+         $45 = i64toi32_i32$0 >> i64toi32_i32$3 | 0;
         } else {
-         i64toi32_i32$2 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
-         $47 = (((1 << i64toi32_i32$1 | 0) - 1 | 0) & i64toi32_i32$4 | 0) << (32 - i64toi32_i32$1 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$1 | 0) | 0;
+         i64toi32_i32$2 = i64toi32_i32$0 >> i64toi32_i32$3 | 0;
+         $45 = (((1 << i64toi32_i32$3 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$3 | 0) | 0 | (i64toi32_i32$1 >>> i64toi32_i32$3 | 0) | 0;
         }
-        var$6 = $47;
+        var$6 = $45;
         var$6$hi = i64toi32_i32$2;
         i64toi32_i32$2 = var$1$hi;
         i64toi32_i32$2 = var$6$hi;
-        i64toi32_i32$4 = var$6;
-        i64toi32_i32$5 = var$1$hi;
-        i64toi32_i32$0 = var$1;
-        i64toi32_i32$5 = i64toi32_i32$2 & i64toi32_i32$5 | 0;
-        $151 = i64toi32_i32$4 & i64toi32_i32$0 | 0;
-        $151$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = $144$hi;
+        i64toi32_i32$0 = var$6;
+        i64toi32_i32$1 = var$1$hi;
+        i64toi32_i32$4 = var$1;
+        i64toi32_i32$1 = i64toi32_i32$2 & i64toi32_i32$1 | 0;
+        $151 = i64toi32_i32$0 & i64toi32_i32$4 | 0;
+        $151$hi = i64toi32_i32$1;
+        i64toi32_i32$1 = $144$hi;
         i64toi32_i32$2 = $144;
-        i64toi32_i32$4 = $151$hi;
-        i64toi32_i32$0 = $151;
-        i64toi32_i32$1 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
-        i64toi32_i32$6 = i64toi32_i32$2 >>> 0 < i64toi32_i32$0 >>> 0;
-        i64toi32_i32$3 = i64toi32_i32$6 + i64toi32_i32$4 | 0;
-        i64toi32_i32$3 = i64toi32_i32$5 - i64toi32_i32$3 | 0;
-        var$5 = i64toi32_i32$1;
-        var$5$hi = i64toi32_i32$3;
-        i64toi32_i32$3 = var$0$hi;
-        i64toi32_i32$5 = var$0;
-        i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-         $48 = 0;
+        i64toi32_i32$0 = $151$hi;
+        i64toi32_i32$4 = $151;
+        i64toi32_i32$3 = i64toi32_i32$2 >>> 0 < i64toi32_i32$4 >>> 0;
+        i64toi32_i32$2 = i64toi32_i32$2 - i64toi32_i32$4 | 0;
+        i64toi32_i32$0 = i64toi32_i32$3 + i64toi32_i32$0 | 0;
+        i64toi32_i32$0 = i64toi32_i32$1 - i64toi32_i32$0 | 0;
+        var$5 = i64toi32_i32$2;
+        var$5$hi = i64toi32_i32$0;
+        i64toi32_i32$0 = var$0$hi;
+        i64toi32_i32$4 = var$0;
+        i64toi32_i32$1 = 0;
+        i64toi32_i32$3 = 1;
+        i64toi32_i32$2 = i64toi32_i32$3 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
+         i64toi32_i32$1 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
+         $46 = 0;
         } else {
-         i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $48 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
+         i64toi32_i32$1 = ((1 << i64toi32_i32$2 | 0) - 1 | 0) & (i64toi32_i32$4 >>> (32 - i64toi32_i32$2 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$2 | 0) | 0;
+         $46 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
         }
-        $154$hi = i64toi32_i32$2;
-        i64toi32_i32$2 = var$7$hi;
-        i64toi32_i32$2 = $154$hi;
-        i64toi32_i32$3 = $48;
-        i64toi32_i32$5 = var$7$hi;
-        i64toi32_i32$0 = var$7;
-        i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
-        var$0 = i64toi32_i32$3 | i64toi32_i32$0 | 0;
-        var$0$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = var$6$hi;
-        i64toi32_i32$2 = var$6;
-        i64toi32_i32$3 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$3 = i64toi32_i32$5 & i64toi32_i32$3 | 0;
-        var$6 = i64toi32_i32$2 & i64toi32_i32$0 | 0;
-        var$6$hi = i64toi32_i32$3;
+        $154$hi = i64toi32_i32$1;
+        i64toi32_i32$1 = var$7$hi;
+        i64toi32_i32$1 = $154$hi;
+        i64toi32_i32$0 = $46;
+        i64toi32_i32$4 = var$7$hi;
+        i64toi32_i32$3 = var$7;
+        i64toi32_i32$4 = i64toi32_i32$1 | i64toi32_i32$4 | 0;
+        var$0 = i64toi32_i32$0 | i64toi32_i32$3 | 0;
+        var$0$hi = i64toi32_i32$4;
+        i64toi32_i32$4 = var$6$hi;
+        i64toi32_i32$1 = var$6;
+        i64toi32_i32$0 = 0;
+        i64toi32_i32$3 = 1;
+        i64toi32_i32$0 = i64toi32_i32$4 & i64toi32_i32$0 | 0;
+        var$6 = i64toi32_i32$1 & i64toi32_i32$3 | 0;
+        var$6$hi = i64toi32_i32$0;
         var$7 = var$6;
-        var$7$hi = i64toi32_i32$3;
+        var$7$hi = i64toi32_i32$0;
         var$2 = var$2 + -1 | 0;
         if (var$2) {
          continue label$15
@@ -7597,41 +7595,41 @@ function asmFunc(global, env, buffer) {
       }
      }
     }
-    i64toi32_i32$3 = var$5$hi;
-    legalfunc$wasm2js_scratch_store_i64(var$5 | 0, i64toi32_i32$3 | 0);
-    i64toi32_i32$3 = var$0$hi;
-    i64toi32_i32$5 = var$0;
-    i64toi32_i32$2 = 0;
-    i64toi32_i32$0 = 1;
-    i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-    if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-     i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-     $49 = 0;
+    i64toi32_i32$0 = var$5$hi;
+    legalfunc$wasm2js_scratch_store_i64(var$5 | 0, i64toi32_i32$0 | 0);
+    i64toi32_i32$0 = var$0$hi;
+    i64toi32_i32$4 = var$0;
+    i64toi32_i32$1 = 0;
+    i64toi32_i32$3 = 1;
+    i64toi32_i32$2 = i64toi32_i32$3 & 31 | 0;
+    if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
+     i64toi32_i32$1 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
+     $47 = 0;
     } else {
-     i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-     $49 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
+     i64toi32_i32$1 = ((1 << i64toi32_i32$2 | 0) - 1 | 0) & (i64toi32_i32$4 >>> (32 - i64toi32_i32$2 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$2 | 0) | 0;
+     $47 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
     }
-    $165$hi = i64toi32_i32$2;
-    i64toi32_i32$2 = var$6$hi;
-    i64toi32_i32$2 = $165$hi;
-    i64toi32_i32$3 = $49;
-    i64toi32_i32$5 = var$6$hi;
-    i64toi32_i32$0 = var$6;
-    i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
-    i64toi32_i32$3 = i64toi32_i32$3 | i64toi32_i32$0 | 0;
-    i64toi32_i32$HIGH_BITS = i64toi32_i32$5;
-    return i64toi32_i32$3 | 0;
+    $165$hi = i64toi32_i32$1;
+    i64toi32_i32$1 = var$6$hi;
+    i64toi32_i32$1 = $165$hi;
+    i64toi32_i32$0 = $47;
+    i64toi32_i32$4 = var$6$hi;
+    i64toi32_i32$3 = var$6;
+    i64toi32_i32$4 = i64toi32_i32$1 | i64toi32_i32$4 | 0;
+    i64toi32_i32$0 = i64toi32_i32$0 | i64toi32_i32$3 | 0;
+    i64toi32_i32$HIGH_BITS = i64toi32_i32$4;
+    return i64toi32_i32$0 | 0;
    }
-   i64toi32_i32$3 = var$0$hi;
-   legalfunc$wasm2js_scratch_store_i64(var$0 | 0, i64toi32_i32$3 | 0);
-   i64toi32_i32$3 = 0;
+   i64toi32_i32$0 = var$0$hi;
+   legalfunc$wasm2js_scratch_store_i64(var$0 | 0, i64toi32_i32$0 | 0);
+   i64toi32_i32$0 = 0;
    var$0 = 0;
-   var$0$hi = i64toi32_i32$3;
+   var$0$hi = i64toi32_i32$0;
   }
-  i64toi32_i32$3 = var$0$hi;
-  i64toi32_i32$5 = var$0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$3;
-  return i64toi32_i32$5 | 0;
+  i64toi32_i32$0 = var$0$hi;
+  i64toi32_i32$4 = var$0;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
+  return i64toi32_i32$4 | 0;
  }
  
  function __wasm_i64_sdiv(var$0, var$0$hi, var$1, var$1$hi) {
@@ -7874,7 +7872,7 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$2$hi = 0, i64toi32_i32$6 = 0, $21 = 0, $22 = 0, $23 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17 = 0, $17$hi = 0, $23$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$4 = 0, var$2 = 0, var$2$hi = 0, $19 = 0, $20 = 0, $21 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17 = 0, $17$hi = 0, $23$hi = 0;
   i64toi32_i32$0 = var$0$hi;
   i64toi32_i32$2 = var$0;
   i64toi32_i32$1 = 0;
@@ -7882,12 +7880,12 @@ function asmFunc(global, env, buffer) {
   i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
   if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
    i64toi32_i32$1 = i64toi32_i32$0 >> 31 | 0;
-   $21 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
+   $19 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
   } else {
    i64toi32_i32$1 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
-   $21 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+   $19 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
   }
-  var$2 = $21;
+  var$2 = $19;
   var$2$hi = i64toi32_i32$1;
   i64toi32_i32$1 = var$0$hi;
   i64toi32_i32$1 = var$2$hi;
@@ -7901,86 +7899,86 @@ function asmFunc(global, env, buffer) {
   i64toi32_i32$1 = i64toi32_i32$0 ^ i64toi32_i32$3 | 0;
   i64toi32_i32$0 = var$2$hi;
   i64toi32_i32$3 = var$2;
-  i64toi32_i32$4 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$5 = i64toi32_i32$6 + i64toi32_i32$0 | 0;
-  i64toi32_i32$5 = i64toi32_i32$2 - i64toi32_i32$5 | 0;
-  $9 = i64toi32_i32$4;
-  $9$hi = i64toi32_i32$5;
-  i64toi32_i32$5 = var$1$hi;
-  i64toi32_i32$2 = var$1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$0 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$5 >> 31 | 0;
-   $22 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
-  } else {
-   i64toi32_i32$1 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
-   $22 = (((1 << i64toi32_i32$0 | 0) - 1 | 0) & i64toi32_i32$5 | 0) << (32 - i64toi32_i32$0 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$0 | 0) | 0;
-  }
-  var$2 = $22;
-  var$2$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$1$hi;
-  i64toi32_i32$1 = var$2$hi;
-  i64toi32_i32$5 = var$2;
-  i64toi32_i32$2 = var$1$hi;
+  i64toi32_i32$4 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
+  i64toi32_i32$1 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
+  i64toi32_i32$0 = i64toi32_i32$4 + i64toi32_i32$0 | 0;
+  i64toi32_i32$0 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
+  $9 = i64toi32_i32$1;
+  $9$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = var$1$hi;
   i64toi32_i32$3 = var$1;
-  i64toi32_i32$2 = i64toi32_i32$1 ^ i64toi32_i32$2 | 0;
-  $14$hi = i64toi32_i32$2;
-  i64toi32_i32$2 = i64toi32_i32$1;
-  i64toi32_i32$2 = $14$hi;
-  i64toi32_i32$1 = i64toi32_i32$5 ^ i64toi32_i32$3 | 0;
-  i64toi32_i32$5 = var$2$hi;
-  i64toi32_i32$3 = var$2;
-  i64toi32_i32$0 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$4 = i64toi32_i32$6 + i64toi32_i32$5 | 0;
-  i64toi32_i32$4 = i64toi32_i32$2 - i64toi32_i32$4 | 0;
-  $16$hi = i64toi32_i32$4;
-  i64toi32_i32$4 = $9$hi;
-  i64toi32_i32$1 = $16$hi;
-  i64toi32_i32$1 = __wasm_i64_udiv($9 | 0, i64toi32_i32$4 | 0, i64toi32_i32$0 | 0, i64toi32_i32$1 | 0) | 0;
-  i64toi32_i32$4 = i64toi32_i32$HIGH_BITS;
-  $17 = i64toi32_i32$1;
-  $17$hi = i64toi32_i32$4;
-  i64toi32_i32$4 = var$1$hi;
-  i64toi32_i32$4 = var$0$hi;
-  i64toi32_i32$4 = var$1$hi;
-  i64toi32_i32$2 = var$1;
-  i64toi32_i32$1 = var$0$hi;
-  i64toi32_i32$3 = var$0;
-  i64toi32_i32$1 = i64toi32_i32$4 ^ i64toi32_i32$1 | 0;
-  i64toi32_i32$4 = i64toi32_i32$2 ^ i64toi32_i32$3 | 0;
   i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$5 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = i64toi32_i32$1 >> 31 | 0;
-   $23 = i64toi32_i32$1 >> i64toi32_i32$5 | 0;
+  i64toi32_i32$4 = 63;
+  i64toi32_i32$1 = i64toi32_i32$4 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$4 & 63 | 0) >>> 0) {
+   i64toi32_i32$2 = i64toi32_i32$0 >> 31 | 0;
+   $20 = i64toi32_i32$0 >> i64toi32_i32$1 | 0;
   } else {
-   i64toi32_i32$2 = i64toi32_i32$1 >> i64toi32_i32$5 | 0;
-   $23 = (((1 << i64toi32_i32$5 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$5 | 0) | 0 | (i64toi32_i32$4 >>> i64toi32_i32$5 | 0) | 0;
+   i64toi32_i32$2 = i64toi32_i32$0 >> i64toi32_i32$1 | 0;
+   $20 = (((1 << i64toi32_i32$1 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$1 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$1 | 0) | 0;
+  }
+  var$2 = $20;
+  var$2$hi = i64toi32_i32$2;
+  i64toi32_i32$2 = var$1$hi;
+  i64toi32_i32$2 = var$2$hi;
+  i64toi32_i32$0 = var$2;
+  i64toi32_i32$3 = var$1$hi;
+  i64toi32_i32$4 = var$1;
+  i64toi32_i32$3 = i64toi32_i32$2 ^ i64toi32_i32$3 | 0;
+  $14$hi = i64toi32_i32$3;
+  i64toi32_i32$3 = i64toi32_i32$2;
+  i64toi32_i32$3 = $14$hi;
+  i64toi32_i32$2 = i64toi32_i32$0 ^ i64toi32_i32$4 | 0;
+  i64toi32_i32$0 = var$2$hi;
+  i64toi32_i32$4 = var$2;
+  i64toi32_i32$1 = i64toi32_i32$2 >>> 0 < i64toi32_i32$4 >>> 0;
+  i64toi32_i32$2 = i64toi32_i32$2 - i64toi32_i32$4 | 0;
+  i64toi32_i32$0 = i64toi32_i32$1 + i64toi32_i32$0 | 0;
+  i64toi32_i32$0 = i64toi32_i32$3 - i64toi32_i32$0 | 0;
+  $16$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = $9$hi;
+  i64toi32_i32$3 = $16$hi;
+  i64toi32_i32$3 = __wasm_i64_udiv($9 | 0, i64toi32_i32$0 | 0, i64toi32_i32$2 | 0, i64toi32_i32$3 | 0) | 0;
+  i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
+  $17 = i64toi32_i32$3;
+  $17$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = var$1$hi;
+  i64toi32_i32$0 = var$0$hi;
+  i64toi32_i32$0 = var$1$hi;
+  i64toi32_i32$4 = var$1;
+  i64toi32_i32$3 = var$0$hi;
+  i64toi32_i32$1 = var$0;
+  i64toi32_i32$3 = i64toi32_i32$0 ^ i64toi32_i32$3 | 0;
+  i64toi32_i32$0 = i64toi32_i32$4 ^ i64toi32_i32$1 | 0;
+  i64toi32_i32$4 = 0;
+  i64toi32_i32$1 = 63;
+  i64toi32_i32$2 = i64toi32_i32$1 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$1 & 63 | 0) >>> 0) {
+   i64toi32_i32$4 = i64toi32_i32$3 >> 31 | 0;
+   $21 = i64toi32_i32$3 >> i64toi32_i32$2 | 0;
+  } else {
+   i64toi32_i32$4 = i64toi32_i32$3 >> i64toi32_i32$2 | 0;
+   $21 = (((1 << i64toi32_i32$2 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$2 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$2 | 0) | 0;
   }
-  var$0 = $23;
-  var$0$hi = i64toi32_i32$2;
-  i64toi32_i32$2 = $17$hi;
-  i64toi32_i32$1 = $17;
-  i64toi32_i32$4 = var$0$hi;
-  i64toi32_i32$3 = var$0;
-  i64toi32_i32$4 = i64toi32_i32$2 ^ i64toi32_i32$4 | 0;
-  $23$hi = i64toi32_i32$4;
-  i64toi32_i32$4 = var$0$hi;
-  i64toi32_i32$4 = $23$hi;
-  i64toi32_i32$2 = i64toi32_i32$1 ^ i64toi32_i32$3 | 0;
-  i64toi32_i32$1 = var$0$hi;
-  i64toi32_i32$5 = i64toi32_i32$2 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$2 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$0 = i64toi32_i32$6 + i64toi32_i32$1 | 0;
-  i64toi32_i32$0 = i64toi32_i32$4 - i64toi32_i32$0 | 0;
-  i64toi32_i32$2 = i64toi32_i32$5;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
-  return i64toi32_i32$2 | 0;
+  var$0 = $21;
+  var$0$hi = i64toi32_i32$4;
+  i64toi32_i32$4 = $17$hi;
+  i64toi32_i32$3 = $17;
+  i64toi32_i32$0 = var$0$hi;
+  i64toi32_i32$1 = var$0;
+  i64toi32_i32$0 = i64toi32_i32$4 ^ i64toi32_i32$0 | 0;
+  $23$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = var$0$hi;
+  i64toi32_i32$0 = $23$hi;
+  i64toi32_i32$4 = i64toi32_i32$3 ^ i64toi32_i32$1 | 0;
+  i64toi32_i32$3 = var$0$hi;
+  i64toi32_i32$2 = i64toi32_i32$4 >>> 0 < i64toi32_i32$1 >>> 0;
+  i64toi32_i32$4 = i64toi32_i32$4 - i64toi32_i32$1 | 0;
+  i64toi32_i32$3 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
+  i64toi32_i32$3 = i64toi32_i32$0 - i64toi32_i32$3 | 0;
+  i64toi32_i32$0 = i64toi32_i32$4;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$3;
+  return i64toi32_i32$0 | 0;
  }
  
  function _ZN17compiler_builtins3int4udiv10divmod_u6417h6026910b5ed08e40E(var$0, var$0$hi, var$1, var$1$hi) {
@@ -7988,7 +7986,7 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$4 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, i64toi32_i32$6 = 0, $37 = 0, $38 = 0, $39 = 0, $40 = 0, $41 = 0, $42 = 0, $43 = 0, $44 = 0, var$8$hi = 0, $45 = 0, $46 = 0, $47 = 0, $48 = 0, var$7$hi = 0, $49 = 0, $63$hi = 0, $65 = 0, $65$hi = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142$hi = 0, $144 = 0, $144$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0;
+  var i64toi32_i32$4 = 0, i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, var$2 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, $35 = 0, $36 = 0, $37 = 0, $38 = 0, $39 = 0, $40 = 0, $41 = 0, $42 = 0, var$8$hi = 0, $43 = 0, $44 = 0, $45 = 0, $46 = 0, var$7$hi = 0, $47 = 0, $63$hi = 0, $65 = 0, $65$hi = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142$hi = 0, $144 = 0, $144$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0;
   label$1 : {
    label$2 : {
     label$3 : {
@@ -8007,12 +8005,12 @@ function asmFunc(global, env, buffer) {
              i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
              if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
               i64toi32_i32$1 = 0;
-              $37 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
+              $35 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
              } else {
               i64toi32_i32$1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-              $37 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+              $35 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
              }
-             var$2 = $37;
+             var$2 = $35;
              if (var$2) {
               block : {
                i64toi32_i32$1 = var$1$hi;
@@ -8027,12 +8025,12 @@ function asmFunc(global, env, buffer) {
                i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
                if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
                 i64toi32_i32$2 = 0;
-                $38 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
+                $36 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
                } else {
                 i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-                $38 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
+                $36 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
                }
-               var$4 = $38;
+               var$4 = $36;
                if (!var$4) {
                 break label$9
                }
@@ -8069,12 +8067,12 @@ function asmFunc(global, env, buffer) {
             i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
             if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
              i64toi32_i32$1 = 0;
-             $39 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
+             $37 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
             } else {
              i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-             $39 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
+             $37 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
             }
-            var$3 = $39;
+            var$3 = $37;
             i64toi32_i32$1 = var$0$hi;
             if (!var$0) {
              break label$7
@@ -8093,10 +8091,10 @@ function asmFunc(global, env, buffer) {
             i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
             if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
              i64toi32_i32$3 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-             $40 = 0;
+             $38 = 0;
             } else {
              i64toi32_i32$3 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-             $40 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
+             $38 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
             }
             $63$hi = i64toi32_i32$3;
             i64toi32_i32$3 = var$0$hi;
@@ -8107,7 +8105,7 @@ function asmFunc(global, env, buffer) {
             $65 = i64toi32_i32$1 & i64toi32_i32$0 | 0;
             $65$hi = i64toi32_i32$2;
             i64toi32_i32$2 = $63$hi;
-            i64toi32_i32$3 = $40;
+            i64toi32_i32$3 = $38;
             i64toi32_i32$1 = $65$hi;
             i64toi32_i32$0 = $65;
             i64toi32_i32$1 = i64toi32_i32$2 | i64toi32_i32$1 | 0;
@@ -8138,12 +8136,12 @@ function asmFunc(global, env, buffer) {
         i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
         if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
          i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-         $41 = 0;
+         $39 = 0;
         } else {
          i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $41 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
+         $39 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
         }
-        legalfunc$wasm2js_scratch_store_i64($41 | 0, i64toi32_i32$1 | 0);
+        legalfunc$wasm2js_scratch_store_i64($39 | 0, i64toi32_i32$1 | 0);
         i64toi32_i32$1 = 0;
         i64toi32_i32$2 = var$4;
         i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
@@ -8171,12 +8169,12 @@ function asmFunc(global, env, buffer) {
       i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
       if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
        i64toi32_i32$1 = 0;
-       $42 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
+       $40 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
       } else {
        i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-       $42 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
+       $40 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
       }
-      i64toi32_i32$3 = $42;
+      i64toi32_i32$3 = $40;
       i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
       return i64toi32_i32$3 | 0;
      }
@@ -8193,12 +8191,12 @@ function asmFunc(global, env, buffer) {
     i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
     if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
      i64toi32_i32$1 = 0;
-     $43 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
+     $41 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
     } else {
      i64toi32_i32$1 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
-     $43 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+     $41 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
     }
-    var$5 = $43;
+    var$5 = $41;
     var$5$hi = i64toi32_i32$1;
     i64toi32_i32$1 = var$0$hi;
     i64toi32_i32$1 = 0;
@@ -8210,12 +8208,12 @@ function asmFunc(global, env, buffer) {
     i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
     if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
      i64toi32_i32$2 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
-     $44 = 0;
+     $42 = 0;
     } else {
      i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$3 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-     $44 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
+     $42 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
     }
-    var$0 = $44;
+    var$0 = $42;
     var$0$hi = i64toi32_i32$2;
     label$13 : {
      if (var$2) {
@@ -8224,121 +8222,121 @@ function asmFunc(global, env, buffer) {
        i64toi32_i32$1 = var$1;
        i64toi32_i32$3 = -1;
        i64toi32_i32$0 = -1;
-       i64toi32_i32$4 = i64toi32_i32$1 + i64toi32_i32$0 | 0;
-       i64toi32_i32$5 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
-       if (i64toi32_i32$4 >>> 0 < i64toi32_i32$0 >>> 0) {
-        i64toi32_i32$5 = i64toi32_i32$5 + 1 | 0
+       i64toi32_i32$1 = i64toi32_i32$1 + i64toi32_i32$0 | 0;
+       i64toi32_i32$2 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
+       if (i64toi32_i32$1 >>> 0 < i64toi32_i32$0 >>> 0) {
+        i64toi32_i32$2 = i64toi32_i32$2 + 1 | 0
        }
-       var$8 = i64toi32_i32$4;
-       var$8$hi = i64toi32_i32$5;
+       var$8 = i64toi32_i32$1;
+       var$8$hi = i64toi32_i32$2;
        label$15 : while (1) {
-        i64toi32_i32$5 = var$5$hi;
-        i64toi32_i32$2 = var$5;
-        i64toi32_i32$1 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
-         $45 = 0;
+        i64toi32_i32$2 = var$5$hi;
+        i64toi32_i32$3 = var$5;
+        i64toi32_i32$0 = 0;
+        i64toi32_i32$1 = 1;
+        i64toi32_i32$4 = i64toi32_i32$1 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$1 & 63 | 0) >>> 0) {
+         i64toi32_i32$0 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
+         $43 = 0;
         } else {
-         i64toi32_i32$1 = ((1 << i64toi32_i32$3 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$3 | 0) | 0) | 0 | (i64toi32_i32$5 << i64toi32_i32$3 | 0) | 0;
-         $45 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
+         i64toi32_i32$0 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$3 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$2 << i64toi32_i32$4 | 0) | 0;
+         $43 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
         }
-        $140 = $45;
-        $140$hi = i64toi32_i32$1;
-        i64toi32_i32$1 = var$0$hi;
-        i64toi32_i32$5 = var$0;
-        i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 63;
-        i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = 0;
-         $46 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
+        $140 = $43;
+        $140$hi = i64toi32_i32$0;
+        i64toi32_i32$0 = var$0$hi;
+        i64toi32_i32$2 = var$0;
+        i64toi32_i32$3 = 0;
+        i64toi32_i32$1 = 63;
+        i64toi32_i32$4 = i64toi32_i32$1 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$1 & 63 | 0) >>> 0) {
+         i64toi32_i32$3 = 0;
+         $44 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
         } else {
-         i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
-         $46 = (((1 << i64toi32_i32$3 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$3 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$3 | 0) | 0;
+         i64toi32_i32$3 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
+         $44 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
         }
-        $142$hi = i64toi32_i32$2;
-        i64toi32_i32$2 = $140$hi;
-        i64toi32_i32$1 = $140;
-        i64toi32_i32$5 = $142$hi;
-        i64toi32_i32$0 = $46;
-        i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
-        var$5 = i64toi32_i32$1 | i64toi32_i32$0 | 0;
-        var$5$hi = i64toi32_i32$5;
+        $142$hi = i64toi32_i32$3;
+        i64toi32_i32$3 = $140$hi;
+        i64toi32_i32$0 = $140;
+        i64toi32_i32$2 = $142$hi;
+        i64toi32_i32$1 = $44;
+        i64toi32_i32$2 = i64toi32_i32$3 | i64toi32_i32$2 | 0;
+        var$5 = i64toi32_i32$0 | i64toi32_i32$1 | 0;
+        var$5$hi = i64toi32_i32$2;
         $144 = var$5;
-        $144$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = var$8$hi;
-        i64toi32_i32$5 = var$5$hi;
-        i64toi32_i32$5 = var$8$hi;
-        i64toi32_i32$2 = var$8;
-        i64toi32_i32$1 = var$5$hi;
-        i64toi32_i32$0 = var$5;
-        i64toi32_i32$3 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
-        i64toi32_i32$6 = i64toi32_i32$2 >>> 0 < i64toi32_i32$0 >>> 0;
-        i64toi32_i32$4 = i64toi32_i32$6 + i64toi32_i32$1 | 0;
-        i64toi32_i32$4 = i64toi32_i32$5 - i64toi32_i32$4 | 0;
-        i64toi32_i32$5 = i64toi32_i32$3;
+        $144$hi = i64toi32_i32$2;
+        i64toi32_i32$2 = var$8$hi;
+        i64toi32_i32$2 = var$5$hi;
+        i64toi32_i32$2 = var$8$hi;
+        i64toi32_i32$3 = var$8;
+        i64toi32_i32$0 = var$5$hi;
+        i64toi32_i32$1 = var$5;
+        i64toi32_i32$4 = i64toi32_i32$3 >>> 0 < i64toi32_i32$1 >>> 0;
+        i64toi32_i32$3 = i64toi32_i32$3 - i64toi32_i32$1 | 0;
+        i64toi32_i32$0 = i64toi32_i32$4 + i64toi32_i32$0 | 0;
+        i64toi32_i32$0 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
+        i64toi32_i32$1 = i64toi32_i32$3;
         i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 63;
-        i64toi32_i32$1 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = i64toi32_i32$4 >> 31 | 0;
-         $47 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
+        i64toi32_i32$4 = 63;
+        i64toi32_i32$3 = i64toi32_i32$4 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$4 & 63 | 0) >>> 0) {
+         i64toi32_i32$2 = i64toi32_i32$0 >> 31 | 0;
+         $45 = i64toi32_i32$0 >> i64toi32_i32$3 | 0;
         } else {
-         i64toi32_i32$2 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
-         $47 = (((1 << i64toi32_i32$1 | 0) - 1 | 0) & i64toi32_i32$4 | 0) << (32 - i64toi32_i32$1 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$1 | 0) | 0;
+         i64toi32_i32$2 = i64toi32_i32$0 >> i64toi32_i32$3 | 0;
+         $45 = (((1 << i64toi32_i32$3 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$3 | 0) | 0 | (i64toi32_i32$1 >>> i64toi32_i32$3 | 0) | 0;
         }
-        var$6 = $47;
+        var$6 = $45;
         var$6$hi = i64toi32_i32$2;
         i64toi32_i32$2 = var$1$hi;
         i64toi32_i32$2 = var$6$hi;
-        i64toi32_i32$4 = var$6;
-        i64toi32_i32$5 = var$1$hi;
-        i64toi32_i32$0 = var$1;
-        i64toi32_i32$5 = i64toi32_i32$2 & i64toi32_i32$5 | 0;
-        $151 = i64toi32_i32$4 & i64toi32_i32$0 | 0;
-        $151$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = $144$hi;
+        i64toi32_i32$0 = var$6;
+        i64toi32_i32$1 = var$1$hi;
+        i64toi32_i32$4 = var$1;
+        i64toi32_i32$1 = i64toi32_i32$2 & i64toi32_i32$1 | 0;
+        $151 = i64toi32_i32$0 & i64toi32_i32$4 | 0;
+        $151$hi = i64toi32_i32$1;
+        i64toi32_i32$1 = $144$hi;
         i64toi32_i32$2 = $144;
-        i64toi32_i32$4 = $151$hi;
-        i64toi32_i32$0 = $151;
-        i64toi32_i32$1 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
-        i64toi32_i32$6 = i64toi32_i32$2 >>> 0 < i64toi32_i32$0 >>> 0;
-        i64toi32_i32$3 = i64toi32_i32$6 + i64toi32_i32$4 | 0;
-        i64toi32_i32$3 = i64toi32_i32$5 - i64toi32_i32$3 | 0;
-        var$5 = i64toi32_i32$1;
-        var$5$hi = i64toi32_i32$3;
-        i64toi32_i32$3 = var$0$hi;
-        i64toi32_i32$5 = var$0;
-        i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-         $48 = 0;
+        i64toi32_i32$0 = $151$hi;
+        i64toi32_i32$4 = $151;
+        i64toi32_i32$3 = i64toi32_i32$2 >>> 0 < i64toi32_i32$4 >>> 0;
+        i64toi32_i32$2 = i64toi32_i32$2 - i64toi32_i32$4 | 0;
+        i64toi32_i32$0 = i64toi32_i32$3 + i64toi32_i32$0 | 0;
+        i64toi32_i32$0 = i64toi32_i32$1 - i64toi32_i32$0 | 0;
+        var$5 = i64toi32_i32$2;
+        var$5$hi = i64toi32_i32$0;
+        i64toi32_i32$0 = var$0$hi;
+        i64toi32_i32$4 = var$0;
+        i64toi32_i32$1 = 0;
+        i64toi32_i32$3 = 1;
+        i64toi32_i32$2 = i64toi32_i32$3 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
+         i64toi32_i32$1 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
+         $46 = 0;
         } else {
-         i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $48 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
+         i64toi32_i32$1 = ((1 << i64toi32_i32$2 | 0) - 1 | 0) & (i64toi32_i32$4 >>> (32 - i64toi32_i32$2 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$2 | 0) | 0;
+         $46 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
         }
-        $154$hi = i64toi32_i32$2;
-        i64toi32_i32$2 = var$7$hi;
-        i64toi32_i32$2 = $154$hi;
-        i64toi32_i32$3 = $48;
-        i64toi32_i32$5 = var$7$hi;
-        i64toi32_i32$0 = var$7;
-        i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
-        var$0 = i64toi32_i32$3 | i64toi32_i32$0 | 0;
-        var$0$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = var$6$hi;
-        i64toi32_i32$2 = var$6;
-        i64toi32_i32$3 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$3 = i64toi32_i32$5 & i64toi32_i32$3 | 0;
-        var$6 = i64toi32_i32$2 & i64toi32_i32$0 | 0;
-        var$6$hi = i64toi32_i32$3;
+        $154$hi = i64toi32_i32$1;
+        i64toi32_i32$1 = var$7$hi;
+        i64toi32_i32$1 = $154$hi;
+        i64toi32_i32$0 = $46;
+        i64toi32_i32$4 = var$7$hi;
+        i64toi32_i32$3 = var$7;
+        i64toi32_i32$4 = i64toi32_i32$1 | i64toi32_i32$4 | 0;
+        var$0 = i64toi32_i32$0 | i64toi32_i32$3 | 0;
+        var$0$hi = i64toi32_i32$4;
+        i64toi32_i32$4 = var$6$hi;
+        i64toi32_i32$1 = var$6;
+        i64toi32_i32$0 = 0;
+        i64toi32_i32$3 = 1;
+        i64toi32_i32$0 = i64toi32_i32$4 & i64toi32_i32$0 | 0;
+        var$6 = i64toi32_i32$1 & i64toi32_i32$3 | 0;
+        var$6$hi = i64toi32_i32$0;
         var$7 = var$6;
-        var$7$hi = i64toi32_i32$3;
+        var$7$hi = i64toi32_i32$0;
         var$2 = var$2 + -1 | 0;
         if (var$2) {
          continue label$15
@@ -8349,41 +8347,41 @@ function asmFunc(global, env, buffer) {
       }
      }
     }
-    i64toi32_i32$3 = var$5$hi;
-    legalfunc$wasm2js_scratch_store_i64(var$5 | 0, i64toi32_i32$3 | 0);
-    i64toi32_i32$3 = var$0$hi;
-    i64toi32_i32$5 = var$0;
-    i64toi32_i32$2 = 0;
-    i64toi32_i32$0 = 1;
-    i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-    if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-     i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-     $49 = 0;
+    i64toi32_i32$0 = var$5$hi;
+    legalfunc$wasm2js_scratch_store_i64(var$5 | 0, i64toi32_i32$0 | 0);
+    i64toi32_i32$0 = var$0$hi;
+    i64toi32_i32$4 = var$0;
+    i64toi32_i32$1 = 0;
+    i64toi32_i32$3 = 1;
+    i64toi32_i32$2 = i64toi32_i32$3 & 31 | 0;
+    if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
+     i64toi32_i32$1 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
+     $47 = 0;
     } else {
-     i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-     $49 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
+     i64toi32_i32$1 = ((1 << i64toi32_i32$2 | 0) - 1 | 0) & (i64toi32_i32$4 >>> (32 - i64toi32_i32$2 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$2 | 0) | 0;
+     $47 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
     }
-    $165$hi = i64toi32_i32$2;
-    i64toi32_i32$2 = var$6$hi;
-    i64toi32_i32$2 = $165$hi;
-    i64toi32_i32$3 = $49;
-    i64toi32_i32$5 = var$6$hi;
-    i64toi32_i32$0 = var$6;
-    i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
-    i64toi32_i32$3 = i64toi32_i32$3 | i64toi32_i32$0 | 0;
-    i64toi32_i32$HIGH_BITS = i64toi32_i32$5;
-    return i64toi32_i32$3 | 0;
+    $165$hi = i64toi32_i32$1;
+    i64toi32_i32$1 = var$6$hi;
+    i64toi32_i32$1 = $165$hi;
+    i64toi32_i32$0 = $47;
+    i64toi32_i32$4 = var$6$hi;
+    i64toi32_i32$3 = var$6;
+    i64toi32_i32$4 = i64toi32_i32$1 | i64toi32_i32$4 | 0;
+    i64toi32_i32$0 = i64toi32_i32$0 | i64toi32_i32$3 | 0;
+    i64toi32_i32$HIGH_BITS = i64toi32_i32$4;
+    return i64toi32_i32$0 | 0;
    }
-   i64toi32_i32$3 = var$0$hi;
-   legalfunc$wasm2js_scratch_store_i64(var$0 | 0, i64toi32_i32$3 | 0);
-   i64toi32_i32$3 = 0;
+   i64toi32_i32$0 = var$0$hi;
+   legalfunc$wasm2js_scratch_store_i64(var$0 | 0, i64toi32_i32$0 | 0);
+   i64toi32_i32$0 = 0;
    var$0 = 0;
-   var$0$hi = i64toi32_i32$3;
+   var$0$hi = i64toi32_i32$0;
   }
-  i64toi32_i32$3 = var$0$hi;
-  i64toi32_i32$5 = var$0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$3;
-  return i64toi32_i32$5 | 0;
+  i64toi32_i32$0 = var$0$hi;
+  i64toi32_i32$4 = var$0;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
+  return i64toi32_i32$4 | 0;
  }
  
  function __wasm_i64_sdiv(var$0, var$0$hi, var$1, var$1$hi) {
@@ -8661,7 +8659,7 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$1 = 0, i64toi32_i32$4 = 0, i64toi32_i32$2 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, i64toi32_i32$5 = 0, var$2$hi = 0, i64toi32_i32$6 = 0, var$2 = 0, $20 = 0, $21 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17$hi = 0, $19$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, var$2$hi = 0, var$2 = 0, $18 = 0, $19 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17$hi = 0, $19$hi = 0;
   i64toi32_i32$0 = var$0$hi;
   i64toi32_i32$2 = var$0;
   i64toi32_i32$1 = 0;
@@ -8669,12 +8667,12 @@ function asmFunc(global, env, buffer) {
   i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
   if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
    i64toi32_i32$1 = i64toi32_i32$0 >> 31 | 0;
-   $20 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
+   $18 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
   } else {
    i64toi32_i32$1 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
-   $20 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+   $18 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
   }
-  var$2 = $20;
+  var$2 = $18;
   var$2$hi = i64toi32_i32$1;
   i64toi32_i32$1 = var$0$hi;
   i64toi32_i32$1 = var$2$hi;
@@ -8688,66 +8686,66 @@ function asmFunc(global, env, buffer) {
   i64toi32_i32$1 = i64toi32_i32$0 ^ i64toi32_i32$3 | 0;
   i64toi32_i32$0 = var$2$hi;
   i64toi32_i32$3 = var$2;
-  i64toi32_i32$4 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$5 = i64toi32_i32$6 + i64toi32_i32$0 | 0;
-  i64toi32_i32$5 = i64toi32_i32$2 - i64toi32_i32$5 | 0;
-  $9 = i64toi32_i32$4;
-  $9$hi = i64toi32_i32$5;
-  i64toi32_i32$5 = var$1$hi;
-  i64toi32_i32$2 = var$1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$0 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$5 >> 31 | 0;
-   $21 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
+  i64toi32_i32$4 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
+  i64toi32_i32$1 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
+  i64toi32_i32$0 = i64toi32_i32$4 + i64toi32_i32$0 | 0;
+  i64toi32_i32$0 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
+  $9 = i64toi32_i32$1;
+  $9$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = var$1$hi;
+  i64toi32_i32$3 = var$1;
+  i64toi32_i32$2 = 0;
+  i64toi32_i32$4 = 63;
+  i64toi32_i32$1 = i64toi32_i32$4 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$4 & 63 | 0) >>> 0) {
+   i64toi32_i32$2 = i64toi32_i32$0 >> 31 | 0;
+   $19 = i64toi32_i32$0 >> i64toi32_i32$1 | 0;
   } else {
-   i64toi32_i32$1 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
-   $21 = (((1 << i64toi32_i32$0 | 0) - 1 | 0) & i64toi32_i32$5 | 0) << (32 - i64toi32_i32$0 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$0 | 0) | 0;
+   i64toi32_i32$2 = i64toi32_i32$0 >> i64toi32_i32$1 | 0;
+   $19 = (((1 << i64toi32_i32$1 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$1 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$1 | 0) | 0;
   }
-  var$0 = $21;
-  var$0$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$1$hi;
-  i64toi32_i32$1 = var$0$hi;
-  i64toi32_i32$5 = var$0;
+  var$0 = $19;
+  var$0$hi = i64toi32_i32$2;
   i64toi32_i32$2 = var$1$hi;
-  i64toi32_i32$3 = var$1;
-  i64toi32_i32$2 = i64toi32_i32$1 ^ i64toi32_i32$2 | 0;
-  $14$hi = i64toi32_i32$2;
-  i64toi32_i32$2 = i64toi32_i32$1;
-  i64toi32_i32$2 = $14$hi;
-  i64toi32_i32$1 = i64toi32_i32$5 ^ i64toi32_i32$3 | 0;
-  i64toi32_i32$5 = var$0$hi;
-  i64toi32_i32$3 = var$0;
-  i64toi32_i32$0 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$4 = i64toi32_i32$6 + i64toi32_i32$5 | 0;
-  i64toi32_i32$4 = i64toi32_i32$2 - i64toi32_i32$4 | 0;
-  $16$hi = i64toi32_i32$4;
-  i64toi32_i32$4 = $9$hi;
-  i64toi32_i32$1 = $16$hi;
-  i64toi32_i32$1 = __wasm_i64_urem($9 | 0, i64toi32_i32$4 | 0, i64toi32_i32$0 | 0, i64toi32_i32$1 | 0) | 0;
-  i64toi32_i32$4 = i64toi32_i32$HIGH_BITS;
-  $17$hi = i64toi32_i32$4;
+  i64toi32_i32$2 = var$0$hi;
+  i64toi32_i32$0 = var$0;
+  i64toi32_i32$3 = var$1$hi;
+  i64toi32_i32$4 = var$1;
+  i64toi32_i32$3 = i64toi32_i32$2 ^ i64toi32_i32$3 | 0;
+  $14$hi = i64toi32_i32$3;
+  i64toi32_i32$3 = i64toi32_i32$2;
+  i64toi32_i32$3 = $14$hi;
+  i64toi32_i32$2 = i64toi32_i32$0 ^ i64toi32_i32$4 | 0;
+  i64toi32_i32$0 = var$0$hi;
+  i64toi32_i32$4 = var$0;
+  i64toi32_i32$1 = i64toi32_i32$2 >>> 0 < i64toi32_i32$4 >>> 0;
+  i64toi32_i32$2 = i64toi32_i32$2 - i64toi32_i32$4 | 0;
+  i64toi32_i32$0 = i64toi32_i32$1 + i64toi32_i32$0 | 0;
+  i64toi32_i32$0 = i64toi32_i32$3 - i64toi32_i32$0 | 0;
+  $16$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = $9$hi;
+  i64toi32_i32$3 = $16$hi;
+  i64toi32_i32$3 = __wasm_i64_urem($9 | 0, i64toi32_i32$0 | 0, i64toi32_i32$2 | 0, i64toi32_i32$3 | 0) | 0;
+  i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
+  $17$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = var$2$hi;
+  i64toi32_i32$0 = $17$hi;
+  i64toi32_i32$4 = i64toi32_i32$3;
+  i64toi32_i32$3 = var$2$hi;
+  i64toi32_i32$1 = var$2;
+  i64toi32_i32$3 = i64toi32_i32$0 ^ i64toi32_i32$3 | 0;
+  $19$hi = i64toi32_i32$3;
+  i64toi32_i32$3 = var$2$hi;
+  i64toi32_i32$3 = $19$hi;
+  i64toi32_i32$0 = i64toi32_i32$4 ^ i64toi32_i32$1 | 0;
   i64toi32_i32$4 = var$2$hi;
-  i64toi32_i32$4 = $17$hi;
-  i64toi32_i32$2 = i64toi32_i32$1;
-  i64toi32_i32$1 = var$2$hi;
-  i64toi32_i32$3 = var$2;
-  i64toi32_i32$1 = i64toi32_i32$4 ^ i64toi32_i32$1 | 0;
-  $19$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$2$hi;
-  i64toi32_i32$1 = $19$hi;
-  i64toi32_i32$4 = i64toi32_i32$2 ^ i64toi32_i32$3 | 0;
-  i64toi32_i32$2 = var$2$hi;
-  i64toi32_i32$5 = i64toi32_i32$4 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$4 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$0 = i64toi32_i32$6 + i64toi32_i32$2 | 0;
-  i64toi32_i32$0 = i64toi32_i32$1 - i64toi32_i32$0 | 0;
-  i64toi32_i32$4 = i64toi32_i32$5;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
-  return i64toi32_i32$4 | 0;
+  i64toi32_i32$2 = i64toi32_i32$0 >>> 0 < i64toi32_i32$1 >>> 0;
+  i64toi32_i32$0 = i64toi32_i32$0 - i64toi32_i32$1 | 0;
+  i64toi32_i32$4 = i64toi32_i32$2 + i64toi32_i32$4 | 0;
+  i64toi32_i32$4 = i64toi32_i32$3 - i64toi32_i32$4 | 0;
+  i64toi32_i32$3 = i64toi32_i32$0;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$4;
+  return i64toi32_i32$0 | 0;
  }
  
  function _ZN17compiler_builtins3int4udiv10divmod_u6417h6026910b5ed08e40E(var$0, var$0$hi, var$1, var$1$hi) {
@@ -8755,7 +8753,7 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$4 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, i64toi32_i32$6 = 0, $37 = 0, $38 = 0, $39 = 0, $40 = 0, $41 = 0, $42 = 0, $43 = 0, $44 = 0, var$8$hi = 0, $45 = 0, $46 = 0, $47 = 0, $48 = 0, var$7$hi = 0, $49 = 0, $63$hi = 0, $65 = 0, $65$hi = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142$hi = 0, $144 = 0, $144$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0;
+  var i64toi32_i32$4 = 0, i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, var$2 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, $35 = 0, $36 = 0, $37 = 0, $38 = 0, $39 = 0, $40 = 0, $41 = 0, $42 = 0, var$8$hi = 0, $43 = 0, $44 = 0, $45 = 0, $46 = 0, var$7$hi = 0, $47 = 0, $63$hi = 0, $65 = 0, $65$hi = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142$hi = 0, $144 = 0, $144$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0;
   label$1 : {
    label$2 : {
     label$3 : {
@@ -8774,12 +8772,12 @@ function asmFunc(global, env, buffer) {
              i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
              if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
               i64toi32_i32$1 = 0;
-              $37 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
+              $35 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
              } else {
               i64toi32_i32$1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-              $37 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+              $35 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
              }
-             var$2 = $37;
+             var$2 = $35;
              if (var$2) {
               block : {
                i64toi32_i32$1 = var$1$hi;
@@ -8794,12 +8792,12 @@ function asmFunc(global, env, buffer) {
                i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
                if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
                 i64toi32_i32$2 = 0;
-                $38 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
+                $36 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
                } else {
                 i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-                $38 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
+                $36 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
                }
-               var$4 = $38;
+               var$4 = $36;
                if (!var$4) {
                 break label$9
                }
@@ -8836,12 +8834,12 @@ function asmFunc(global, env, buffer) {
             i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
             if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
              i64toi32_i32$1 = 0;
-             $39 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
+             $37 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
             } else {
              i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-             $39 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
+             $37 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
             }
-            var$3 = $39;
+            var$3 = $37;
             i64toi32_i32$1 = var$0$hi;
             if (!var$0) {
              break label$7
@@ -8860,10 +8858,10 @@ function asmFunc(global, env, buffer) {
             i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
             if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
              i64toi32_i32$3 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-             $40 = 0;
+             $38 = 0;
             } else {
              i64toi32_i32$3 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-             $40 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
+             $38 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
             }
             $63$hi = i64toi32_i32$3;
             i64toi32_i32$3 = var$0$hi;
@@ -8874,7 +8872,7 @@ function asmFunc(global, env, buffer) {
             $65 = i64toi32_i32$1 & i64toi32_i32$0 | 0;
             $65$hi = i64toi32_i32$2;
             i64toi32_i32$2 = $63$hi;
-            i64toi32_i32$3 = $40;
+            i64toi32_i32$3 = $38;
             i64toi32_i32$1 = $65$hi;
             i64toi32_i32$0 = $65;
             i64toi32_i32$1 = i64toi32_i32$2 | i64toi32_i32$1 | 0;
@@ -8905,12 +8903,12 @@ function asmFunc(global, env, buffer) {
         i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
         if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
          i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-         $41 = 0;
+         $39 = 0;
         } else {
          i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $41 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
+         $39 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
         }
-        legalfunc$wasm2js_scratch_store_i64($41 | 0, i64toi32_i32$1 | 0);
+        legalfunc$wasm2js_scratch_store_i64($39 | 0, i64toi32_i32$1 | 0);
         i64toi32_i32$1 = 0;
         i64toi32_i32$2 = var$4;
         i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
@@ -8938,12 +8936,12 @@ function asmFunc(global, env, buffer) {
       i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
       if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
        i64toi32_i32$1 = 0;
-       $42 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
+       $40 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
       } else {
        i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-       $42 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
+       $40 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
       }
-      i64toi32_i32$3 = $42;
+      i64toi32_i32$3 = $40;
       i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
       return i64toi32_i32$3 | 0;
      }
@@ -8960,12 +8958,12 @@ function asmFunc(global, env, buffer) {
     i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
     if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
      i64toi32_i32$1 = 0;
-     $43 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
+     $41 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
     } else {
      i64toi32_i32$1 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
-     $43 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+     $41 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
     }
-    var$5 = $43;
+    var$5 = $41;
     var$5$hi = i64toi32_i32$1;
     i64toi32_i32$1 = var$0$hi;
     i64toi32_i32$1 = 0;
@@ -8977,12 +8975,12 @@ function asmFunc(global, env, buffer) {
     i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
     if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
      i64toi32_i32$2 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
-     $44 = 0;
+     $42 = 0;
     } else {
      i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$3 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-     $44 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
+     $42 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
     }
-    var$0 = $44;
+    var$0 = $42;
     var$0$hi = i64toi32_i32$2;
     label$13 : {
      if (var$2) {
@@ -8991,121 +8989,121 @@ function asmFunc(global, env, buffer) {
        i64toi32_i32$1 = var$1;
        i64toi32_i32$3 = -1;
        i64toi32_i32$0 = -1;
-       i64toi32_i32$4 = i64toi32_i32$1 + i64toi32_i32$0 | 0;
-       i64toi32_i32$5 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
-       if (i64toi32_i32$4 >>> 0 < i64toi32_i32$0 >>> 0) {
-        i64toi32_i32$5 = i64toi32_i32$5 + 1 | 0
+       i64toi32_i32$1 = i64toi32_i32$1 + i64toi32_i32$0 | 0;
+       i64toi32_i32$2 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
+       if (i64toi32_i32$1 >>> 0 < i64toi32_i32$0 >>> 0) {
+        i64toi32_i32$2 = i64toi32_i32$2 + 1 | 0
        }
-       var$8 = i64toi32_i32$4;
-       var$8$hi = i64toi32_i32$5;
+       var$8 = i64toi32_i32$1;
+       var$8$hi = i64toi32_i32$2;
        label$15 : while (1) {
-        i64toi32_i32$5 = var$5$hi;
-        i64toi32_i32$2 = var$5;
-        i64toi32_i32$1 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
-         $45 = 0;
+        i64toi32_i32$2 = var$5$hi;
+        i64toi32_i32$3 = var$5;
+        i64toi32_i32$0 = 0;
+        i64toi32_i32$1 = 1;
+        i64toi32_i32$4 = i64toi32_i32$1 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$1 & 63 | 0) >>> 0) {
+         i64toi32_i32$0 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
+         $43 = 0;
         } else {
-         i64toi32_i32$1 = ((1 << i64toi32_i32$3 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$3 | 0) | 0) | 0 | (i64toi32_i32$5 << i64toi32_i32$3 | 0) | 0;
-         $45 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
+         i64toi32_i32$0 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$3 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$2 << i64toi32_i32$4 | 0) | 0;
+         $43 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
         }
-        $140 = $45;
-        $140$hi = i64toi32_i32$1;
-        i64toi32_i32$1 = var$0$hi;
-        i64toi32_i32$5 = var$0;
-        i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 63;
-        i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = 0;
-         $46 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
+        $140 = $43;
+        $140$hi = i64toi32_i32$0;
+        i64toi32_i32$0 = var$0$hi;
+        i64toi32_i32$2 = var$0;
+        i64toi32_i32$3 = 0;
+        i64toi32_i32$1 = 63;
+        i64toi32_i32$4 = i64toi32_i32$1 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$1 & 63 | 0) >>> 0) {
+         i64toi32_i32$3 = 0;
+         $44 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
         } else {
-         i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
-         $46 = (((1 << i64toi32_i32$3 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$3 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$3 | 0) | 0;
+         i64toi32_i32$3 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
+         $44 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
         }
-        $142$hi = i64toi32_i32$2;
-        i64toi32_i32$2 = $140$hi;
-        i64toi32_i32$1 = $140;
-        i64toi32_i32$5 = $142$hi;
-        i64toi32_i32$0 = $46;
-        i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
-        var$5 = i64toi32_i32$1 | i64toi32_i32$0 | 0;
-        var$5$hi = i64toi32_i32$5;
+        $142$hi = i64toi32_i32$3;
+        i64toi32_i32$3 = $140$hi;
+        i64toi32_i32$0 = $140;
+        i64toi32_i32$2 = $142$hi;
+        i64toi32_i32$1 = $44;
+        i64toi32_i32$2 = i64toi32_i32$3 | i64toi32_i32$2 | 0;
+        var$5 = i64toi32_i32$0 | i64toi32_i32$1 | 0;
+        var$5$hi = i64toi32_i32$2;
         $144 = var$5;
-        $144$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = var$8$hi;
-        i64toi32_i32$5 = var$5$hi;
-        i64toi32_i32$5 = var$8$hi;
-        i64toi32_i32$2 = var$8;
-        i64toi32_i32$1 = var$5$hi;
-        i64toi32_i32$0 = var$5;
-        i64toi32_i32$3 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
-        i64toi32_i32$6 = i64toi32_i32$2 >>> 0 < i64toi32_i32$0 >>> 0;
-        i64toi32_i32$4 = i64toi32_i32$6 + i64toi32_i32$1 | 0;
-        i64toi32_i32$4 = i64toi32_i32$5 - i64toi32_i32$4 | 0;
-        i64toi32_i32$5 = i64toi32_i32$3;
+        $144$hi = i64toi32_i32$2;
+        i64toi32_i32$2 = var$8$hi;
+        i64toi32_i32$2 = var$5$hi;
+        i64toi32_i32$2 = var$8$hi;
+        i64toi32_i32$3 = var$8;
+        i64toi32_i32$0 = var$5$hi;
+        i64toi32_i32$1 = var$5;
+        i64toi32_i32$4 = i64toi32_i32$3 >>> 0 < i64toi32_i32$1 >>> 0;
+        i64toi32_i32$3 = i64toi32_i32$3 - i64toi32_i32$1 | 0;
+        i64toi32_i32$0 = i64toi32_i32$4 + i64toi32_i32$0 | 0;
+        i64toi32_i32$0 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
+        i64toi32_i32$1 = i64toi32_i32$3;
         i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 63;
-        i64toi32_i32$1 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = i64toi32_i32$4 >> 31 | 0;
-         $47 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
+        i64toi32_i32$4 = 63;
+        i64toi32_i32$3 = i64toi32_i32$4 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$4 & 63 | 0) >>> 0) {
+         i64toi32_i32$2 = i64toi32_i32$0 >> 31 | 0;
+         $45 = i64toi32_i32$0 >> i64toi32_i32$3 | 0;
         } else {
-         i64toi32_i32$2 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
-         $47 = (((1 << i64toi32_i32$1 | 0) - 1 | 0) & i64toi32_i32$4 | 0) << (32 - i64toi32_i32$1 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$1 | 0) | 0;
+         i64toi32_i32$2 = i64toi32_i32$0 >> i64toi32_i32$3 | 0;
+         $45 = (((1 << i64toi32_i32$3 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$3 | 0) | 0 | (i64toi32_i32$1 >>> i64toi32_i32$3 | 0) | 0;
         }
-        var$6 = $47;
+        var$6 = $45;
         var$6$hi = i64toi32_i32$2;
         i64toi32_i32$2 = var$1$hi;
         i64toi32_i32$2 = var$6$hi;
-        i64toi32_i32$4 = var$6;
-        i64toi32_i32$5 = var$1$hi;
-        i64toi32_i32$0 = var$1;
-        i64toi32_i32$5 = i64toi32_i32$2 & i64toi32_i32$5 | 0;
-        $151 = i64toi32_i32$4 & i64toi32_i32$0 | 0;
-        $151$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = $144$hi;
+        i64toi32_i32$0 = var$6;
+        i64toi32_i32$1 = var$1$hi;
+        i64toi32_i32$4 = var$1;
+        i64toi32_i32$1 = i64toi32_i32$2 & i64toi32_i32$1 | 0;
+        $151 = i64toi32_i32$0 & i64toi32_i32$4 | 0;
+        $151$hi = i64toi32_i32$1;
+        i64toi32_i32$1 = $144$hi;
         i64toi32_i32$2 = $144;
-        i64toi32_i32$4 = $151$hi;
-        i64toi32_i32$0 = $151;
-        i64toi32_i32$1 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
-        i64toi32_i32$6 = i64toi32_i32$2 >>> 0 < i64toi32_i32$0 >>> 0;
-        i64toi32_i32$3 = i64toi32_i32$6 + i64toi32_i32$4 | 0;
-        i64toi32_i32$3 = i64toi32_i32$5 - i64toi32_i32$3 | 0;
-        var$5 = i64toi32_i32$1;
-        var$5$hi = i64toi32_i32$3;
-        i64toi32_i32$3 = var$0$hi;
-        i64toi32_i32$5 = var$0;
-        i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-         $48 = 0;
+        i64toi32_i32$0 = $151$hi;
+        i64toi32_i32$4 = $151;
+        i64toi32_i32$3 = i64toi32_i32$2 >>> 0 < i64toi32_i32$4 >>> 0;
+        i64toi32_i32$2 = i64toi32_i32$2 - i64toi32_i32$4 | 0;
+        i64toi32_i32$0 = i64toi32_i32$3 + i64toi32_i32$0 | 0;
+        i64toi32_i32$0 = i64toi32_i32$1 - i64toi32_i32$0 | 0;
+        var$5 = i64toi32_i32$2;
+        var$5$hi = i64toi32_i32$0;
+        i64toi32_i32$0 = var$0$hi;
+        i64toi32_i32$4 = var$0;
+        i64toi32_i32$1 = 0;
+        i64toi32_i32$3 = 1;
+        i64toi32_i32$2 = i64toi32_i32$3 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
+         i64toi32_i32$1 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
+         $46 = 0;
         } else {
-         i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $48 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
+         i64toi32_i32$1 = ((1 << i64toi32_i32$2 | 0) - 1 | 0) & (i64toi32_i32$4 >>> (32 - i64toi32_i32$2 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$2 | 0) | 0;
+         $46 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
         }
-        $154$hi = i64toi32_i32$2;
-        i64toi32_i32$2 = var$7$hi;
-        i64toi32_i32$2 = $154$hi;
-        i64toi32_i32$3 = $48;
-        i64toi32_i32$5 = var$7$hi;
-        i64toi32_i32$0 = var$7;
-        i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
-        var$0 = i64toi32_i32$3 | i64toi32_i32$0 | 0;
-        var$0$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = var$6$hi;
-        i64toi32_i32$2 = var$6;
-        i64toi32_i32$3 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$3 = i64toi32_i32$5 & i64toi32_i32$3 | 0;
-        var$6 = i64toi32_i32$2 & i64toi32_i32$0 | 0;
-        var$6$hi = i64toi32_i32$3;
+        $154$hi = i64toi32_i32$1;
+        i64toi32_i32$1 = var$7$hi;
+        i64toi32_i32$1 = $154$hi;
+        i64toi32_i32$0 = $46;
+        i64toi32_i32$4 = var$7$hi;
+        i64toi32_i32$3 = var$7;
+        i64toi32_i32$4 = i64toi32_i32$1 | i64toi32_i32$4 | 0;
+        var$0 = i64toi32_i32$0 | i64toi32_i32$3 | 0;
+        var$0$hi = i64toi32_i32$4;
+        i64toi32_i32$4 = var$6$hi;
+        i64toi32_i32$1 = var$6;
+        i64toi32_i32$0 = 0;
+        i64toi32_i32$3 = 1;
+        i64toi32_i32$0 = i64toi32_i32$4 & i64toi32_i32$0 | 0;
+        var$6 = i64toi32_i32$1 & i64toi32_i32$3 | 0;
+        var$6$hi = i64toi32_i32$0;
         var$7 = var$6;
-        var$7$hi = i64toi32_i32$3;
+        var$7$hi = i64toi32_i32$0;
         var$2 = var$2 + -1 | 0;
         if (var$2) {
          continue label$15
@@ -9116,41 +9114,41 @@ function asmFunc(global, env, buffer) {
       }
      }
     }
-    i64toi32_i32$3 = var$5$hi;
-    legalfunc$wasm2js_scratch_store_i64(var$5 | 0, i64toi32_i32$3 | 0);
-    i64toi32_i32$3 = var$0$hi;
-    i64toi32_i32$5 = var$0;
-    i64toi32_i32$2 = 0;
-    i64toi32_i32$0 = 1;
-    i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-    if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-     i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-     $49 = 0;
+    i64toi32_i32$0 = var$5$hi;
+    legalfunc$wasm2js_scratch_store_i64(var$5 | 0, i64toi32_i32$0 | 0);
+    i64toi32_i32$0 = var$0$hi;
+    i64toi32_i32$4 = var$0;
+    i64toi32_i32$1 = 0;
+    i64toi32_i32$3 = 1;
+    i64toi32_i32$2 = i64toi32_i32$3 & 31 | 0;
+    if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
+     i64toi32_i32$1 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
+     $47 = 0;
     } else {
-     i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-     $49 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
+     i64toi32_i32$1 = ((1 << i64toi32_i32$2 | 0) - 1 | 0) & (i64toi32_i32$4 >>> (32 - i64toi32_i32$2 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$2 | 0) | 0;
+     $47 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
     }
-    $165$hi = i64toi32_i32$2;
-    i64toi32_i32$2 = var$6$hi;
-    i64toi32_i32$2 = $165$hi;
-    i64toi32_i32$3 = $49;
-    i64toi32_i32$5 = var$6$hi;
-    i64toi32_i32$0 = var$6;
-    i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
-    i64toi32_i32$3 = i64toi32_i32$3 | i64toi32_i32$0 | 0;
-    i64toi32_i32$HIGH_BITS = i64toi32_i32$5;
-    return i64toi32_i32$3 | 0;
+    $165$hi = i64toi32_i32$1;
+    i64toi32_i32$1 = var$6$hi;
+    i64toi32_i32$1 = $165$hi;
+    i64toi32_i32$0 = $47;
+    i64toi32_i32$4 = var$6$hi;
+    i64toi32_i32$3 = var$6;
+    i64toi32_i32$4 = i64toi32_i32$1 | i64toi32_i32$4 | 0;
+    i64toi32_i32$0 = i64toi32_i32$0 | i64toi32_i32$3 | 0;
+    i64toi32_i32$HIGH_BITS = i64toi32_i32$4;
+    return i64toi32_i32$0 | 0;
    }
-   i64toi32_i32$3 = var$0$hi;
-   legalfunc$wasm2js_scratch_store_i64(var$0 | 0, i64toi32_i32$3 | 0);
-   i64toi32_i32$3 = 0;
+   i64toi32_i32$0 = var$0$hi;
+   legalfunc$wasm2js_scratch_store_i64(var$0 | 0, i64toi32_i32$0 | 0);
+   i64toi32_i32$0 = 0;
    var$0 = 0;
-   var$0$hi = i64toi32_i32$3;
+   var$0$hi = i64toi32_i32$0;
   }
-  i64toi32_i32$3 = var$0$hi;
-  i64toi32_i32$5 = var$0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$3;
-  return i64toi32_i32$5 | 0;
+  i64toi32_i32$0 = var$0$hi;
+  i64toi32_i32$4 = var$0;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
+  return i64toi32_i32$4 | 0;
  }
  
  function __wasm_i64_srem(var$0, var$0$hi, var$1, var$1$hi) {
@@ -9430,7 +9428,7 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$1 = 0, i64toi32_i32$4 = 0, i64toi32_i32$2 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, i64toi32_i32$5 = 0, var$2$hi = 0, i64toi32_i32$6 = 0, var$2 = 0, $20 = 0, $21 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17$hi = 0, $19$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, var$2$hi = 0, var$2 = 0, $18 = 0, $19 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17$hi = 0, $19$hi = 0;
   i64toi32_i32$0 = var$0$hi;
   i64toi32_i32$2 = var$0;
   i64toi32_i32$1 = 0;
@@ -9438,12 +9436,12 @@ function asmFunc(global, env, buffer) {
   i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
   if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
    i64toi32_i32$1 = i64toi32_i32$0 >> 31 | 0;
-   $20 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
+   $18 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
   } else {
    i64toi32_i32$1 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
-   $20 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+   $18 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
   }
-  var$2 = $20;
+  var$2 = $18;
   var$2$hi = i64toi32_i32$1;
   i64toi32_i32$1 = var$0$hi;
   i64toi32_i32$1 = var$2$hi;
@@ -9457,66 +9455,66 @@ function asmFunc(global, env, buffer) {
   i64toi32_i32$1 = i64toi32_i32$0 ^ i64toi32_i32$3 | 0;
   i64toi32_i32$0 = var$2$hi;
   i64toi32_i32$3 = var$2;
-  i64toi32_i32$4 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$5 = i64toi32_i32$6 + i64toi32_i32$0 | 0;
-  i64toi32_i32$5 = i64toi32_i32$2 - i64toi32_i32$5 | 0;
-  $9 = i64toi32_i32$4;
-  $9$hi = i64toi32_i32$5;
-  i64toi32_i32$5 = var$1$hi;
-  i64toi32_i32$2 = var$1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$0 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$5 >> 31 | 0;
-   $21 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
+  i64toi32_i32$4 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
+  i64toi32_i32$1 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
+  i64toi32_i32$0 = i64toi32_i32$4 + i64toi32_i32$0 | 0;
+  i64toi32_i32$0 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
+  $9 = i64toi32_i32$1;
+  $9$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = var$1$hi;
+  i64toi32_i32$3 = var$1;
+  i64toi32_i32$2 = 0;
+  i64toi32_i32$4 = 63;
+  i64toi32_i32$1 = i64toi32_i32$4 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$4 & 63 | 0) >>> 0) {
+   i64toi32_i32$2 = i64toi32_i32$0 >> 31 | 0;
+   $19 = i64toi32_i32$0 >> i64toi32_i32$1 | 0;
   } else {
-   i64toi32_i32$1 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
-   $21 = (((1 << i64toi32_i32$0 | 0) - 1 | 0) & i64toi32_i32$5 | 0) << (32 - i64toi32_i32$0 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$0 | 0) | 0;
+   i64toi32_i32$2 = i64toi32_i32$0 >> i64toi32_i32$1 | 0;
+   $19 = (((1 << i64toi32_i32$1 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$1 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$1 | 0) | 0;
   }
-  var$0 = $21;
-  var$0$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$1$hi;
-  i64toi32_i32$1 = var$0$hi;
-  i64toi32_i32$5 = var$0;
+  var$0 = $19;
+  var$0$hi = i64toi32_i32$2;
   i64toi32_i32$2 = var$1$hi;
-  i64toi32_i32$3 = var$1;
-  i64toi32_i32$2 = i64toi32_i32$1 ^ i64toi32_i32$2 | 0;
-  $14$hi = i64toi32_i32$2;
-  i64toi32_i32$2 = i64toi32_i32$1;
-  i64toi32_i32$2 = $14$hi;
-  i64toi32_i32$1 = i64toi32_i32$5 ^ i64toi32_i32$3 | 0;
-  i64toi32_i32$5 = var$0$hi;
-  i64toi32_i32$3 = var$0;
-  i64toi32_i32$0 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$4 = i64toi32_i32$6 + i64toi32_i32$5 | 0;
-  i64toi32_i32$4 = i64toi32_i32$2 - i64toi32_i32$4 | 0;
-  $16$hi = i64toi32_i32$4;
-  i64toi32_i32$4 = $9$hi;
-  i64toi32_i32$1 = $16$hi;
-  i64toi32_i32$1 = __wasm_i64_urem($9 | 0, i64toi32_i32$4 | 0, i64toi32_i32$0 | 0, i64toi32_i32$1 | 0) | 0;
-  i64toi32_i32$4 = i64toi32_i32$HIGH_BITS;
-  $17$hi = i64toi32_i32$4;
+  i64toi32_i32$2 = var$0$hi;
+  i64toi32_i32$0 = var$0;
+  i64toi32_i32$3 = var$1$hi;
+  i64toi32_i32$4 = var$1;
+  i64toi32_i32$3 = i64toi32_i32$2 ^ i64toi32_i32$3 | 0;
+  $14$hi = i64toi32_i32$3;
+  i64toi32_i32$3 = i64toi32_i32$2;
+  i64toi32_i32$3 = $14$hi;
+  i64toi32_i32$2 = i64toi32_i32$0 ^ i64toi32_i32$4 | 0;
+  i64toi32_i32$0 = var$0$hi;
+  i64toi32_i32$4 = var$0;
+  i64toi32_i32$1 = i64toi32_i32$2 >>> 0 < i64toi32_i32$4 >>> 0;
+  i64toi32_i32$2 = i64toi32_i32$2 - i64toi32_i32$4 | 0;
+  i64toi32_i32$0 = i64toi32_i32$1 + i64toi32_i32$0 | 0;
+  i64toi32_i32$0 = i64toi32_i32$3 - i64toi32_i32$0 | 0;
+  $16$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = $9$hi;
+  i64toi32_i32$3 = $16$hi;
+  i64toi32_i32$3 = __wasm_i64_urem($9 | 0, i64toi32_i32$0 | 0, i64toi32_i32$2 | 0, i64toi32_i32$3 | 0) | 0;
+  i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
+  $17$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = var$2$hi;
+  i64toi32_i32$0 = $17$hi;
+  i64toi32_i32$4 = i64toi32_i32$3;
+  i64toi32_i32$3 = var$2$hi;
+  i64toi32_i32$1 = var$2;
+  i64toi32_i32$3 = i64toi32_i32$0 ^ i64toi32_i32$3 | 0;
+  $19$hi = i64toi32_i32$3;
+  i64toi32_i32$3 = var$2$hi;
+  i64toi32_i32$3 = $19$hi;
+  i64toi32_i32$0 = i64toi32_i32$4 ^ i64toi32_i32$1 | 0;
   i64toi32_i32$4 = var$2$hi;
-  i64toi32_i32$4 = $17$hi;
-  i64toi32_i32$2 = i64toi32_i32$1;
-  i64toi32_i32$1 = var$2$hi;
-  i64toi32_i32$3 = var$2;
-  i64toi32_i32$1 = i64toi32_i32$4 ^ i64toi32_i32$1 | 0;
-  $19$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$2$hi;
-  i64toi32_i32$1 = $19$hi;
-  i64toi32_i32$4 = i64toi32_i32$2 ^ i64toi32_i32$3 | 0;
-  i64toi32_i32$2 = var$2$hi;
-  i64toi32_i32$5 = i64toi32_i32$4 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$4 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$0 = i64toi32_i32$6 + i64toi32_i32$2 | 0;
-  i64toi32_i32$0 = i64toi32_i32$1 - i64toi32_i32$0 | 0;
-  i64toi32_i32$4 = i64toi32_i32$5;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
-  return i64toi32_i32$4 | 0;
+  i64toi32_i32$2 = i64toi32_i32$0 >>> 0 < i64toi32_i32$1 >>> 0;
+  i64toi32_i32$0 = i64toi32_i32$0 - i64toi32_i32$1 | 0;
+  i64toi32_i32$4 = i64toi32_i32$2 + i64toi32_i32$4 | 0;
+  i64toi32_i32$4 = i64toi32_i32$3 - i64toi32_i32$4 | 0;
+  i64toi32_i32$3 = i64toi32_i32$0;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$4;
+  return i64toi32_i32$0 | 0;
  }
  
  function _ZN17compiler_builtins3int4udiv10divmod_u6417h6026910b5ed08e40E(var$0, var$0$hi, var$1, var$1$hi) {
@@ -9524,7 +9522,7 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$4 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, i64toi32_i32$6 = 0, $37 = 0, $38 = 0, $39 = 0, $40 = 0, $41 = 0, $42 = 0, $43 = 0, $44 = 0, var$8$hi = 0, $45 = 0, $46 = 0, $47 = 0, $48 = 0, var$7$hi = 0, $49 = 0, $63$hi = 0, $65 = 0, $65$hi = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142$hi = 0, $144 = 0, $144$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0;
+  var i64toi32_i32$4 = 0, i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, var$2 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, $35 = 0, $36 = 0, $37 = 0, $38 = 0, $39 = 0, $40 = 0, $41 = 0, $42 = 0, var$8$hi = 0, $43 = 0, $44 = 0, $45 = 0, $46 = 0, var$7$hi = 0, $47 = 0, $63$hi = 0, $65 = 0, $65$hi = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142$hi = 0, $144 = 0, $144$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0;
   label$1 : {
    label$2 : {
     label$3 : {
@@ -9543,12 +9541,12 @@ function asmFunc(global, env, buffer) {
              i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
              if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
               i64toi32_i32$1 = 0;
-              $37 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
+              $35 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
              } else {
               i64toi32_i32$1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-              $37 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+              $35 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
              }
-             var$2 = $37;
+             var$2 = $35;
              if (var$2) {
               block : {
                i64toi32_i32$1 = var$1$hi;
@@ -9563,12 +9561,12 @@ function asmFunc(global, env, buffer) {
                i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
                if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
                 i64toi32_i32$2 = 0;
-                $38 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
+                $36 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
                } else {
                 i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-                $38 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
+                $36 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
                }
-               var$4 = $38;
+               var$4 = $36;
                if (!var$4) {
                 break label$9
                }
@@ -9605,12 +9603,12 @@ function asmFunc(global, env, buffer) {
             i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
             if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
              i64toi32_i32$1 = 0;
-             $39 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
+             $37 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
             } else {
              i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-             $39 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
+             $37 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
             }
-            var$3 = $39;
+            var$3 = $37;
             i64toi32_i32$1 = var$0$hi;
             if (!var$0) {
              break label$7
@@ -9629,10 +9627,10 @@ function asmFunc(global, env, buffer) {
             i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
             if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
              i64toi32_i32$3 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-             $40 = 0;
+             $38 = 0;
             } else {
              i64toi32_i32$3 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-             $40 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
+             $38 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
             }
             $63$hi = i64toi32_i32$3;
             i64toi32_i32$3 = var$0$hi;
@@ -9643,7 +9641,7 @@ function asmFunc(global, env, buffer) {
             $65 = i64toi32_i32$1 & i64toi32_i32$0 | 0;
             $65$hi = i64toi32_i32$2;
             i64toi32_i32$2 = $63$hi;
-            i64toi32_i32$3 = $40;
+            i64toi32_i32$3 = $38;
             i64toi32_i32$1 = $65$hi;
             i64toi32_i32$0 = $65;
             i64toi32_i32$1 = i64toi32_i32$2 | i64toi32_i32$1 | 0;
@@ -9674,12 +9672,12 @@ function asmFunc(global, env, buffer) {
         i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
         if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
          i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-         $41 = 0;
+         $39 = 0;
         } else {
          i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $41 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
+         $39 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
         }
-        legalfunc$wasm2js_scratch_store_i64($41 | 0, i64toi32_i32$1 | 0);
+        legalfunc$wasm2js_scratch_store_i64($39 | 0, i64toi32_i32$1 | 0);
         i64toi32_i32$1 = 0;
         i64toi32_i32$2 = var$4;
         i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
@@ -9707,12 +9705,12 @@ function asmFunc(global, env, buffer) {
       i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
       if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
        i64toi32_i32$1 = 0;
-       $42 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
+       $40 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
       } else {
        i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-       $42 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
+       $40 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
       }
-      i64toi32_i32$3 = $42;
+      i64toi32_i32$3 = $40;
       i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
       return i64toi32_i32$3 | 0;
      }
@@ -9729,12 +9727,12 @@ function asmFunc(global, env, buffer) {
     i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
     if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
      i64toi32_i32$1 = 0;
-     $43 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
+     $41 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
     } else {
      i64toi32_i32$1 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
-     $43 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+     $41 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
     }
-    var$5 = $43;
+    var$5 = $41;
     var$5$hi = i64toi32_i32$1;
     i64toi32_i32$1 = var$0$hi;
     i64toi32_i32$1 = 0;
@@ -9746,12 +9744,12 @@ function asmFunc(global, env, buffer) {
     i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
     if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
      i64toi32_i32$2 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
-     $44 = 0;
+     $42 = 0;
     } else {
      i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$3 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-     $44 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
+     $42 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
     }
-    var$0 = $44;
+    var$0 = $42;
     var$0$hi = i64toi32_i32$2;
     label$13 : {
      if (var$2) {
@@ -9760,121 +9758,121 @@ function asmFunc(global, env, buffer) {
        i64toi32_i32$1 = var$1;
        i64toi32_i32$3 = -1;
        i64toi32_i32$0 = -1;
-       i64toi32_i32$4 = i64toi32_i32$1 + i64toi32_i32$0 | 0;
-       i64toi32_i32$5 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
-       if (i64toi32_i32$4 >>> 0 < i64toi32_i32$0 >>> 0) {
-        i64toi32_i32$5 = i64toi32_i32$5 + 1 | 0
+       i64toi32_i32$1 = i64toi32_i32$1 + i64toi32_i32$0 | 0;
+       i64toi32_i32$2 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
+       if (i64toi32_i32$1 >>> 0 < i64toi32_i32$0 >>> 0) {
+        i64toi32_i32$2 = i64toi32_i32$2 + 1 | 0
        }
-       var$8 = i64toi32_i32$4;
-       var$8$hi = i64toi32_i32$5;
+       var$8 = i64toi32_i32$1;
+       var$8$hi = i64toi32_i32$2;
        label$15 : while (1) {
-        i64toi32_i32$5 = var$5$hi;
-        i64toi32_i32$2 = var$5;
-        i64toi32_i32$1 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
-         $45 = 0;
+        i64toi32_i32$2 = var$5$hi;
+        i64toi32_i32$3 = var$5;
+        i64toi32_i32$0 = 0;
+        i64toi32_i32$1 = 1;
+        i64toi32_i32$4 = i64toi32_i32$1 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$1 & 63 | 0) >>> 0) {
+         i64toi32_i32$0 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
+         $43 = 0;
         } else {
-         i64toi32_i32$1 = ((1 << i64toi32_i32$3 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$3 | 0) | 0) | 0 | (i64toi32_i32$5 << i64toi32_i32$3 | 0) | 0;
-         $45 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
+         i64toi32_i32$0 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$3 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$2 << i64toi32_i32$4 | 0) | 0;
+         $43 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
         }
-        $140 = $45;
-        $140$hi = i64toi32_i32$1;
-        i64toi32_i32$1 = var$0$hi;
-        i64toi32_i32$5 = var$0;
-        i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 63;
-        i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = 0;
-         $46 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
+        $140 = $43;
+        $140$hi = i64toi32_i32$0;
+        i64toi32_i32$0 = var$0$hi;
+        i64toi32_i32$2 = var$0;
+        i64toi32_i32$3 = 0;
+        i64toi32_i32$1 = 63;
+        i64toi32_i32$4 = i64toi32_i32$1 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$1 & 63 | 0) >>> 0) {
+         i64toi32_i32$3 = 0;
+         $44 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
         } else {
-         i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
-         $46 = (((1 << i64toi32_i32$3 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$3 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$3 | 0) | 0;
+         i64toi32_i32$3 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
+         $44 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
         }
-        $142$hi = i64toi32_i32$2;
-        i64toi32_i32$2 = $140$hi;
-        i64toi32_i32$1 = $140;
-        i64toi32_i32$5 = $142$hi;
-        i64toi32_i32$0 = $46;
-        i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
-        var$5 = i64toi32_i32$1 | i64toi32_i32$0 | 0;
-        var$5$hi = i64toi32_i32$5;
+        $142$hi = i64toi32_i32$3;
+        i64toi32_i32$3 = $140$hi;
+        i64toi32_i32$0 = $140;
+        i64toi32_i32$2 = $142$hi;
+        i64toi32_i32$1 = $44;
+        i64toi32_i32$2 = i64toi32_i32$3 | i64toi32_i32$2 | 0;
+        var$5 = i64toi32_i32$0 | i64toi32_i32$1 | 0;
+        var$5$hi = i64toi32_i32$2;
         $144 = var$5;
-        $144$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = var$8$hi;
-        i64toi32_i32$5 = var$5$hi;
-        i64toi32_i32$5 = var$8$hi;
-        i64toi32_i32$2 = var$8;
-        i64toi32_i32$1 = var$5$hi;
-        i64toi32_i32$0 = var$5;
-        i64toi32_i32$3 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
-        i64toi32_i32$6 = i64toi32_i32$2 >>> 0 < i64toi32_i32$0 >>> 0;
-        i64toi32_i32$4 = i64toi32_i32$6 + i64toi32_i32$1 | 0;
-        i64toi32_i32$4 = i64toi32_i32$5 - i64toi32_i32$4 | 0;
-        i64toi32_i32$5 = i64toi32_i32$3;
+        $144$hi = i64toi32_i32$2;
+        i64toi32_i32$2 = var$8$hi;
+        i64toi32_i32$2 = var$5$hi;
+        i64toi32_i32$2 = var$8$hi;
+        i64toi32_i32$3 = var$8;
+        i64toi32_i32$0 = var$5$hi;
+        i64toi32_i32$1 = var$5;
+        i64toi32_i32$4 = i64toi32_i32$3 >>> 0 < i64toi32_i32$1 >>> 0;
+        i64toi32_i32$3 = i64toi32_i32$3 - i64toi32_i32$1 | 0;
+        i64toi32_i32$0 = i64toi32_i32$4 + i64toi32_i32$0 | 0;
+        i64toi32_i32$0 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
+        i64toi32_i32$1 = i64toi32_i32$3;
         i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 63;
-        i64toi32_i32$1 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = i64toi32_i32$4 >> 31 | 0;
-         $47 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
+        i64toi32_i32$4 = 63;
+        i64toi32_i32$3 = i64toi32_i32$4 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$4 & 63 | 0) >>> 0) {
+         i64toi32_i32$2 = i64toi32_i32$0 >> 31 | 0;
+         $45 = i64toi32_i32$0 >> i64toi32_i32$3 | 0;
         } else {
-         i64toi32_i32$2 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
-         $47 = (((1 << i64toi32_i32$1 | 0) - 1 | 0) & i64toi32_i32$4 | 0) << (32 - i64toi32_i32$1 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$1 | 0) | 0;
+         i64toi32_i32$2 = i64toi32_i32$0 >> i64toi32_i32$3 | 0;
+         $45 = (((1 << i64toi32_i32$3 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$3 | 0) | 0 | (i64toi32_i32$1 >>> i64toi32_i32$3 | 0) | 0;
         }
-        var$6 = $47;
+        var$6 = $45;
         var$6$hi = i64toi32_i32$2;
         i64toi32_i32$2 = var$1$hi;
         i64toi32_i32$2 = var$6$hi;
-        i64toi32_i32$4 = var$6;
-        i64toi32_i32$5 = var$1$hi;
-        i64toi32_i32$0 = var$1;
-        i64toi32_i32$5 = i64toi32_i32$2 & i64toi32_i32$5 | 0;
-        $151 = i64toi32_i32$4 & i64toi32_i32$0 | 0;
-        $151$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = $144$hi;
+        i64toi32_i32$0 = var$6;
+        i64toi32_i32$1 = var$1$hi;
+        i64toi32_i32$4 = var$1;
+        i64toi32_i32$1 = i64toi32_i32$2 & i64toi32_i32$1 | 0;
+        $151 = i64toi32_i32$0 & i64toi32_i32$4 | 0;
+        $151$hi = i64toi32_i32$1;
+        i64toi32_i32$1 = $144$hi;
         i64toi32_i32$2 = $144;
-        i64toi32_i32$4 = $151$hi;
-        i64toi32_i32$0 = $151;
-        i64toi32_i32$1 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
-        i64toi32_i32$6 = i64toi32_i32$2 >>> 0 < i64toi32_i32$0 >>> 0;
-        i64toi32_i32$3 = i64toi32_i32$6 + i64toi32_i32$4 | 0;
-        i64toi32_i32$3 = i64toi32_i32$5 - i64toi32_i32$3 | 0;
-        var$5 = i64toi32_i32$1;
-        var$5$hi = i64toi32_i32$3;
-        i64toi32_i32$3 = var$0$hi;
-        i64toi32_i32$5 = var$0;
-        i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-         $48 = 0;
+        i64toi32_i32$0 = $151$hi;
+        i64toi32_i32$4 = $151;
+        i64toi32_i32$3 = i64toi32_i32$2 >>> 0 < i64toi32_i32$4 >>> 0;
+        i64toi32_i32$2 = i64toi32_i32$2 - i64toi32_i32$4 | 0;
+        i64toi32_i32$0 = i64toi32_i32$3 + i64toi32_i32$0 | 0;
+        i64toi32_i32$0 = i64toi32_i32$1 - i64toi32_i32$0 | 0;
+        var$5 = i64toi32_i32$2;
+        var$5$hi = i64toi32_i32$0;
+        i64toi32_i32$0 = var$0$hi;
+        i64toi32_i32$4 = var$0;
+        i64toi32_i32$1 = 0;
+        i64toi32_i32$3 = 1;
+        i64toi32_i32$2 = i64toi32_i32$3 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
+         i64toi32_i32$1 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
+         $46 = 0;
         } else {
-         i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $48 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
+         i64toi32_i32$1 = ((1 << i64toi32_i32$2 | 0) - 1 | 0) & (i64toi32_i32$4 >>> (32 - i64toi32_i32$2 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$2 | 0) | 0;
+         $46 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
         }
-        $154$hi = i64toi32_i32$2;
-        i64toi32_i32$2 = var$7$hi;
-        i64toi32_i32$2 = $154$hi;
-        i64toi32_i32$3 = $48;
-        i64toi32_i32$5 = var$7$hi;
-        i64toi32_i32$0 = var$7;
-        i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
-        var$0 = i64toi32_i32$3 | i64toi32_i32$0 | 0;
-        var$0$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = var$6$hi;
-        i64toi32_i32$2 = var$6;
-        i64toi32_i32$3 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$3 = i64toi32_i32$5 & i64toi32_i32$3 | 0;
-        var$6 = i64toi32_i32$2 & i64toi32_i32$0 | 0;
-        var$6$hi = i64toi32_i32$3;
+        $154$hi = i64toi32_i32$1;
+        i64toi32_i32$1 = var$7$hi;
+        i64toi32_i32$1 = $154$hi;
+        i64toi32_i32$0 = $46;
+        i64toi32_i32$4 = var$7$hi;
+        i64toi32_i32$3 = var$7;
+        i64toi32_i32$4 = i64toi32_i32$1 | i64toi32_i32$4 | 0;
+        var$0 = i64toi32_i32$0 | i64toi32_i32$3 | 0;
+        var$0$hi = i64toi32_i32$4;
+        i64toi32_i32$4 = var$6$hi;
+        i64toi32_i32$1 = var$6;
+        i64toi32_i32$0 = 0;
+        i64toi32_i32$3 = 1;
+        i64toi32_i32$0 = i64toi32_i32$4 & i64toi32_i32$0 | 0;
+        var$6 = i64toi32_i32$1 & i64toi32_i32$3 | 0;
+        var$6$hi = i64toi32_i32$0;
         var$7 = var$6;
-        var$7$hi = i64toi32_i32$3;
+        var$7$hi = i64toi32_i32$0;
         var$2 = var$2 + -1 | 0;
         if (var$2) {
          continue label$15
@@ -9885,41 +9883,41 @@ function asmFunc(global, env, buffer) {
       }
      }
     }
-    i64toi32_i32$3 = var$5$hi;
-    legalfunc$wasm2js_scratch_store_i64(var$5 | 0, i64toi32_i32$3 | 0);
-    i64toi32_i32$3 = var$0$hi;
-    i64toi32_i32$5 = var$0;
-    i64toi32_i32$2 = 0;
-    i64toi32_i32$0 = 1;
-    i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-    if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-     i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-     $49 = 0;
+    i64toi32_i32$0 = var$5$hi;
+    legalfunc$wasm2js_scratch_store_i64(var$5 | 0, i64toi32_i32$0 | 0);
+    i64toi32_i32$0 = var$0$hi;
+    i64toi32_i32$4 = var$0;
+    i64toi32_i32$1 = 0;
+    i64toi32_i32$3 = 1;
+    i64toi32_i32$2 = i64toi32_i32$3 & 31 | 0;
+    if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
+     i64toi32_i32$1 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
+     $47 = 0;
     } else {
-     i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-     $49 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
+     i64toi32_i32$1 = ((1 << i64toi32_i32$2 | 0) - 1 | 0) & (i64toi32_i32$4 >>> (32 - i64toi32_i32$2 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$2 | 0) | 0;
+     $47 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
     }
-    $165$hi = i64toi32_i32$2;
-    i64toi32_i32$2 = var$6$hi;
-    i64toi32_i32$2 = $165$hi;
-    i64toi32_i32$3 = $49;
-    i64toi32_i32$5 = var$6$hi;
-    i64toi32_i32$0 = var$6;
-    i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
-    i64toi32_i32$3 = i64toi32_i32$3 | i64toi32_i32$0 | 0;
-    i64toi32_i32$HIGH_BITS = i64toi32_i32$5;
-    return i64toi32_i32$3 | 0;
+    $165$hi = i64toi32_i32$1;
+    i64toi32_i32$1 = var$6$hi;
+    i64toi32_i32$1 = $165$hi;
+    i64toi32_i32$0 = $47;
+    i64toi32_i32$4 = var$6$hi;
+    i64toi32_i32$3 = var$6;
+    i64toi32_i32$4 = i64toi32_i32$1 | i64toi32_i32$4 | 0;
+    i64toi32_i32$0 = i64toi32_i32$0 | i64toi32_i32$3 | 0;
+    i64toi32_i32$HIGH_BITS = i64toi32_i32$4;
+    return i64toi32_i32$0 | 0;
    }
-   i64toi32_i32$3 = var$0$hi;
-   legalfunc$wasm2js_scratch_store_i64(var$0 | 0, i64toi32_i32$3 | 0);
-   i64toi32_i32$3 = 0;
+   i64toi32_i32$0 = var$0$hi;
+   legalfunc$wasm2js_scratch_store_i64(var$0 | 0, i64toi32_i32$0 | 0);
+   i64toi32_i32$0 = 0;
    var$0 = 0;
-   var$0$hi = i64toi32_i32$3;
+   var$0$hi = i64toi32_i32$0;
   }
-  i64toi32_i32$3 = var$0$hi;
-  i64toi32_i32$5 = var$0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$3;
-  return i64toi32_i32$5 | 0;
+  i64toi32_i32$0 = var$0$hi;
+  i64toi32_i32$4 = var$0;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
+  return i64toi32_i32$4 | 0;
  }
  
  function __wasm_i64_srem(var$0, var$0$hi, var$1, var$1$hi) {
@@ -10199,7 +10197,7 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$1 = 0, i64toi32_i32$4 = 0, i64toi32_i32$2 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, i64toi32_i32$5 = 0, var$2$hi = 0, i64toi32_i32$6 = 0, var$2 = 0, $20 = 0, $21 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17$hi = 0, $19$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, var$2$hi = 0, var$2 = 0, $18 = 0, $19 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17$hi = 0, $19$hi = 0;
   i64toi32_i32$0 = var$0$hi;
   i64toi32_i32$2 = var$0;
   i64toi32_i32$1 = 0;
@@ -10207,12 +10205,12 @@ function asmFunc(global, env, buffer) {
   i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
   if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
    i64toi32_i32$1 = i64toi32_i32$0 >> 31 | 0;
-   $20 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
+   $18 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
   } else {
    i64toi32_i32$1 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
-   $20 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+   $18 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
   }
-  var$2 = $20;
+  var$2 = $18;
   var$2$hi = i64toi32_i32$1;
   i64toi32_i32$1 = var$0$hi;
   i64toi32_i32$1 = var$2$hi;
@@ -10226,66 +10224,66 @@ function asmFunc(global, env, buffer) {
   i64toi32_i32$1 = i64toi32_i32$0 ^ i64toi32_i32$3 | 0;
   i64toi32_i32$0 = var$2$hi;
   i64toi32_i32$3 = var$2;
-  i64toi32_i32$4 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$5 = i64toi32_i32$6 + i64toi32_i32$0 | 0;
-  i64toi32_i32$5 = i64toi32_i32$2 - i64toi32_i32$5 | 0;
-  $9 = i64toi32_i32$4;
-  $9$hi = i64toi32_i32$5;
-  i64toi32_i32$5 = var$1$hi;
-  i64toi32_i32$2 = var$1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$0 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$5 >> 31 | 0;
-   $21 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
+  i64toi32_i32$4 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
+  i64toi32_i32$1 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
+  i64toi32_i32$0 = i64toi32_i32$4 + i64toi32_i32$0 | 0;
+  i64toi32_i32$0 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
+  $9 = i64toi32_i32$1;
+  $9$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = var$1$hi;
+  i64toi32_i32$3 = var$1;
+  i64toi32_i32$2 = 0;
+  i64toi32_i32$4 = 63;
+  i64toi32_i32$1 = i64toi32_i32$4 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$4 & 63 | 0) >>> 0) {
+   i64toi32_i32$2 = i64toi32_i32$0 >> 31 | 0;
+   $19 = i64toi32_i32$0 >> i64toi32_i32$1 | 0;
   } else {
-   i64toi32_i32$1 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
-   $21 = (((1 << i64toi32_i32$0 | 0) - 1 | 0) & i64toi32_i32$5 | 0) << (32 - i64toi32_i32$0 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$0 | 0) | 0;
+   i64toi32_i32$2 = i64toi32_i32$0 >> i64toi32_i32$1 | 0;
+   $19 = (((1 << i64toi32_i32$1 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$1 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$1 | 0) | 0;
   }
-  var$0 = $21;
-  var$0$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$1$hi;
-  i64toi32_i32$1 = var$0$hi;
-  i64toi32_i32$5 = var$0;
+  var$0 = $19;
+  var$0$hi = i64toi32_i32$2;
   i64toi32_i32$2 = var$1$hi;
-  i64toi32_i32$3 = var$1;
-  i64toi32_i32$2 = i64toi32_i32$1 ^ i64toi32_i32$2 | 0;
-  $14$hi = i64toi32_i32$2;
-  i64toi32_i32$2 = i64toi32_i32$1;
-  i64toi32_i32$2 = $14$hi;
-  i64toi32_i32$1 = i64toi32_i32$5 ^ i64toi32_i32$3 | 0;
-  i64toi32_i32$5 = var$0$hi;
-  i64toi32_i32$3 = var$0;
-  i64toi32_i32$0 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$4 = i64toi32_i32$6 + i64toi32_i32$5 | 0;
-  i64toi32_i32$4 = i64toi32_i32$2 - i64toi32_i32$4 | 0;
-  $16$hi = i64toi32_i32$4;
-  i64toi32_i32$4 = $9$hi;
-  i64toi32_i32$1 = $16$hi;
-  i64toi32_i32$1 = __wasm_i64_urem($9 | 0, i64toi32_i32$4 | 0, i64toi32_i32$0 | 0, i64toi32_i32$1 | 0) | 0;
-  i64toi32_i32$4 = i64toi32_i32$HIGH_BITS;
-  $17$hi = i64toi32_i32$4;
+  i64toi32_i32$2 = var$0$hi;
+  i64toi32_i32$0 = var$0;
+  i64toi32_i32$3 = var$1$hi;
+  i64toi32_i32$4 = var$1;
+  i64toi32_i32$3 = i64toi32_i32$2 ^ i64toi32_i32$3 | 0;
+  $14$hi = i64toi32_i32$3;
+  i64toi32_i32$3 = i64toi32_i32$2;
+  i64toi32_i32$3 = $14$hi;
+  i64toi32_i32$2 = i64toi32_i32$0 ^ i64toi32_i32$4 | 0;
+  i64toi32_i32$0 = var$0$hi;
+  i64toi32_i32$4 = var$0;
+  i64toi32_i32$1 = i64toi32_i32$2 >>> 0 < i64toi32_i32$4 >>> 0;
+  i64toi32_i32$2 = i64toi32_i32$2 - i64toi32_i32$4 | 0;
+  i64toi32_i32$0 = i64toi32_i32$1 + i64toi32_i32$0 | 0;
+  i64toi32_i32$0 = i64toi32_i32$3 - i64toi32_i32$0 | 0;
+  $16$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = $9$hi;
+  i64toi32_i32$3 = $16$hi;
+  i64toi32_i32$3 = __wasm_i64_urem($9 | 0, i64toi32_i32$0 | 0, i64toi32_i32$2 | 0, i64toi32_i32$3 | 0) | 0;
+  i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
+  $17$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = var$2$hi;
+  i64toi32_i32$0 = $17$hi;
+  i64toi32_i32$4 = i64toi32_i32$3;
+  i64toi32_i32$3 = var$2$hi;
+  i64toi32_i32$1 = var$2;
+  i64toi32_i32$3 = i64toi32_i32$0 ^ i64toi32_i32$3 | 0;
+  $19$hi = i64toi32_i32$3;
+  i64toi32_i32$3 = var$2$hi;
+  i64toi32_i32$3 = $19$hi;
+  i64toi32_i32$0 = i64toi32_i32$4 ^ i64toi32_i32$1 | 0;
   i64toi32_i32$4 = var$2$hi;
-  i64toi32_i32$4 = $17$hi;
-  i64toi32_i32$2 = i64toi32_i32$1;
-  i64toi32_i32$1 = var$2$hi;
-  i64toi32_i32$3 = var$2;
-  i64toi32_i32$1 = i64toi32_i32$4 ^ i64toi32_i32$1 | 0;
-  $19$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$2$hi;
-  i64toi32_i32$1 = $19$hi;
-  i64toi32_i32$4 = i64toi32_i32$2 ^ i64toi32_i32$3 | 0;
-  i64toi32_i32$2 = var$2$hi;
-  i64toi32_i32$5 = i64toi32_i32$4 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$4 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$0 = i64toi32_i32$6 + i64toi32_i32$2 | 0;
-  i64toi32_i32$0 = i64toi32_i32$1 - i64toi32_i32$0 | 0;
-  i64toi32_i32$4 = i64toi32_i32$5;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
-  return i64toi32_i32$4 | 0;
+  i64toi32_i32$2 = i64toi32_i32$0 >>> 0 < i64toi32_i32$1 >>> 0;
+  i64toi32_i32$0 = i64toi32_i32$0 - i64toi32_i32$1 | 0;
+  i64toi32_i32$4 = i64toi32_i32$2 + i64toi32_i32$4 | 0;
+  i64toi32_i32$4 = i64toi32_i32$3 - i64toi32_i32$4 | 0;
+  i64toi32_i32$3 = i64toi32_i32$0;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$4;
+  return i64toi32_i32$0 | 0;
  }
  
  function _ZN17compiler_builtins3int4udiv10divmod_u6417h6026910b5ed08e40E(var$0, var$0$hi, var$1, var$1$hi) {
@@ -10293,7 +10291,7 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$4 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, i64toi32_i32$6 = 0, $37 = 0, $38 = 0, $39 = 0, $40 = 0, $41 = 0, $42 = 0, $43 = 0, $44 = 0, var$8$hi = 0, $45 = 0, $46 = 0, $47 = 0, $48 = 0, var$7$hi = 0, $49 = 0, $63$hi = 0, $65 = 0, $65$hi = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142$hi = 0, $144 = 0, $144$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0;
+  var i64toi32_i32$4 = 0, i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, var$2 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, $35 = 0, $36 = 0, $37 = 0, $38 = 0, $39 = 0, $40 = 0, $41 = 0, $42 = 0, var$8$hi = 0, $43 = 0, $44 = 0, $45 = 0, $46 = 0, var$7$hi = 0, $47 = 0, $63$hi = 0, $65 = 0, $65$hi = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142$hi = 0, $144 = 0, $144$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0;
   label$1 : {
    label$2 : {
     label$3 : {
@@ -10312,12 +10310,12 @@ function asmFunc(global, env, buffer) {
              i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
              if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
               i64toi32_i32$1 = 0;
-              $37 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
+              $35 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
              } else {
               i64toi32_i32$1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-              $37 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+              $35 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
              }
-             var$2 = $37;
+             var$2 = $35;
              if (var$2) {
               block : {
                i64toi32_i32$1 = var$1$hi;
@@ -10332,12 +10330,12 @@ function asmFunc(global, env, buffer) {
                i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
                if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
                 i64toi32_i32$2 = 0;
-                $38 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
+                $36 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
                } else {
                 i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-                $38 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
+                $36 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
                }
-               var$4 = $38;
+               var$4 = $36;
                if (!var$4) {
                 break label$9
                }
@@ -10374,12 +10372,12 @@ function asmFunc(global, env, buffer) {
             i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
             if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
              i64toi32_i32$1 = 0;
-             $39 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
+             $37 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
             } else {
              i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-             $39 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
+             $37 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
             }
-            var$3 = $39;
+            var$3 = $37;
             i64toi32_i32$1 = var$0$hi;
             if (!var$0) {
              break label$7
@@ -10398,10 +10396,10 @@ function asmFunc(global, env, buffer) {
             i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
             if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
              i64toi32_i32$3 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-             $40 = 0;
+             $38 = 0;
             } else {
              i64toi32_i32$3 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-             $40 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
+             $38 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
             }
             $63$hi = i64toi32_i32$3;
             i64toi32_i32$3 = var$0$hi;
@@ -10412,7 +10410,7 @@ function asmFunc(global, env, buffer) {
             $65 = i64toi32_i32$1 & i64toi32_i32$0 | 0;
             $65$hi = i64toi32_i32$2;
             i64toi32_i32$2 = $63$hi;
-            i64toi32_i32$3 = $40;
+            i64toi32_i32$3 = $38;
             i64toi32_i32$1 = $65$hi;
             i64toi32_i32$0 = $65;
             i64toi32_i32$1 = i64toi32_i32$2 | i64toi32_i32$1 | 0;
@@ -10443,12 +10441,12 @@ function asmFunc(global, env, buffer) {
         i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
         if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
          i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-         $41 = 0;
+         $39 = 0;
         } else {
          i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $41 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
+         $39 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
         }
-        legalfunc$wasm2js_scratch_store_i64($41 | 0, i64toi32_i32$1 | 0);
+        legalfunc$wasm2js_scratch_store_i64($39 | 0, i64toi32_i32$1 | 0);
         i64toi32_i32$1 = 0;
         i64toi32_i32$2 = var$4;
         i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
@@ -10476,12 +10474,12 @@ function asmFunc(global, env, buffer) {
       i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
       if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
        i64toi32_i32$1 = 0;
-       $42 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
+       $40 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
       } else {
        i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-       $42 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
+       $40 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
       }
-      i64toi32_i32$3 = $42;
+      i64toi32_i32$3 = $40;
       i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
       return i64toi32_i32$3 | 0;
      }
@@ -10498,12 +10496,12 @@ function asmFunc(global, env, buffer) {
     i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
     if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
      i64toi32_i32$1 = 0;
-     $43 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
+     $41 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
     } else {
      i64toi32_i32$1 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
-     $43 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+     $41 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
     }
-    var$5 = $43;
+    var$5 = $41;
     var$5$hi = i64toi32_i32$1;
     i64toi32_i32$1 = var$0$hi;
     i64toi32_i32$1 = 0;
@@ -10515,12 +10513,12 @@ function asmFunc(global, env, buffer) {
     i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
     if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
      i64toi32_i32$2 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
-     $44 = 0;
+     $42 = 0;
     } else {
      i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$3 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-     $44 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
+     $42 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
     }
-    var$0 = $44;
+    var$0 = $42;
     var$0$hi = i64toi32_i32$2;
     label$13 : {
      if (var$2) {
@@ -10529,121 +10527,121 @@ function asmFunc(global, env, buffer) {
        i64toi32_i32$1 = var$1;
        i64toi32_i32$3 = -1;
        i64toi32_i32$0 = -1;
-       i64toi32_i32$4 = i64toi32_i32$1 + i64toi32_i32$0 | 0;
-       i64toi32_i32$5 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
-       if (i64toi32_i32$4 >>> 0 < i64toi32_i32$0 >>> 0) {
-        i64toi32_i32$5 = i64toi32_i32$5 + 1 | 0
+       i64toi32_i32$1 = i64toi32_i32$1 + i64toi32_i32$0 | 0;
+       i64toi32_i32$2 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
+       if (i64toi32_i32$1 >>> 0 < i64toi32_i32$0 >>> 0) {
+        i64toi32_i32$2 = i64toi32_i32$2 + 1 | 0
        }
-       var$8 = i64toi32_i32$4;
-       var$8$hi = i64toi32_i32$5;
+       var$8 = i64toi32_i32$1;
+       var$8$hi = i64toi32_i32$2;
        label$15 : while (1) {
-        i64toi32_i32$5 = var$5$hi;
-        i64toi32_i32$2 = var$5;
-        i64toi32_i32$1 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
-         $45 = 0;
+        i64toi32_i32$2 = var$5$hi;
+        i64toi32_i32$3 = var$5;
+        i64toi32_i32$0 = 0;
+        i64toi32_i32$1 = 1;
+        i64toi32_i32$4 = i64toi32_i32$1 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$1 & 63 | 0) >>> 0) {
+         i64toi32_i32$0 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
+         $43 = 0;
         } else {
-         i64toi32_i32$1 = ((1 << i64toi32_i32$3 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$3 | 0) | 0) | 0 | (i64toi32_i32$5 << i64toi32_i32$3 | 0) | 0;
-         $45 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
+         i64toi32_i32$0 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$3 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$2 << i64toi32_i32$4 | 0) | 0;
+         $43 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
         }
-        $140 = $45;
-        $140$hi = i64toi32_i32$1;
-        i64toi32_i32$1 = var$0$hi;
-        i64toi32_i32$5 = var$0;
-        i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 63;
-        i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = 0;
-         $46 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
+        $140 = $43;
+        $140$hi = i64toi32_i32$0;
+        i64toi32_i32$0 = var$0$hi;
+        i64toi32_i32$2 = var$0;
+        i64toi32_i32$3 = 0;
+        i64toi32_i32$1 = 63;
+        i64toi32_i32$4 = i64toi32_i32$1 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$1 & 63 | 0) >>> 0) {
+         i64toi32_i32$3 = 0;
+         $44 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
         } else {
-         i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
-         $46 = (((1 << i64toi32_i32$3 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$3 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$3 | 0) | 0;
+         i64toi32_i32$3 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
+         $44 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
         }
-        $142$hi = i64toi32_i32$2;
-        i64toi32_i32$2 = $140$hi;
-        i64toi32_i32$1 = $140;
-        i64toi32_i32$5 = $142$hi;
-        i64toi32_i32$0 = $46;
-        i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
-        var$5 = i64toi32_i32$1 | i64toi32_i32$0 | 0;
-        var$5$hi = i64toi32_i32$5;
+        $142$hi = i64toi32_i32$3;
+        i64toi32_i32$3 = $140$hi;
+        i64toi32_i32$0 = $140;
+        i64toi32_i32$2 = $142$hi;
+        i64toi32_i32$1 = $44;
+        i64toi32_i32$2 = i64toi32_i32$3 | i64toi32_i32$2 | 0;
+        var$5 = i64toi32_i32$0 | i64toi32_i32$1 | 0;
+        var$5$hi = i64toi32_i32$2;
         $144 = var$5;
-        $144$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = var$8$hi;
-        i64toi32_i32$5 = var$5$hi;
-        i64toi32_i32$5 = var$8$hi;
-        i64toi32_i32$2 = var$8;
-        i64toi32_i32$1 = var$5$hi;
-        i64toi32_i32$0 = var$5;
-        i64toi32_i32$3 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
-        i64toi32_i32$6 = i64toi32_i32$2 >>> 0 < i64toi32_i32$0 >>> 0;
-        i64toi32_i32$4 = i64toi32_i32$6 + i64toi32_i32$1 | 0;
-        i64toi32_i32$4 = i64toi32_i32$5 - i64toi32_i32$4 | 0;
-        i64toi32_i32$5 = i64toi32_i32$3;
+        $144$hi = i64toi32_i32$2;
+        i64toi32_i32$2 = var$8$hi;
+        i64toi32_i32$2 = var$5$hi;
+        i64toi32_i32$2 = var$8$hi;
+        i64toi32_i32$3 = var$8;
+        i64toi32_i32$0 = var$5$hi;
+        i64toi32_i32$1 = var$5;
+        i64toi32_i32$4 = i64toi32_i32$3 >>> 0 < i64toi32_i32$1 >>> 0;
+        i64toi32_i32$3 = i64toi32_i32$3 - i64toi32_i32$1 | 0;
+        i64toi32_i32$0 = i64toi32_i32$4 + i64toi32_i32$0 | 0;
+        i64toi32_i32$0 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
+        i64toi32_i32$1 = i64toi32_i32$3;
         i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 63;
-        i64toi32_i32$1 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = i64toi32_i32$4 >> 31 | 0;
-         $47 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
+        i64toi32_i32$4 = 63;
+        i64toi32_i32$3 = i64toi32_i32$4 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$4 & 63 | 0) >>> 0) {
+         i64toi32_i32$2 = i64toi32_i32$0 >> 31 | 0;
+         $45 = i64toi32_i32$0 >> i64toi32_i32$3 | 0;
         } else {
-         i64toi32_i32$2 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
-         $47 = (((1 << i64toi32_i32$1 | 0) - 1 | 0) & i64toi32_i32$4 | 0) << (32 - i64toi32_i32$1 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$1 | 0) | 0;
+         i64toi32_i32$2 = i64toi32_i32$0 >> i64toi32_i32$3 | 0;
+         $45 = (((1 << i64toi32_i32$3 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$3 | 0) | 0 | (i64toi32_i32$1 >>> i64toi32_i32$3 | 0) | 0;
         }
-        var$6 = $47;
+        var$6 = $45;
         var$6$hi = i64toi32_i32$2;
         i64toi32_i32$2 = var$1$hi;
         i64toi32_i32$2 = var$6$hi;
-        i64toi32_i32$4 = var$6;
-        i64toi32_i32$5 = var$1$hi;
-        i64toi32_i32$0 = var$1;
-        i64toi32_i32$5 = i64toi32_i32$2 & i64toi32_i32$5 | 0;
-        $151 = i64toi32_i32$4 & i64toi32_i32$0 | 0;
-        $151$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = $144$hi;
+        i64toi32_i32$0 = var$6;
+        i64toi32_i32$1 = var$1$hi;
+        i64toi32_i32$4 = var$1;
+        i64toi32_i32$1 = i64toi32_i32$2 & i64toi32_i32$1 | 0;
+        $151 = i64toi32_i32$0 & i64toi32_i32$4 | 0;
+        $151$hi = i64toi32_i32$1;
+        i64toi32_i32$1 = $144$hi;
         i64toi32_i32$2 = $144;
-        i64toi32_i32$4 = $151$hi;
-        i64toi32_i32$0 = $151;
-        i64toi32_i32$1 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
-        i64toi32_i32$6 = i64toi32_i32$2 >>> 0 < i64toi32_i32$0 >>> 0;
-        i64toi32_i32$3 = i64toi32_i32$6 + i64toi32_i32$4 | 0;
-        i64toi32_i32$3 = i64toi32_i32$5 - i64toi32_i32$3 | 0;
-        var$5 = i64toi32_i32$1;
-        var$5$hi = i64toi32_i32$3;
-        i64toi32_i32$3 = var$0$hi;
-        i64toi32_i32$5 = var$0;
-        i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-         $48 = 0;
+        i64toi32_i32$0 = $151$hi;
+        i64toi32_i32$4 = $151;
+        i64toi32_i32$3 = i64toi32_i32$2 >>> 0 < i64toi32_i32$4 >>> 0;
+        i64toi32_i32$2 = i64toi32_i32$2 - i64toi32_i32$4 | 0;
+        i64toi32_i32$0 = i64toi32_i32$3 + i64toi32_i32$0 | 0;
+        i64toi32_i32$0 = i64toi32_i32$1 - i64toi32_i32$0 | 0;
+        var$5 = i64toi32_i32$2;
+        var$5$hi = i64toi32_i32$0;
+        i64toi32_i32$0 = var$0$hi;
+        i64toi32_i32$4 = var$0;
+        i64toi32_i32$1 = 0;
+        i64toi32_i32$3 = 1;
+        i64toi32_i32$2 = i64toi32_i32$3 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
+         i64toi32_i32$1 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
+         $46 = 0;
         } else {
-         i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $48 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
+         i64toi32_i32$1 = ((1 << i64toi32_i32$2 | 0) - 1 | 0) & (i64toi32_i32$4 >>> (32 - i64toi32_i32$2 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$2 | 0) | 0;
+         $46 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
         }
-        $154$hi = i64toi32_i32$2;
-        i64toi32_i32$2 = var$7$hi;
-        i64toi32_i32$2 = $154$hi;
-        i64toi32_i32$3 = $48;
-        i64toi32_i32$5 = var$7$hi;
-        i64toi32_i32$0 = var$7;
-        i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
-        var$0 = i64toi32_i32$3 | i64toi32_i32$0 | 0;
-        var$0$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = var$6$hi;
-        i64toi32_i32$2 = var$6;
-        i64toi32_i32$3 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$3 = i64toi32_i32$5 & i64toi32_i32$3 | 0;
-        var$6 = i64toi32_i32$2 & i64toi32_i32$0 | 0;
-        var$6$hi = i64toi32_i32$3;
+        $154$hi = i64toi32_i32$1;
+        i64toi32_i32$1 = var$7$hi;
+        i64toi32_i32$1 = $154$hi;
+        i64toi32_i32$0 = $46;
+        i64toi32_i32$4 = var$7$hi;
+        i64toi32_i32$3 = var$7;
+        i64toi32_i32$4 = i64toi32_i32$1 | i64toi32_i32$4 | 0;
+        var$0 = i64toi32_i32$0 | i64toi32_i32$3 | 0;
+        var$0$hi = i64toi32_i32$4;
+        i64toi32_i32$4 = var$6$hi;
+        i64toi32_i32$1 = var$6;
+        i64toi32_i32$0 = 0;
+        i64toi32_i32$3 = 1;
+        i64toi32_i32$0 = i64toi32_i32$4 & i64toi32_i32$0 | 0;
+        var$6 = i64toi32_i32$1 & i64toi32_i32$3 | 0;
+        var$6$hi = i64toi32_i32$0;
         var$7 = var$6;
-        var$7$hi = i64toi32_i32$3;
+        var$7$hi = i64toi32_i32$0;
         var$2 = var$2 + -1 | 0;
         if (var$2) {
          continue label$15
@@ -10654,41 +10652,41 @@ function asmFunc(global, env, buffer) {
       }
      }
     }
-    i64toi32_i32$3 = var$5$hi;
-    legalfunc$wasm2js_scratch_store_i64(var$5 | 0, i64toi32_i32$3 | 0);
-    i64toi32_i32$3 = var$0$hi;
-    i64toi32_i32$5 = var$0;
-    i64toi32_i32$2 = 0;
-    i64toi32_i32$0 = 1;
-    i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-    if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-     i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-     $49 = 0;
+    i64toi32_i32$0 = var$5$hi;
+    legalfunc$wasm2js_scratch_store_i64(var$5 | 0, i64toi32_i32$0 | 0);
+    i64toi32_i32$0 = var$0$hi;
+    i64toi32_i32$4 = var$0;
+    i64toi32_i32$1 = 0;
+    i64toi32_i32$3 = 1;
+    i64toi32_i32$2 = i64toi32_i32$3 & 31 | 0;
+    if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
+     i64toi32_i32$1 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
+     $47 = 0;
     } else {
-     i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-     $49 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
+     i64toi32_i32$1 = ((1 << i64toi32_i32$2 | 0) - 1 | 0) & (i64toi32_i32$4 >>> (32 - i64toi32_i32$2 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$2 | 0) | 0;
+     $47 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
     }
-    $165$hi = i64toi32_i32$2;
-    i64toi32_i32$2 = var$6$hi;
-    i64toi32_i32$2 = $165$hi;
-    i64toi32_i32$3 = $49;
-    i64toi32_i32$5 = var$6$hi;
-    i64toi32_i32$0 = var$6;
-    i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
-    i64toi32_i32$3 = i64toi32_i32$3 | i64toi32_i32$0 | 0;
-    i64toi32_i32$HIGH_BITS = i64toi32_i32$5;
-    return i64toi32_i32$3 | 0;
+    $165$hi = i64toi32_i32$1;
+    i64toi32_i32$1 = var$6$hi;
+    i64toi32_i32$1 = $165$hi;
+    i64toi32_i32$0 = $47;
+    i64toi32_i32$4 = var$6$hi;
+    i64toi32_i32$3 = var$6;
+    i64toi32_i32$4 = i64toi32_i32$1 | i64toi32_i32$4 | 0;
+    i64toi32_i32$0 = i64toi32_i32$0 | i64toi32_i32$3 | 0;
+    i64toi32_i32$HIGH_BITS = i64toi32_i32$4;
+    return i64toi32_i32$0 | 0;
    }
-   i64toi32_i32$3 = var$0$hi;
-   legalfunc$wasm2js_scratch_store_i64(var$0 | 0, i64toi32_i32$3 | 0);
-   i64toi32_i32$3 = 0;
+   i64toi32_i32$0 = var$0$hi;
+   legalfunc$wasm2js_scratch_store_i64(var$0 | 0, i64toi32_i32$0 | 0);
+   i64toi32_i32$0 = 0;
    var$0 = 0;
-   var$0$hi = i64toi32_i32$3;
+   var$0$hi = i64toi32_i32$0;
   }
-  i64toi32_i32$3 = var$0$hi;
-  i64toi32_i32$5 = var$0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$3;
-  return i64toi32_i32$5 | 0;
+  i64toi32_i32$0 = var$0$hi;
+  i64toi32_i32$4 = var$0;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
+  return i64toi32_i32$4 | 0;
  }
  
  function __wasm_i64_srem(var$0, var$0$hi, var$1, var$1$hi) {
@@ -10871,7 +10869,7 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$2$hi = 0, i64toi32_i32$6 = 0, $21 = 0, $22 = 0, $23 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17 = 0, $17$hi = 0, $23$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$4 = 0, var$2 = 0, var$2$hi = 0, $19 = 0, $20 = 0, $21 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17 = 0, $17$hi = 0, $23$hi = 0;
   i64toi32_i32$0 = var$0$hi;
   i64toi32_i32$2 = var$0;
   i64toi32_i32$1 = 0;
@@ -10879,12 +10877,12 @@ function asmFunc(global, env, buffer) {
   i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
   if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
    i64toi32_i32$1 = i64toi32_i32$0 >> 31 | 0;
-   $21 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
+   $19 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
   } else {
    i64toi32_i32$1 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
-   $21 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+   $19 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
   }
-  var$2 = $21;
+  var$2 = $19;
   var$2$hi = i64toi32_i32$1;
   i64toi32_i32$1 = var$0$hi;
   i64toi32_i32$1 = var$2$hi;
@@ -10898,86 +10896,86 @@ function asmFunc(global, env, buffer) {
   i64toi32_i32$1 = i64toi32_i32$0 ^ i64toi32_i32$3 | 0;
   i64toi32_i32$0 = var$2$hi;
   i64toi32_i32$3 = var$2;
-  i64toi32_i32$4 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$5 = i64toi32_i32$6 + i64toi32_i32$0 | 0;
-  i64toi32_i32$5 = i64toi32_i32$2 - i64toi32_i32$5 | 0;
-  $9 = i64toi32_i32$4;
-  $9$hi = i64toi32_i32$5;
-  i64toi32_i32$5 = var$1$hi;
-  i64toi32_i32$2 = var$1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$0 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$5 >> 31 | 0;
-   $22 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
-  } else {
-   i64toi32_i32$1 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
-   $22 = (((1 << i64toi32_i32$0 | 0) - 1 | 0) & i64toi32_i32$5 | 0) << (32 - i64toi32_i32$0 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$0 | 0) | 0;
-  }
-  var$2 = $22;
-  var$2$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$1$hi;
-  i64toi32_i32$1 = var$2$hi;
-  i64toi32_i32$5 = var$2;
-  i64toi32_i32$2 = var$1$hi;
+  i64toi32_i32$4 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
+  i64toi32_i32$1 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
+  i64toi32_i32$0 = i64toi32_i32$4 + i64toi32_i32$0 | 0;
+  i64toi32_i32$0 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
+  $9 = i64toi32_i32$1;
+  $9$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = var$1$hi;
   i64toi32_i32$3 = var$1;
-  i64toi32_i32$2 = i64toi32_i32$1 ^ i64toi32_i32$2 | 0;
-  $14$hi = i64toi32_i32$2;
-  i64toi32_i32$2 = i64toi32_i32$1;
-  i64toi32_i32$2 = $14$hi;
-  i64toi32_i32$1 = i64toi32_i32$5 ^ i64toi32_i32$3 | 0;
-  i64toi32_i32$5 = var$2$hi;
-  i64toi32_i32$3 = var$2;
-  i64toi32_i32$0 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$4 = i64toi32_i32$6 + i64toi32_i32$5 | 0;
-  i64toi32_i32$4 = i64toi32_i32$2 - i64toi32_i32$4 | 0;
-  $16$hi = i64toi32_i32$4;
-  i64toi32_i32$4 = $9$hi;
-  i64toi32_i32$1 = $16$hi;
-  i64toi32_i32$1 = __wasm_i64_udiv($9 | 0, i64toi32_i32$4 | 0, i64toi32_i32$0 | 0, i64toi32_i32$1 | 0) | 0;
-  i64toi32_i32$4 = i64toi32_i32$HIGH_BITS;
-  $17 = i64toi32_i32$1;
-  $17$hi = i64toi32_i32$4;
-  i64toi32_i32$4 = var$1$hi;
-  i64toi32_i32$4 = var$0$hi;
-  i64toi32_i32$4 = var$1$hi;
-  i64toi32_i32$2 = var$1;
-  i64toi32_i32$1 = var$0$hi;
-  i64toi32_i32$3 = var$0;
-  i64toi32_i32$1 = i64toi32_i32$4 ^ i64toi32_i32$1 | 0;
-  i64toi32_i32$4 = i64toi32_i32$2 ^ i64toi32_i32$3 | 0;
   i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$5 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = i64toi32_i32$1 >> 31 | 0;
-   $23 = i64toi32_i32$1 >> i64toi32_i32$5 | 0;
+  i64toi32_i32$4 = 63;
+  i64toi32_i32$1 = i64toi32_i32$4 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$4 & 63 | 0) >>> 0) {
+   i64toi32_i32$2 = i64toi32_i32$0 >> 31 | 0;
+   $20 = i64toi32_i32$0 >> i64toi32_i32$1 | 0;
   } else {
-   i64toi32_i32$2 = i64toi32_i32$1 >> i64toi32_i32$5 | 0;
-   $23 = (((1 << i64toi32_i32$5 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$5 | 0) | 0 | (i64toi32_i32$4 >>> i64toi32_i32$5 | 0) | 0;
+   i64toi32_i32$2 = i64toi32_i32$0 >> i64toi32_i32$1 | 0;
+   $20 = (((1 << i64toi32_i32$1 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$1 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$1 | 0) | 0;
   }
-  var$0 = $23;
-  var$0$hi = i64toi32_i32$2;
-  i64toi32_i32$2 = $17$hi;
-  i64toi32_i32$1 = $17;
-  i64toi32_i32$4 = var$0$hi;
-  i64toi32_i32$3 = var$0;
-  i64toi32_i32$4 = i64toi32_i32$2 ^ i64toi32_i32$4 | 0;
-  $23$hi = i64toi32_i32$4;
-  i64toi32_i32$4 = var$0$hi;
-  i64toi32_i32$4 = $23$hi;
-  i64toi32_i32$2 = i64toi32_i32$1 ^ i64toi32_i32$3 | 0;
-  i64toi32_i32$1 = var$0$hi;
-  i64toi32_i32$5 = i64toi32_i32$2 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$2 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$0 = i64toi32_i32$6 + i64toi32_i32$1 | 0;
-  i64toi32_i32$0 = i64toi32_i32$4 - i64toi32_i32$0 | 0;
-  i64toi32_i32$2 = i64toi32_i32$5;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
-  return i64toi32_i32$2 | 0;
+  var$2 = $20;
+  var$2$hi = i64toi32_i32$2;
+  i64toi32_i32$2 = var$1$hi;
+  i64toi32_i32$2 = var$2$hi;
+  i64toi32_i32$0 = var$2;
+  i64toi32_i32$3 = var$1$hi;
+  i64toi32_i32$4 = var$1;
+  i64toi32_i32$3 = i64toi32_i32$2 ^ i64toi32_i32$3 | 0;
+  $14$hi = i64toi32_i32$3;
+  i64toi32_i32$3 = i64toi32_i32$2;
+  i64toi32_i32$3 = $14$hi;
+  i64toi32_i32$2 = i64toi32_i32$0 ^ i64toi32_i32$4 | 0;
+  i64toi32_i32$0 = var$2$hi;
+  i64toi32_i32$4 = var$2;
+  i64toi32_i32$1 = i64toi32_i32$2 >>> 0 < i64toi32_i32$4 >>> 0;
+  i64toi32_i32$2 = i64toi32_i32$2 - i64toi32_i32$4 | 0;
+  i64toi32_i32$0 = i64toi32_i32$1 + i64toi32_i32$0 | 0;
+  i64toi32_i32$0 = i64toi32_i32$3 - i64toi32_i32$0 | 0;
+  $16$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = $9$hi;
+  i64toi32_i32$3 = $16$hi;
+  i64toi32_i32$3 = __wasm_i64_udiv($9 | 0, i64toi32_i32$0 | 0, i64toi32_i32$2 | 0, i64toi32_i32$3 | 0) | 0;
+  i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
+  $17 = i64toi32_i32$3;
+  $17$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = var$1$hi;
+  i64toi32_i32$0 = var$0$hi;
+  i64toi32_i32$0 = var$1$hi;
+  i64toi32_i32$4 = var$1;
+  i64toi32_i32$3 = var$0$hi;
+  i64toi32_i32$1 = var$0;
+  i64toi32_i32$3 = i64toi32_i32$0 ^ i64toi32_i32$3 | 0;
+  i64toi32_i32$0 = i64toi32_i32$4 ^ i64toi32_i32$1 | 0;
+  i64toi32_i32$4 = 0;
+  i64toi32_i32$1 = 63;
+  i64toi32_i32$2 = i64toi32_i32$1 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$1 & 63 | 0) >>> 0) {
+   i64toi32_i32$4 = i64toi32_i32$3 >> 31 | 0;
+   $21 = i64toi32_i32$3 >> i64toi32_i32$2 | 0;
+  } else {
+   i64toi32_i32$4 = i64toi32_i32$3 >> i64toi32_i32$2 | 0;
+   $21 = (((1 << i64toi32_i32$2 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$2 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$2 | 0) | 0;
+  }
+  var$0 = $21;
+  var$0$hi = i64toi32_i32$4;
+  i64toi32_i32$4 = $17$hi;
+  i64toi32_i32$3 = $17;
+  i64toi32_i32$0 = var$0$hi;
+  i64toi32_i32$1 = var$0;
+  i64toi32_i32$0 = i64toi32_i32$4 ^ i64toi32_i32$0 | 0;
+  $23$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = var$0$hi;
+  i64toi32_i32$0 = $23$hi;
+  i64toi32_i32$4 = i64toi32_i32$3 ^ i64toi32_i32$1 | 0;
+  i64toi32_i32$3 = var$0$hi;
+  i64toi32_i32$2 = i64toi32_i32$4 >>> 0 < i64toi32_i32$1 >>> 0;
+  i64toi32_i32$4 = i64toi32_i32$4 - i64toi32_i32$1 | 0;
+  i64toi32_i32$3 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
+  i64toi32_i32$3 = i64toi32_i32$0 - i64toi32_i32$3 | 0;
+  i64toi32_i32$0 = i64toi32_i32$4;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$3;
+  return i64toi32_i32$0 | 0;
  }
  
  function __wasm_i64_sdiv(var$0, var$0$hi, var$1, var$1$hi) {
@@ -11001,7 +10999,7 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$4 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, i64toi32_i32$6 = 0, $37 = 0, $38 = 0, $39 = 0, $40 = 0, $41 = 0, $42 = 0, $43 = 0, $44 = 0, var$8$hi = 0, $45 = 0, $46 = 0, $47 = 0, $48 = 0, var$7$hi = 0, $49 = 0, $63$hi = 0, $65 = 0, $65$hi = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142$hi = 0, $144 = 0, $144$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0;
+  var i64toi32_i32$4 = 0, i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, var$2 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, $35 = 0, $36 = 0, $37 = 0, $38 = 0, $39 = 0, $40 = 0, $41 = 0, $42 = 0, var$8$hi = 0, $43 = 0, $44 = 0, $45 = 0, $46 = 0, var$7$hi = 0, $47 = 0, $63$hi = 0, $65 = 0, $65$hi = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142$hi = 0, $144 = 0, $144$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0;
   label$1 : {
    label$2 : {
     label$3 : {
@@ -11020,12 +11018,12 @@ function asmFunc(global, env, buffer) {
              i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
              if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
               i64toi32_i32$1 = 0;
-              $37 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
+              $35 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
              } else {
               i64toi32_i32$1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-              $37 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+              $35 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
              }
-             var$2 = $37;
+             var$2 = $35;
              if (var$2) {
               block : {
                i64toi32_i32$1 = var$1$hi;
@@ -11040,12 +11038,12 @@ function asmFunc(global, env, buffer) {
                i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
                if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
                 i64toi32_i32$2 = 0;
-                $38 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
+                $36 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
                } else {
                 i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-                $38 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
+                $36 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
                }
-               var$4 = $38;
+               var$4 = $36;
                if (!var$4) {
                 break label$9
                }
@@ -11082,12 +11080,12 @@ function asmFunc(global, env, buffer) {
             i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
             if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
              i64toi32_i32$1 = 0;
-             $39 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
+             $37 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
             } else {
              i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-             $39 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
+             $37 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
             }
-            var$3 = $39;
+            var$3 = $37;
             i64toi32_i32$1 = var$0$hi;
             if (!var$0) {
              break label$7
@@ -11106,10 +11104,10 @@ function asmFunc(global, env, buffer) {
             i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
             if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
              i64toi32_i32$3 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-             $40 = 0;
+             $38 = 0;
             } else {
              i64toi32_i32$3 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-             $40 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
+             $38 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
             }
             $63$hi = i64toi32_i32$3;
             i64toi32_i32$3 = var$0$hi;
@@ -11120,7 +11118,7 @@ function asmFunc(global, env, buffer) {
             $65 = i64toi32_i32$1 & i64toi32_i32$0 | 0;
             $65$hi = i64toi32_i32$2;
             i64toi32_i32$2 = $63$hi;
-            i64toi32_i32$3 = $40;
+            i64toi32_i32$3 = $38;
             i64toi32_i32$1 = $65$hi;
             i64toi32_i32$0 = $65;
             i64toi32_i32$1 = i64toi32_i32$2 | i64toi32_i32$1 | 0;
@@ -11151,12 +11149,12 @@ function asmFunc(global, env, buffer) {
         i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
         if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
          i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-         $41 = 0;
+         $39 = 0;
         } else {
          i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $41 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
+         $39 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
         }
-        legalfunc$wasm2js_scratch_store_i64($41 | 0, i64toi32_i32$1 | 0);
+        legalfunc$wasm2js_scratch_store_i64($39 | 0, i64toi32_i32$1 | 0);
         i64toi32_i32$1 = 0;
         i64toi32_i32$2 = var$4;
         i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
@@ -11184,12 +11182,12 @@ function asmFunc(global, env, buffer) {
       i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
       if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
        i64toi32_i32$1 = 0;
-       $42 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
+       $40 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
       } else {
        i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-       $42 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
+       $40 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
       }
-      i64toi32_i32$3 = $42;
+      i64toi32_i32$3 = $40;
       i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
       return i64toi32_i32$3 | 0;
      }
@@ -11206,12 +11204,12 @@ function asmFunc(global, env, buffer) {
     i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
     if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
      i64toi32_i32$1 = 0;
-     $43 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
+     $41 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
     } else {
      i64toi32_i32$1 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
-     $43 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+     $41 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
     }
-    var$5 = $43;
+    var$5 = $41;
     var$5$hi = i64toi32_i32$1;
     i64toi32_i32$1 = var$0$hi;
     i64toi32_i32$1 = 0;
@@ -11223,12 +11221,12 @@ function asmFunc(global, env, buffer) {
     i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
     if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
      i64toi32_i32$2 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
-     $44 = 0;
+     $42 = 0;
     } else {
      i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$3 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-     $44 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
+     $42 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
     }
-    var$0 = $44;
+    var$0 = $42;
     var$0$hi = i64toi32_i32$2;
     label$13 : {
      if (var$2) {
@@ -11237,121 +11235,121 @@ function asmFunc(global, env, buffer) {
        i64toi32_i32$1 = var$1;
        i64toi32_i32$3 = -1;
        i64toi32_i32$0 = -1;
-       i64toi32_i32$4 = i64toi32_i32$1 + i64toi32_i32$0 | 0;
-       i64toi32_i32$5 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
-       if (i64toi32_i32$4 >>> 0 < i64toi32_i32$0 >>> 0) {
-        i64toi32_i32$5 = i64toi32_i32$5 + 1 | 0
+       i64toi32_i32$1 = i64toi32_i32$1 + i64toi32_i32$0 | 0;
+       i64toi32_i32$2 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
+       if (i64toi32_i32$1 >>> 0 < i64toi32_i32$0 >>> 0) {
+        i64toi32_i32$2 = i64toi32_i32$2 + 1 | 0
        }
-       var$8 = i64toi32_i32$4;
-       var$8$hi = i64toi32_i32$5;
+       var$8 = i64toi32_i32$1;
+       var$8$hi = i64toi32_i32$2;
        label$15 : while (1) {
-        i64toi32_i32$5 = var$5$hi;
-        i64toi32_i32$2 = var$5;
-        i64toi32_i32$1 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
-         $45 = 0;
+        i64toi32_i32$2 = var$5$hi;
+        i64toi32_i32$3 = var$5;
+        i64toi32_i32$0 = 0;
+        i64toi32_i32$1 = 1;
+        i64toi32_i32$4 = i64toi32_i32$1 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$1 & 63 | 0) >>> 0) {
+         i64toi32_i32$0 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
+         $43 = 0;
         } else {
-         i64toi32_i32$1 = ((1 << i64toi32_i32$3 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$3 | 0) | 0) | 0 | (i64toi32_i32$5 << i64toi32_i32$3 | 0) | 0;
-         $45 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
+         i64toi32_i32$0 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$3 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$2 << i64toi32_i32$4 | 0) | 0;
+         $43 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
         }
-        $140 = $45;
-        $140$hi = i64toi32_i32$1;
-        i64toi32_i32$1 = var$0$hi;
-        i64toi32_i32$5 = var$0;
-        i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 63;
-        i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = 0;
-         $46 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
+        $140 = $43;
+        $140$hi = i64toi32_i32$0;
+        i64toi32_i32$0 = var$0$hi;
+        i64toi32_i32$2 = var$0;
+        i64toi32_i32$3 = 0;
+        i64toi32_i32$1 = 63;
+        i64toi32_i32$4 = i64toi32_i32$1 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$1 & 63 | 0) >>> 0) {
+         i64toi32_i32$3 = 0;
+         $44 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
         } else {
-         i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
-         $46 = (((1 << i64toi32_i32$3 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$3 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$3 | 0) | 0;
+         i64toi32_i32$3 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
+         $44 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
         }
-        $142$hi = i64toi32_i32$2;
-        i64toi32_i32$2 = $140$hi;
-        i64toi32_i32$1 = $140;
-        i64toi32_i32$5 = $142$hi;
-        i64toi32_i32$0 = $46;
-        i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
-        var$5 = i64toi32_i32$1 | i64toi32_i32$0 | 0;
-        var$5$hi = i64toi32_i32$5;
+        $142$hi = i64toi32_i32$3;
+        i64toi32_i32$3 = $140$hi;
+        i64toi32_i32$0 = $140;
+        i64toi32_i32$2 = $142$hi;
+        i64toi32_i32$1 = $44;
+        i64toi32_i32$2 = i64toi32_i32$3 | i64toi32_i32$2 | 0;
+        var$5 = i64toi32_i32$0 | i64toi32_i32$1 | 0;
+        var$5$hi = i64toi32_i32$2;
         $144 = var$5;
-        $144$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = var$8$hi;
-        i64toi32_i32$5 = var$5$hi;
-        i64toi32_i32$5 = var$8$hi;
-        i64toi32_i32$2 = var$8;
-        i64toi32_i32$1 = var$5$hi;
-        i64toi32_i32$0 = var$5;
-        i64toi32_i32$3 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
-        i64toi32_i32$6 = i64toi32_i32$2 >>> 0 < i64toi32_i32$0 >>> 0;
-        i64toi32_i32$4 = i64toi32_i32$6 + i64toi32_i32$1 | 0;
-        i64toi32_i32$4 = i64toi32_i32$5 - i64toi32_i32$4 | 0;
-        i64toi32_i32$5 = i64toi32_i32$3;
+        $144$hi = i64toi32_i32$2;
+        i64toi32_i32$2 = var$8$hi;
+        i64toi32_i32$2 = var$5$hi;
+        i64toi32_i32$2 = var$8$hi;
+        i64toi32_i32$3 = var$8;
+        i64toi32_i32$0 = var$5$hi;
+        i64toi32_i32$1 = var$5;
+        i64toi32_i32$4 = i64toi32_i32$3 >>> 0 < i64toi32_i32$1 >>> 0;
+        i64toi32_i32$3 = i64toi32_i32$3 - i64toi32_i32$1 | 0;
+        i64toi32_i32$0 = i64toi32_i32$4 + i64toi32_i32$0 | 0;
+        i64toi32_i32$0 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
+        i64toi32_i32$1 = i64toi32_i32$3;
         i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 63;
-        i64toi32_i32$1 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = i64toi32_i32$4 >> 31 | 0;
-         $47 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
+        i64toi32_i32$4 = 63;
+        i64toi32_i32$3 = i64toi32_i32$4 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$4 & 63 | 0) >>> 0) {
+         i64toi32_i32$2 = i64toi32_i32$0 >> 31 | 0;
+         $45 = i64toi32_i32$0 >> i64toi32_i32$3 | 0;
         } else {
-         i64toi32_i32$2 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
-         $47 = (((1 << i64toi32_i32$1 | 0) - 1 | 0) & i64toi32_i32$4 | 0) << (32 - i64toi32_i32$1 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$1 | 0) | 0;
+         i64toi32_i32$2 = i64toi32_i32$0 >> i64toi32_i32$3 | 0;
+         $45 = (((1 << i64toi32_i32$3 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$3 | 0) | 0 | (i64toi32_i32$1 >>> i64toi32_i32$3 | 0) | 0;
         }
-        var$6 = $47;
+        var$6 = $45;
         var$6$hi = i64toi32_i32$2;
         i64toi32_i32$2 = var$1$hi;
         i64toi32_i32$2 = var$6$hi;
-        i64toi32_i32$4 = var$6;
-        i64toi32_i32$5 = var$1$hi;
-        i64toi32_i32$0 = var$1;
-        i64toi32_i32$5 = i64toi32_i32$2 & i64toi32_i32$5 | 0;
-        $151 = i64toi32_i32$4 & i64toi32_i32$0 | 0;
-        $151$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = $144$hi;
+        i64toi32_i32$0 = var$6;
+        i64toi32_i32$1 = var$1$hi;
+        i64toi32_i32$4 = var$1;
+        i64toi32_i32$1 = i64toi32_i32$2 & i64toi32_i32$1 | 0;
+        $151 = i64toi32_i32$0 & i64toi32_i32$4 | 0;
+        $151$hi = i64toi32_i32$1;
+        i64toi32_i32$1 = $144$hi;
         i64toi32_i32$2 = $144;
-        i64toi32_i32$4 = $151$hi;
-        i64toi32_i32$0 = $151;
-        i64toi32_i32$1 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
-        i64toi32_i32$6 = i64toi32_i32$2 >>> 0 < i64toi32_i32$0 >>> 0;
-        i64toi32_i32$3 = i64toi32_i32$6 + i64toi32_i32$4 | 0;
-        i64toi32_i32$3 = i64toi32_i32$5 - i64toi32_i32$3 | 0;
-        var$5 = i64toi32_i32$1;
-        var$5$hi = i64toi32_i32$3;
-        i64toi32_i32$3 = var$0$hi;
-        i64toi32_i32$5 = var$0;
-        i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-         $48 = 0;
+        i64toi32_i32$0 = $151$hi;
+        i64toi32_i32$4 = $151;
+        i64toi32_i32$3 = i64toi32_i32$2 >>> 0 < i64toi32_i32$4 >>> 0;
+        i64toi32_i32$2 = i64toi32_i32$2 - i64toi32_i32$4 | 0;
+        i64toi32_i32$0 = i64toi32_i32$3 + i64toi32_i32$0 | 0;
+        i64toi32_i32$0 = i64toi32_i32$1 - i64toi32_i32$0 | 0;
+        var$5 = i64toi32_i32$2;
+        var$5$hi = i64toi32_i32$0;
+        i64toi32_i32$0 = var$0$hi;
+        i64toi32_i32$4 = var$0;
+        i64toi32_i32$1 = 0;
+        i64toi32_i32$3 = 1;
+        i64toi32_i32$2 = i64toi32_i32$3 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
+         i64toi32_i32$1 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
+         $46 = 0;
         } else {
-         i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $48 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
+         i64toi32_i32$1 = ((1 << i64toi32_i32$2 | 0) - 1 | 0) & (i64toi32_i32$4 >>> (32 - i64toi32_i32$2 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$2 | 0) | 0;
+         $46 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
         }
-        $154$hi = i64toi32_i32$2;
-        i64toi32_i32$2 = var$7$hi;
-        i64toi32_i32$2 = $154$hi;
-        i64toi32_i32$3 = $48;
-        i64toi32_i32$5 = var$7$hi;
-        i64toi32_i32$0 = var$7;
-        i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
-        var$0 = i64toi32_i32$3 | i64toi32_i32$0 | 0;
-        var$0$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = var$6$hi;
-        i64toi32_i32$2 = var$6;
-        i64toi32_i32$3 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$3 = i64toi32_i32$5 & i64toi32_i32$3 | 0;
-        var$6 = i64toi32_i32$2 & i64toi32_i32$0 | 0;
-        var$6$hi = i64toi32_i32$3;
+        $154$hi = i64toi32_i32$1;
+        i64toi32_i32$1 = var$7$hi;
+        i64toi32_i32$1 = $154$hi;
+        i64toi32_i32$0 = $46;
+        i64toi32_i32$4 = var$7$hi;
+        i64toi32_i32$3 = var$7;
+        i64toi32_i32$4 = i64toi32_i32$1 | i64toi32_i32$4 | 0;
+        var$0 = i64toi32_i32$0 | i64toi32_i32$3 | 0;
+        var$0$hi = i64toi32_i32$4;
+        i64toi32_i32$4 = var$6$hi;
+        i64toi32_i32$1 = var$6;
+        i64toi32_i32$0 = 0;
+        i64toi32_i32$3 = 1;
+        i64toi32_i32$0 = i64toi32_i32$4 & i64toi32_i32$0 | 0;
+        var$6 = i64toi32_i32$1 & i64toi32_i32$3 | 0;
+        var$6$hi = i64toi32_i32$0;
         var$7 = var$6;
-        var$7$hi = i64toi32_i32$3;
+        var$7$hi = i64toi32_i32$0;
         var$2 = var$2 + -1 | 0;
         if (var$2) {
          continue label$15
@@ -11362,41 +11360,41 @@ function asmFunc(global, env, buffer) {
       }
      }
     }
-    i64toi32_i32$3 = var$5$hi;
-    legalfunc$wasm2js_scratch_store_i64(var$5 | 0, i64toi32_i32$3 | 0);
-    i64toi32_i32$3 = var$0$hi;
-    i64toi32_i32$5 = var$0;
-    i64toi32_i32$2 = 0;
-    i64toi32_i32$0 = 1;
-    i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-    if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-     i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-     $49 = 0;
+    i64toi32_i32$0 = var$5$hi;
+    legalfunc$wasm2js_scratch_store_i64(var$5 | 0, i64toi32_i32$0 | 0);
+    i64toi32_i32$0 = var$0$hi;
+    i64toi32_i32$4 = var$0;
+    i64toi32_i32$1 = 0;
+    i64toi32_i32$3 = 1;
+    i64toi32_i32$2 = i64toi32_i32$3 & 31 | 0;
+    if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
+     i64toi32_i32$1 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
+     $47 = 0;
     } else {
-     i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-     $49 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
+     i64toi32_i32$1 = ((1 << i64toi32_i32$2 | 0) - 1 | 0) & (i64toi32_i32$4 >>> (32 - i64toi32_i32$2 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$2 | 0) | 0;
+     $47 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
     }
-    $165$hi = i64toi32_i32$2;
-    i64toi32_i32$2 = var$6$hi;
-    i64toi32_i32$2 = $165$hi;
-    i64toi32_i32$3 = $49;
-    i64toi32_i32$5 = var$6$hi;
-    i64toi32_i32$0 = var$6;
-    i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
-    i64toi32_i32$3 = i64toi32_i32$3 | i64toi32_i32$0 | 0;
-    i64toi32_i32$HIGH_BITS = i64toi32_i32$5;
-    return i64toi32_i32$3 | 0;
+    $165$hi = i64toi32_i32$1;
+    i64toi32_i32$1 = var$6$hi;
+    i64toi32_i32$1 = $165$hi;
+    i64toi32_i32$0 = $47;
+    i64toi32_i32$4 = var$6$hi;
+    i64toi32_i32$3 = var$6;
+    i64toi32_i32$4 = i64toi32_i32$1 | i64toi32_i32$4 | 0;
+    i64toi32_i32$0 = i64toi32_i32$0 | i64toi32_i32$3 | 0;
+    i64toi32_i32$HIGH_BITS = i64toi32_i32$4;
+    return i64toi32_i32$0 | 0;
    }
-   i64toi32_i32$3 = var$0$hi;
-   legalfunc$wasm2js_scratch_store_i64(var$0 | 0, i64toi32_i32$3 | 0);
-   i64toi32_i32$3 = 0;
+   i64toi32_i32$0 = var$0$hi;
+   legalfunc$wasm2js_scratch_store_i64(var$0 | 0, i64toi32_i32$0 | 0);
+   i64toi32_i32$0 = 0;
    var$0 = 0;
-   var$0$hi = i64toi32_i32$3;
+   var$0$hi = i64toi32_i32$0;
   }
-  i64toi32_i32$3 = var$0$hi;
-  i64toi32_i32$5 = var$0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$3;
-  return i64toi32_i32$5 | 0;
+  i64toi32_i32$0 = var$0$hi;
+  i64toi32_i32$4 = var$0;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
+  return i64toi32_i32$4 | 0;
  }
  
  function __wasm_i64_udiv(var$0, var$0$hi, var$1, var$1$hi) {
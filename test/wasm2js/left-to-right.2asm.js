@@ -430,7 +430,7 @@ function asmFunc(global, env, buffer) {
  }
  
  function $64() {
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$3 = 0, i64toi32_i32$4 = 0, i64toi32_i32$5 = 0, $0 = 0, $0$hi = 0, $1 = 0, $1$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, $0 = 0, $0$hi = 0, $1 = 0, $1$hi = 0;
   reset();
   i64toi32_i32$0 = i64_left() | 0;
   i64toi32_i32$1 = i64toi32_i32$HIGH_BITS;
@@ -441,18 +441,19 @@ function asmFunc(global, env, buffer) {
   $1 = i64toi32_i32$1;
   $1$hi = i64toi32_i32$0;
   i64toi32_i32$0 = $0$hi;
+  i64toi32_i32$2 = $0;
   i64toi32_i32$1 = $1$hi;
   i64toi32_i32$3 = $1;
-  i64toi32_i32$4 = $0 + i64toi32_i32$3 | 0;
-  i64toi32_i32$5 = i64toi32_i32$0 + i64toi32_i32$1 | 0;
-  if (i64toi32_i32$4 >>> 0 < i64toi32_i32$3 >>> 0) {
-   i64toi32_i32$5 = i64toi32_i32$5 + 1 | 0
+  i64toi32_i32$2 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
+  i64toi32_i32$0 = i64toi32_i32$0 + i64toi32_i32$1 | 0;
+  if (i64toi32_i32$2 >>> 0 < i64toi32_i32$3 >>> 0) {
+   i64toi32_i32$0 = i64toi32_i32$0 + 1 | 0
   }
   return get() | 0 | 0;
  }
  
  function $65() {
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$5 = 0, $0 = 0, $0$hi = 0, $1 = 0, $1$hi = 0;
+  var i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, $0 = 0, $0$hi = 0, $1 = 0, $1$hi = 0, i64toi32_i32$4 = 0;
   reset();
   i64toi32_i32$0 = i64_left() | 0;
   i64toi32_i32$1 = i64toi32_i32$HIGH_BITS;
@@ -466,8 +467,10 @@ function asmFunc(global, env, buffer) {
   i64toi32_i32$2 = $0;
   i64toi32_i32$1 = $1$hi;
   i64toi32_i32$3 = $1;
-  i64toi32_i32$5 = (i64toi32_i32$2 >>> 0 < i64toi32_i32$3 >>> 0) + i64toi32_i32$1 | 0;
-  i64toi32_i32$5 = i64toi32_i32$0 - i64toi32_i32$5 | 0;
+  i64toi32_i32$4 = i64toi32_i32$2 >>> 0 < i64toi32_i32$3 >>> 0;
+  i64toi32_i32$2 = i64toi32_i32$2 - i64toi32_i32$3 | 0;
+  i64toi32_i32$1 = i64toi32_i32$4 + i64toi32_i32$1 | 0;
+  i64toi32_i32$1 = i64toi32_i32$0 - i64toi32_i32$1 | 0;
   return get() | 0 | 0;
  }
  
@@ -1393,7 +1396,7 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$2$hi = 0, i64toi32_i32$6 = 0, $21 = 0, $22 = 0, $23 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17 = 0, $17$hi = 0, $23$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$4 = 0, var$2 = 0, var$2$hi = 0, $19 = 0, $20 = 0, $21 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17 = 0, $17$hi = 0, $23$hi = 0;
   i64toi32_i32$0 = var$0$hi;
   i64toi32_i32$2 = var$0;
   i64toi32_i32$1 = 0;
@@ -1401,12 +1404,12 @@ function asmFunc(global, env, buffer) {
   i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
   if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
    i64toi32_i32$1 = i64toi32_i32$0 >> 31 | 0;
-   $21 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
+   $19 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
   } else {
    i64toi32_i32$1 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
-   $21 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+   $19 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
   }
-  var$2 = $21;
+  var$2 = $19;
   var$2$hi = i64toi32_i32$1;
   i64toi32_i32$1 = var$0$hi;
   i64toi32_i32$1 = var$2$hi;
@@ -1420,86 +1423,86 @@ function asmFunc(global, env, buffer) {
   i64toi32_i32$1 = i64toi32_i32$0 ^ i64toi32_i32$3 | 0;
   i64toi32_i32$0 = var$2$hi;
   i64toi32_i32$3 = var$2;
-  i64toi32_i32$4 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$5 = i64toi32_i32$6 + i64toi32_i32$0 | 0;
-  i64toi32_i32$5 = i64toi32_i32$2 - i64toi32_i32$5 | 0;
-  $9 = i64toi32_i32$4;
-  $9$hi = i64toi32_i32$5;
-  i64toi32_i32$5 = var$1$hi;
-  i64toi32_i32$2 = var$1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$0 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$5 >> 31 | 0;
-   $22 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
+  i64toi32_i32$4 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
+  i64toi32_i32$1 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
+  i64toi32_i32$0 = i64toi32_i32$4 + i64toi32_i32$0 | 0;
+  i64toi32_i32$0 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
+  $9 = i64toi32_i32$1;
+  $9$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = var$1$hi;
+  i64toi32_i32$3 = var$1;
+  i64toi32_i32$2 = 0;
+  i64toi32_i32$4 = 63;
+  i64toi32_i32$1 = i64toi32_i32$4 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$4 & 63 | 0) >>> 0) {
+   i64toi32_i32$2 = i64toi32_i32$0 >> 31 | 0;
+   $20 = i64toi32_i32$0 >> i64toi32_i32$1 | 0;
   } else {
-   i64toi32_i32$1 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
-   $22 = (((1 << i64toi32_i32$0 | 0) - 1 | 0) & i64toi32_i32$5 | 0) << (32 - i64toi32_i32$0 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$0 | 0) | 0;
+   i64toi32_i32$2 = i64toi32_i32$0 >> i64toi32_i32$1 | 0;
+   $20 = (((1 << i64toi32_i32$1 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$1 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$1 | 0) | 0;
   }
-  var$2 = $22;
-  var$2$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$1$hi;
-  i64toi32_i32$1 = var$2$hi;
-  i64toi32_i32$5 = var$2;
+  var$2 = $20;
+  var$2$hi = i64toi32_i32$2;
   i64toi32_i32$2 = var$1$hi;
-  i64toi32_i32$3 = var$1;
-  i64toi32_i32$2 = i64toi32_i32$1 ^ i64toi32_i32$2 | 0;
-  $14$hi = i64toi32_i32$2;
-  i64toi32_i32$2 = i64toi32_i32$1;
-  i64toi32_i32$2 = $14$hi;
-  i64toi32_i32$1 = i64toi32_i32$5 ^ i64toi32_i32$3 | 0;
-  i64toi32_i32$5 = var$2$hi;
-  i64toi32_i32$3 = var$2;
-  i64toi32_i32$0 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$4 = i64toi32_i32$6 + i64toi32_i32$5 | 0;
-  i64toi32_i32$4 = i64toi32_i32$2 - i64toi32_i32$4 | 0;
-  $16$hi = i64toi32_i32$4;
-  i64toi32_i32$4 = $9$hi;
-  i64toi32_i32$1 = $16$hi;
-  i64toi32_i32$1 = __wasm_i64_udiv($9 | 0, i64toi32_i32$4 | 0, i64toi32_i32$0 | 0, i64toi32_i32$1 | 0) | 0;
-  i64toi32_i32$4 = i64toi32_i32$HIGH_BITS;
-  $17 = i64toi32_i32$1;
-  $17$hi = i64toi32_i32$4;
-  i64toi32_i32$4 = var$1$hi;
-  i64toi32_i32$4 = var$0$hi;
-  i64toi32_i32$4 = var$1$hi;
-  i64toi32_i32$2 = var$1;
-  i64toi32_i32$1 = var$0$hi;
-  i64toi32_i32$3 = var$0;
-  i64toi32_i32$1 = i64toi32_i32$4 ^ i64toi32_i32$1 | 0;
-  i64toi32_i32$4 = i64toi32_i32$2 ^ i64toi32_i32$3 | 0;
-  i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$5 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = i64toi32_i32$1 >> 31 | 0;
-   $23 = i64toi32_i32$1 >> i64toi32_i32$5 | 0;
+  i64toi32_i32$2 = var$2$hi;
+  i64toi32_i32$0 = var$2;
+  i64toi32_i32$3 = var$1$hi;
+  i64toi32_i32$4 = var$1;
+  i64toi32_i32$3 = i64toi32_i32$2 ^ i64toi32_i32$3 | 0;
+  $14$hi = i64toi32_i32$3;
+  i64toi32_i32$3 = i64toi32_i32$2;
+  i64toi32_i32$3 = $14$hi;
+  i64toi32_i32$2 = i64toi32_i32$0 ^ i64toi32_i32$4 | 0;
+  i64toi32_i32$0 = var$2$hi;
+  i64toi32_i32$4 = var$2;
+  i64toi32_i32$1 = i64toi32_i32$2 >>> 0 < i64toi32_i32$4 >>> 0;
+  i64toi32_i32$2 = i64toi32_i32$2 - i64toi32_i32$4 | 0;
+  i64toi32_i32$0 = i64toi32_i32$1 + i64toi32_i32$0 | 0;
+  i64toi32_i32$0 = i64toi32_i32$3 - i64toi32_i32$0 | 0;
+  $16$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = $9$hi;
+  i64toi32_i32$3 = $16$hi;
+  i64toi32_i32$3 = __wasm_i64_udiv($9 | 0, i64toi32_i32$0 | 0, i64toi32_i32$2 | 0, i64toi32_i32$3 | 0) | 0;
+  i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
+  $17 = i64toi32_i32$3;
+  $17$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = var$1$hi;
+  i64toi32_i32$0 = var$0$hi;
+  i64toi32_i32$0 = var$1$hi;
+  i64toi32_i32$4 = var$1;
+  i64toi32_i32$3 = var$0$hi;
+  i64toi32_i32$1 = var$0;
+  i64toi32_i32$3 = i64toi32_i32$0 ^ i64toi32_i32$3 | 0;
+  i64toi32_i32$0 = i64toi32_i32$4 ^ i64toi32_i32$1 | 0;
+  i64toi32_i32$4 = 0;
+  i64toi32_i32$1 = 63;
+  i64toi32_i32$2 = i64toi32_i32$1 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$1 & 63 | 0) >>> 0) {
+   i64toi32_i32$4 = i64toi32_i32$3 >> 31 | 0;
+   $21 = i64toi32_i32$3 >> i64toi32_i32$2 | 0;
   } else {
-   i64toi32_i32$2 = i64toi32_i32$1 >> i64toi32_i32$5 | 0;
-   $23 = (((1 << i64toi32_i32$5 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$5 | 0) | 0 | (i64toi32_i32$4 >>> i64toi32_i32$5 | 0) | 0;
+   i64toi32_i32$4 = i64toi32_i32$3 >> i64toi32_i32$2 | 0;
+   $21 = (((1 << i64toi32_i32$2 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$2 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$2 | 0) | 0;
   }
-  var$0 = $23;
-  var$0$hi = i64toi32_i32$2;
-  i64toi32_i32$2 = $17$hi;
-  i64toi32_i32$1 = $17;
-  i64toi32_i32$4 = var$0$hi;
-  i64toi32_i32$3 = var$0;
-  i64toi32_i32$4 = i64toi32_i32$2 ^ i64toi32_i32$4 | 0;
-  $23$hi = i64toi32_i32$4;
-  i64toi32_i32$4 = var$0$hi;
-  i64toi32_i32$4 = $23$hi;
-  i64toi32_i32$2 = i64toi32_i32$1 ^ i64toi32_i32$3 | 0;
-  i64toi32_i32$1 = var$0$hi;
-  i64toi32_i32$5 = i64toi32_i32$2 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$2 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$0 = i64toi32_i32$6 + i64toi32_i32$1 | 0;
-  i64toi32_i32$0 = i64toi32_i32$4 - i64toi32_i32$0 | 0;
-  i64toi32_i32$2 = i64toi32_i32$5;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
-  return i64toi32_i32$2 | 0;
+  var$0 = $21;
+  var$0$hi = i64toi32_i32$4;
+  i64toi32_i32$4 = $17$hi;
+  i64toi32_i32$3 = $17;
+  i64toi32_i32$0 = var$0$hi;
+  i64toi32_i32$1 = var$0;
+  i64toi32_i32$0 = i64toi32_i32$4 ^ i64toi32_i32$0 | 0;
+  $23$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = var$0$hi;
+  i64toi32_i32$0 = $23$hi;
+  i64toi32_i32$4 = i64toi32_i32$3 ^ i64toi32_i32$1 | 0;
+  i64toi32_i32$3 = var$0$hi;
+  i64toi32_i32$2 = i64toi32_i32$4 >>> 0 < i64toi32_i32$1 >>> 0;
+  i64toi32_i32$4 = i64toi32_i32$4 - i64toi32_i32$1 | 0;
+  i64toi32_i32$3 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
+  i64toi32_i32$3 = i64toi32_i32$0 - i64toi32_i32$3 | 0;
+  i64toi32_i32$0 = i64toi32_i32$4;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$3;
+  return i64toi32_i32$0 | 0;
  }
  
  function _ZN17compiler_builtins3int4sdiv3Mod4mod_17h2cbb7bbf36e41d68E(var$0, var$0$hi, var$1, var$1$hi) {
@@ -1507,7 +1510,7 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$1 = 0, i64toi32_i32$4 = 0, i64toi32_i32$2 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, i64toi32_i32$5 = 0, var$2$hi = 0, i64toi32_i32$6 = 0, var$2 = 0, $20 = 0, $21 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17$hi = 0, $19$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, var$2$hi = 0, var$2 = 0, $18 = 0, $19 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17$hi = 0, $19$hi = 0;
   i64toi32_i32$0 = var$0$hi;
   i64toi32_i32$2 = var$0;
   i64toi32_i32$1 = 0;
@@ -1515,12 +1518,12 @@ function asmFunc(global, env, buffer) {
   i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
   if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
    i64toi32_i32$1 = i64toi32_i32$0 >> 31 | 0;
-   $20 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
+   $18 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
   } else {
    i64toi32_i32$1 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
-   $20 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+   $18 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
   }
-  var$2 = $20;
+  var$2 = $18;
   var$2$hi = i64toi32_i32$1;
   i64toi32_i32$1 = var$0$hi;
   i64toi32_i32$1 = var$2$hi;
@@ -1534,66 +1537,66 @@ function asmFunc(global, env, buffer) {
   i64toi32_i32$1 = i64toi32_i32$0 ^ i64toi32_i32$3 | 0;
   i64toi32_i32$0 = var$2$hi;
   i64toi32_i32$3 = var$2;
-  i64toi32_i32$4 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$5 = i64toi32_i32$6 + i64toi32_i32$0 | 0;
-  i64toi32_i32$5 = i64toi32_i32$2 - i64toi32_i32$5 | 0;
-  $9 = i64toi32_i32$4;
-  $9$hi = i64toi32_i32$5;
-  i64toi32_i32$5 = var$1$hi;
-  i64toi32_i32$2 = var$1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$0 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$5 >> 31 | 0;
-   $21 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
+  i64toi32_i32$4 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
+  i64toi32_i32$1 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
+  i64toi32_i32$0 = i64toi32_i32$4 + i64toi32_i32$0 | 0;
+  i64toi32_i32$0 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
+  $9 = i64toi32_i32$1;
+  $9$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = var$1$hi;
+  i64toi32_i32$3 = var$1;
+  i64toi32_i32$2 = 0;
+  i64toi32_i32$4 = 63;
+  i64toi32_i32$1 = i64toi32_i32$4 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$4 & 63 | 0) >>> 0) {
+   i64toi32_i32$2 = i64toi32_i32$0 >> 31 | 0;
+   $19 = i64toi32_i32$0 >> i64toi32_i32$1 | 0;
   } else {
-   i64toi32_i32$1 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
-   $21 = (((1 << i64toi32_i32$0 | 0) - 1 | 0) & i64toi32_i32$5 | 0) << (32 - i64toi32_i32$0 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$0 | 0) | 0;
+   i64toi32_i32$2 = i64toi32_i32$0 >> i64toi32_i32$1 | 0;
+   $19 = (((1 << i64toi32_i32$1 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$1 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$1 | 0) | 0;
   }
-  var$0 = $21;
-  var$0$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$1$hi;
-  i64toi32_i32$1 = var$0$hi;
-  i64toi32_i32$5 = var$0;
+  var$0 = $19;
+  var$0$hi = i64toi32_i32$2;
   i64toi32_i32$2 = var$1$hi;
-  i64toi32_i32$3 = var$1;
-  i64toi32_i32$2 = i64toi32_i32$1 ^ i64toi32_i32$2 | 0;
-  $14$hi = i64toi32_i32$2;
-  i64toi32_i32$2 = i64toi32_i32$1;
-  i64toi32_i32$2 = $14$hi;
-  i64toi32_i32$1 = i64toi32_i32$5 ^ i64toi32_i32$3 | 0;
-  i64toi32_i32$5 = var$0$hi;
-  i64toi32_i32$3 = var$0;
-  i64toi32_i32$0 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$4 = i64toi32_i32$6 + i64toi32_i32$5 | 0;
-  i64toi32_i32$4 = i64toi32_i32$2 - i64toi32_i32$4 | 0;
-  $16$hi = i64toi32_i32$4;
-  i64toi32_i32$4 = $9$hi;
-  i64toi32_i32$1 = $16$hi;
-  i64toi32_i32$1 = __wasm_i64_urem($9 | 0, i64toi32_i32$4 | 0, i64toi32_i32$0 | 0, i64toi32_i32$1 | 0) | 0;
-  i64toi32_i32$4 = i64toi32_i32$HIGH_BITS;
-  $17$hi = i64toi32_i32$4;
+  i64toi32_i32$2 = var$0$hi;
+  i64toi32_i32$0 = var$0;
+  i64toi32_i32$3 = var$1$hi;
+  i64toi32_i32$4 = var$1;
+  i64toi32_i32$3 = i64toi32_i32$2 ^ i64toi32_i32$3 | 0;
+  $14$hi = i64toi32_i32$3;
+  i64toi32_i32$3 = i64toi32_i32$2;
+  i64toi32_i32$3 = $14$hi;
+  i64toi32_i32$2 = i64toi32_i32$0 ^ i64toi32_i32$4 | 0;
+  i64toi32_i32$0 = var$0$hi;
+  i64toi32_i32$4 = var$0;
+  i64toi32_i32$1 = i64toi32_i32$2 >>> 0 < i64toi32_i32$4 >>> 0;
+  i64toi32_i32$2 = i64toi32_i32$2 - i64toi32_i32$4 | 0;
+  i64toi32_i32$0 = i64toi32_i32$1 + i64toi32_i32$0 | 0;
+  i64toi32_i32$0 = i64toi32_i32$3 - i64toi32_i32$0 | 0;
+  $16$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = $9$hi;
+  i64toi32_i32$3 = $16$hi;
+  i64toi32_i32$3 = __wasm_i64_urem($9 | 0, i64toi32_i32$0 | 0, i64toi32_i32$2 | 0, i64toi32_i32$3 | 0) | 0;
+  i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
+  $17$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = var$2$hi;
+  i64toi32_i32$0 = $17$hi;
+  i64toi32_i32$4 = i64toi32_i32$3;
+  i64toi32_i32$3 = var$2$hi;
+  i64toi32_i32$1 = var$2;
+  i64toi32_i32$3 = i64toi32_i32$0 ^ i64toi32_i32$3 | 0;
+  $19$hi = i64toi32_i32$3;
+  i64toi32_i32$3 = var$2$hi;
+  i64toi32_i32$3 = $19$hi;
+  i64toi32_i32$0 = i64toi32_i32$4 ^ i64toi32_i32$1 | 0;
   i64toi32_i32$4 = var$2$hi;
-  i64toi32_i32$4 = $17$hi;
-  i64toi32_i32$2 = i64toi32_i32$1;
-  i64toi32_i32$1 = var$2$hi;
-  i64toi32_i32$3 = var$2;
-  i64toi32_i32$1 = i64toi32_i32$4 ^ i64toi32_i32$1 | 0;
-  $19$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$2$hi;
-  i64toi32_i32$1 = $19$hi;
-  i64toi32_i32$4 = i64toi32_i32$2 ^ i64toi32_i32$3 | 0;
-  i64toi32_i32$2 = var$2$hi;
-  i64toi32_i32$5 = i64toi32_i32$4 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$4 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$0 = i64toi32_i32$6 + i64toi32_i32$2 | 0;
-  i64toi32_i32$0 = i64toi32_i32$1 - i64toi32_i32$0 | 0;
-  i64toi32_i32$4 = i64toi32_i32$5;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
-  return i64toi32_i32$4 | 0;
+  i64toi32_i32$2 = i64toi32_i32$0 >>> 0 < i64toi32_i32$1 >>> 0;
+  i64toi32_i32$0 = i64toi32_i32$0 - i64toi32_i32$1 | 0;
+  i64toi32_i32$4 = i64toi32_i32$2 + i64toi32_i32$4 | 0;
+  i64toi32_i32$4 = i64toi32_i32$3 - i64toi32_i32$4 | 0;
+  i64toi32_i32$3 = i64toi32_i32$0;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$4;
+  return i64toi32_i32$0 | 0;
  }
  
  function _ZN17compiler_builtins3int4udiv10divmod_u6417h6026910b5ed08e40E(var$0, var$0$hi, var$1, var$1$hi) {
@@ -1601,7 +1604,7 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$4 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, i64toi32_i32$6 = 0, $37_1 = 0, $38_1 = 0, $39_1 = 0, $40_1 = 0, $41_1 = 0, $42_1 = 0, $43_1 = 0, $44_1 = 0, var$8$hi = 0, $45_1 = 0, $46_1 = 0, $47_1 = 0, $48_1 = 0, var$7$hi = 0, $49_1 = 0, $63$hi = 0, $65_1 = 0, $65$hi = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142$hi = 0, $144 = 0, $144$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0;
+  var i64toi32_i32$4 = 0, i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, var$2 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, $35_1 = 0, $36_1 = 0, $37_1 = 0, $38_1 = 0, $39_1 = 0, $40_1 = 0, $41_1 = 0, $42_1 = 0, var$8$hi = 0, $43_1 = 0, $44_1 = 0, $45_1 = 0, $46_1 = 0, var$7$hi = 0, $47_1 = 0, $63$hi = 0, $65_1 = 0, $65$hi = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142$hi = 0, $144 = 0, $144$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0;
   label$1 : {
    label$2 : {
     label$3 : {
@@ -1620,12 +1623,12 @@ function asmFunc(global, env, buffer) {
              i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
              if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
               i64toi32_i32$1 = 0;
-              $37_1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
+              $35_1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
              } else {
               i64toi32_i32$1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-              $37_1 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+              $35_1 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
              }
-             var$2 = $37_1;
+             var$2 = $35_1;
              if (var$2) {
               block : {
                i64toi32_i32$1 = var$1$hi;
@@ -1640,12 +1643,12 @@ function asmFunc(global, env, buffer) {
                i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
                if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
                 i64toi32_i32$2 = 0;
-                $38_1 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
+                $36_1 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
                } else {
                 i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-                $38_1 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
+                $36_1 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
                }
-               var$4 = $38_1;
+               var$4 = $36_1;
                if (!var$4) {
                 break label$9
                }
@@ -1682,12 +1685,12 @@ function asmFunc(global, env, buffer) {
             i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
             if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
              i64toi32_i32$1 = 0;
-             $39_1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
+             $37_1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
             } else {
              i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-             $39_1 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
+             $37_1 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
             }
-            var$3 = $39_1;
+            var$3 = $37_1;
             i64toi32_i32$1 = var$0$hi;
             if (!var$0) {
              break label$7
@@ -1706,10 +1709,10 @@ function asmFunc(global, env, buffer) {
             i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
             if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
              i64toi32_i32$3 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-             $40_1 = 0;
+             $38_1 = 0;
             } else {
              i64toi32_i32$3 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-             $40_1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
+             $38_1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
             }
             $63$hi = i64toi32_i32$3;
             i64toi32_i32$3 = var$0$hi;
@@ -1720,7 +1723,7 @@ function asmFunc(global, env, buffer) {
             $65_1 = i64toi32_i32$1 & i64toi32_i32$0 | 0;
             $65$hi = i64toi32_i32$2;
             i64toi32_i32$2 = $63$hi;
-            i64toi32_i32$3 = $40_1;
+            i64toi32_i32$3 = $38_1;
             i64toi32_i32$1 = $65$hi;
             i64toi32_i32$0 = $65_1;
             i64toi32_i32$1 = i64toi32_i32$2 | i64toi32_i32$1 | 0;
@@ -1751,12 +1754,12 @@ function asmFunc(global, env, buffer) {
         i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
         if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
          i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-         $41_1 = 0;
+         $39_1 = 0;
         } else {
          i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $41_1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
+         $39_1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
         }
-        legalfunc$wasm2js_scratch_store_i64($41_1 | 0, i64toi32_i32$1 | 0);
+        legalfunc$wasm2js_scratch_store_i64($39_1 | 0, i64toi32_i32$1 | 0);
         i64toi32_i32$1 = 0;
         i64toi32_i32$2 = var$4;
         i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
@@ -1784,12 +1787,12 @@ function asmFunc(global, env, buffer) {
       i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
       if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
        i64toi32_i32$1 = 0;
-       $42_1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
+       $40_1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
       } else {
        i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-       $42_1 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
+       $40_1 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
       }
-      i64toi32_i32$3 = $42_1;
+      i64toi32_i32$3 = $40_1;
       i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
       return i64toi32_i32$3 | 0;
      }
@@ -1806,12 +1809,12 @@ function asmFunc(global, env, buffer) {
     i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
     if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
      i64toi32_i32$1 = 0;
-     $43_1 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
+     $41_1 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
     } else {
      i64toi32_i32$1 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
-     $43_1 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+     $41_1 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
     }
-    var$5 = $43_1;
+    var$5 = $41_1;
     var$5$hi = i64toi32_i32$1;
     i64toi32_i32$1 = var$0$hi;
     i64toi32_i32$1 = 0;
@@ -1823,12 +1826,12 @@ function asmFunc(global, env, buffer) {
     i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
     if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
      i64toi32_i32$2 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
-     $44_1 = 0;
+     $42_1 = 0;
     } else {
      i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$3 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-     $44_1 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
+     $42_1 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
     }
-    var$0 = $44_1;
+    var$0 = $42_1;
     var$0$hi = i64toi32_i32$2;
     label$13 : {
      if (var$2) {
@@ -1837,121 +1840,121 @@ function asmFunc(global, env, buffer) {
        i64toi32_i32$1 = var$1;
        i64toi32_i32$3 = -1;
        i64toi32_i32$0 = -1;
-       i64toi32_i32$4 = i64toi32_i32$1 + i64toi32_i32$0 | 0;
-       i64toi32_i32$5 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
-       if (i64toi32_i32$4 >>> 0 < i64toi32_i32$0 >>> 0) {
-        i64toi32_i32$5 = i64toi32_i32$5 + 1 | 0
+       i64toi32_i32$1 = i64toi32_i32$1 + i64toi32_i32$0 | 0;
+       i64toi32_i32$2 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
+       if (i64toi32_i32$1 >>> 0 < i64toi32_i32$0 >>> 0) {
+        i64toi32_i32$2 = i64toi32_i32$2 + 1 | 0
        }
-       var$8 = i64toi32_i32$4;
-       var$8$hi = i64toi32_i32$5;
+       var$8 = i64toi32_i32$1;
+       var$8$hi = i64toi32_i32$2;
        label$15 : while (1) {
-        i64toi32_i32$5 = var$5$hi;
-        i64toi32_i32$2 = var$5;
-        i64toi32_i32$1 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
-         $45_1 = 0;
+        i64toi32_i32$2 = var$5$hi;
+        i64toi32_i32$3 = var$5;
+        i64toi32_i32$0 = 0;
+        i64toi32_i32$1 = 1;
+        i64toi32_i32$4 = i64toi32_i32$1 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$1 & 63 | 0) >>> 0) {
+         i64toi32_i32$0 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
+         $43_1 = 0;
         } else {
-         i64toi32_i32$1 = ((1 << i64toi32_i32$3 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$3 | 0) | 0) | 0 | (i64toi32_i32$5 << i64toi32_i32$3 | 0) | 0;
-         $45_1 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
+         i64toi32_i32$0 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$3 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$2 << i64toi32_i32$4 | 0) | 0;
+         $43_1 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
         }
-        $140 = $45_1;
-        $140$hi = i64toi32_i32$1;
-        i64toi32_i32$1 = var$0$hi;
-        i64toi32_i32$5 = var$0;
-        i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 63;
-        i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = 0;
-         $46_1 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
+        $140 = $43_1;
+        $140$hi = i64toi32_i32$0;
+        i64toi32_i32$0 = var$0$hi;
+        i64toi32_i32$2 = var$0;
+        i64toi32_i32$3 = 0;
+        i64toi32_i32$1 = 63;
+        i64toi32_i32$4 = i64toi32_i32$1 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$1 & 63 | 0) >>> 0) {
+         i64toi32_i32$3 = 0;
+         $44_1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
         } else {
-         i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
-         $46_1 = (((1 << i64toi32_i32$3 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$3 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$3 | 0) | 0;
+         i64toi32_i32$3 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
+         $44_1 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
         }
-        $142$hi = i64toi32_i32$2;
-        i64toi32_i32$2 = $140$hi;
-        i64toi32_i32$1 = $140;
-        i64toi32_i32$5 = $142$hi;
-        i64toi32_i32$0 = $46_1;
-        i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
-        var$5 = i64toi32_i32$1 | i64toi32_i32$0 | 0;
-        var$5$hi = i64toi32_i32$5;
+        $142$hi = i64toi32_i32$3;
+        i64toi32_i32$3 = $140$hi;
+        i64toi32_i32$0 = $140;
+        i64toi32_i32$2 = $142$hi;
+        i64toi32_i32$1 = $44_1;
+        i64toi32_i32$2 = i64toi32_i32$3 | i64toi32_i32$2 | 0;
+        var$5 = i64toi32_i32$0 | i64toi32_i32$1 | 0;
+        var$5$hi = i64toi32_i32$2;
         $144 = var$5;
-        $144$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = var$8$hi;
-        i64toi32_i32$5 = var$5$hi;
-        i64toi32_i32$5 = var$8$hi;
-        i64toi32_i32$2 = var$8;
-        i64toi32_i32$1 = var$5$hi;
-        i64toi32_i32$0 = var$5;
-        i64toi32_i32$3 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
-        i64toi32_i32$6 = i64toi32_i32$2 >>> 0 < i64toi32_i32$0 >>> 0;
-        i64toi32_i32$4 = i64toi32_i32$6 + i64toi32_i32$1 | 0;
-        i64toi32_i32$4 = i64toi32_i32$5 - i64toi32_i32$4 | 0;
-        i64toi32_i32$5 = i64toi32_i32$3;
+        $144$hi = i64toi32_i32$2;
+        i64toi32_i32$2 = var$8$hi;
+        i64toi32_i32$2 = var$5$hi;
+        i64toi32_i32$2 = var$8$hi;
+        i64toi32_i32$3 = var$8;
+        i64toi32_i32$0 = var$5$hi;
+        i64toi32_i32$1 = var$5;
+        i64toi32_i32$4 = i64toi32_i32$3 >>> 0 < i64toi32_i32$1 >>> 0;
+        i64toi32_i32$3 = i64toi32_i32$3 - i64toi32_i32$1 | 0;
+        i64toi32_i32$0 = i64toi32_i32$4 + i64toi32_i32$0 | 0;
+        i64toi32_i32$0 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
+        i64toi32_i32$1 = i64toi32_i32$3;
         i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 63;
-        i64toi32_i32$1 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = i64toi32_i32$4 >> 31 | 0;
-         $47_1 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
+        i64toi32_i32$4 = 63;
+        i64toi32_i32$3 = i64toi32_i32$4 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$4 & 63 | 0) >>> 0) {
+         i64toi32_i32$2 = i64toi32_i32$0 >> 31 | 0;
+         $45_1 = i64toi32_i32$0 >> i64toi32_i32$3 | 0;
         } else {
-         i64toi32_i32$2 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
-         $47_1 = (((1 << i64toi32_i32$1 | 0) - 1 | 0) & i64toi32_i32$4 | 0) << (32 - i64toi32_i32$1 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$1 | 0) | 0;
+         i64toi32_i32$2 = i64toi32_i32$0 >> i64toi32_i32$3 | 0;
+         $45_1 = (((1 << i64toi32_i32$3 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$3 | 0) | 0 | (i64toi32_i32$1 >>> i64toi32_i32$3 | 0) | 0;
         }
-        var$6 = $47_1;
+        var$6 = $45_1;
         var$6$hi = i64toi32_i32$2;
         i64toi32_i32$2 = var$1$hi;
         i64toi32_i32$2 = var$6$hi;
-        i64toi32_i32$4 = var$6;
-        i64toi32_i32$5 = var$1$hi;
-        i64toi32_i32$0 = var$1;
-        i64toi32_i32$5 = i64toi32_i32$2 & i64toi32_i32$5 | 0;
-        $151 = i64toi32_i32$4 & i64toi32_i32$0 | 0;
-        $151$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = $144$hi;
+        i64toi32_i32$0 = var$6;
+        i64toi32_i32$1 = var$1$hi;
+        i64toi32_i32$4 = var$1;
+        i64toi32_i32$1 = i64toi32_i32$2 & i64toi32_i32$1 | 0;
+        $151 = i64toi32_i32$0 & i64toi32_i32$4 | 0;
+        $151$hi = i64toi32_i32$1;
+        i64toi32_i32$1 = $144$hi;
         i64toi32_i32$2 = $144;
-        i64toi32_i32$4 = $151$hi;
-        i64toi32_i32$0 = $151;
-        i64toi32_i32$1 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
-        i64toi32_i32$6 = i64toi32_i32$2 >>> 0 < i64toi32_i32$0 >>> 0;
-        i64toi32_i32$3 = i64toi32_i32$6 + i64toi32_i32$4 | 0;
-        i64toi32_i32$3 = i64toi32_i32$5 - i64toi32_i32$3 | 0;
-        var$5 = i64toi32_i32$1;
-        var$5$hi = i64toi32_i32$3;
-        i64toi32_i32$3 = var$0$hi;
-        i64toi32_i32$5 = var$0;
-        i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-         $48_1 = 0;
+        i64toi32_i32$0 = $151$hi;
+        i64toi32_i32$4 = $151;
+        i64toi32_i32$3 = i64toi32_i32$2 >>> 0 < i64toi32_i32$4 >>> 0;
+        i64toi32_i32$2 = i64toi32_i32$2 - i64toi32_i32$4 | 0;
+        i64toi32_i32$0 = i64toi32_i32$3 + i64toi32_i32$0 | 0;
+        i64toi32_i32$0 = i64toi32_i32$1 - i64toi32_i32$0 | 0;
+        var$5 = i64toi32_i32$2;
+        var$5$hi = i64toi32_i32$0;
+        i64toi32_i32$0 = var$0$hi;
+        i64toi32_i32$4 = var$0;
+        i64toi32_i32$1 = 0;
+        i64toi32_i32$3 = 1;
+        i64toi32_i32$2 = i64toi32_i32$3 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
+         i64toi32_i32$1 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
+         $46_1 = 0;
         } else {
-         i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $48_1 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
+         i64toi32_i32$1 = ((1 << i64toi32_i32$2 | 0) - 1 | 0) & (i64toi32_i32$4 >>> (32 - i64toi32_i32$2 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$2 | 0) | 0;
+         $46_1 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
         }
-        $154$hi = i64toi32_i32$2;
-        i64toi32_i32$2 = var$7$hi;
-        i64toi32_i32$2 = $154$hi;
-        i64toi32_i32$3 = $48_1;
-        i64toi32_i32$5 = var$7$hi;
-        i64toi32_i32$0 = var$7;
-        i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
-        var$0 = i64toi32_i32$3 | i64toi32_i32$0 | 0;
-        var$0$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = var$6$hi;
-        i64toi32_i32$2 = var$6;
-        i64toi32_i32$3 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$3 = i64toi32_i32$5 & i64toi32_i32$3 | 0;
-        var$6 = i64toi32_i32$2 & i64toi32_i32$0 | 0;
-        var$6$hi = i64toi32_i32$3;
+        $154$hi = i64toi32_i32$1;
+        i64toi32_i32$1 = var$7$hi;
+        i64toi32_i32$1 = $154$hi;
+        i64toi32_i32$0 = $46_1;
+        i64toi32_i32$4 = var$7$hi;
+        i64toi32_i32$3 = var$7;
+        i64toi32_i32$4 = i64toi32_i32$1 | i64toi32_i32$4 | 0;
+        var$0 = i64toi32_i32$0 | i64toi32_i32$3 | 0;
+        var$0$hi = i64toi32_i32$4;
+        i64toi32_i32$4 = var$6$hi;
+        i64toi32_i32$1 = var$6;
+        i64toi32_i32$0 = 0;
+        i64toi32_i32$3 = 1;
+        i64toi32_i32$0 = i64toi32_i32$4 & i64toi32_i32$0 | 0;
+        var$6 = i64toi32_i32$1 & i64toi32_i32$3 | 0;
+        var$6$hi = i64toi32_i32$0;
         var$7 = var$6;
-        var$7$hi = i64toi32_i32$3;
+        var$7$hi = i64toi32_i32$0;
         var$2 = var$2 + -1 | 0;
         if (var$2) {
          continue label$15
@@ -1962,41 +1965,41 @@ function asmFunc(global, env, buffer) {
       }
      }
     }
-    i64toi32_i32$3 = var$5$hi;
-    legalfunc$wasm2js_scratch_store_i64(var$5 | 0, i64toi32_i32$3 | 0);
-    i64toi32_i32$3 = var$0$hi;
-    i64toi32_i32$5 = var$0;
-    i64toi32_i32$2 = 0;
-    i64toi32_i32$0 = 1;
-    i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-    if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-     i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-     $49_1 = 0;
+    i64toi32_i32$0 = var$5$hi;
+    legalfunc$wasm2js_scratch_store_i64(var$5 | 0, i64toi32_i32$0 | 0);
+    i64toi32_i32$0 = var$0$hi;
+    i64toi32_i32$4 = var$0;
+    i64toi32_i32$1 = 0;
+    i64toi32_i32$3 = 1;
+    i64toi32_i32$2 = i64toi32_i32$3 & 31 | 0;
+    if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
+     i64toi32_i32$1 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
+     $47_1 = 0;
     } else {
-     i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-     $49_1 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
+     i64toi32_i32$1 = ((1 << i64toi32_i32$2 | 0) - 1 | 0) & (i64toi32_i32$4 >>> (32 - i64toi32_i32$2 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$2 | 0) | 0;
+     $47_1 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
     }
-    $165$hi = i64toi32_i32$2;
-    i64toi32_i32$2 = var$6$hi;
-    i64toi32_i32$2 = $165$hi;
-    i64toi32_i32$3 = $49_1;
-    i64toi32_i32$5 = var$6$hi;
-    i64toi32_i32$0 = var$6;
-    i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
-    i64toi32_i32$3 = i64toi32_i32$3 | i64toi32_i32$0 | 0;
-    i64toi32_i32$HIGH_BITS = i64toi32_i32$5;
-    return i64toi32_i32$3 | 0;
+    $165$hi = i64toi32_i32$1;
+    i64toi32_i32$1 = var$6$hi;
+    i64toi32_i32$1 = $165$hi;
+    i64toi32_i32$0 = $47_1;
+    i64toi32_i32$4 = var$6$hi;
+    i64toi32_i32$3 = var$6;
+    i64toi32_i32$4 = i64toi32_i32$1 | i64toi32_i32$4 | 0;
+    i64toi32_i32$0 = i64toi32_i32$0 | i64toi32_i32$3 | 0;
+    i64toi32_i32$HIGH_BITS = i64toi32_i32$4;
+    return i64toi32_i32$0 | 0;
    }
-   i64toi32_i32$3 = var$0$hi;
-   legalfunc$wasm2js_scratch_store_i64(var$0 | 0, i64toi32_i32$3 | 0);
-   i64toi32_i32$3 = 0;
+   i64toi32_i32$0 = var$0$hi;
+   legalfunc$wasm2js_scratch_store_i64(var$0 | 0, i64toi32_i32$0 | 0);
+   i64toi32_i32$0 = 0;
    var$0 = 0;
-   var$0$hi = i64toi32_i32$3;
+   var$0$hi = i64toi32_i32$0;
   }
-  i64toi32_i32$3 = var$0$hi;
-  i64toi32_i32$5 = var$0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$3;
-  return i64toi32_i32$5 | 0;
+  i64toi32_i32$0 = var$0$hi;
+  i64toi32_i32$4 = var$0;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
+  return i64toi32_i32$4 | 0;
  }
  
  function __wasm_i64_mul(var$0, var$0$hi, var$1, var$1$hi) {
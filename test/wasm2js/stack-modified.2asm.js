@@ -26,7 +26,7 @@ function asmFunc(global, env, buffer) {
  function $0(var$0, var$0$hi) {
   var$0 = var$0 | 0;
   var$0$hi = var$0$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, var$1$hi = 0, i64toi32_i32$5 = 0, var$1 = 0, var$2$hi = 0, i64toi32_i32$1 = 0, var$2 = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, var$1$hi = 0, var$1 = 0, var$2$hi = 0, i64toi32_i32$1 = 0, var$2 = 0, i64toi32_i32$4 = 0;
   i64toi32_i32$0 = var$0$hi;
   var$1 = var$0;
   var$1$hi = i64toi32_i32$0;
@@ -55,25 +55,27 @@ function asmFunc(global, env, buffer) {
       i64toi32_i32$3 = var$1;
       i64toi32_i32$0 = 0;
       i64toi32_i32$1 = 1;
-      i64toi32_i32$5 = (i64toi32_i32$3 >>> 0 < i64toi32_i32$1 >>> 0) + i64toi32_i32$0 | 0;
-      i64toi32_i32$5 = i64toi32_i32$2 - i64toi32_i32$5 | 0;
-      var$1 = i64toi32_i32$3 - i64toi32_i32$1 | 0;
-      var$1$hi = i64toi32_i32$5;
+      i64toi32_i32$4 = i64toi32_i32$3 >>> 0 < i64toi32_i32$1 >>> 0;
+      i64toi32_i32$3 = i64toi32_i32$3 - i64toi32_i32$1 | 0;
+      i64toi32_i32$0 = i64toi32_i32$4 + i64toi32_i32$0 | 0;
+      i64toi32_i32$0 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
+      var$1 = i64toi32_i32$3;
+      var$1$hi = i64toi32_i32$0;
      }
     }
     continue label$2;
    };
   }
-  i64toi32_i32$5 = var$2$hi;
-  i64toi32_i32$3 = var$2;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$5;
-  return i64toi32_i32$3 | 0;
+  i64toi32_i32$0 = var$2$hi;
+  i64toi32_i32$2 = var$2;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
+  return i64toi32_i32$2 | 0;
  }
  
  function $1(var$0, var$0$hi) {
   var$0 = var$0 | 0;
   var$0$hi = var$0$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, var$1$hi = 0, i64toi32_i32$5 = 0, var$1 = 0, var$2$hi = 0, i64toi32_i32$1 = 0, var$2 = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, var$1$hi = 0, var$1 = 0, var$2$hi = 0, i64toi32_i32$1 = 0, var$2 = 0, i64toi32_i32$4 = 0;
   i64toi32_i32$0 = var$0$hi;
   var$1 = var$0;
   var$1$hi = i64toi32_i32$0;
@@ -102,25 +104,27 @@ function asmFunc(global, env, buffer) {
       i64toi32_i32$3 = var$1;
       i64toi32_i32$0 = 0;
       i64toi32_i32$1 = 1;
-      i64toi32_i32$5 = (i64toi32_i32$3 >>> 0 < i64toi32_i32$1 >>> 0) + i64toi32_i32$0 | 0;
-      i64toi32_i32$5 = i64toi32_i32$2 - i64toi32_i32$5 | 0;
-      var$1 = i64toi32_i32$3 - i64toi32_i32$1 | 0;
-      var$1$hi = i64toi32_i32$5;
+      i64toi32_i32$4 = i64toi32_i32$3 >>> 0 < i64toi32_i32$1 >>> 0;
+      i64toi32_i32$3 = i64toi32_i32$3 - i64toi32_i32$1 | 0;
+      i64toi32_i32$0 = i64toi32_i32$4 + i64toi32_i32$0 | 0;
+      i64toi32_i32$0 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
+      var$1 = i64toi32_i32$3;
+      var$1$hi = i64toi32_i32$0;
      }
     }
     continue label$2;
    };
   }
-  i64toi32_i32$5 = var$2$hi;
-  i64toi32_i32$3 = var$2;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$5;
-  return i64toi32_i32$3 | 0;
+  i64toi32_i32$0 = var$2$hi;
+  i64toi32_i32$2 = var$2;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
+  return i64toi32_i32$2 | 0;
  }
  
  function $2(var$0, var$0$hi) {
   var$0 = var$0 | 0;
   var$0$hi = var$0$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, var$1$hi = 0, i64toi32_i32$5 = 0, var$1 = 0, var$2$hi = 0, i64toi32_i32$1 = 0, var$2 = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, var$1$hi = 0, var$1 = 0, var$2$hi = 0, i64toi32_i32$1 = 0, var$2 = 0, i64toi32_i32$4 = 0;
   i64toi32_i32$0 = var$0$hi;
   var$1 = var$0;
   var$1$hi = i64toi32_i32$0;
@@ -149,25 +153,27 @@ function asmFunc(global, env, buffer) {
       i64toi32_i32$3 = var$1;
       i64toi32_i32$0 = 0;
       i64toi32_i32$1 = 1;
-      i64toi32_i32$5 = (i64toi32_i32$3 >>> 0 < i64toi32_i32$1 >>> 0) + i64toi32_i32$0 | 0;
-      i64toi32_i32$5 = i64toi32_i32$2 - i64toi32_i32$5 | 0;
-      var$1 = i64toi32_i32$3 - i64toi32_i32$1 | 0;
-      var$1$hi = i64toi32_i32$5;
+      i64toi32_i32$4 = i64toi32_i32$3 >>> 0 < i64toi32_i32$1 >>> 0;
+      i64toi32_i32$3 = i64toi32_i32$3 - i64toi32_i32$1 | 0;
+      i64toi32_i32$0 = i64toi32_i32$4 + i64toi32_i32$0 | 0;
+      i64toi32_i32$0 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
+      var$1 = i64toi32_i32$3;
+      var$1$hi = i64toi32_i32$0;
      }
     }
     continue label$2;
    };
   }
-  i64toi32_i32$5 = var$2$hi;
-  i64toi32_i32$3 = var$2;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$5;
-  return i64toi32_i32$3 | 0;
+  i64toi32_i32$0 = var$2$hi;
+  i64toi32_i32$2 = var$2;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
+  return i64toi32_i32$2 | 0;
  }
  
  function $3(var$0, var$0$hi) {
   var$0 = var$0 | 0;
   var$0$hi = var$0$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, var$1$hi = 0, i64toi32_i32$5 = 0, var$1 = 0, var$2$hi = 0, i64toi32_i32$1 = 0, var$2 = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, var$1$hi = 0, var$1 = 0, var$2$hi = 0, i64toi32_i32$1 = 0, var$2 = 0, i64toi32_i32$4 = 0;
   i64toi32_i32$0 = var$0$hi;
   var$1 = var$0;
   var$1$hi = i64toi32_i32$0;
@@ -196,25 +202,27 @@ function asmFunc(global, env, buffer) {
       i64toi32_i32$3 = var$1;
       i64toi32_i32$0 = 0;
       i64toi32_i32$1 = 1;
-      i64toi32_i32$5 = (i64toi32_i32$3 >>> 0 < i64toi32_i32$1 >>> 0) + i64toi32_i32$0 | 0;
-      i64toi32_i32$5 = i64toi32_i32$2 - i64toi32_i32$5 | 0;
-      var$1 = i64toi32_i32$3 - i64toi32_i32$1 | 0;
-      var$1$hi = i64toi32_i32$5;
+      i64toi32_i32$4 = i64toi32_i32$3 >>> 0 < i64toi32_i32$1 >>> 0;
+      i64toi32_i32$3 = i64toi32_i32$3 - i64toi32_i32$1 | 0;
+      i64toi32_i32$0 = i64toi32_i32$4 + i64toi32_i32$0 | 0;
+      i64toi32_i32$0 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
+      var$1 = i64toi32_i32$3;
+      var$1$hi = i64toi32_i32$0;
      }
     }
     continue label$2;
    };
   }
-  i64toi32_i32$5 = var$2$hi;
-  i64toi32_i32$3 = var$2;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$5;
-  return i64toi32_i32$3 | 0;
+  i64toi32_i32$0 = var$2$hi;
+  i64toi32_i32$2 = var$2;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
+  return i64toi32_i32$2 | 0;
  }
  
  function $4(var$0, var$0$hi) {
   var$0 = var$0 | 0;
   var$0$hi = var$0$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, var$1$hi = 0, i64toi32_i32$5 = 0, var$1 = 0, var$2$hi = 0, i64toi32_i32$1 = 0, var$2 = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, var$1$hi = 0, var$1 = 0, var$2$hi = 0, i64toi32_i32$1 = 0, var$2 = 0, i64toi32_i32$4 = 0;
   i64toi32_i32$0 = var$0$hi;
   var$1 = var$0;
   var$1$hi = i64toi32_i32$0;
@@ -243,19 +251,21 @@ function asmFunc(global, env, buffer) {
       i64toi32_i32$3 = var$1;
       i64toi32_i32$0 = 0;
       i64toi32_i32$1 = 1;
-      i64toi32_i32$5 = (i64toi32_i32$3 >>> 0 < i64toi32_i32$1 >>> 0) + i64toi32_i32$0 | 0;
-      i64toi32_i32$5 = i64toi32_i32$2 - i64toi32_i32$5 | 0;
-      var$1 = i64toi32_i32$3 - i64toi32_i32$1 | 0;
-      var$1$hi = i64toi32_i32$5;
+      i64toi32_i32$4 = i64toi32_i32$3 >>> 0 < i64toi32_i32$1 >>> 0;
+      i64toi32_i32$3 = i64toi32_i32$3 - i64toi32_i32$1 | 0;
+      i64toi32_i32$0 = i64toi32_i32$4 + i64toi32_i32$0 | 0;
+      i64toi32_i32$0 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
+      var$1 = i64toi32_i32$3;
+      var$1$hi = i64toi32_i32$0;
      }
     }
     continue label$2;
    };
   }
-  i64toi32_i32$5 = var$2$hi;
-  i64toi32_i32$3 = var$2;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$5;
-  return i64toi32_i32$3 | 0;
+  i64toi32_i32$0 = var$2$hi;
+  i64toi32_i32$2 = var$2;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
+  return i64toi32_i32$2 | 0;
  }
  
  function legalstub$0($0_1, $1_1) {
@@ -199,7 +199,7 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$2$hi = 0, i64toi32_i32$6 = 0, $21 = 0, $22 = 0, $23 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17 = 0, $17$hi = 0, $23$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$4 = 0, var$2 = 0, var$2$hi = 0, $19 = 0, $20 = 0, $21 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17 = 0, $17$hi = 0, $23$hi = 0;
   i64toi32_i32$0 = var$0$hi;
   i64toi32_i32$2 = var$0;
   i64toi32_i32$1 = 0;
@@ -207,12 +207,12 @@ function asmFunc(global, env, buffer) {
   i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
   if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
    i64toi32_i32$1 = i64toi32_i32$0 >> 31 | 0;
-   $21 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
+   $19 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
   } else {
    i64toi32_i32$1 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
-   $21 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+   $19 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
   }
-  var$2 = $21;
+  var$2 = $19;
   var$2$hi = i64toi32_i32$1;
   i64toi32_i32$1 = var$0$hi;
   i64toi32_i32$1 = var$2$hi;
@@ -226,86 +226,86 @@ function asmFunc(global, env, buffer) {
   i64toi32_i32$1 = i64toi32_i32$0 ^ i64toi32_i32$3 | 0;
   i64toi32_i32$0 = var$2$hi;
   i64toi32_i32$3 = var$2;
-  i64toi32_i32$4 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$5 = i64toi32_i32$6 + i64toi32_i32$0 | 0;
-  i64toi32_i32$5 = i64toi32_i32$2 - i64toi32_i32$5 | 0;
-  $9 = i64toi32_i32$4;
-  $9$hi = i64toi32_i32$5;
-  i64toi32_i32$5 = var$1$hi;
-  i64toi32_i32$2 = var$1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$0 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$5 >> 31 | 0;
-   $22 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
+  i64toi32_i32$4 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
+  i64toi32_i32$1 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
+  i64toi32_i32$0 = i64toi32_i32$4 + i64toi32_i32$0 | 0;
+  i64toi32_i32$0 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
+  $9 = i64toi32_i32$1;
+  $9$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = var$1$hi;
+  i64toi32_i32$3 = var$1;
+  i64toi32_i32$2 = 0;
+  i64toi32_i32$4 = 63;
+  i64toi32_i32$1 = i64toi32_i32$4 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$4 & 63 | 0) >>> 0) {
+   i64toi32_i32$2 = i64toi32_i32$0 >> 31 | 0;
+   $20 = i64toi32_i32$0 >> i64toi32_i32$1 | 0;
   } else {
-   i64toi32_i32$1 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
-   $22 = (((1 << i64toi32_i32$0 | 0) - 1 | 0) & i64toi32_i32$5 | 0) << (32 - i64toi32_i32$0 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$0 | 0) | 0;
+   i64toi32_i32$2 = i64toi32_i32$0 >> i64toi32_i32$1 | 0;
+   $20 = (((1 << i64toi32_i32$1 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$1 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$1 | 0) | 0;
   }
-  var$2 = $22;
-  var$2$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$1$hi;
-  i64toi32_i32$1 = var$2$hi;
-  i64toi32_i32$5 = var$2;
+  var$2 = $20;
+  var$2$hi = i64toi32_i32$2;
   i64toi32_i32$2 = var$1$hi;
-  i64toi32_i32$3 = var$1;
-  i64toi32_i32$2 = i64toi32_i32$1 ^ i64toi32_i32$2 | 0;
-  $14$hi = i64toi32_i32$2;
-  i64toi32_i32$2 = i64toi32_i32$1;
-  i64toi32_i32$2 = $14$hi;
-  i64toi32_i32$1 = i64toi32_i32$5 ^ i64toi32_i32$3 | 0;
-  i64toi32_i32$5 = var$2$hi;
-  i64toi32_i32$3 = var$2;
-  i64toi32_i32$0 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$4 = i64toi32_i32$6 + i64toi32_i32$5 | 0;
-  i64toi32_i32$4 = i64toi32_i32$2 - i64toi32_i32$4 | 0;
-  $16$hi = i64toi32_i32$4;
-  i64toi32_i32$4 = $9$hi;
-  i64toi32_i32$1 = $16$hi;
-  i64toi32_i32$1 = __wasm_i64_udiv($9 | 0, i64toi32_i32$4 | 0, i64toi32_i32$0 | 0, i64toi32_i32$1 | 0) | 0;
-  i64toi32_i32$4 = i64toi32_i32$HIGH_BITS;
-  $17 = i64toi32_i32$1;
-  $17$hi = i64toi32_i32$4;
-  i64toi32_i32$4 = var$1$hi;
-  i64toi32_i32$4 = var$0$hi;
-  i64toi32_i32$4 = var$1$hi;
-  i64toi32_i32$2 = var$1;
-  i64toi32_i32$1 = var$0$hi;
-  i64toi32_i32$3 = var$0;
-  i64toi32_i32$1 = i64toi32_i32$4 ^ i64toi32_i32$1 | 0;
-  i64toi32_i32$4 = i64toi32_i32$2 ^ i64toi32_i32$3 | 0;
-  i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$5 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = i64toi32_i32$1 >> 31 | 0;
-   $23 = i64toi32_i32$1 >> i64toi32_i32$5 | 0;
+  i64toi32_i32$2 = var$2$hi;
+  i64toi32_i32$0 = var$2;
+  i64toi32_i32$3 = var$1$hi;
+  i64toi32_i32$4 = var$1;
+  i64toi32_i32$3 = i64toi32_i32$2 ^ i64toi32_i32$3 | 0;
+  $14$hi = i64toi32_i32$3;
+  i64toi32_i32$3 = i64toi32_i32$2;
+  i64toi32_i32$3 = $14$hi;
+  i64toi32_i32$2 = i64toi32_i32$0 ^ i64toi32_i32$4 | 0;
+  i64toi32_i32$0 = var$2$hi;
+  i64toi32_i32$4 = var$2;
+  i64toi32_i32$1 = i64toi32_i32$2 >>> 0 < i64toi32_i32$4 >>> 0;
+  i64toi32_i32$2 = i64toi32_i32$2 - i64toi32_i32$4 | 0;
+  i64toi32_i32$0 = i64toi32_i32$1 + i64toi32_i32$0 | 0;
+  i64toi32_i32$0 = i64toi32_i32$3 - i64toi32_i32$0 | 0;
+  $16$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = $9$hi;
+  i64toi32_i32$3 = $16$hi;
+  i64toi32_i32$3 = __wasm_i64_udiv($9 | 0, i64toi32_i32$0 | 0, i64toi32_i32$2 | 0, i64toi32_i32$3 | 0) | 0;
+  i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
+  $17 = i64toi32_i32$3;
+  $17$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = var$1$hi;
+  i64toi32_i32$0 = var$0$hi;
+  i64toi32_i32$0 = var$1$hi;
+  i64toi32_i32$4 = var$1;
+  i64toi32_i32$3 = var$0$hi;
+  i64toi32_i32$1 = var$0;
+  i64toi32_i32$3 = i64toi32_i32$0 ^ i64toi32_i32$3 | 0;
+  i64toi32_i32$0 = i64toi32_i32$4 ^ i64toi32_i32$1 | 0;
+  i64toi32_i32$4 = 0;
+  i64toi32_i32$1 = 63;
+  i64toi32_i32$2 = i64toi32_i32$1 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$1 & 63 | 0) >>> 0) {
+   i64toi32_i32$4 = i64toi32_i32$3 >> 31 | 0;
+   $21 = i64toi32_i32$3 >> i64toi32_i32$2 | 0;
   } else {
-   i64toi32_i32$2 = i64toi32_i32$1 >> i64toi32_i32$5 | 0;
-   $23 = (((1 << i64toi32_i32$5 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$5 | 0) | 0 | (i64toi32_i32$4 >>> i64toi32_i32$5 | 0) | 0;
+   i64toi32_i32$4 = i64toi32_i32$3 >> i64toi32_i32$2 | 0;
+   $21 = (((1 << i64toi32_i32$2 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$2 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$2 | 0) | 0;
   }
-  var$0 = $23;
-  var$0$hi = i64toi32_i32$2;
-  i64toi32_i32$2 = $17$hi;
-  i64toi32_i32$1 = $17;
-  i64toi32_i32$4 = var$0$hi;
-  i64toi32_i32$3 = var$0;
-  i64toi32_i32$4 = i64toi32_i32$2 ^ i64toi32_i32$4 | 0;
-  $23$hi = i64toi32_i32$4;
-  i64toi32_i32$4 = var$0$hi;
-  i64toi32_i32$4 = $23$hi;
-  i64toi32_i32$2 = i64toi32_i32$1 ^ i64toi32_i32$3 | 0;
-  i64toi32_i32$1 = var$0$hi;
-  i64toi32_i32$5 = i64toi32_i32$2 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$2 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$0 = i64toi32_i32$6 + i64toi32_i32$1 | 0;
-  i64toi32_i32$0 = i64toi32_i32$4 - i64toi32_i32$0 | 0;
-  i64toi32_i32$2 = i64toi32_i32$5;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
-  return i64toi32_i32$2 | 0;
+  var$0 = $21;
+  var$0$hi = i64toi32_i32$4;
+  i64toi32_i32$4 = $17$hi;
+  i64toi32_i32$3 = $17;
+  i64toi32_i32$0 = var$0$hi;
+  i64toi32_i32$1 = var$0;
+  i64toi32_i32$0 = i64toi32_i32$4 ^ i64toi32_i32$0 | 0;
+  $23$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = var$0$hi;
+  i64toi32_i32$0 = $23$hi;
+  i64toi32_i32$4 = i64toi32_i32$3 ^ i64toi32_i32$1 | 0;
+  i64toi32_i32$3 = var$0$hi;
+  i64toi32_i32$2 = i64toi32_i32$4 >>> 0 < i64toi32_i32$1 >>> 0;
+  i64toi32_i32$4 = i64toi32_i32$4 - i64toi32_i32$1 | 0;
+  i64toi32_i32$3 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
+  i64toi32_i32$3 = i64toi32_i32$0 - i64toi32_i32$3 | 0;
+  i64toi32_i32$0 = i64toi32_i32$4;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$3;
+  return i64toi32_i32$0 | 0;
  }
  
  function _ZN17compiler_builtins3int4udiv10divmod_u6417h6026910b5ed08e40E(var$0, var$0$hi, var$1, var$1$hi) {
@@ -313,7 +313,7 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$4 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, i64toi32_i32$6 = 0, $37 = 0, $38 = 0, $39 = 0, $40 = 0, $41 = 0, $42 = 0, $43 = 0, $44 = 0, var$8$hi = 0, $45 = 0, $46 = 0, $47 = 0, $48 = 0, var$7$hi = 0, $49 = 0, $63$hi = 0, $65 = 0, $65$hi = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142$hi = 0, $144 = 0, $144$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0;
+  var i64toi32_i32$4 = 0, i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, var$2 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, $35 = 0, $36 = 0, $37 = 0, $38 = 0, $39 = 0, $40 = 0, $41 = 0, $42 = 0, var$8$hi = 0, $43 = 0, $44 = 0, $45 = 0, $46 = 0, var$7$hi = 0, $47 = 0, $63$hi = 0, $65 = 0, $65$hi = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142$hi = 0, $144 = 0, $144$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0;
   label$1 : {
    label$2 : {
     label$3 : {
@@ -332,12 +332,12 @@ function asmFunc(global, env, buffer) {
              i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
              if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
               i64toi32_i32$1 = 0;
-              $37 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
+              $35 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
              } else {
               i64toi32_i32$1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-              $37 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+              $35 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
              }
-             var$2 = $37;
+             var$2 = $35;
              if (var$2) {
               block : {
                i64toi32_i32$1 = var$1$hi;
@@ -352,12 +352,12 @@ function asmFunc(global, env, buffer) {
                i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
                if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
                 i64toi32_i32$2 = 0;
-                $38 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
+                $36 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
                } else {
                 i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-                $38 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
+                $36 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
                }
-               var$4 = $38;
+               var$4 = $36;
                if (!var$4) {
                 break label$9
                }
@@ -394,12 +394,12 @@ function asmFunc(global, env, buffer) {
             i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
             if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
              i64toi32_i32$1 = 0;
-             $39 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
+             $37 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
             } else {
              i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-             $39 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
+             $37 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
             }
-            var$3 = $39;
+            var$3 = $37;
             i64toi32_i32$1 = var$0$hi;
             if (!var$0) {
              break label$7
@@ -418,10 +418,10 @@ function asmFunc(global, env, buffer) {
             i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
             if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
              i64toi32_i32$3 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-             $40 = 0;
+             $38 = 0;
             } else {
              i64toi32_i32$3 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-             $40 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
+             $38 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
             }
             $63$hi = i64toi32_i32$3;
             i64toi32_i32$3 = var$0$hi;
@@ -432,7 +432,7 @@ function asmFunc(global, env, buffer) {
             $65 = i64toi32_i32$1 & i64toi32_i32$0 | 0;
             $65$hi = i64toi32_i32$2;
             i64toi32_i32$2 = $63$hi;
-            i64toi32_i32$3 = $40;
+            i64toi32_i32$3 = $38;
             i64toi32_i32$1 = $65$hi;
             i64toi32_i32$0 = $65;
             i64toi32_i32$1 = i64toi32_i32$2 | i64toi32_i32$1 | 0;
@@ -463,12 +463,12 @@ function asmFunc(global, env, buffer) {
         i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
         if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
          i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-         $41 = 0;
+         $39 = 0;
         } else {
          i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $41 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
+         $39 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
         }
-        legalfunc$wasm2js_scratch_store_i64($41 | 0, i64toi32_i32$1 | 0);
+        legalfunc$wasm2js_scratch_store_i64($39 | 0, i64toi32_i32$1 | 0);
         i64toi32_i32$1 = 0;
         i64toi32_i32$2 = var$4;
         i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
@@ -496,12 +496,12 @@ function asmFunc(global, env, buffer) {
       i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
       if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
        i64toi32_i32$1 = 0;
-       $42 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
+       $40 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
       } else {
        i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-       $42 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
+       $40 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
       }
-      i64toi32_i32$3 = $42;
+      i64toi32_i32$3 = $40;
       i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
       return i64toi32_i32$3 | 0;
      }
@@ -518,12 +518,12 @@ function asmFunc(global, env, buffer) {
     i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
     if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
      i64toi32_i32$1 = 0;
-     $43 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
+     $41 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
     } else {
      i64toi32_i32$1 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
-     $43 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+     $41 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
     }
-    var$5 = $43;
+    var$5 = $41;
     var$5$hi = i64toi32_i32$1;
     i64toi32_i32$1 = var$0$hi;
     i64toi32_i32$1 = 0;
@@ -535,12 +535,12 @@ function asmFunc(global, env, buffer) {
     i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
     if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
      i64toi32_i32$2 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
-     $44 = 0;
+     $42 = 0;
     } else {
      i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$3 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-     $44 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
+     $42 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
     }
-    var$0 = $44;
+    var$0 = $42;
     var$0$hi = i64toi32_i32$2;
     label$13 : {
      if (var$2) {
@@ -549,121 +549,121 @@ function asmFunc(global, env, buffer) {
        i64toi32_i32$1 = var$1;
        i64toi32_i32$3 = -1;
        i64toi32_i32$0 = -1;
-       i64toi32_i32$4 = i64toi32_i32$1 + i64toi32_i32$0 | 0;
-       i64toi32_i32$5 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
-       if (i64toi32_i32$4 >>> 0 < i64toi32_i32$0 >>> 0) {
-        i64toi32_i32$5 = i64toi32_i32$5 + 1 | 0
+       i64toi32_i32$1 = i64toi32_i32$1 + i64toi32_i32$0 | 0;
+       i64toi32_i32$2 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
+       if (i64toi32_i32$1 >>> 0 < i64toi32_i32$0 >>> 0) {
+        i64toi32_i32$2 = i64toi32_i32$2 + 1 | 0
        }
-       var$8 = i64toi32_i32$4;
-       var$8$hi = i64toi32_i32$5;
+       var$8 = i64toi32_i32$1;
+       var$8$hi = i64toi32_i32$2;
        label$15 : while (1) {
-        i64toi32_i32$5 = var$5$hi;
-        i64toi32_i32$2 = var$5;
-        i64toi32_i32$1 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
-         $45 = 0;
+        i64toi32_i32$2 = var$5$hi;
+        i64toi32_i32$3 = var$5;
+        i64toi32_i32$0 = 0;
+        i64toi32_i32$1 = 1;
+        i64toi32_i32$4 = i64toi32_i32$1 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$1 & 63 | 0) >>> 0) {
+         i64toi32_i32$0 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
+         $43 = 0;
         } else {
-         i64toi32_i32$1 = ((1 << i64toi32_i32$3 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$3 | 0) | 0) | 0 | (i64toi32_i32$5 << i64toi32_i32$3 | 0) | 0;
-         $45 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
+         i64toi32_i32$0 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$3 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$2 << i64toi32_i32$4 | 0) | 0;
+         $43 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
         }
-        $140 = $45;
-        $140$hi = i64toi32_i32$1;
-        i64toi32_i32$1 = var$0$hi;
-        i64toi32_i32$5 = var$0;
-        i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 63;
-        i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = 0;
-         $46 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
+        $140 = $43;
+        $140$hi = i64toi32_i32$0;
+        i64toi32_i32$0 = var$0$hi;
+        i64toi32_i32$2 = var$0;
+        i64toi32_i32$3 = 0;
+        i64toi32_i32$1 = 63;
+        i64toi32_i32$4 = i64toi32_i32$1 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$1 & 63 | 0) >>> 0) {
+         i64toi32_i32$3 = 0;
+         $44 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
         } else {
-         i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
-         $46 = (((1 << i64toi32_i32$3 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$3 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$3 | 0) | 0;
+         i64toi32_i32$3 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
+         $44 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
         }
-        $142$hi = i64toi32_i32$2;
-        i64toi32_i32$2 = $140$hi;
-        i64toi32_i32$1 = $140;
-        i64toi32_i32$5 = $142$hi;
-        i64toi32_i32$0 = $46;
-        i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
-        var$5 = i64toi32_i32$1 | i64toi32_i32$0 | 0;
-        var$5$hi = i64toi32_i32$5;
+        $142$hi = i64toi32_i32$3;
+        i64toi32_i32$3 = $140$hi;
+        i64toi32_i32$0 = $140;
+        i64toi32_i32$2 = $142$hi;
+        i64toi32_i32$1 = $44;
+        i64toi32_i32$2 = i64toi32_i32$3 | i64toi32_i32$2 | 0;
+        var$5 = i64toi32_i32$0 | i64toi32_i32$1 | 0;
+        var$5$hi = i64toi32_i32$2;
         $144 = var$5;
-        $144$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = var$8$hi;
-        i64toi32_i32$5 = var$5$hi;
-        i64toi32_i32$5 = var$8$hi;
-        i64toi32_i32$2 = var$8;
-        i64toi32_i32$1 = var$5$hi;
-        i64toi32_i32$0 = var$5;
-        i64toi32_i32$3 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
-        i64toi32_i32$6 = i64toi32_i32$2 >>> 0 < i64toi32_i32$0 >>> 0;
-        i64toi32_i32$4 = i64toi32_i32$6 + i64toi32_i32$1 | 0;
-        i64toi32_i32$4 = i64toi32_i32$5 - i64toi32_i32$4 | 0;
-        i64toi32_i32$5 = i64toi32_i32$3;
+        $144$hi = i64toi32_i32$2;
+        i64toi32_i32$2 = var$8$hi;
+        i64toi32_i32$2 = var$5$hi;
+        i64toi32_i32$2 = var$8$hi;
+        i64toi32_i32$3 = var$8;
+        i64toi32_i32$0 = var$5$hi;
+        i64toi32_i32$1 = var$5;
+        i64toi32_i32$4 = i64toi32_i32$3 >>> 0 < i64toi32_i32$1 >>> 0;
+        i64toi32_i32$3 = i64toi32_i32$3 - i64toi32_i32$1 | 0;
+        i64toi32_i32$0 = i64toi32_i32$4 + i64toi32_i32$0 | 0;
+        i64toi32_i32$0 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
+        i64toi32_i32$1 = i64toi32_i32$3;
         i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 63;
-        i64toi32_i32$1 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = i64toi32_i32$4 >> 31 | 0;
-         $47 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
+        i64toi32_i32$4 = 63;
+        i64toi32_i32$3 = i64toi32_i32$4 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$4 & 63 | 0) >>> 0) {
+         i64toi32_i32$2 = i64toi32_i32$0 >> 31 | 0;
+         $45 = i64toi32_i32$0 >> i64toi32_i32$3 | 0;
         } else {
-         i64toi32_i32$2 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
-         $47 = (((1 << i64toi32_i32$1 | 0) - 1 | 0) & i64toi32_i32$4 | 0) << (32 - i64toi32_i32$1 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$1 | 0) | 0;
+         i64toi32_i32$2 = i64toi32_i32$0 >> i64toi32_i32$3 | 0;
+         $45 = (((1 << i64toi32_i32$3 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$3 | 0) | 0 | (i64toi32_i32$1 >>> i64toi32_i32$3 | 0) | 0;
         }
-        var$6 = $47;
+        var$6 = $45;
         var$6$hi = i64toi32_i32$2;
         i64toi32_i32$2 = var$1$hi;
         i64toi32_i32$2 = var$6$hi;
-        i64toi32_i32$4 = var$6;
-        i64toi32_i32$5 = var$1$hi;
-        i64toi32_i32$0 = var$1;
-        i64toi32_i32$5 = i64toi32_i32$2 & i64toi32_i32$5 | 0;
-        $151 = i64toi32_i32$4 & i64toi32_i32$0 | 0;
-        $151$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = $144$hi;
+        i64toi32_i32$0 = var$6;
+        i64toi32_i32$1 = var$1$hi;
+        i64toi32_i32$4 = var$1;
+        i64toi32_i32$1 = i64toi32_i32$2 & i64toi32_i32$1 | 0;
+        $151 = i64toi32_i32$0 & i64toi32_i32$4 | 0;
+        $151$hi = i64toi32_i32$1;
+        i64toi32_i32$1 = $144$hi;
         i64toi32_i32$2 = $144;
-        i64toi32_i32$4 = $151$hi;
-        i64toi32_i32$0 = $151;
-        i64toi32_i32$1 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
-        i64toi32_i32$6 = i64toi32_i32$2 >>> 0 < i64toi32_i32$0 >>> 0;
-        i64toi32_i32$3 = i64toi32_i32$6 + i64toi32_i32$4 | 0;
-        i64toi32_i32$3 = i64toi32_i32$5 - i64toi32_i32$3 | 0;
-        var$5 = i64toi32_i32$1;
-        var$5$hi = i64toi32_i32$3;
-        i64toi32_i32$3 = var$0$hi;
-        i64toi32_i32$5 = var$0;
-        i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-         $48 = 0;
+        i64toi32_i32$0 = $151$hi;
+        i64toi32_i32$4 = $151;
+        i64toi32_i32$3 = i64toi32_i32$2 >>> 0 < i64toi32_i32$4 >>> 0;
+        i64toi32_i32$2 = i64toi32_i32$2 - i64toi32_i32$4 | 0;
+        i64toi32_i32$0 = i64toi32_i32$3 + i64toi32_i32$0 | 0;
+        i64toi32_i32$0 = i64toi32_i32$1 - i64toi32_i32$0 | 0;
+        var$5 = i64toi32_i32$2;
+        var$5$hi = i64toi32_i32$0;
+        i64toi32_i32$0 = var$0$hi;
+        i64toi32_i32$4 = var$0;
+        i64toi32_i32$1 = 0;
+        i64toi32_i32$3 = 1;
+        i64toi32_i32$2 = i64toi32_i32$3 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
+         i64toi32_i32$1 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
+         $46 = 0;
         } else {
-         i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $48 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
+         i64toi32_i32$1 = ((1 << i64toi32_i32$2 | 0) - 1 | 0) & (i64toi32_i32$4 >>> (32 - i64toi32_i32$2 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$2 | 0) | 0;
+         $46 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
         }
-        $154$hi = i64toi32_i32$2;
-        i64toi32_i32$2 = var$7$hi;
-        i64toi32_i32$2 = $154$hi;
-        i64toi32_i32$3 = $48;
-        i64toi32_i32$5 = var$7$hi;
-        i64toi32_i32$0 = var$7;
-        i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
-        var$0 = i64toi32_i32$3 | i64toi32_i32$0 | 0;
-        var$0$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = var$6$hi;
-        i64toi32_i32$2 = var$6;
-        i64toi32_i32$3 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$3 = i64toi32_i32$5 & i64toi32_i32$3 | 0;
-        var$6 = i64toi32_i32$2 & i64toi32_i32$0 | 0;
-        var$6$hi = i64toi32_i32$3;
+        $154$hi = i64toi32_i32$1;
+        i64toi32_i32$1 = var$7$hi;
+        i64toi32_i32$1 = $154$hi;
+        i64toi32_i32$0 = $46;
+        i64toi32_i32$4 = var$7$hi;
+        i64toi32_i32$3 = var$7;
+        i64toi32_i32$4 = i64toi32_i32$1 | i64toi32_i32$4 | 0;
+        var$0 = i64toi32_i32$0 | i64toi32_i32$3 | 0;
+        var$0$hi = i64toi32_i32$4;
+        i64toi32_i32$4 = var$6$hi;
+        i64toi32_i32$1 = var$6;
+        i64toi32_i32$0 = 0;
+        i64toi32_i32$3 = 1;
+        i64toi32_i32$0 = i64toi32_i32$4 & i64toi32_i32$0 | 0;
+        var$6 = i64toi32_i32$1 & i64toi32_i32$3 | 0;
+        var$6$hi = i64toi32_i32$0;
         var$7 = var$6;
-        var$7$hi = i64toi32_i32$3;
+        var$7$hi = i64toi32_i32$0;
         var$2 = var$2 + -1 | 0;
         if (var$2) {
          continue label$15
@@ -674,41 +674,41 @@ function asmFunc(global, env, buffer) {
       }
      }
     }
-    i64toi32_i32$3 = var$5$hi;
-    legalfunc$wasm2js_scratch_store_i64(var$5 | 0, i64toi32_i32$3 | 0);
-    i64toi32_i32$3 = var$0$hi;
-    i64toi32_i32$5 = var$0;
-    i64toi32_i32$2 = 0;
-    i64toi32_i32$0 = 1;
-    i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-    if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-     i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-     $49 = 0;
+    i64toi32_i32$0 = var$5$hi;
+    legalfunc$wasm2js_scratch_store_i64(var$5 | 0, i64toi32_i32$0 | 0);
+    i64toi32_i32$0 = var$0$hi;
+    i64toi32_i32$4 = var$0;
+    i64toi32_i32$1 = 0;
+    i64toi32_i32$3 = 1;
+    i64toi32_i32$2 = i64toi32_i32$3 & 31 | 0;
+    if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
+     i64toi32_i32$1 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
+     $47 = 0;
     } else {
-     i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-     $49 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
+     i64toi32_i32$1 = ((1 << i64toi32_i32$2 | 0) - 1 | 0) & (i64toi32_i32$4 >>> (32 - i64toi32_i32$2 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$2 | 0) | 0;
+     $47 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
     }
-    $165$hi = i64toi32_i32$2;
-    i64toi32_i32$2 = var$6$hi;
-    i64toi32_i32$2 = $165$hi;
-    i64toi32_i32$3 = $49;
-    i64toi32_i32$5 = var$6$hi;
-    i64toi32_i32$0 = var$6;
-    i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
-    i64toi32_i32$3 = i64toi32_i32$3 | i64toi32_i32$0 | 0;
-    i64toi32_i32$HIGH_BITS = i64toi32_i32$5;
-    return i64toi32_i32$3 | 0;
+    $165$hi = i64toi32_i32$1;
+    i64toi32_i32$1 = var$6$hi;
+    i64toi32_i32$1 = $165$hi;
+    i64toi32_i32$0 = $47;
+    i64toi32_i32$4 = var$6$hi;
+    i64toi32_i32$3 = var$6;
+    i64toi32_i32$4 = i64toi32_i32$1 | i64toi32_i32$4 | 0;
+    i64toi32_i32$0 = i64toi32_i32$0 | i64toi32_i32$3 | 0;
+    i64toi32_i32$HIGH_BITS = i64toi32_i32$4;
+    return i64toi32_i32$0 | 0;
    }
-   i64toi32_i32$3 = var$0$hi;
-   legalfunc$wasm2js_scratch_store_i64(var$0 | 0, i64toi32_i32$3 | 0);
-   i64toi32_i32$3 = 0;
+   i64toi32_i32$0 = var$0$hi;
+   legalfunc$wasm2js_scratch_store_i64(var$0 | 0, i64toi32_i32$0 | 0);
+   i64toi32_i32$0 = 0;
    var$0 = 0;
-   var$0$hi = i64toi32_i32$3;
+   var$0$hi = i64toi32_i32$0;
   }
-  i64toi32_i32$3 = var$0$hi;
-  i64toi32_i32$5 = var$0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$3;
-  return i64toi32_i32$5 | 0;
+  i64toi32_i32$0 = var$0$hi;
+  i64toi32_i32$4 = var$0;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
+  return i64toi32_i32$4 | 0;
  }
  
  function __wasm_i64_sdiv(var$0, var$0$hi, var$1, var$1$hi) {
@@ -1002,7 +1002,7 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$1 = 0, i64toi32_i32$4 = 0, i64toi32_i32$2 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, i64toi32_i32$5 = 0, var$2$hi = 0, i64toi32_i32$6 = 0, var$2 = 0, $20 = 0, $21 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17$hi = 0, $19$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, var$2$hi = 0, var$2 = 0, $18 = 0, $19 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17$hi = 0, $19$hi = 0;
   i64toi32_i32$0 = var$0$hi;
   i64toi32_i32$2 = var$0;
   i64toi32_i32$1 = 0;
@@ -1010,12 +1010,12 @@ function asmFunc(global, env, buffer) {
   i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
   if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
    i64toi32_i32$1 = i64toi32_i32$0 >> 31 | 0;
-   $20 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
+   $18 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
   } else {
    i64toi32_i32$1 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
-   $20 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+   $18 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
   }
-  var$2 = $20;
+  var$2 = $18;
   var$2$hi = i64toi32_i32$1;
   i64toi32_i32$1 = var$0$hi;
   i64toi32_i32$1 = var$2$hi;
@@ -1029,66 +1029,66 @@ function asmFunc(global, env, buffer) {
   i64toi32_i32$1 = i64toi32_i32$0 ^ i64toi32_i32$3 | 0;
   i64toi32_i32$0 = var$2$hi;
   i64toi32_i32$3 = var$2;
-  i64toi32_i32$4 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$5 = i64toi32_i32$6 + i64toi32_i32$0 | 0;
-  i64toi32_i32$5 = i64toi32_i32$2 - i64toi32_i32$5 | 0;
-  $9 = i64toi32_i32$4;
-  $9$hi = i64toi32_i32$5;
-  i64toi32_i32$5 = var$1$hi;
-  i64toi32_i32$2 = var$1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$0 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$5 >> 31 | 0;
-   $21 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
+  i64toi32_i32$4 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
+  i64toi32_i32$1 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
+  i64toi32_i32$0 = i64toi32_i32$4 + i64toi32_i32$0 | 0;
+  i64toi32_i32$0 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
+  $9 = i64toi32_i32$1;
+  $9$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = var$1$hi;
+  i64toi32_i32$3 = var$1;
+  i64toi32_i32$2 = 0;
+  i64toi32_i32$4 = 63;
+  i64toi32_i32$1 = i64toi32_i32$4 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$4 & 63 | 0) >>> 0) {
+   i64toi32_i32$2 = i64toi32_i32$0 >> 31 | 0;
+   $19 = i64toi32_i32$0 >> i64toi32_i32$1 | 0;
   } else {
-   i64toi32_i32$1 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
-   $21 = (((1 << i64toi32_i32$0 | 0) - 1 | 0) & i64toi32_i32$5 | 0) << (32 - i64toi32_i32$0 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$0 | 0) | 0;
+   i64toi32_i32$2 = i64toi32_i32$0 >> i64toi32_i32$1 | 0;
+   $19 = (((1 << i64toi32_i32$1 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$1 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$1 | 0) | 0;
   }
-  var$0 = $21;
-  var$0$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$1$hi;
-  i64toi32_i32$1 = var$0$hi;
-  i64toi32_i32$5 = var$0;
+  var$0 = $19;
+  var$0$hi = i64toi32_i32$2;
   i64toi32_i32$2 = var$1$hi;
-  i64toi32_i32$3 = var$1;
-  i64toi32_i32$2 = i64toi32_i32$1 ^ i64toi32_i32$2 | 0;
-  $14$hi = i64toi32_i32$2;
-  i64toi32_i32$2 = i64toi32_i32$1;
-  i64toi32_i32$2 = $14$hi;
-  i64toi32_i32$1 = i64toi32_i32$5 ^ i64toi32_i32$3 | 0;
-  i64toi32_i32$5 = var$0$hi;
-  i64toi32_i32$3 = var$0;
-  i64toi32_i32$0 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$4 = i64toi32_i32$6 + i64toi32_i32$5 | 0;
-  i64toi32_i32$4 = i64toi32_i32$2 - i64toi32_i32$4 | 0;
-  $16$hi = i64toi32_i32$4;
-  i64toi32_i32$4 = $9$hi;
-  i64toi32_i32$1 = $16$hi;
-  i64toi32_i32$1 = __wasm_i64_urem($9 | 0, i64toi32_i32$4 | 0, i64toi32_i32$0 | 0, i64toi32_i32$1 | 0) | 0;
-  i64toi32_i32$4 = i64toi32_i32$HIGH_BITS;
-  $17$hi = i64toi32_i32$4;
+  i64toi32_i32$2 = var$0$hi;
+  i64toi32_i32$0 = var$0;
+  i64toi32_i32$3 = var$1$hi;
+  i64toi32_i32$4 = var$1;
+  i64toi32_i32$3 = i64toi32_i32$2 ^ i64toi32_i32$3 | 0;
+  $14$hi = i64toi32_i32$3;
+  i64toi32_i32$3 = i64toi32_i32$2;
+  i64toi32_i32$3 = $14$hi;
+  i64toi32_i32$2 = i64toi32_i32$0 ^ i64toi32_i32$4 | 0;
+  i64toi32_i32$0 = var$0$hi;
+  i64toi32_i32$4 = var$0;
+  i64toi32_i32$1 = i64toi32_i32$2 >>> 0 < i64toi32_i32$4 >>> 0;
+  i64toi32_i32$2 = i64toi32_i32$2 - i64toi32_i32$4 | 0;
+  i64toi32_i32$0 = i64toi32_i32$1 + i64toi32_i32$0 | 0;
+  i64toi32_i32$0 = i64toi32_i32$3 - i64toi32_i32$0 | 0;
+  $16$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = $9$hi;
+  i64toi32_i32$3 = $16$hi;
+  i64toi32_i32$3 = __wasm_i64_urem($9 | 0, i64toi32_i32$0 | 0, i64toi32_i32$2 | 0, i64toi32_i32$3 | 0) | 0;
+  i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
+  $17$hi = i64toi32_i32$0;
+  i64toi32_i32$0 = var$2$hi;
+  i64toi32_i32$0 = $17$hi;
+  i64toi32_i32$4 = i64toi32_i32$3;
+  i64toi32_i32$3 = var$2$hi;
+  i64toi32_i32$1 = var$2;
+  i64toi32_i32$3 = i64toi32_i32$0 ^ i64toi32_i32$3 | 0;
+  $19$hi = i64toi32_i32$3;
+  i64toi32_i32$3 = var$2$hi;
+  i64toi32_i32$3 = $19$hi;
+  i64toi32_i32$0 = i64toi32_i32$4 ^ i64toi32_i32$1 | 0;
   i64toi32_i32$4 = var$2$hi;
-  i64toi32_i32$4 = $17$hi;
-  i64toi32_i32$2 = i64toi32_i32$1;
-  i64toi32_i32$1 = var$2$hi;
-  i64toi32_i32$3 = var$2;
-  i64toi32_i32$1 = i64toi32_i32$4 ^ i64toi32_i32$1 | 0;
-  $19$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$2$hi;
-  i64toi32_i32$1 = $19$hi;
-  i64toi32_i32$4 = i64toi32_i32$2 ^ i64toi32_i32$3 | 0;
-  i64toi32_i32$2 = var$2$hi;
-  i64toi32_i32$5 = i64toi32_i32$4 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$4 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$0 = i64toi32_i32$6 + i64toi32_i32$2 | 0;
-  i64toi32_i32$0 = i64toi32_i32$1 - i64toi32_i32$0 | 0;
-  i64toi32_i32$4 = i64toi32_i32$5;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
-  return i64toi32_i32$4 | 0;
+  i64toi32_i32$2 = i64toi32_i32$0 >>> 0 < i64toi32_i32$1 >>> 0;
+  i64toi32_i32$0 = i64toi32_i32$0 - i64toi32_i32$1 | 0;
+  i64toi32_i32$4 = i64toi32_i32$2 + i64toi32_i32$4 | 0;
+  i64toi32_i32$4 = i64toi32_i32$3 - i64toi32_i32$4 | 0;
+  i64toi32_i32$3 = i64toi32_i32$0;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$4;
+  return i64toi32_i32$0 | 0;
  }
  
  function _ZN17compiler_builtins3int4udiv10divmod_u6417h6026910b5ed08e40E(var$0, var$0$hi, var$1, var$1$hi) {
@@ -1096,7 +1096,7 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$4 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, i64toi32_i32$6 = 0, $37 = 0, $38 = 0, $39 = 0, $40 = 0, $41 = 0, $42 = 0, $43 = 0, $44 = 0, var$8$hi = 0, $45 = 0, $46 = 0, $47 = 0, $48 = 0, var$7$hi = 0, $49 = 0, $63$hi = 0, $65 = 0, $65$hi = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142$hi = 0, $144 = 0, $144$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0;
+  var i64toi32_i32$4 = 0, i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, var$2 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, $35 = 0, $36 = 0, $37 = 0, $38 = 0, $39 = 0, $40 = 0, $41 = 0, $42 = 0, var$8$hi = 0, $43 = 0, $44 = 0, $45 = 0, $46 = 0, var$7$hi = 0, $47 = 0, $63$hi = 0, $65 = 0, $65$hi = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142$hi = 0, $144 = 0, $144$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0;
   label$1 : {
    label$2 : {
     label$3 : {
@@ -1115,12 +1115,12 @@ function asmFunc(global, env, buffer) {
              i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
              if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
               i64toi32_i32$1 = 0;
-              $37 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
+              $35 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
              } else {
               i64toi32_i32$1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-              $37 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+              $35 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
              }
-             var$2 = $37;
+             var$2 = $35;
              if (var$2) {
               block : {
                i64toi32_i32$1 = var$1$hi;
@@ -1135,12 +1135,12 @@ function asmFunc(global, env, buffer) {
                i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
                if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
                 i64toi32_i32$2 = 0;
-                $38 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
+                $36 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
                } else {
                 i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-                $38 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
+                $36 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
                }
-               var$4 = $38;
+               var$4 = $36;
                if (!var$4) {
                 break label$9
                }
@@ -1177,12 +1177,12 @@ function asmFunc(global, env, buffer) {
             i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
             if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
              i64toi32_i32$1 = 0;
-             $39 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
+             $37 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
             } else {
              i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-             $39 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
+             $37 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
             }
-            var$3 = $39;
+            var$3 = $37;
             i64toi32_i32$1 = var$0$hi;
             if (!var$0) {
              break label$7
@@ -1201,10 +1201,10 @@ function asmFunc(global, env, buffer) {
             i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
             if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
              i64toi32_i32$3 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-             $40 = 0;
+             $38 = 0;
             } else {
              i64toi32_i32$3 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-             $40 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
+             $38 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
             }
             $63$hi = i64toi32_i32$3;
             i64toi32_i32$3 = var$0$hi;
@@ -1215,7 +1215,7 @@ function asmFunc(global, env, buffer) {
             $65 = i64toi32_i32$1 & i64toi32_i32$0 | 0;
             $65$hi = i64toi32_i32$2;
             i64toi32_i32$2 = $63$hi;
-            i64toi32_i32$3 = $40;
+            i64toi32_i32$3 = $38;
             i64toi32_i32$1 = $65$hi;
             i64toi32_i32$0 = $65;
             i64toi32_i32$1 = i64toi32_i32$2 | i64toi32_i32$1 | 0;
@@ -1246,12 +1246,12 @@ function asmFunc(global, env, buffer) {
         i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
         if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
          i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-         $41 = 0;
+         $39 = 0;
         } else {
          i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $41 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
+         $39 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
         }
-        legalfunc$wasm2js_scratch_store_i64($41 | 0, i64toi32_i32$1 | 0);
+        legalfunc$wasm2js_scratch_store_i64($39 | 0, i64toi32_i32$1 | 0);
         i64toi32_i32$1 = 0;
         i64toi32_i32$2 = var$4;
         i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
@@ -1279,12 +1279,12 @@ function asmFunc(global, env, buffer) {
       i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
       if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
        i64toi32_i32$1 = 0;
-       $42 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
+       $40 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
       } else {
        i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-       $42 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
+       $40 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
       }
-      i64toi32_i32$3 = $42;
+      i64toi32_i32$3 = $40;
       i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
       return i64toi32_i32$3 | 0;
      }
@@ -1301,12 +1301,12 @@ function asmFunc(global, env, buffer) {
     i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
     if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
      i64toi32_i32$1 = 0;
-     $43 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
+     $41 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
     } else {
      i64toi32_i32$1 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
-     $43 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+     $41 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
     }
-    var$5 = $43;
+    var$5 = $41;
     var$5$hi = i64toi32_i32$1;
     i64toi32_i32$1 = var$0$hi;
     i64toi32_i32$1 = 0;
@@ -1318,12 +1318,12 @@ function asmFunc(global, env, buffer) {
     i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
     if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
      i64toi32_i32$2 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
-     $44 = 0;
+     $42 = 0;
     } else {
      i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$3 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-     $44 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
+     $42 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
     }
-    var$0 = $44;
+    var$0 = $42;
     var$0$hi = i64toi32_i32$2;
     label$13 : {
      if (var$2) {
@@ -1332,121 +1332,121 @@ function asmFunc(global, env, buffer) {
        i64toi32_i32$1 = var$1;
        i64toi32_i32$3 = -1;
        i64toi32_i32$0 = -1;
-       i64toi32_i32$4 = i64toi32_i32$1 + i64toi32_i32$0 | 0;
-       i64toi32_i32$5 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
-       if (i64toi32_i32$4 >>> 0 < i64toi32_i32$0 >>> 0) {
-        i64toi32_i32$5 = i64toi32_i32$5 + 1 | 0
+       i64toi32_i32$1 = i64toi32_i32$1 + i64toi32_i32$0 | 0;
+       i64toi32_i32$2 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
+       if (i64toi32_i32$1 >>> 0 < i64toi32_i32$0 >>> 0) {
+        i64toi32_i32$2 = i64toi32_i32$2 + 1 | 0
        }
-       var$8 = i64toi32_i32$4;
-       var$8$hi = i64toi32_i32$5;
+       var$8 = i64toi32_i32$1;
+       var$8$hi = i64toi32_i32$2;
        label$15 : while (1) {
-        i64toi32_i32$5 = var$5$hi;
-        i64toi32_i32$2 = var$5;
-        i64toi32_i32$1 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
-         $45 = 0;
+        i64toi32_i32$2 = var$5$hi;
+        i64toi32_i32$3 = var$5;
+        i64toi32_i32$0 = 0;
+        i64toi32_i32$1 = 1;
+        i64toi32_i32$4 = i64toi32_i32$1 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$1 & 63 | 0) >>> 0) {
+         i64toi32_i32$0 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
+         $43 = 0;
         } else {
-         i64toi32_i32$1 = ((1 << i64toi32_i32$3 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$3 | 0) | 0) | 0 | (i64toi32_i32$5 << i64toi32_i32$3 | 0) | 0;
-         $45 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
+         i64toi32_i32$0 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$3 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$2 << i64toi32_i32$4 | 0) | 0;
+         $43 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
         }
-        $140 = $45;
-        $140$hi = i64toi32_i32$1;
-        i64toi32_i32$1 = var$0$hi;
-        i64toi32_i32$5 = var$0;
-        i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 63;
-        i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = 0;
-         $46 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
+        $140 = $43;
+        $140$hi = i64toi32_i32$0;
+        i64toi32_i32$0 = var$0$hi;
+        i64toi32_i32$2 = var$0;
+        i64toi32_i32$3 = 0;
+        i64toi32_i32$1 = 63;
+        i64toi32_i32$4 = i64toi32_i32$1 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$1 & 63 | 0) >>> 0) {
+         i64toi32_i32$3 = 0;
+         $44 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
         } else {
-         i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
-         $46 = (((1 << i64toi32_i32$3 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$3 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$3 | 0) | 0;
+         i64toi32_i32$3 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
+         $44 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
         }
-        $142$hi = i64toi32_i32$2;
-        i64toi32_i32$2 = $140$hi;
-        i64toi32_i32$1 = $140;
-        i64toi32_i32$5 = $142$hi;
-        i64toi32_i32$0 = $46;
-        i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
-        var$5 = i64toi32_i32$1 | i64toi32_i32$0 | 0;
-        var$5$hi = i64toi32_i32$5;
+        $142$hi = i64toi32_i32$3;
+        i64toi32_i32$3 = $140$hi;
+        i64toi32_i32$0 = $140;
+        i64toi32_i32$2 = $142$hi;
+        i64toi32_i32$1 = $44;
+        i64toi32_i32$2 = i64toi32_i32$3 | i64toi32_i32$2 | 0;
+        var$5 = i64toi32_i32$0 | i64toi32_i32$1 | 0;
+        var$5$hi = i64toi32_i32$2;
         $144 = var$5;
-        $144$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = var$8$hi;
-        i64toi32_i32$5 = var$5$hi;
-        i64toi32_i32$5 = var$8$hi;
-        i64toi32_i32$2 = var$8;
-        i64toi32_i32$1 = var$5$hi;
-        i64toi32_i32$0 = var$5;
-        i64toi32_i32$3 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
-        i64toi32_i32$6 = i64toi32_i32$2 >>> 0 < i64toi32_i32$0 >>> 0;
-        i64toi32_i32$4 = i64toi32_i32$6 + i64toi32_i32$1 | 0;
-        i64toi32_i32$4 = i64toi32_i32$5 - i64toi32_i32$4 | 0;
-        i64toi32_i32$5 = i64toi32_i32$3;
+        $144$hi = i64toi32_i32$2;
+        i64toi32_i32$2 = var$8$hi;
+        i64toi32_i32$2 = var$5$hi;
+        i64toi32_i32$2 = var$8$hi;
+        i64toi32_i32$3 = var$8;
+        i64toi32_i32$0 = var$5$hi;
+        i64toi32_i32$1 = var$5;
+        i64toi32_i32$4 = i64toi32_i32$3 >>> 0 < i64toi32_i32$1 >>> 0;
+        i64toi32_i32$3 = i64toi32_i32$3 - i64toi32_i32$1 | 0;
+        i64toi32_i32$0 = i64toi32_i32$4 + i64toi32_i32$0 | 0;
+        i64toi32_i32$0 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
+        i64toi32_i32$1 = i64toi32_i32$3;
         i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 63;
-        i64toi32_i32$1 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = i64toi32_i32$4 >> 31 | 0;
-         $47 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
+        i64toi32_i32$4 = 63;
+        i64toi32_i32$3 = i64toi32_i32$4 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$4 & 63 | 0) >>> 0) {
+         i64toi32_i32$2 = i64toi32_i32$0 >> 31 | 0;
+         $45 = i64toi32_i32$0 >> i64toi32_i32$3 | 0;
         } else {
-         i64toi32_i32$2 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
-         $47 = (((1 << i64toi32_i32$1 | 0) - 1 | 0) & i64toi32_i32$4 | 0) << (32 - i64toi32_i32$1 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$1 | 0) | 0;
+         i64toi32_i32$2 = i64toi32_i32$0 >> i64toi32_i32$3 | 0;
+         $45 = (((1 << i64toi32_i32$3 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$3 | 0) | 0 | (i64toi32_i32$1 >>> i64toi32_i32$3 | 0) | 0;
         }
-        var$6 = $47;
+        var$6 = $45;
         var$6$hi = i64toi32_i32$2;
         i64toi32_i32$2 = var$1$hi;
         i64toi32_i32$2 = var$6$hi;
-        i64toi32_i32$4 = var$6;
-        i64toi32_i32$5 = var$1$hi;
-        i64toi32_i32$0 = var$1;
-        i64toi32_i32$5 = i64toi32_i32$2 & i64toi32_i32$5 | 0;
-        $151 = i64toi32_i32$4 & i64toi32_i32$0 | 0;
-        $151$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = $144$hi;
+        i64toi32_i32$0 = var$6;
+        i64toi32_i32$1 = var$1$hi;
+        i64toi32_i32$4 = var$1;
+        i64toi32_i32$1 = i64toi32_i32$2 & i64toi32_i32$1 | 0;
+        $151 = i64toi32_i32$0 & i64toi32_i32$4 | 0;
+        $151$hi = i64toi32_i32$1;
+        i64toi32_i32$1 = $144$hi;
         i64toi32_i32$2 = $144;
-        i64toi32_i32$4 = $151$hi;
-        i64toi32_i32$0 = $151;
-        i64toi32_i32$1 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
-        i64toi32_i32$6 = i64toi32_i32$2 >>> 0 < i64toi32_i32$0 >>> 0;
-        i64toi32_i32$3 = i64toi32_i32$6 + i64toi32_i32$4 | 0;
-        i64toi32_i32$3 = i64toi32_i32$5 - i64toi32_i32$3 | 0;
-        var$5 = i64toi32_i32$1;
-        var$5$hi = i64toi32_i32$3;
-        i64toi32_i32$3 = var$0$hi;
-        i64toi32_i32$5 = var$0;
-        i64toi32_i32$2 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-         $48 = 0;
+        i64toi32_i32$0 = $151$hi;
+        i64toi32_i32$4 = $151;
+        i64toi32_i32$3 = i64toi32_i32$2 >>> 0 < i64toi32_i32$4 >>> 0;
+        i64toi32_i32$2 = i64toi32_i32$2 - i64toi32_i32$4 | 0;
+        i64toi32_i32$0 = i64toi32_i32$3 + i64toi32_i32$0 | 0;
+        i64toi32_i32$0 = i64toi32_i32$1 - i64toi32_i32$0 | 0;
+        var$5 = i64toi32_i32$2;
+        var$5$hi = i64toi32_i32$0;
+        i64toi32_i32$0 = var$0$hi;
+        i64toi32_i32$4 = var$0;
+        i64toi32_i32$1 = 0;
+        i64toi32_i32$3 = 1;
+        i64toi32_i32$2 = i64toi32_i32$3 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
+         i64toi32_i32$1 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
+         $46 = 0;
         } else {
-         i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $48 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
+         i64toi32_i32$1 = ((1 << i64toi32_i32$2 | 0) - 1 | 0) & (i64toi32_i32$4 >>> (32 - i64toi32_i32$2 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$2 | 0) | 0;
+         $46 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
         }
-        $154$hi = i64toi32_i32$2;
-        i64toi32_i32$2 = var$7$hi;
-        i64toi32_i32$2 = $154$hi;
-        i64toi32_i32$3 = $48;
-        i64toi32_i32$5 = var$7$hi;
-        i64toi32_i32$0 = var$7;
-        i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
-        var$0 = i64toi32_i32$3 | i64toi32_i32$0 | 0;
-        var$0$hi = i64toi32_i32$5;
-        i64toi32_i32$5 = var$6$hi;
-        i64toi32_i32$2 = var$6;
-        i64toi32_i32$3 = 0;
-        i64toi32_i32$0 = 1;
-        i64toi32_i32$3 = i64toi32_i32$5 & i64toi32_i32$3 | 0;
-        var$6 = i64toi32_i32$2 & i64toi32_i32$0 | 0;
-        var$6$hi = i64toi32_i32$3;
+        $154$hi = i64toi32_i32$1;
+        i64toi32_i32$1 = var$7$hi;
+        i64toi32_i32$1 = $154$hi;
+        i64toi32_i32$0 = $46;
+        i64toi32_i32$4 = var$7$hi;
+        i64toi32_i32$3 = var$7;
+        i64toi32_i32$4 = i64toi32_i32$1 | i64toi32_i32$4 | 0;
+        var$0 = i64toi32_i32$0 | i64toi32_i32$3 | 0;
+        var$0$hi = i64toi32_i32$4;
+        i64toi32_i32$4 = var$6$hi;
+        i64toi32_i32$1 = var$6;
+        i64toi32_i32$0 = 0;
+        i64toi32_i32$3 = 1;
+        i64toi32_i32$0 = i64toi32_i32$4 & i64toi32_i32$0 | 0;
+        var$6 = i64toi32_i32$1 & i64toi32_i32$3 | 0;
+        var$6$hi = i64toi32_i32$0;
         var$7 = var$6;
-        var$7$hi = i64toi32_i32$3;
+        var$7$hi = i64toi32_i32$0;
         var$2 = var$2 + -1 | 0;
         if (var$2) {
          continue label$15
@@ -1457,41 +1457,41 @@ function asmFunc(global, env, buffer) {
       }
      }
     }
-    i64toi32_i32$3 = var$5$hi;
-    legalfunc$wasm2js_scratch_store_i64(var$5 | 0, i64toi32_i32$3 | 0);
-    i64toi32_i32$3 = var$0$hi;
-    i64toi32_i32$5 = var$0;
-    i64toi32_i32$2 = 0;
-    i64toi32_i32$0 = 1;
-    i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-    if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-     i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-     $49 = 0;
+    i64toi32_i32$0 = var$5$hi;
+    legalfunc$wasm2js_scratch_store_i64(var$5 | 0, i64toi32_i32$0 | 0);
+    i64toi32_i32$0 = var$0$hi;
+    i64toi32_i32$4 = var$0;
+    i64toi32_i32$1 = 0;
+    i64toi32_i32$3 = 1;
+    i64toi32_i32$2 = i64toi32_i32$3 & 31 | 0;
+    if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
+     i64toi32_i32$1 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
+     $47 = 0;
     } else {
-     i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-     $49 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
+     i64toi32_i32$1 = ((1 << i64toi32_i32$2 | 0) - 1 | 0) & (i64toi32_i32$4 >>> (32 - i64toi32_i32$2 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$2 | 0) | 0;
+     $47 = i64toi32_i32$4 << i64toi32_i32$2 | 0;
     }
-    $165$hi = i64toi32_i32$2;
-    i64toi32_i32$2 = var$6$hi;
-    i64toi32_i32$2 = $165$hi;
-    i64toi32_i32$3 = $49;
-    i64toi32_i32$5 = var$6$hi;
-    i64toi32_i32$0 = var$6;
-    i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
-    i64toi32_i32$3 = i64toi32_i32$3 | i64toi32_i32$0 | 0;
-    i64toi32_i32$HIGH_BITS = i64toi32_i32$5;
-    return i64toi32_i32$3 | 0;
+    $165$hi = i64toi32_i32$1;
+    i64toi32_i32$1 = var$6$hi;
+    i64toi32_i32$1 = $165$hi;
+    i64toi32_i32$0 = $47;
+    i64toi32_i32$4 = var$6$hi;
+    i64toi32_i32$3 = var$6;
+    i64toi32_i32$4 = i64toi32_i32$1 | i64toi32_i32$4 | 0;
+    i64toi32_i32$0 = i64toi32_i32$0 | i64toi32_i32$3 | 0;
+    i64toi32_i32$HIGH_BITS = i64toi32_i32$4;
+    return i64toi32_i32$0 | 0;
    }
-   i64toi32_i32$3 = var$0$hi;
-   legalfunc$wasm2js_scratch_store_i64(var$0 | 0, i64toi32_i32$3 | 0);
-   i64toi32_i32$3 = 0;
+   i64toi32_i32$0 = var$0$hi;
+   legalfunc$wasm2js_scratch_store_i64(var$0 | 0, i64toi32_i32$0 | 0);
+   i64toi32_i32$0 = 0;
    var$0 = 0;
-   var$0$hi = i64toi32_i32$3;
+   var$0$hi = i64toi32_i32$0;
   }
-  i64toi32_i32$3 = var$0$hi;
-  i64toi32_i32$5 = var$0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$3;
-  return i64toi32_i32$5 | 0;
+  i64toi32_i32$0 = var$0$hi;
+  i64toi32_i32$4 = var$0;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
+  return i64toi32_i32$4 | 0;
  }
  
  function __wasm_i64_srem(var$0, var$0$hi, var$1, var$1$hi) {
@@ -398,49 +398,50 @@ function asmFunc(global, env, buffer) {
  function __wasm_ctz_i64(var$0, var$0$hi) {
   var$0 = var$0 | 0;
   var$0$hi = var$0$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, i64toi32_i32$5 = 0, i64toi32_i32$4 = 0, i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, $10 = 0, $5$hi = 0, $8$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, $9_1 = 0, $5$hi = 0, $8$hi = 0, i64toi32_i32$4 = 0;
   i64toi32_i32$0 = var$0$hi;
   if (!!(var$0 | i64toi32_i32$0 | 0)) {
    i64toi32_i32$0 = var$0$hi;
    i64toi32_i32$2 = var$0;
    i64toi32_i32$1 = -1;
    i64toi32_i32$3 = -1;
-   i64toi32_i32$4 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
-   i64toi32_i32$5 = i64toi32_i32$0 + i64toi32_i32$1 | 0;
-   if (i64toi32_i32$4 >>> 0 < i64toi32_i32$3 >>> 0) {
-    i64toi32_i32$5 = i64toi32_i32$5 + 1 | 0
+   i64toi32_i32$2 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
+   i64toi32_i32$0 = i64toi32_i32$0 + i64toi32_i32$1 | 0;
+   if (i64toi32_i32$2 >>> 0 < i64toi32_i32$3 >>> 0) {
+    i64toi32_i32$0 = i64toi32_i32$0 + 1 | 0
    }
-   $5$hi = i64toi32_i32$5;
-   i64toi32_i32$5 = var$0$hi;
-   i64toi32_i32$5 = $5$hi;
-   i64toi32_i32$0 = i64toi32_i32$4;
-   i64toi32_i32$2 = var$0$hi;
-   i64toi32_i32$3 = var$0;
-   i64toi32_i32$2 = i64toi32_i32$5 ^ i64toi32_i32$2 | 0;
-   i64toi32_i32$0 = i64toi32_i32$0 ^ i64toi32_i32$3 | 0;
-   i64toi32_i32$3 = Math_clz32(i64toi32_i32$2);
-   i64toi32_i32$5 = 0;
-   if ((i64toi32_i32$3 | 0) == (32 | 0)) {
-    $10 = Math_clz32(i64toi32_i32$0) + 32 | 0
+   $5$hi = i64toi32_i32$0;
+   i64toi32_i32$0 = var$0$hi;
+   i64toi32_i32$0 = $5$hi;
+   i64toi32_i32$1 = i64toi32_i32$2;
+   i64toi32_i32$3 = var$0$hi;
+   i64toi32_i32$2 = var$0;
+   i64toi32_i32$3 = i64toi32_i32$0 ^ i64toi32_i32$3 | 0;
+   i64toi32_i32$1 = i64toi32_i32$1 ^ i64toi32_i32$2 | 0;
+   i64toi32_i32$2 = Math_clz32(i64toi32_i32$3);
+   i64toi32_i32$0 = 0;
+   if ((i64toi32_i32$2 | 0) == (32 | 0)) {
+    $9_1 = Math_clz32(i64toi32_i32$1) + 32 | 0
    } else {
-    $10 = i64toi32_i32$3
+    $9_1 = i64toi32_i32$2
    }
-   $8$hi = i64toi32_i32$5;
-   i64toi32_i32$5 = 0;
-   i64toi32_i32$0 = 63;
-   i64toi32_i32$2 = $8$hi;
-   i64toi32_i32$3 = $10;
-   i64toi32_i32$1 = i64toi32_i32$0 - i64toi32_i32$3 | 0;
-   i64toi32_i32$4 = (i64toi32_i32$0 >>> 0 < i64toi32_i32$3 >>> 0) + i64toi32_i32$2 | 0;
-   i64toi32_i32$4 = i64toi32_i32$5 - i64toi32_i32$4 | 0;
+   $8$hi = i64toi32_i32$0;
+   i64toi32_i32$0 = 0;
+   i64toi32_i32$1 = 63;
+   i64toi32_i32$3 = $8$hi;
+   i64toi32_i32$2 = $9_1;
+   i64toi32_i32$4 = i64toi32_i32$1 >>> 0 < i64toi32_i32$2 >>> 0;
+   i64toi32_i32$1 = i64toi32_i32$1 - i64toi32_i32$2 | 0;
+   i64toi32_i32$3 = i64toi32_i32$4 + i64toi32_i32$3 | 0;
+   i64toi32_i32$3 = i64toi32_i32$0 - i64toi32_i32$3 | 0;
    i64toi32_i32$0 = i64toi32_i32$1;
-   i64toi32_i32$HIGH_BITS = i64toi32_i32$4;
+   i64toi32_i32$HIGH_BITS = i64toi32_i32$3;
    return i64toi32_i32$0 | 0;
   }
   i64toi32_i32$0 = 0;
-  i64toi32_i32$4 = 64;
+  i64toi32_i32$3 = 64;
   i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
-  return i64toi32_i32$4 | 0;
+  return i64toi32_i32$3 | 0;
  }
  
  function __wasm_popcnt_i32(var$0) {
@@ -463,7 +464,7 @@ function asmFunc(global, env, buffer) {
  function __wasm_popcnt_i64(var$0, var$0$hi) {
   var$0 = var$0 | 0;
   var$0$hi = var$0$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, i64toi32_i32$5 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, i64toi32_i32$1 = 0, var$1$hi = 0, var$1 = 0, $5_1 = 0, $5$hi = 0, $4_1 = 0, $9$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, var$1$hi = 0, var$1 = 0, $5_1 = 0, $5$hi = 0, $4_1 = 0, i64toi32_i32$2 = 0, $9$hi = 0;
   label$1 : {
    label$2 : while (1) {
     i64toi32_i32$0 = var$1$hi;
@@ -477,38 +478,38 @@ function asmFunc(global, env, buffer) {
     }
     i64toi32_i32$0 = $5$hi;
     i64toi32_i32$0 = var$0$hi;
-    i64toi32_i32$2 = var$0;
     i64toi32_i32$1 = 0;
     i64toi32_i32$3 = 1;
-    i64toi32_i32$4 = i64toi32_i32$2 - i64toi32_i32$3 | 0;
-    i64toi32_i32$5 = (i64toi32_i32$2 >>> 0 < i64toi32_i32$3 >>> 0) + i64toi32_i32$1 | 0;
-    i64toi32_i32$5 = i64toi32_i32$0 - i64toi32_i32$5 | 0;
-    $9$hi = i64toi32_i32$5;
-    i64toi32_i32$5 = i64toi32_i32$0;
-    i64toi32_i32$0 = i64toi32_i32$2;
-    i64toi32_i32$2 = $9$hi;
-    i64toi32_i32$3 = i64toi32_i32$4;
-    i64toi32_i32$2 = i64toi32_i32$5 & i64toi32_i32$2 | 0;
-    var$0 = i64toi32_i32$0 & i64toi32_i32$4 | 0;
-    var$0$hi = i64toi32_i32$2;
-    i64toi32_i32$2 = var$1$hi;
-    i64toi32_i32$5 = var$1;
-    i64toi32_i32$0 = 0;
-    i64toi32_i32$3 = 1;
-    i64toi32_i32$1 = i64toi32_i32$5 + i64toi32_i32$3 | 0;
-    i64toi32_i32$4 = i64toi32_i32$2 + i64toi32_i32$0 | 0;
-    if (i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0) {
-     i64toi32_i32$4 = i64toi32_i32$4 + 1 | 0
+    i64toi32_i32$4 = var$0 >>> 0 < i64toi32_i32$3 >>> 0;
+    i64toi32_i32$2 = var$0 - i64toi32_i32$3 | 0;
+    i64toi32_i32$1 = i64toi32_i32$4 + i64toi32_i32$1 | 0;
+    i64toi32_i32$1 = i64toi32_i32$0 - i64toi32_i32$1 | 0;
+    $9$hi = i64toi32_i32$1;
+    i64toi32_i32$1 = i64toi32_i32$0;
+    i64toi32_i32$3 = var$0;
+    i64toi32_i32$0 = $9$hi;
+    i64toi32_i32$4 = i64toi32_i32$2;
+    i64toi32_i32$0 = i64toi32_i32$1 & i64toi32_i32$0 | 0;
+    var$0 = var$0 & i64toi32_i32$4 | 0;
+    var$0$hi = i64toi32_i32$0;
+    i64toi32_i32$0 = var$1$hi;
+    i64toi32_i32$1 = var$1;
+    i64toi32_i32$3 = 0;
+    i64toi32_i32$4 = 1;
+    i64toi32_i32$1 = i64toi32_i32$1 + i64toi32_i32$4 | 0;
+    i64toi32_i32$0 = i64toi32_i32$0 + i64toi32_i32$3 | 0;
+    if (i64toi32_i32$1 >>> 0 < i64toi32_i32$4 >>> 0) {
+     i64toi32_i32$0 = i64toi32_i32$0 + 1 | 0
     }
     var$1 = i64toi32_i32$1;
-    var$1$hi = i64toi32_i32$4;
+    var$1$hi = i64toi32_i32$0;
     continue label$2;
    };
   }
-  i64toi32_i32$4 = $5$hi;
-  i64toi32_i32$5 = $5_1;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$4;
-  return i64toi32_i32$5 | 0;
+  i64toi32_i32$0 = $5$hi;
+  i64toi32_i32$4 = $5_1;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
+  return i64toi32_i32$4 | 0;
  }
  
  var FUNCTION_TABLE = [];